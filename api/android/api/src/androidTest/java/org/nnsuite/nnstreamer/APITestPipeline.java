@@ -301,6 +301,75 @@ public class APITestPipeline {
         }
     }
 
+    @Test
+    public void testDataListCb() {
+        String desc = "appsrc name=srcx ! " +
+                "other/tensor,dimension=(string)2:10:10:1,type=(string)uint8,framerate=(fraction)0/1 ! " +
+                "tensor_sink name=sinkx";
+
+        try (Pipeline pipe = new Pipeline(desc)) {
+            TensorsInfo info = new TensorsInfo();
+            info.addTensorInfo(NNStreamer.TensorType.UINT8, new int[]{2,10,10,1});
+
+            final int[] batches = {0};
+
+            /* register sink callback (batch of 4 data) */
+            pipe.registerSinkListCallback("sinkx", 4, 0, new Pipeline.NewDataListCallback() {
+                @Override
+                public void onNewDataListReceived(TensorsData[] data) {
+                    if (data == null || data.length == 0 || data.length > 4) {
+                        mInvalidState = true;
+                        return;
+                    }
+
+                    for (TensorsData d : data) {
+                        mSinkCb.onNewDataReceived(d);
+                    }
+
+                    batches[0]++;
+                }
+            });
+
+            /* start pipeline */
+            pipe.start();
+
+            /* push input buffer */
+            for (int i = 0; i < 8; i++) {
+                /* dummy input */
+                pipe.inputData("srcx", info.allocate());
+                Thread.sleep(50);
+            }
+
+            Thread.sleep(100);
+            pipe.stop();
+
+            /* check received data from sink */
+            assertFalse(mInvalidState);
+            assertEquals(8, mReceived);
+            assertEquals(2, batches[0]);
+        } catch (Exception e) {
+            fail();
+        }
+    }
+
+    @Test
+    public void testRegisterDataListCbInvalidBatch_n() {
+        String desc = "videotestsrc ! videoconvert ! video/x-raw,format=RGB ! " +
+                "tensor_converter ! tensor_sink name=sinkx";
+
+        try (Pipeline pipe = new Pipeline(desc)) {
+            pipe.registerSinkListCallback("sinkx", 1, 0, new Pipeline.NewDataListCallback() {
+                @Override
+                public void onNewDataListReceived(TensorsData[] data) {
+                }
+            });
+
+            fail();
+        } catch (Exception e) {
+            /* expected */
+        }
+    }
+
     @Test
     public void testDuplicatedDataCb() {
         String desc = "appsrc name=srcx ! " +
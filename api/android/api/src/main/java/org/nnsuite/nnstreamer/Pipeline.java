@@ -34,6 +34,7 @@ import java.util.HashMap;
 public final class Pipeline implements AutoCloseable {
     private long mHandle = 0;
     private HashMap<String, ArrayList<NewDataCallback>> mSinkCallbacks = new HashMap<>();
+    private HashMap<String, ArrayList<NewDataListCallback>> mSinkListCallbacks = new HashMap<>();
     private StateChangeCallback mStateCallback = null;
 
     private native long nativeConstruct(String description, boolean addStateCb);
@@ -47,6 +48,8 @@ public final class Pipeline implements AutoCloseable {
     private native boolean nativeControlValve(long handle, String name, boolean open);
     private native boolean nativeAddSinkCallback(long handle, String name);
     private native boolean nativeRemoveSinkCallback(long handle, String name);
+    private native boolean nativeAddSinkListCallback(long handle, String name, int batchSize, int batchTimeout);
+    private native boolean nativeRemoveSinkListCallback(long handle, String name);
 
     /**
      * Interface definition for a callback to be invoked when a sink node receives new data.
@@ -65,6 +68,21 @@ public final class Pipeline implements AutoCloseable {
         void onNewDataReceived(TensorsData data);
     }
 
+    /**
+     * Interface definition for a callback to be invoked when a sink node receives the batch of new data.
+     */
+    public interface NewDataListCallback {
+        /**
+         * Called when a sink node collects the batch of new data.
+         *
+         * For the streams with high frame rate (e.g., sensors), this reduces the overhead of the callbacks.
+         * Note that this is synchronously called, as same as {@link NewDataCallback}.
+         *
+         * @param data The array of output data (each element is a single frame, tensor/tensors)
+         */
+        void onNewDataListReceived(TensorsData[] data);
+    }
+
     /**
      * Interface definition for a callback to be invoked when the pipeline state is changed.
      * This callback can be registered only when constructing the pipeline.
@@ -373,6 +391,92 @@ public final class Pipeline implements AutoCloseable {
         }
     }
 
+    /**
+     * Registers the callback to get the batch of new data from sink node.
+     * The sink node should be tensor_sink. It collects up to batchSize data or the data for batchTimeout milliseconds,
+     * and the callback gets the data at once. The remaining data is passed at the end of stream.
+     * The batch size and timeout are applied to the sink node when the first callback is registered with given name.
+     *
+     * @param name         The name of sink node
+     * @param batchSize    The max number of data in a batch (2 ~ 1024)
+     * @param batchTimeout The max time in milliseconds to hold the data in a batch (0 for no limit)
+     * @param callback     The callback for the batch of new data
+     *
+     * @throws IllegalArgumentException if given param is invalid
+     * @throws IllegalStateException if failed to register the callback to sink node in the pipeline
+     */
+    public void registerSinkListCallback(@NonNull String name, int batchSize, int batchTimeout,
+                                         @NonNull NewDataListCallback callback) {
+        if (name == null || name.isEmpty()) {
+            throw new IllegalArgumentException("Given name is invalid");
+        }
+
+        if (batchSize < 2 || batchSize > 1024) {
+            throw new IllegalArgumentException("Given batch size is invalid");
+        }
+
+        if (batchTimeout < 0) {
+            throw new IllegalArgumentException("Given batch timeout is invalid");
+        }
+
+        if (callback == null) {
+            throw new IllegalArgumentException("Given callback is null");
+        }
+
+        synchronized(this) {
+            ArrayList<NewDataListCallback> cbList = mSinkListCallbacks.get(name);
+
+            if (cbList != null) {
+                /* check the list already includes same callback */
+                if (!cbList.contains(callback)) {
+                    cbList.add(callback);
+                }
+            } else {
+                if (nativeAddSinkListCallback(mHandle, name, batchSize, batchTimeout)) {
+                    cbList = new ArrayList<>();
+                    cbList.add(callback);
+                    mSinkListCallbacks.put(name, cbList);
+                } else {
+                    throw new IllegalStateException("Failed to register sink callback to " + name);
+                }
+            }
+        }
+    }
+
+    /**
+     * Unregisters the callback for the batch of new data from sink node.
+     *
+     * @param name     The name of sink node
+     * @param callback The callback object to be unregistered
+     *
+     * @throws IllegalArgumentException if given param is invalid
+     * @throws IllegalStateException if failed to unregister the callback from sink node
+     */
+    public void unregisterSinkListCallback(@NonNull String name, @NonNull NewDataListCallback callback) {
+        if (name == null || name.isEmpty()) {
+            throw new IllegalArgumentException("Given name is invalid");
+        }
+
+        if (callback == null) {
+            throw new IllegalArgumentException("Given callback is null");
+        }
+
+        synchronized(this) {
+            ArrayList<NewDataListCallback> cbList = mSinkListCallbacks.get(name);
+
+            if (cbList == null || !cbList.contains(callback)) {
+                throw new IllegalStateException("Failed to unregister sink callback from " + name);
+            }
+
+            cbList.remove(callback);
+            if (cbList.isEmpty()) {
+                /* remove callback */
+                mSinkListCallbacks.remove(name);
+                nativeRemoveSinkListCallback(mHandle, name);
+            }
+        }
+    }
+
     /**
      * Internal method called from native when a new data is available.
      */
@@ -388,6 +492,21 @@ public final class Pipeline implements AutoCloseable {
         }
     }
 
+    /**
+     * Internal method called from native when the batch of new data is available.
+     */
+    private void newDataListReceived(String name, TensorsData[] data) {
+        synchronized(this) {
+            ArrayList<NewDataListCallback> cbList = mSinkListCallbacks.get(name);
+
+            if (cbList != null) {
+                for (int i = 0; i < cbList.size(); i++) {
+                    cbList.get(i).onNewDataListReceived(data);
+                }
+            }
+        }
+    }
+
     /**
      * Internal method called from native when the state of pipeline is changed.
      */
@@ -450,6 +569,7 @@ public final class Pipeline implements AutoCloseable {
     public void close() {
         synchronized(this) {
             mSinkCallbacks.clear();
+            mSinkListCallbacks.clear();
             mStateCallback = null;
         }
 
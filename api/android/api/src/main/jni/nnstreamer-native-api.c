@@ -107,6 +107,7 @@ nns_free_element_data (gpointer data)
         ml_pipeline_src_release_handle ((ml_pipeline_src_h) item->handle);
         break;
       case NNS_ELEMENT_TYPE_SINK:
+      case NNS_ELEMENT_TYPE_SINK_LIST:
         ml_pipeline_sink_unregister ((ml_pipeline_sink_h) item->handle);
         break;
       case NNS_ELEMENT_TYPE_VALVE:
@@ -94,6 +94,127 @@ nns_sink_data_cb (const ml_tensors_data_h data, const ml_tensors_info_h info, vo
   }
 }
 
+/**
+ * @brief New data callback for sink node to get the list of data.
+ */
+static void
+nns_sink_data_list_cb (const ml_tensors_data_h * data, unsigned int num_data,
+    const ml_tensors_info_h info, void *user_data)
+{
+  element_data_s *cb_data;
+  pipeline_info_s *pipe_info;
+  jobjectArray obj_list = NULL;
+  jobject obj_data = NULL;
+  jclass cls_pipeline;
+  jmethodID mid_callback;
+  jstring sink_name;
+  JNIEnv *env;
+  unsigned int i;
+
+  cb_data = (element_data_s *) user_data;
+  pipe_info = cb_data->pipe_info;
+
+  if ((env = nns_get_jni_env (pipe_info)) == NULL) {
+    nns_logw ("Cannot get jni env in the sink callback.");
+    return;
+  }
+
+  obj_list = (*env)->NewObjectArray (env, num_data, pipe_info->cls_tensors_data, NULL);
+  if (obj_list == NULL) {
+    nns_loge ("Failed to allocate the array of data object.");
+    return;
+  }
+
+  for (i = 0; i < num_data; i++) {
+    if (!nns_convert_tensors_data (pipe_info, env, data[i], info, &obj_data)) {
+      nns_loge ("Failed to convert the result to data object.");
+      goto done;
+    }
+
+    (*env)->SetObjectArrayElement (env, obj_list, i, obj_data);
+    (*env)->DeleteLocalRef (env, obj_data);
+  }
+
+  /* method for sink callback */
+  cls_pipeline = (*env)->GetObjectClass (env, pipe_info->instance);
+  mid_callback = (*env)->GetMethodID (env, cls_pipeline, "newDataListReceived",
+      "(Ljava/lang/String;[Lorg/nnsuite/nnstreamer/TensorsData;)V");
+  sink_name = (*env)->NewStringUTF (env, cb_data->name);
+
+  (*env)->CallVoidMethod (env, pipe_info->instance, mid_callback, sink_name, obj_list);
+
+  if ((*env)->ExceptionCheck (env)) {
+    nns_loge ("Failed to call the callback method.");
+    (*env)->ExceptionClear (env);
+  }
+
+  (*env)->DeleteLocalRef (env, sink_name);
+  (*env)->DeleteLocalRef (env, cls_pipeline);
+
+done:
+  (*env)->DeleteLocalRef (env, obj_list);
+}
+
+/**
+ * @brief Get the key of the sink handle for the list of data in element table.
+ */
+static gchar *
+nns_get_sink_list_key (const gchar * element_name)
+{
+  return g_strdup_printf ("%s/list", element_name);
+}
+
+/**
+ * @brief Get sink handle for the list of data.
+ */
+static void *
+nns_get_sink_list_handle (pipeline_info_s * pipe_info, const gchar * element_name,
+    guint batch_size, guint batch_timeout)
+{
+  ml_pipeline_sink_h handle;
+  ml_pipeline_h pipe;
+  gchar *key;
+  int status;
+
+  g_assert (pipe_info);
+  pipe = pipe_info->pipeline_handle;
+  key = nns_get_sink_list_key (element_name);
+
+  handle = (ml_pipeline_sink_h) nns_get_element_handle (pipe_info, key);
+  if (handle == NULL) {
+    /* get sink handle and register to table */
+    element_data_s *item = g_new0 (element_data_s, 1);
+    if (item == NULL) {
+      nns_loge ("Failed to allocate memory for sink handle data.");
+      goto done;
+    }
+
+    status = ml_pipeline_sink_register_list (pipe, element_name, batch_size,
+        batch_timeout, nns_sink_data_list_cb, item, &handle);
+    if (status != ML_ERROR_NONE) {
+      nns_loge ("Failed to get sink node %s.", element_name);
+      g_free (item);
+      handle = NULL;
+      goto done;
+    }
+
+    item->name = g_strdup (element_name);
+    item->type = NNS_ELEMENT_TYPE_SINK_LIST;
+    item->handle = handle;
+    item->pipe_info = pipe_info;
+
+    if (!nns_add_element_handle (pipe_info, key, item)) {
+      nns_loge ("Failed to add sink node %s.", element_name);
+      nns_free_element_data (item);
+      handle = NULL;
+    }
+  }
+
+done:
+  g_free (key);
+  return handle;
+}
+
 /**
  * @brief Get sink handle.
  */
@@ -619,3 +740,55 @@ Java_org_nnsuite_nnstreamer_Pipeline_nativeRemoveSinkCallback (JNIEnv * env, job
   (*env)->ReleaseStringUTFChars (env, name, element_name);
   return res;
 }
+
+/**
+ * @brief Native method for pipeline API.
+ */
+jboolean
+Java_org_nnsuite_nnstreamer_Pipeline_nativeAddSinkListCallback (JNIEnv * env, jobject thiz,
+    jlong handle, jstring name, jint batch_size, jint batch_timeout)
+{
+  pipeline_info_s *pipe_info = NULL;
+  ml_pipeline_sink_h sink;
+  jboolean res = JNI_FALSE;
+  const char *element_name = (*env)->GetStringUTFChars (env, name, NULL);
+
+  pipe_info = CAST_TO_TYPE (handle, pipeline_info_s*);
+
+  sink = (ml_pipeline_sink_h) nns_get_sink_list_handle (pipe_info, element_name,
+      (guint) batch_size, (guint) batch_timeout);
+  if (sink == NULL) {
+    goto done;
+  }
+
+  res = JNI_TRUE;
+
+done:
+  (*env)->ReleaseStringUTFChars (env, name, element_name);
+  return res;
+}
+
+/**
+ * @brief Native method for pipeline API.
+ */
+jboolean
+Java_org_nnsuite_nnstreamer_Pipeline_nativeRemoveSinkListCallback (JNIEnv * env, jobject thiz,
+    jlong handle, jstring name)
+{
+  pipeline_info_s *pipe_info = NULL;
+  jboolean res = JNI_FALSE;
+  const char *element_name = (*env)->GetStringUTFChars (env, name, NULL);
+  gchar *key = nns_get_sink_list_key (element_name);
+
+  pipe_info = CAST_TO_TYPE (handle, pipeline_info_s*);
+
+  /* get handle from table */
+  if (nns_get_element_handle (pipe_info, key)) {
+    nns_remove_element_handle (pipe_info, key);
+    res = JNI_TRUE;
+  }
+
+  g_free (key);
+  (*env)->ReleaseStringUTFChars (env, name, element_name);
+  return res;
+}
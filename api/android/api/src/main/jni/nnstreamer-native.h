@@ -65,6 +65,7 @@ typedef enum
   NNS_ELEMENT_TYPE_VALVE,
   NNS_ELEMENT_TYPE_SWITCH_IN,
   NNS_ELEMENT_TYPE_SWITCH_OUT,
+  NNS_ELEMENT_TYPE_SINK_LIST,
 
   NNS_ELEMENT_TYPE_UNKNOWN
 } nns_element_type_e;
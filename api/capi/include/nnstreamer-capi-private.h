@@ -94,6 +94,9 @@ typedef struct {
 typedef struct {
   unsigned int num_tensors; /**< The number of tensors. */
   ml_tensor_data_s tensors[ML_TENSOR_SIZE_LIMIT]; /**< The list of tensor data. NULL for unused tensors. */
+  gboolean wrapped; /**< TRUE if the memory blocks are given by application (ml_tensors_data_create_from_ptr). */
+  ml_tensors_data_destroy_cb destroy; /**< The function to release the memory blocks given by application. */
+  void *user_data; /**< Private data for destroy callback. */
 } ml_tensors_data_s;
 
 /**
@@ -130,6 +133,7 @@ typedef struct _ml_pipeline_element {
   GList *handles;
   int maxid; /**< to allocate id for each handle */
   gulong handle_id;
+  gulong list_handle_id; /**< The signal for the list of buffers (batch mode of tensor_sink) */
 
   GMutex lock; /**< Lock for internal values */
   gboolean is_media_stream;
@@ -174,7 +178,18 @@ typedef struct _ml_pipeline_sink {
   ml_pipeline_element *element;
   guint32 id;
   ml_pipeline_sink_cb cb;
+  ml_pipeline_sink_list_cb list_cb; /**< The callback for the list of data (batch mode of tensor_sink) */
   void *pdata;
+
+  ml_pipeline_sink_dispatch_e dispatch; /**< The dispatch policy of the callback */
+  guint max_queue; /**< The max number of buffers in the queue (async dispatch) */
+  GQueue queue; /**< The buffers and the tensors info to be passed to the callback (async dispatch) */
+  GThread *thread; /**< The thread calling the callback (async dispatch) */
+  gboolean running; /**< TRUE while the dispatch thread is running */
+  guint num_dropped; /**< The number of dropped buffers */
+  gint ref_count; /**< The streaming thread holds the handle while it queues the data without the element's lock (async dispatch) */
+  GMutex lock; /**< Lock for the queue */
+  GCond cond; /**< Signals the change of the queue */
 } ml_pipeline_sink;
 
 /**
@@ -42,6 +42,29 @@ extern "C" {
  */
 typedef void *ml_single_h;
 
+/**
+ * @brief A handle of a pool of single-shot instances.
+ * @since_tizen 6.0
+ */
+typedef void *ml_single_pool_h;
+
+/**
+ * @brief The maximum number of the requests queued with ml_single_invoke_async().
+ * @since_tizen 6.0
+ */
+#define ML_SINGLE_ASYNC_QUEUE_LIMIT (16)
+
+/**
+ * @brief Callback for the completion of the request with ml_single_invoke_async().
+ * @details The callback is called in the invoke thread of the single handle. Do not call ml_single_close() in the callback.
+ *          If @a status is not #ML_ERROR_NONE, @a output is NULL.
+ * @since_tizen 6.0
+ * @param[in] status The result of the request. #ML_ERROR_TIMED_OUT if the request is not completed in the timeout, #ML_ERROR_STREAMS_PIPE if the handle is closed before the request is started.
+ * @param[in] output The output data. The application is responsible for freeing the output with ml_tensors_data_destroy().
+ * @param[in] user_data User application's private data.
+ */
+typedef void (*ml_single_invoke_cb) (int status, ml_tensors_data_h output, void *user_data);
+
 /*************
  * MAIN FUNC *
  *************/
@@ -105,6 +128,25 @@ int ml_single_close (ml_single_h single);
  */
 int ml_single_invoke (ml_single_h single, const ml_tensors_data_h input, ml_tensors_data_h *output);
 
+/**
+ * @brief Invokes the model with the given input data, and writes the result in the given output buffer.
+ * @details Unlike ml_single_invoke(), this does not allocate the output data. An application may create the output data once with ml_tensors_data_create() and the output information of the model, and reuse it for each invocation.
+ *          Note that this has a default timeout of 3 seconds. If an application wants to change the time to wait for an output, set the timeout using ml_single_set_timeout().
+ *          If this returns #ML_ERROR_TIMED_OUT, the model may still write the result in @a output. Do not free @a output until the handle is closed or the next invocation succeeds.
+ * @since_tizen 6.0
+ * @param[in] single The model handle to be inferred.
+ * @param[in] input The input data to be inferred.
+ * @param[in,out] output The output buffer. The number and the size of the tensors should be same as the output information of the model.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to push a buffer into source element.
+ * @retval #ML_ERROR_TIMED_OUT Failed to get the result from sink element.
+ * @retval #ML_ERROR_TRY_AGAIN The previous invocation is not finished yet.
+ */
+int ml_single_invoke_fast (ml_single_h single, const ml_tensors_data_h input, ml_tensors_data_h output);
+
 /**
  * @brief Invokes the model with the given input data with the given tensors information.
  * @details This function changes the input tensors information for the model, and returns the corresponding output data.
@@ -126,6 +168,27 @@ int ml_single_invoke (ml_single_h single, const ml_tensors_data_h input, ml_tens
  */
 int ml_single_invoke_dynamic (ml_single_h single, const ml_tensors_data_h input, const ml_tensors_info_h in_info, ml_tensors_data_h *output, ml_tensors_info_h *out_info);
 
+/**
+ * @brief Requests to invoke the model with the given input data, and returns without waiting for the output.
+ * @details The requests are queued and processed in order. The callback is called with the output when the request is completed.
+ *          A request which is not completed in the timeout of the handle (see ml_single_set_timeout()) since it is queued fails with #ML_ERROR_TIMED_OUT.
+ *          The pending requests are canceled with #ML_ERROR_STREAMS_PIPE when the handle is closed.
+ *          Note that ml_single_invoke() returns #ML_ERROR_TRY_AGAIN while the requests are being processed.
+ * @since_tizen 6.0
+ * @param[in] single The model handle to be inferred.
+ * @param[in] input The input data to be inferred. The input data should not be changed or freed until the callback is called.
+ * @param[in] cb The function to be called when the request is completed.
+ * @param[in] user_data Private data for the callback function.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE The handle is closed or being closed.
+ * @retval #ML_ERROR_TRY_AGAIN The queue is full (#ML_SINGLE_ASYNC_QUEUE_LIMIT requests are pending).
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_invoke_async (ml_single_h single, const ml_tensors_data_h input, ml_single_invoke_cb cb, void *user_data);
+
 /*************
  * UTILITIES *
  *************/
@@ -174,9 +237,10 @@ int ml_single_set_input_info (ml_single_h single, const ml_tensors_info_h info);
 
 /**
  * @brief Sets the maximum amount of time to wait for an output, in milliseconds.
+ * @details If @a timeout is 0, ml_single_invoke() and ml_single_invoke_fast() invoke the model in the caller's thread and wait for the output without timeout. This removes the overhead to wake up the internal thread for each invocation (Since 6.0).
  * @since_tizen 5.5
  * @param[in] single The model handle.
- * @param[in] timeout The time to wait for an output.
+ * @param[in] timeout The time to wait for an output. 0 for no timeout.
  * @return @c 0 on success. Otherwise a negative error value.
  * @retval #ML_ERROR_NONE Successful
  * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
@@ -211,6 +275,108 @@ int ml_single_set_property (ml_single_h single, const char *name, const char *va
  */
 int ml_single_get_property (ml_single_h single, const char *name, char **value);
 
+/********
+ * POOL *
+ ********/
+
+/**
+ * @brief Opens an ML model with the pool of instances and returns the pool as a handle.
+ * @details A single-shot instance runs one request at a time, and ml_single_invoke() returns #ML_ERROR_TRY_AGAIN if the instance is busy.
+ *          The pool opens @a num_instances instances of the model, and ml_single_pool_invoke() runs the request with an idle instance, so that multiple threads can invoke the model concurrently.
+ *          If all instances are busy, the request waits for an idle instance in the queue (max @a max_waiting requests).
+ *          Note that each instance loads the model with the neural network framework.
+ * @since_tizen 6.0
+ * @remarks http://tizen.org/privilege/mediastorage is needed if @a model is relevant to media storage.
+ * @remarks http://tizen.org/privilege/externalstorage is needed if @a model is relevant to external storage.
+ * @param[out] pool This is the pool handle opened. Users are required to close the given handle with ml_single_pool_close().
+ * @param[in] model This is the path to the neural network model file.
+ * @param[in] input_info This is required if the given model has flexible input dimension. See ml_single_open() for the details.
+ * @param[in] output_info This is required if the given model has flexible output dimension.
+ * @param[in] nnfw The neural network framework used to open the given @a model.
+ * @param[in] hw Tell the corresponding @a nnfw to use a specific hardware.
+ * @param[in] num_instances The number of instances in the pool. This should be larger than 0.
+ * @param[in] max_waiting The max number of requests waiting for an idle instance. Set 0 to return #ML_ERROR_TRY_AGAIN immediately if all instances are busy.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the privilege to access to the media storage or external storage.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to start the pipeline.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_pool_open (ml_single_pool_h *pool, const char *model, const ml_tensors_info_h input_info, const ml_tensors_info_h output_info, ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, unsigned int num_instances, unsigned int max_waiting);
+
+/**
+ * @brief Closes the pool handle.
+ * @details This waits for the running and waiting requests, and closes all instances in the pool.
+ * @since_tizen 6.0
+ * @param[in] pool The pool handle to be closed.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_pool_close (ml_single_pool_h pool);
+
+/**
+ * @brief Invokes the model with the given input data, using an idle instance in the pool.
+ * @details This is thread-safe. The requests waiting for an idle instance are served in arrival order. Note that this has a default timeout of 3 seconds to wait for an idle instance and an output. Set the timeout using ml_single_pool_set_timeout().
+ * @since_tizen 6.0
+ * @param[in] pool The pool handle.
+ * @param[in] input The input data to be inferred.
+ * @param[out] output The allocated output buffer. The caller is responsible for freeing the output buffer with ml_tensors_data_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ * @retval #ML_ERROR_TRY_AGAIN All instances are busy and the waiting queue is full.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to invoke the model, or the pool is being closed.
+ * @retval #ML_ERROR_TIMED_OUT Failed to get an idle instance or the result in time.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_single_pool_invoke (ml_single_pool_h pool, const ml_tensors_data_h input, ml_tensors_data_h *output);
+
+/**
+ * @brief Sets the maximum amount of time to wait for an idle instance and an output, in milliseconds.
+ * @details The timeout is the total time of a request. The time waiting for an idle instance is deducted from the time to wait for the output.
+ * @since_tizen 6.0
+ * @param[in] pool The pool handle.
+ * @param[in] timeout The time to wait for an idle instance and an output.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_pool_set_timeout (ml_single_pool_h pool, unsigned int timeout);
+
+/**
+ * @brief Gets the information of input or output data for the model in the pool.
+ * @since_tizen 6.0
+ * @param[in] pool The pool handle.
+ * @param[in] is_input @c true to get the input information, @c false to get the output information.
+ * @param[out] info The handle of tensors information. The caller is responsible for freeing the information with ml_tensors_info_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_pool_get_tensors_info (ml_single_pool_h pool, bool is_input, ml_tensors_info_h *info);
+
+/**
+ * @brief Gets the utilization of the pool.
+ * @since_tizen 6.0
+ * @param[in] pool The pool handle.
+ * @param[out] num_instances The number of instances in the pool. This can be null.
+ * @param[out] num_busy The number of instances running a request. This can be null.
+ * @param[out] num_waiting The number of requests waiting for an idle instance. This can be null.
+ * @param[out] num_rejected The number of requests rejected with #ML_ERROR_TRY_AGAIN or #ML_ERROR_TIMED_OUT while waiting for an idle instance. This can be null.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Fail. The parameter is invalid.
+ */
+int ml_single_pool_get_stats (ml_single_pool_h pool, unsigned int *num_instances, unsigned int *num_busy, unsigned int *num_waiting, unsigned int *num_rejected);
+
 /**
  * @}
  */
@@ -65,6 +65,12 @@ extern "C" {
  */
 #define ML_TENSOR_SIZE_LIMIT  (16)
 
+/**
+ * @brief The maximum number of data in the list for ml_pipeline_sink_list_cb().
+ * @since_tizen 6.0
+ */
+#define ML_PIPELINE_SINK_BATCH_SIZE_LIMIT  (1024)
+
 /**
  * @brief The dimensions of a tensor that NNStreamer supports.
  * @since_tizen 5.5
@@ -218,9 +224,20 @@ typedef enum {
   ML_PIPELINE_SWITCH_INPUT_SELECTOR			= 1, /**< GstInputSelector */
 } ml_pipeline_switch_e;
 
+/**
+ * @brief Enumeration for the dispatch policies of the sink callback.
+ * @details With the asynchronous policies, the callback is called in a dedicated thread and the pipeline does not wait for the callback. The data is kept in a bounded queue until the callback is called.
+ * @since_tizen 6.0
+ */
+typedef enum {
+  ML_PIPELINE_SINK_DISPATCH_SYNC			= 0, /**< Default. The callback is called in the streaming thread of the pipeline. */
+  ML_PIPELINE_SINK_DISPATCH_ASYNC_DROP_OLDEST		= 1, /**< The callback is called in a dedicated thread. If the queue is full, the oldest data in the queue is dropped. */
+  ML_PIPELINE_SINK_DISPATCH_ASYNC_BLOCK			= 2, /**< The callback is called in a dedicated thread. If the queue is full, the pipeline waits until the queue has room. */
+} ml_pipeline_sink_dispatch_e;
+
 /**
  * @brief Callback for sink element of NNStreamer pipelines (pipeline's output).
- * @details If an application wants to accept data outputs of an NNStreamer stream, use this callback to get data from the stream. Note that the buffer may be deallocated after the return and this is synchronously called. Thus, if you need the data afterwards, copy the data to another buffer and return fast. Do not spend too much time in the callback. It is recommended to use very small tensors at sinks.
+ * @details If an application wants to accept data outputs of an NNStreamer stream, use this callback to get data from the stream. Note that the buffer may be deallocated after the return. By default, this is synchronously called in the streaming thread. With ml_pipeline_sink_set_dispatch(), this is called in a dedicated thread. Thus, if you need the data afterwards, copy the data to another buffer and return fast. Do not spend too much time in the callback. It is recommended to use very small tensors at sinks.
  * @since_tizen 5.5
  * @remarks The @a data can be used only in the callback. To use outside, make a copy.
  * @remarks The @a info can be used only in the callback. To use outside, make a copy.
@@ -230,6 +247,27 @@ typedef enum {
  */
 typedef void (*ml_pipeline_sink_cb) (const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data);
 
+/**
+ * @brief Callback for sink element of NNStreamer pipelines to get the list of data at once.
+ * @details This is called with the batch of data from tensor_sink, instead of calling #ml_pipeline_sink_cb for each data. This reduces the overhead of the callbacks for the streams with high frame rate (e.g., sensors).
+ * @since_tizen 6.0
+ * @remarks The @a data and each data handle in it can be used only in the callback. To use outside, make a copy.
+ * @remarks The @a info can be used only in the callback. To use outside, make a copy.
+ * @param[out] data The array of the handles of the tensor output. Each handle is a single frame.
+ * @param[out] num_data The number of the handles in @a data.
+ * @param[out] info The handle of tensors information of each frame.
+ * @param[out] user_data User application's private data.
+ */
+typedef void (*ml_pipeline_sink_list_cb) (const ml_tensors_data_h *data, unsigned int num_data, const ml_tensors_info_h info, void *user_data);
+
+/**
+ * @brief Callback to release the memory blocks given by the application, when the tensors data handle is destroyed.
+ * @details This is called once when the handle created with ml_tensors_data_create_from_ptr() and all the buffers referring the memory blocks in the pipeline are released. Note that this may be called in the streaming thread of the pipeline.
+ * @since_tizen 6.0
+ * @param[in] user_data User application's private data given with ml_tensors_data_create_from_ptr().
+ */
+typedef void (*ml_tensors_data_destroy_cb) (void *user_data);
+
 /**
  * @brief Callback for the change of pipeline state.
  * @details If an application wants to get the change of pipeline state, use this callback. This callback can be registered when constructing the pipeline using ml_pipeline_construct(). Do not spend too much time in the callback.
@@ -373,6 +411,59 @@ int ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name, ml_pip
  */
 int ml_pipeline_sink_unregister (ml_pipeline_sink_h sink_handle);
 
+/**
+ * @brief Registers a callback to get the list of data at once for sink node of NNStreamer pipelines.
+ * @details The sink node collects up to @a batch_size data or the data for @a batch_timeout milliseconds, and calls the callback once with the list. The remaining data is passed at the end of stream.
+ * @since_tizen 6.0
+ * @remarks If the function succeeds, @a sink_handle handle must be unregistered using ml_pipeline_sink_unregister().
+ * @remarks The sink node should be tensor_sink. The batch size and timeout are applied to the sink node, so that the other callbacks registered to the sink node are called with the same batch.
+ * @param[in] pipe The pipeline to be attached with a sink node.
+ * @param[in] sink_name The name of sink node, described with ml_pipeline_construct().
+ * @param[in] batch_size The max number of data in the list. This should be in [2, #ML_PIPELINE_SINK_BATCH_SIZE_LIMIT].
+ * @param[in] batch_timeout The max time in milliseconds to hold the data in the list, 0 for no limit. This is checked when new data is received.
+ * @param[in] cb The function to be called by the sink node.
+ * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
+ * @param[out] sink_handle The sink handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid. (@a sink_name is not found, @a sink_name is not tensor_sink, or @a batch_size is out of range.)
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to connect a signal to sink element.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ *
+ * @pre The pipeline state should be #ML_PIPELINE_STATE_PAUSED.
+ */
+int ml_pipeline_sink_register_list (ml_pipeline_h pipe, const char *sink_name, unsigned int batch_size, unsigned int batch_timeout, ml_pipeline_sink_list_cb cb, void *user_data, ml_pipeline_sink_h *sink_handle);
+
+/**
+ * @brief Sets the dispatch policy of the callback for sink node of NNStreamer pipelines.
+ * @details By default, the callback is called synchronously in the streaming thread, so that a slow callback stalls the pipeline. With the asynchronous policies, the sink node queues the data (without copying it) and a dedicated thread calls the callback.
+ * @since_tizen 6.0
+ * @remarks With the asynchronous policies, the @a data and @a info of the callback are valid only in the callback, as same as the synchronous policy.
+ * @param[in] sink_handle The sink handle registered with ml_pipeline_sink_register().
+ * @param[in] policy The dispatch policy of the callback.
+ * @param[in] max_queue The max number of data in the queue. This should be larger than 0 with the asynchronous policies, and it is ignored with #ML_PIPELINE_SINK_DISPATCH_SYNC.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid. (@a sink_handle is registered with ml_pipeline_sink_register_list().)
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to create the dispatch thread.
+ */
+int ml_pipeline_sink_set_dispatch (ml_pipeline_sink_h sink_handle, ml_pipeline_sink_dispatch_e policy, unsigned int max_queue);
+
+/**
+ * @brief Gets the statistics of the dispatch queue of the sink handle.
+ * @since_tizen 6.0
+ * @param[in] sink_handle The sink handle registered with ml_pipeline_sink_register().
+ * @param[out] queued The number of data in the queue. This can be null.
+ * @param[out] dropped The number of data dropped since the dispatch policy is set. This can be null.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_pipeline_sink_get_dispatch_stats (ml_pipeline_sink_h sink_handle, unsigned int *queued, unsigned int *dropped);
+
 /**
  * @brief Gets a handle to operate as a src node of NNStreamer pipelines.
  * @since_tizen 5.5
@@ -407,6 +498,7 @@ int ml_pipeline_src_release_handle (ml_pipeline_src_h src_handle);
  * @param[in] src_handle The source handle returned by ml_pipeline_src_get_handle().
  * @param[in] data The handle of input tensors, in the format of tensors info given by ml_pipeline_src_get_tensors_info().
  *                 This function takes ownership of the data if @a policy is #ML_PIPELINE_BUF_POLICY_AUTO_FREE.
+ *                 If the data is created with ml_tensors_data_create_from_ptr(), the memory blocks are pushed without copy, and the destroy callback is called when the pipeline releases them.
  * @param[in] policy The policy of buffer deallocation.
  * @return 0 on success. Otherwise a negative error value.
  * @retval #ML_ERROR_NONE Successful
@@ -765,6 +857,24 @@ int ml_tensors_info_get_tensor_size (ml_tensors_info_h info, int index, size_t *
  */
 int ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h *data);
 
+/**
+ * @brief Creates a tensor data frame wrapping the memory blocks of the application, without memory allocation and copy.
+ * @details The memory blocks should be valid until @a destroy is called. The handle does not free the memory blocks, instead @a destroy is called once when the handle is destroyed.
+ *          If the handle is given to ml_pipeline_src_input_data() with #ML_PIPELINE_BUF_POLICY_AUTO_FREE, @a destroy is called after the pipeline releases the memory blocks.
+ * @since_tizen 6.0
+ * @param[in] info The handle of tensors information of the memory blocks.
+ * @param[in] raw_data The array of the memory blocks, one per tensor. The number of the blocks is the count of tensors in @a info, and the size of each block should be same as the size of the tensor.
+ * @param[in] destroy The function to release the memory blocks. NULL if the application releases the memory blocks after destroying the handle.
+ * @param[in] user_data Private data for @a destroy.
+ * @param[out] data The handle of tensors data. The caller is responsible for freeing the data with ml_tensors_data_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_create_from_ptr (const ml_tensors_info_h info, void * const *raw_data, ml_tensors_data_destroy_cb destroy, void *user_data, ml_tensors_data_h *data);
+
 /**
  * @brief Frees the given tensors' data handle.
  * @since_tizen 5.5
@@ -121,13 +121,228 @@ get_tensors_info_from_caps (GstCaps * caps, ml_tensors_info_s * info)
 }
 
 /**
- * @brief Handle a sink element for registered ml_pipeline_sink_cb
+ * @brief The data queued for the dispatch thread of the sink handle.
+ */
+typedef struct
+{
+  ml_pipeline_sink *sink; /**< The sink handle (referenced) */
+  GstBuffer *buffer; /**< The buffer (referenced, not copied) */
+  ml_tensors_info_s info; /**< The tensors info when the buffer is rendered */
+} ml_pipeline_sink_item;
+
+/**
+ * @brief Internal function to increase the reference count of the sink handle.
+ */
+static ml_pipeline_sink *
+sink_handle_ref (ml_pipeline_sink * sink)
+{
+  g_atomic_int_inc (&sink->ref_count);
+  return sink;
+}
+
+/**
+ * @brief Internal function to release the sink handle when it is not referenced.
  */
 static void
-cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
+sink_handle_unref (ml_pipeline_sink * sink)
 {
-  ml_pipeline_element *elem = user_data;
+  if (!g_atomic_int_dec_and_test (&sink->ref_count))
+    return;
+
+  g_mutex_clear (&sink->lock);
+  g_cond_clear (&sink->cond);
+  g_free (sink);
+}
+
+/**
+ * @brief Internal function to create the data for the dispatch thread.
+ * @note This should be called with elem->lock, the info of the element may be changed.
+ */
+static ml_pipeline_sink_item *
+sink_item_new (ml_pipeline_sink * sink, GstBuffer * b, ml_tensors_info_s * info)
+{
+  ml_pipeline_sink_item *item;
+
+  item = g_new0 (ml_pipeline_sink_item, 1);
+  item->sink = sink_handle_ref (sink);
+  item->buffer = gst_buffer_ref (b);
+  ml_tensors_info_initialize (&item->info);
+  ml_tensors_info_clone (&item->info, info);
+
+  return item;
+}
+
+/**
+ * @brief Internal function to release the data for the dispatch thread.
+ */
+static void
+sink_item_free (ml_pipeline_sink_item * item)
+{
+  gst_buffer_unref (item->buffer);
+  ml_tensors_info_free (&item->info);
+  sink_handle_unref (item->sink);
+  g_free (item);
+}
+
+/**
+ * @brief Internal function to pass the buffer to the callback of the sink handle.
+ */
+static void
+sink_invoke_callback (ml_pipeline_sink * sink, GstBuffer * b,
+    ml_tensors_info_s * info)
+{
+  GstMemory *mem[ML_TENSOR_SIZE_LIMIT];
+  GstMapInfo map[ML_TENSOR_SIZE_LIMIT];
+  ml_tensors_data_s data;
+  guint i, num_mems;
+
+  num_mems = gst_buffer_n_memory (b);
+  if (num_mems > ML_TENSOR_SIZE_LIMIT)
+    return;
+
+  memset (&data, 0, sizeof (ml_tensors_data_s));
+  data.num_tensors = num_mems;
+
+  for (i = 0; i < num_mems; i++) {
+    mem[i] = gst_buffer_peek_memory (b, i);
+    if (!gst_memory_map (mem[i], &map[i], GST_MAP_READ)) {
+      ml_loge ("Failed to map the output in the dispatch thread.");
+      num_mems = i;
+      goto done;
+    }
+
+    data.tensors[i].tensor = map[i].data;
+    data.tensors[i].size = map[i].size;
+  }
+
+  sink->cb (&data, info, sink->pdata);
+
+done:
+  for (i = 0; i < num_mems; i++) {
+    gst_memory_unmap (mem[i], &map[i]);
+  }
+}
+
+/**
+ * @brief Thread to call the callback of the sink handle (async dispatch).
+ */
+static gpointer
+sink_dispatch_thread (gpointer user_data)
+{
+  ml_pipeline_sink *sink = user_data;
+  ml_pipeline_sink_item *item;
+  GThread *self = g_thread_self ();
+
+  g_mutex_lock (&sink->lock);
+  /* the callback may stop this thread and start new one with ml_pipeline_sink_set_dispatch() */
+  while (sink->running && sink->thread == self) {
+    if (g_queue_is_empty (&sink->queue)) {
+      g_cond_wait (&sink->cond, &sink->lock);
+      continue;
+    }
+
+    item = g_queue_pop_head (&sink->queue);
+    g_cond_broadcast (&sink->cond);
+    g_mutex_unlock (&sink->lock);
+
+    sink_invoke_callback (sink, item->buffer, &item->info);
+    sink_item_free (item);
+
+    g_mutex_lock (&sink->lock);
+  }
+  g_mutex_unlock (&sink->lock);
+
+  /* the reference for this thread */
+  sink_handle_unref (sink);
+  return NULL;
+}
+
+/**
+ * @brief Internal function to queue the data for the dispatch thread.
+ * @details The buffer is kept by reference, not copied. This should be called without elem->lock,
+ * because the streaming thread may wait for the queue (ML_PIPELINE_SINK_DISPATCH_ASYNC_BLOCK) and the callback may call the API of the element.
+ */
+static void
+sink_dispatch_push (ml_pipeline_sink_item * item)
+{
+  ml_pipeline_sink *sink = item->sink;
+
+  g_mutex_lock (&sink->lock);
+
+  while (sink->running && g_queue_get_length (&sink->queue) >= sink->max_queue) {
+    if (sink->dispatch == ML_PIPELINE_SINK_DISPATCH_ASYNC_DROP_OLDEST) {
+      sink_item_free (g_queue_pop_head (&sink->queue));
+      sink->num_dropped++;
+    } else {
+      g_cond_wait (&sink->cond, &sink->lock);
+    }
+  }
+
+  if (sink->running) {
+    g_queue_push_tail (&sink->queue, item);
+    g_cond_broadcast (&sink->cond);
+    item = NULL;
+  }
+
+  g_mutex_unlock (&sink->lock);
+
+  /* the dispatch thread is stopped */
+  if (item)
+    sink_item_free (item);
+}
+
+/**
+ * @brief Internal function to stop the dispatch thread and clear the queue.
+ */
+static void
+sink_dispatch_stop (ml_pipeline_sink * sink)
+{
+  GThread *thread;
+  GQueue queue = G_QUEUE_INIT;
+
+  g_mutex_lock (&sink->lock);
+  sink->running = FALSE;
+  g_cond_broadcast (&sink->cond);
+
+  thread = sink->thread;
+  sink->thread = NULL;
+
+  /* free the data without lock, the data holds the reference of the handle */
+  queue = sink->queue;
+  g_queue_init (&sink->queue);
+  g_mutex_unlock (&sink->lock);
+
+  if (thread) {
+    /* the callback may unregister the handle in the dispatch thread */
+    if (thread == g_thread_self ())
+      g_thread_unref (thread);
+    else
+      g_thread_join (thread);
+  }
+
+  g_queue_foreach (&queue, (GFunc) sink_item_free, NULL);
+  g_queue_clear (&queue);
+}
+
+/**
+ * @brief Internal function to release the sink handle.
+ */
+static void
+sink_handle_free (gpointer data)
+{
+  ml_pipeline_sink *sink = data;
+
+  sink_dispatch_stop (sink);
+  sink_handle_unref (sink);
+}
 
+/**
+ * @brief Internal function to validate the buffer and pass it to the registered ml_pipeline_sink_cb.
+ * @return TRUE if the buffer is valid.
+ */
+static gboolean
+sink_handle_buffer (ml_pipeline_element * elem, GstBuffer * b)
+{
   /** @todo CRITICAL if the pipeline is being killed, don't proceed! */
 
   GstMemory *mem[ML_TENSOR_SIZE_LIMIT];
@@ -135,22 +350,24 @@ cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
   guint i;
   guint num_mems;
   GList *l;
+  GSList *pending = NULL;
   ml_tensors_data_s *data = NULL;
   size_t total_size = 0;
+  gboolean valid = FALSE;
 
   num_mems = gst_buffer_n_memory (b);
 
   if (num_mems > ML_TENSOR_SIZE_LIMIT) {
     ml_loge ("Number of memory chunks in a GstBuffer exceed the limit: %u > %u",
         num_mems, ML_TENSOR_SIZE_LIMIT);
-    return;
+    return FALSE;
   }
 
   /* set tensor data */
   data = g_new0 (ml_tensors_data_s, 1);
   if (data == NULL) {
     ml_loge ("Failed to allocate memory for tensors data in sink callback.");
-    return;
+    return FALSE;
   }
 
   data->num_tensors = num_mems;
@@ -232,11 +449,24 @@ cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
     goto error;
   }
 
+  valid = TRUE;
+
   /* Iterate e->handles, pass the data to them */
   for (l = elem->handles; l != NULL; l = l->next) {
     ml_pipeline_sink *sink = l->data;
     ml_pipeline_sink_cb callback = sink->cb;
 
+    /* The handle for the list of data is called in cb_sink_list_event() */
+    if (callback == NULL)
+      continue;
+
+    if (sink->dispatch != ML_PIPELINE_SINK_DISPATCH_SYNC) {
+      /* queue the data after releasing elem->lock */
+      pending = g_slist_prepend (pending,
+          sink_item_new (sink, b, &elem->tensors_info));
+      continue;
+    }
+
     callback (data, &elem->tensors_info, sink->pdata);
 
     /** @todo Measure time. Warn if it takes long. Kill if it takes too long. */
@@ -245,6 +475,12 @@ cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
 error:
   g_mutex_unlock (&elem->lock);
 
+  if (pending) {
+    pending = g_slist_reverse (pending);
+    g_slist_foreach (pending, (GFunc) sink_dispatch_push, NULL);
+    g_slist_free (pending);
+  }
+
   for (i = 0; i < num_mems; i++) {
     gst_memory_unmap (mem[i], &info[i]);
   }
@@ -253,7 +489,100 @@ error:
     g_free (data);
     data = NULL;
   }
-  return;
+  return valid;
+}
+
+/**
+ * @brief Handle a sink element for registered ml_pipeline_sink_cb
+ */
+static void
+cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
+{
+  sink_handle_buffer ((ml_pipeline_element *) user_data, b);
+}
+
+/**
+ * @brief Handle the list of buffers from a sink element (batch mode of tensor_sink) for registered ml_pipeline_sink_list_cb
+ */
+static void
+cb_sink_list_event (GstElement * e, GstBufferList * list, gpointer user_data)
+{
+  ml_pipeline_element *elem = user_data;
+  GstBuffer **buffers;
+  GstMapInfo *info;
+  ml_tensors_data_s *data;
+  ml_tensors_data_h *data_h;
+  guint i, j, num_buffers, num_data;
+  GList *l;
+
+  num_buffers = gst_buffer_list_length (list);
+  if (num_buffers == 0)
+    return;
+
+  buffers = g_new0 (GstBuffer *, num_buffers);
+  info = g_new0 (GstMapInfo, num_buffers * ML_TENSOR_SIZE_LIMIT);
+  data = g_new0 (ml_tensors_data_s, num_buffers);
+  data_h = g_new0 (ml_tensors_data_h, num_buffers);
+  num_data = 0;
+
+  for (i = 0; i < num_buffers; i++) {
+    GstBuffer *b = gst_buffer_list_get (list, i);
+
+    /* Validate the buffer, and pass it to the handles for each data. */
+    if (!sink_handle_buffer (elem, b))
+      continue;
+
+    buffers[num_data] = b;
+    data[num_data].num_tensors = gst_buffer_n_memory (b);
+
+    for (j = 0; j < data[num_data].num_tensors; j++) {
+      GstMapInfo *map = &info[num_data * ML_TENSOR_SIZE_LIMIT + j];
+
+      if (!gst_memory_map (gst_buffer_peek_memory (b, j), map, GST_MAP_READ)) {
+        ml_loge ("Failed to map the output in the batch of sink %s.", elem->name);
+        break;
+      }
+
+      data[num_data].tensors[j].tensor = map->data;
+      data[num_data].tensors[j].size = map->size;
+    }
+
+    if (j < data[num_data].num_tensors) {
+      /* skip this buffer, release the mapped memories */
+      while (j-- > 0)
+        gst_memory_unmap (gst_buffer_peek_memory (b, j),
+            &info[num_data * ML_TENSOR_SIZE_LIMIT + j]);
+      continue;
+    }
+
+    data_h[num_data] = &data[num_data];
+    num_data++;
+  }
+
+  if (num_data > 0) {
+    g_mutex_lock (&elem->lock);
+
+    for (l = elem->handles; l != NULL; l = l->next) {
+      ml_pipeline_sink *sink = l->data;
+
+      if (sink->list_cb)
+        sink->list_cb (data_h, num_data, &elem->tensors_info, sink->pdata);
+    }
+
+    g_mutex_unlock (&elem->lock);
+  }
+
+  for (i = 0; i < num_data; i++) {
+    for (j = 0; j < data[i].num_tensors; j++) {
+      gst_memory_unmap (gst_buffer_peek_memory (buffers[i], j),
+          &info[i * ML_TENSOR_SIZE_LIMIT + j]);
+    }
+  }
+
+  g_free (buffers);
+  g_free (info);
+  g_free (data);
+  g_free (data_h);
 }
 
 /**
@@ -331,8 +660,13 @@ cleanup_node (gpointer data)
     e->handle_id = 0;
   }
 
+  if (e->list_handle_id > 0) {
+    g_signal_handler_disconnect (e->element, e->list_handle_id);
+    e->list_handle_id = 0;
+  }
+
   if (e->handles)
-    g_list_free_full (e->handles, g_free);
+    g_list_free_full (e->handles, sink_handle_free);
   e->handles = NULL;
 
   ml_tensors_info_free (&e->tensors_info);
@@ -779,11 +1113,14 @@ ml_pipeline_stop (ml_pipeline_h pipe)
  ** NNStreamer Pipeline Sink/Src Control           **
  ****************************************************/
 /**
- * @brief Register a callback for sink (more info in nnstreamer.h)
+ * @brief Internal function to register a callback for sink.
+ * @details If list_cb is given, tensor_sink emits the list of buffers (batch mode).
  */
-int
-ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
-    ml_pipeline_sink_cb cb, void *user_data, ml_pipeline_sink_h * h)
+static int
+register_sink_handle (ml_pipeline_h pipe, const char *sink_name,
+    ml_pipeline_sink_cb cb, ml_pipeline_sink_list_cb list_cb,
+    unsigned int batch_size, unsigned int batch_timeout, void *user_data,
+    ml_pipeline_sink_h * h)
 {
   ml_pipeline_element *elem;
   ml_pipeline *p = pipe;
@@ -810,7 +1147,7 @@ ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
     return ML_ERROR_INVALID_PARAMETER;
   }
 
-  if (cb == NULL) {
+  if (cb == NULL && list_cb == NULL) {
     ml_loge ("The callback argument, cb, is not valid.");
     return ML_ERROR_INVALID_PARAMETER;
   }
@@ -832,7 +1169,29 @@ ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
     goto unlock_return;
   }
 
-  if (elem->handle_id > 0) {
+  if (list_cb) {
+    /* only tensor_sink supports the batch mode */
+    if (elem->type != ML_PIPELINE_ELEMENT_SINK) {
+      ml_loge ("The element [%s] in the pipeline is not a tensor_sink.",
+          sink_name);
+      ret = ML_ERROR_INVALID_PARAMETER;
+      goto unlock_return;
+    }
+
+    g_object_set (G_OBJECT (elem->element), "emit-signal", (gboolean) TRUE,
+        "batch-size", batch_size, "batch-timeout", batch_timeout, NULL);
+
+    if (elem->list_handle_id == 0) {
+      elem->list_handle_id = g_signal_connect (elem->element, "new-data-list",
+          G_CALLBACK (cb_sink_list_event), elem);
+
+      if (elem->list_handle_id == 0) {
+        ml_loge ("Failed to connect a signal to the element [%s].", sink_name);
+        ret = ML_ERROR_STREAMS_PIPE;
+        goto unlock_return;
+      }
+    }
+  } else if (elem->handle_id > 0) {
     /* no need to connect signal to sink element */
     ml_logw ("Sink callback is already registered.");
   } else {
@@ -866,7 +1225,13 @@ ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
   sink->pipe = p;
   sink->element = elem;
   sink->cb = cb;
+  sink->list_cb = list_cb;
   sink->pdata = user_data;
+  sink->dispatch = ML_PIPELINE_SINK_DISPATCH_SYNC;
+  sink->ref_count = 1;
+  g_queue_init (&sink->queue);
+  g_mutex_init (&sink->lock);
+  g_cond_init (&sink->cond);
 
   g_mutex_lock (&elem->lock);
 
@@ -881,6 +1246,34 @@ unlock_return:
   return ret;
 }
 
+/**
+ * @brief Register a callback for sink (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
+    ml_pipeline_sink_cb cb, void *user_data, ml_pipeline_sink_h * h)
+{
+  return register_sink_handle (pipe, sink_name, cb, NULL, 0, 0, user_data, h);
+}
+
+/**
+ * @brief Register a callback for the list of data from sink (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_register_list (ml_pipeline_h pipe, const char *sink_name,
+    unsigned int batch_size, unsigned int batch_timeout,
+    ml_pipeline_sink_list_cb cb, void *user_data, ml_pipeline_sink_h * h)
+{
+  if (batch_size < 2 || batch_size > ML_PIPELINE_SINK_BATCH_SIZE_LIMIT) {
+    ml_loge ("The batch size %u is not valid, it should be in [2, %u].",
+        batch_size, ML_PIPELINE_SINK_BATCH_SIZE_LIMIT);
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  return register_sink_handle (pipe, sink_name, NULL, cb, batch_size,
+      batch_timeout, user_data, h);
+}
+
 /**
  * @brief Unregister a callback for sink (more info in nnstreamer.h)
  */
@@ -889,13 +1282,116 @@ ml_pipeline_sink_unregister (ml_pipeline_sink_h h)
 {
   handle_init (sink, sink, h);
 
-  if (elem->handle_id > 0) {
+  elem->handles = g_list_remove (elem->handles, sink);
+
+  if (sink->list_cb) {
+    GList *l;
+    gboolean has_list_cb = FALSE;
+
+    for (l = elem->handles; l != NULL; l = l->next) {
+      if (((ml_pipeline_sink *) l->data)->list_cb) {
+        has_list_cb = TRUE;
+        break;
+      }
+    }
+
+    /* disable the batch mode of tensor_sink if no handle for the list */
+    if (!has_list_cb && elem->list_handle_id > 0) {
+      g_signal_handler_disconnect (elem->element, elem->list_handle_id);
+      elem->list_handle_id = 0;
+      g_object_set (G_OBJECT (elem->element), "batch-size", 0U, NULL);
+    }
+  } else if (elem->handle_id > 0) {
     g_signal_handler_disconnect (elem->element, elem->handle_id);
     elem->handle_id = 0;
   }
 
-  elem->handles = g_list_remove (elem->handles, sink);
-  g_free (sink);
+  sink_handle_free (sink);
+
+  handle_exit (h);
+}
+
+/**
+ * @brief Set the dispatch policy of the sink callback (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_set_dispatch (ml_pipeline_sink_h h,
+    ml_pipeline_sink_dispatch_e policy, unsigned int max_queue)
+{
+  GError *error = NULL;
+
+  handle_init (sink, sink, h);
+
+  if (sink->cb == NULL) {
+    ml_loge ("The dispatch policy cannot be set to the handle for the list of data.");
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (policy != ML_PIPELINE_SINK_DISPATCH_SYNC &&
+      policy != ML_PIPELINE_SINK_DISPATCH_ASYNC_DROP_OLDEST &&
+      policy != ML_PIPELINE_SINK_DISPATCH_ASYNC_BLOCK) {
+    ml_loge ("The dispatch policy %d is not valid.", policy);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (policy != ML_PIPELINE_SINK_DISPATCH_SYNC && max_queue == 0) {
+    ml_loge ("The max number of data in the queue should be larger than 0.");
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  /* Flush the queue of previous policy. */
+  sink_dispatch_stop (sink);
+
+  /* The streaming thread queues the data with sink->lock (without elem->lock). */
+  g_mutex_lock (&sink->lock);
+
+  sink->dispatch = policy;
+  sink->max_queue = max_queue;
+  sink->num_dropped = 0;
+
+  if (policy != ML_PIPELINE_SINK_DISPATCH_SYNC) {
+    sink->running = TRUE;
+    sink->thread = g_thread_try_new (NULL, sink_dispatch_thread,
+        sink_handle_ref (sink), &error);
+
+    if (sink->thread == NULL) {
+      ml_loge ("Failed to create the dispatch thread, error: %s.",
+          error ? error->message : "unknown");
+      g_clear_error (&error);
+
+      sink->running = FALSE;
+      sink->dispatch = ML_PIPELINE_SINK_DISPATCH_SYNC;
+      ret = ML_ERROR_STREAMS_PIPE;
+    }
+  }
+
+  g_mutex_unlock (&sink->lock);
+
+  /* the reference for the thread which is not created */
+  if (ret != ML_ERROR_NONE)
+    sink_handle_unref (sink);
+
+  handle_exit (h);
+}
+
+/**
+ * @brief Get the statistics of the dispatch queue (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_get_dispatch_stats (ml_pipeline_sink_h h,
+    unsigned int *queued, unsigned int *dropped)
+{
+  handle_init (sink, sink, h);
+
+  g_mutex_lock (&sink->lock);
+  if (queued)
+    *queued = g_queue_get_length (&sink->queue);
+  if (dropped)
+    *dropped = sink->num_dropped;
+  g_mutex_unlock (&sink->lock);
 
   handle_exit (h);
 }
@@ -1048,6 +1544,31 @@ ml_pipeline_src_release_handle (ml_pipeline_src_h h)
   handle_exit (h);
 }
 
+/**
+ * @brief Data to release the memory blocks given by application, shared by the memories in a buffer.
+ */
+typedef struct
+{
+  ml_tensors_data_destroy_cb destroy; /**< The function to release the memory blocks */
+  void *user_data; /**< Private data for destroy callback */
+  gint refcount; /**< The number of the memories referring this */
+} ml_pipeline_src_wrapped_s;
+
+/**
+ * @brief Internal function to release the memory blocks given by application, when the last memory is freed.
+ */
+static void
+ml_pipeline_src_release_wrapped (gpointer data)
+{
+  ml_pipeline_src_wrapped_s *wrapped = (ml_pipeline_src_wrapped_s *) data;
+
+  if (g_atomic_int_dec_and_test (&wrapped->refcount)) {
+    if (wrapped->destroy)
+      wrapped->destroy (wrapped->user_data);
+    g_free (wrapped);
+  }
+}
+
 /**
  * @brief Push a data frame to a src (more info in nnstreamer.h)
  */
@@ -1059,6 +1580,7 @@ ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
   GstMemory *mem;
   GstFlowReturn gret;
   ml_tensors_data_s *_data;
+  ml_pipeline_src_wrapped_s *wrapped = NULL;
   unsigned int i;
 
   handle_init (src, src, h);
@@ -1108,13 +1630,30 @@ ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
     }
   }
 
+  /**
+   * The memory blocks given by application are released with the callback,
+   * after all memories in the pipeline are freed.
+   */
+  if (_data->wrapped && policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
+    wrapped = g_new0 (ml_pipeline_src_wrapped_s, 1);
+    wrapped->destroy = _data->destroy;
+    wrapped->user_data = _data->user_data;
+    wrapped->refcount = (gint) _data->num_tensors;
+  }
+
   /* Create buffer to be pushed from buf[] */
   buffer = gst_buffer_new ();
   for (i = 0; i < _data->num_tensors; i++) {
-    mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
-        _data->tensors[i].tensor, _data->tensors[i].size, 0,
-        _data->tensors[i].size, _data->tensors[i].tensor,
-        (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) ? g_free : NULL);
+    if (wrapped) {
+      mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          _data->tensors[i].tensor, _data->tensors[i].size, 0,
+          _data->tensors[i].size, wrapped, ml_pipeline_src_release_wrapped);
+    } else {
+      mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          _data->tensors[i].tensor, _data->tensors[i].size, 0,
+          _data->tensors[i].size, _data->tensors[i].tensor,
+          (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) ? g_free : NULL);
+    }
 
     gst_buffer_append_memory (buffer, mem);
     /** @todo Verify that gst_buffer_append lists tensors/gstmem in the correct order */
@@ -29,6 +29,7 @@
 #include "tensor_filter_single.h"
 
 #define ML_SINGLE_MAGIC 0xfeedfeed
+#define ML_SINGLE_POOL_MAGIC 0xfeedf00d
 
 /**
  * @brief Default time to wait for an output in appsink (3 seconds).
@@ -72,6 +73,27 @@ G_LOCK_DEFINE_STATIC (magic);
  */
 #define ML_SINGLE_HANDLE_UNLOCK(single_h) g_mutex_unlock (&single_h->mutex);
 
+/**
+ * @brief Get valid pool handle after magic verification
+ * @note handle's mutex (pool_h->mutex) is acquired after this
+ * @param[out] pool_h The handle properly casted: (ml_single_pool *).
+ * @param[in] pool The handle to be validated: (void *).
+ * @param[in] reset Set TRUE if the handle is to be reset (magic = 0).
+ */
+#define ML_SINGLE_POOL_GET_VALID_HANDLE_LOCKED(pool_h, pool, reset) do { \
+  G_LOCK (magic); \
+  pool_h = (ml_single_pool *) pool; \
+  if (pool_h->magic != ML_SINGLE_POOL_MAGIC) { \
+    ml_loge ("The given param, pool is invalid."); \
+    G_UNLOCK (magic); \
+    return ML_ERROR_INVALID_PARAMETER; \
+  } \
+  if (reset) \
+    pool_h->magic = 0; \
+  g_mutex_lock (&pool_h->mutex); \
+  G_UNLOCK (magic); \
+} while (0)
+
 /** define string names for input/output */
 #define INPUT_STR "input"
 #define OUTPUT_STR "output"
@@ -103,12 +125,128 @@ typedef struct
   GCond cond;                   /**< condition for synchronization */
   ml_tensors_data_h input;      /**< input received from user */
   ml_tensors_data_h *output;    /**< output to be sent back to user */
+  ml_tensors_data_h prealloc_output; /**< output buffer given by user (no allocation in invoke) */
   guint timeout;                /**< timeout for invoking */
   thread_state state;           /**< current state of the thread */
   gboolean ignore_output;       /**< ignore and free the output */
   int status;                   /**< status of processing */
+  GQueue async_queue;           /**< pending requests with ml_single_invoke_async */
+  gboolean invoking_direct;     /**< TRUE if the model is being invoked in the caller's thread */
 } ml_single;
 
+/** The request with ml_single_invoke_async */
+typedef struct
+{
+  ml_tensors_data_h input;      /**< input received from user */
+  ml_single_invoke_cb cb;       /**< callback for the completion */
+  void *user_data;              /**< private data for the callback */
+  gint64 end_time;              /**< deadline to complete the request */
+} ml_single_async_request;
+
+/** ML single api data structure for the pool of single-shot instances */
+typedef struct
+{
+  ml_single_h *instances;       /**< single-shot instances */
+  gboolean *busy;               /**< TRUE if the instance is running a request */
+  guint num_instances;          /**< the number of instances */
+  guint num_busy;               /**< the number of busy instances */
+  guint num_waiting;            /**< the number of requests waiting for an idle instance */
+  guint max_waiting;            /**< max number of waiting requests */
+  guint num_rejected;           /**< the number of rejected requests */
+  guint timeout;                /**< timeout to wait for an idle instance and invoke the model */
+  GQueue waiters;               /**< requests waiting for an idle instance, in arrival order */
+  ml_tensors_info_h in_info;    /**< input info of the model */
+  ml_tensors_info_h out_info;   /**< output info of the model */
+  gboolean closing;             /**< TRUE if the pool is being closed */
+  guint magic;                  /**< code to verify valid handle */
+
+  GMutex mutex;                 /**< mutex for synchronization */
+  GCond cond;                   /**< signals the change of idle instances */
+} ml_single_pool;
+
+/** The request waiting for an idle instance in the pool */
+typedef struct
+{
+  gint idx;                     /**< index of the instance handed over, -1 if not assigned */
+} ml_single_pool_waiter;
+
+/**
+ * @brief Internal function to call the callback of the async request and release it.
+ * @note This should be called without the handle's mutex.
+ */
+static void
+ml_single_async_complete (ml_single_async_request * req, int status,
+    ml_tensors_data_h output)
+{
+  if (status != ML_ERROR_NONE && output) {
+    ml_tensors_data_destroy (output);
+    output = NULL;
+  }
+
+  req->cb (status, output, req->user_data);
+  g_free (req);
+}
+
+/**
+ * @brief Internal function to invoke the filter with the input data.
+ * @note This should be called without the handle's mutex, the state of the handle should be RUNNING.
+ * @param[in] prealloc The output buffer given by user. If NULL, the output is allocated.
+ * @param[out] output The allocated output. Not touched if prealloc is given.
+ */
+static int
+ml_single_invoke_filter (ml_single * single_h, GTensorFilterSingleClass * klass,
+    ml_tensors_data_s * in_data, ml_tensors_data_s * prealloc,
+    ml_tensors_data_h * output)
+{
+  GstTensorMemory in_tensors[NNS_TENSOR_SIZE_LIMIT];
+  GstTensorMemory out_tensors[NNS_TENSOR_SIZE_LIMIT];
+  ml_tensors_data_s *out_data;
+  unsigned int i;
+  int status;
+
+  /** Setup input buffer */
+  for (i = 0; i < in_data->num_tensors; i++) {
+    in_tensors[i].data = in_data->tensors[i].tensor;
+    in_tensors[i].size = in_data->tensors[i].size;
+    in_tensors[i].type = (tensor_type) single_h->in_info.info[i].type;
+  }
+
+  /** Setup output buffer */
+  for (i = 0; i < single_h->out_info.num_tensors; i++) {
+    /** memory will be allocated by tensor_filter_single, if not given */
+    out_tensors[i].data = (prealloc) ? prealloc->tensors[i].tensor : NULL;
+    out_tensors[i].size =
+        ml_tensor_info_get_size (&single_h->out_info.info[i]);
+    out_tensors[i].type = (tensor_type) single_h->out_info.info[i].type;
+  }
+
+  /** invoke the filter */
+  if (klass->invoke (single_h->filter, in_tensors, out_tensors) == FALSE)
+    return ML_ERROR_STREAMS_PIPE;
+
+  /** the result is written in the output buffer given by user */
+  if (prealloc)
+    return ML_ERROR_NONE;
+
+  /** Allocate output buffer */
+  status = ml_tensors_data_create_no_alloc (&single_h->out_info, output);
+  if (status != ML_ERROR_NONE) {
+    ml_loge ("Failed to allocate the memory block.");
+    for (i = 0; i < single_h->out_info.num_tensors; i++)
+      g_free (out_tensors[i].data);
+    *output = NULL;
+    return status;
+  }
+
+  /** set the result */
+  out_data = (ml_tensors_data_s *) (*output);
+  for (i = 0; i < single_h->out_info.num_tensors; i++) {
+    out_data->tensors[i].tensor = out_tensors[i].data;
+  }
+
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief thread to execute calls to invoke
  */
@@ -117,10 +255,9 @@ invoke_thread (void *arg)
 {
   ml_single *single_h;
   GTensorFilterSingleClass *klass;
-  GstTensorMemory in_tensors[NNS_TENSOR_SIZE_LIMIT];
-  GstTensorMemory out_tensors[NNS_TENSOR_SIZE_LIMIT];
-  ml_tensors_data_s *in_data, *out_data;
-  unsigned int i;
+  ml_tensors_data_s *in_data, *prealloc;
+  ml_single_async_request *req;
+  ml_tensors_data_h result;
   int status = ML_ERROR_NONE;
 
   single_h = (ml_single *) arg;
@@ -136,68 +273,69 @@ invoke_thread (void *arg)
   }
 
   while (single_h->state <= RUNNING) {
+    req = NULL;
+    result = NULL;
+
+    /** wait for data (sync request or queued async request) */
+    while (single_h->state != RUNNING || single_h->invoking_direct) {
+      if (single_h->state == IDLE &&
+          (req = g_queue_pop_head (&single_h->async_queue)) != NULL) {
+        single_h->state = RUNNING;
+        break;
+      }
 
-    /** wait for data */
-    while (single_h->state != RUNNING) {
       g_cond_wait (&single_h->cond, &single_h->mutex);
       if (single_h->state >= JOIN_REQUESTED)
         goto exit;
     }
 
-    in_data = (ml_tensors_data_s *) single_h->input;
-
-    /** Setup input buffer */
-    for (i = 0; i < in_data->num_tensors; i++) {
-      in_tensors[i].data = in_data->tensors[i].tensor;
-      in_tensors[i].size = in_data->tensors[i].size;
-      in_tensors[i].type = (tensor_type) single_h->in_info.info[i].type;
-    }
+    if (req) {
+      if (g_get_monotonic_time () > req->end_time) {
+        /** the request has waited in the queue longer than the timeout */
+        status = ML_ERROR_TIMED_OUT;
+        goto wait_for_next;
+      }
 
-    /** Setup output buffer */
-    for (i = 0; i < single_h->out_info.num_tensors; i++) {
-      /** memory will be allocated by tensor_filter_single */
-      out_tensors[i].data = NULL;
-      out_tensors[i].size =
-          ml_tensor_info_get_size (&single_h->out_info.info[i]);
-      out_tensors[i].type = (tensor_type) single_h->out_info.info[i].type;
+      in_data = (ml_tensors_data_s *) req->input;
+      prealloc = NULL;
+    } else {
+      in_data = (ml_tensors_data_s *) single_h->input;
+      prealloc = (ml_tensors_data_s *) single_h->prealloc_output;
     }
     g_mutex_unlock (&single_h->mutex);
 
-    /** invoke the thread */
-    if (klass->invoke (single_h->filter, in_tensors, out_tensors) == FALSE) {
-      status = ML_ERROR_STREAMS_PIPE;
-      g_mutex_lock (&single_h->mutex);
-      goto wait_for_next;
-    }
+    status = ml_single_invoke_filter (single_h, klass, in_data, prealloc,
+        &result);
 
     g_mutex_lock (&single_h->mutex);
-    /** Allocate output buffer */
-    if (single_h->ignore_output == FALSE) {
-      status = ml_tensors_data_create_no_alloc (&single_h->out_info,
-          single_h->output);
-      if (status != ML_ERROR_NONE) {
-        ml_loge ("Failed to allocate the memory block.");
-        (*single_h->output) = NULL;
-        goto wait_for_next;
-      }
 
-      /** set the result */
-      out_data = (ml_tensors_data_s *) (*single_h->output);
-      for (i = 0; i < single_h->out_info.num_tensors; i++) {
-        out_data->tensors[i].tensor = out_tensors[i].data;
+    if (req) {
+      /** same as the timeout of sync request */
+      if (status == ML_ERROR_NONE && g_get_monotonic_time () > req->end_time)
+        status = ML_ERROR_TIMED_OUT;
+    } else if (result) {
+      if (single_h->ignore_output == FALSE) {
+        *single_h->output = result;
+      } else {
+        /**
+         * Caller of the invoke thread has returned back with timeout
+         * so, free the memory allocated by the invoke as their is no receiver
+         */
+        ml_tensors_data_destroy (result);
       }
-    } else {
-      /**
-       * Caller of the invoke thread has returned back with timeout
-       * so, free the memory allocated by the invoke as their is no receiver
-       */
-      for (i = 0; i < single_h->out_info.num_tensors; i++)
-        g_free (out_tensors[i].data);
     }
 
     /** loop over to wait for the next element */
   wait_for_next:
-    single_h->status = status;
+    if (req) {
+      /** do not touch the status of sync request, call the callback without lock */
+      g_mutex_unlock (&single_h->mutex);
+      ml_single_async_complete (req, status, result);
+      g_mutex_lock (&single_h->mutex);
+    } else {
+      single_h->status = status;
+    }
+
     if (single_h->state == RUNNING)
       single_h->state = IDLE;
     g_cond_broadcast (&single_h->cond);
@@ -206,6 +344,14 @@ invoke_thread (void *arg)
 exit:
   if (single_h->state != ERROR)
     single_h->state = IDLE;
+
+  /** cancel the pending requests */
+  while ((req = g_queue_pop_head (&single_h->async_queue)) != NULL) {
+    g_mutex_unlock (&single_h->mutex);
+    ml_single_async_complete (req, ML_ERROR_STREAMS_PIPE, NULL);
+    g_mutex_lock (&single_h->mutex);
+  }
+
   g_mutex_unlock (&single_h->mutex);
   return NULL;
 }
@@ -500,6 +646,7 @@ ml_single_create_handle (ml_nnfw_type_e nnfw)
 
   ml_tensors_info_initialize (&single_h->in_info);
   ml_tensors_info_initialize (&single_h->out_info);
+  g_queue_init (&single_h->async_queue);
   g_mutex_init (&single_h->mutex);
   g_cond_init (&single_h->cond);
 
@@ -702,6 +849,10 @@ ml_single_close (ml_single_h single)
   single_h->state = JOIN_REQUESTED;
   g_cond_broadcast (&single_h->cond);
 
+  /** wait for the invocation in the caller's thread */
+  while (single_h->invoking_direct)
+    g_cond_wait (&single_h->cond, &single_h->mutex);
+
   ML_SINGLE_HANDLE_UNLOCK (single_h);
 
   if (single_h->thread != NULL)
@@ -726,64 +877,29 @@ ml_single_close (ml_single_h single)
 }
 
 /**
- * @brief Invokes the model with the given input data.
+ * @brief Internal function to validate the state of the handle and the input data.
+ * @note This should be called with the handle's mutex.
  */
-int
-ml_single_invoke (ml_single_h single,
-    const ml_tensors_data_h input, ml_tensors_data_h * output)
+static int
+ml_single_validate_input (ml_single * single_h, ml_tensors_data_s * in_data)
 {
-  ml_single *single_h;
-  ml_tensors_data_s *in_data;
-  gint64 end_time;
   unsigned int i;
-  int status = ML_ERROR_NONE;
-
-  check_feature_state ();
-
-  if (!single) {
-    ml_loge ("The first argument of ml_single_invoke() is not valid. Please check the single handle.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
-
-  if (!input) {
-    ml_loge ("The second argument of ml_single_invoke() is not valid. Please check the input data handle.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
-
-  if (!output) {
-    ml_loge ("The third argument of ml_single_invoke() is not valid. Please check the output data handle.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
-
-  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
-
-  in_data = (ml_tensors_data_s *) input;
-  *output = NULL;
-
-  if (!single_h->filter) {
-    ml_loge ("The tensor_filter element is not valid. It is not correctly created or already freed.");
-    status = ML_ERROR_INVALID_PARAMETER;
-    goto exit;
-  }
 
   if (single_h->state == JOIN_REQUESTED) {
     ml_loge ("The handle is closed or being closed.");
-    status = ML_ERROR_STREAMS_PIPE;
-    goto exit;
+    return ML_ERROR_STREAMS_PIPE;
   }
 
   if (single_h->state == ERROR) {
     ml_loge ("There was error on getting tesnor_filter element.");
-    status = ML_ERROR_STREAMS_PIPE;
-    goto exit;
+    return ML_ERROR_STREAMS_PIPE;
   }
 
   /* Validate input data */
   if (in_data->num_tensors != single_h->in_info.num_tensors) {
     ml_loge ("The number of input tensors is not compatible with model. Given: %u, Expected: %u.",
         in_data->num_tensors, single_h->in_info.num_tensors);
-    status = ML_ERROR_INVALID_PARAMETER;
-    goto exit;
+    return ML_ERROR_INVALID_PARAMETER;
   }
 
   for (i = 0; i < in_data->num_tensors; i++) {
@@ -791,8 +907,7 @@ ml_single_invoke (ml_single_h single,
 
     if (!in_data->tensors[i].tensor) {
       ml_loge ("The %d-th input tensor is not valid.", i);
-      status = ML_ERROR_INVALID_PARAMETER;
-      goto exit;
+      return ML_ERROR_INVALID_PARAMETER;
     }
 
     raw_size = ml_tensor_info_get_size (&single_h->in_info.info[i]);
@@ -800,11 +915,87 @@ ml_single_invoke (ml_single_h single,
     if (in_data->tensors[i].size != raw_size) {
       ml_loge ("The size of %d-th input tensor is not compatible with model. Given: %zu, Expected: %zu (type: %d).",
           i, in_data->tensors[i].size, raw_size, single_h->in_info.info[i].type);
-      status = ML_ERROR_INVALID_PARAMETER;
-      goto exit;
+      return ML_ERROR_INVALID_PARAMETER;
     }
   }
 
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to validate the output data given by user.
+ * @note This should be called with the handle's mutex.
+ */
+static int
+ml_single_validate_output (ml_single * single_h, ml_tensors_data_s * out_data)
+{
+  unsigned int i;
+
+  if (out_data->num_tensors != single_h->out_info.num_tensors) {
+    ml_loge ("The number of output tensors is not compatible with model. Given: %u, Expected: %u.",
+        out_data->num_tensors, single_h->out_info.num_tensors);
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  for (i = 0; i < out_data->num_tensors; i++) {
+    size_t raw_size;
+
+    if (!out_data->tensors[i].tensor) {
+      ml_loge ("The %d-th output tensor is not valid.", i);
+      return ML_ERROR_INVALID_PARAMETER;
+    }
+
+    raw_size = ml_tensor_info_get_size (&single_h->out_info.info[i]);
+
+    if (out_data->tensors[i].size != raw_size) {
+      ml_loge ("The size of %d-th output tensor is not compatible with model. Given: %zu, Expected: %zu (type: %d).",
+          i, out_data->tensors[i].size, raw_size, single_h->out_info.info[i].type);
+      return ML_ERROR_INVALID_PARAMETER;
+    }
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to invoke the model.
+ * @param[out] output The output allocated in invoke thread. NULL if prealloc_output is given.
+ * @param[in] prealloc_output The output buffer given by user.
+ */
+static int
+ml_single_invoke_internal (ml_single_h single,
+    const ml_tensors_data_h input, ml_tensors_data_h * output,
+    ml_tensors_data_h prealloc_output)
+{
+  ml_single *single_h;
+  GTensorFilterSingleClass *klass;
+  ml_tensors_data_s *in_data;
+  gint64 end_time;
+  int status = ML_ERROR_NONE;
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  in_data = (ml_tensors_data_s *) input;
+  if (output)
+    *output = NULL;
+
+  if (!single_h->filter) {
+    ml_loge ("The tensor_filter element is not valid. It is not correctly created or already freed.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  status = ml_single_validate_input (single_h, in_data);
+  if (status != ML_ERROR_NONE)
+    goto exit;
+
+  if (prealloc_output) {
+    status = ml_single_validate_output (single_h,
+        (ml_tensors_data_s *) prealloc_output);
+    if (status != ML_ERROR_NONE)
+      goto exit;
+  }
+
   if (single_h->state != IDLE) {
     ml_loge ("The single invoking thread is not idle.");
     status = ML_ERROR_TRY_AGAIN;
@@ -813,9 +1004,35 @@ ml_single_invoke (ml_single_h single,
 
   single_h->input = input;
   single_h->output = output;
+  single_h->prealloc_output = prealloc_output;
   single_h->state = RUNNING;
   single_h->ignore_output = FALSE;
 
+  if (single_h->timeout == 0) {
+    /** no timeout, invoke the model in the caller's thread without the thread hop */
+    klass = g_type_class_peek (G_TYPE_TENSOR_FILTER_SINGLE);
+    if (!klass) {
+      single_h->state = IDLE;
+      status = ML_ERROR_STREAMS_PIPE;
+      goto exit;
+    }
+
+    single_h->invoking_direct = TRUE;
+    ML_SINGLE_HANDLE_UNLOCK (single_h);
+
+    status = ml_single_invoke_filter (single_h, klass, in_data,
+        (ml_tensors_data_s *) prealloc_output, output);
+
+    g_mutex_lock (&single_h->mutex);
+    single_h->invoking_direct = FALSE;
+    if (single_h->state == RUNNING)
+      single_h->state = IDLE;
+
+    /** wake up the invoke thread (queued async requests) and close */
+    g_cond_broadcast (&single_h->cond);
+    goto exit;
+  }
+
   end_time = g_get_monotonic_time () +
     single_h->timeout * G_TIME_SPAN_MILLISECOND;
 
@@ -829,7 +1046,7 @@ ml_single_invoke (ml_single_h single,
     single_h->ignore_output = TRUE;
 
     /** Free if any output memory was allocated */
-    if (*single_h->output != NULL) {
+    if (single_h->output && *single_h->output != NULL) {
       ml_tensors_data_destroy ((ml_tensors_data_h) *single_h->output);
       *single_h->output = NULL;
     }
@@ -840,6 +1057,127 @@ exit:
   return status;
 }
 
+/**
+ * @brief Invokes the model with the given input data.
+ */
+int
+ml_single_invoke (ml_single_h single,
+    const ml_tensors_data_h input, ml_tensors_data_h * output)
+{
+  check_feature_state ();
+
+  if (!single) {
+    ml_loge ("The first argument of ml_single_invoke() is not valid. Please check the single handle.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!input) {
+    ml_loge ("The second argument of ml_single_invoke() is not valid. Please check the input data handle.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!output) {
+    ml_loge ("The third argument of ml_single_invoke() is not valid. Please check the output data handle.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  return ml_single_invoke_internal (single, input, output, NULL);
+}
+
+/**
+ * @brief Invokes the model with the given input data, and writes the result in the given output buffer.
+ */
+int
+ml_single_invoke_fast (ml_single_h single,
+    const ml_tensors_data_h input, ml_tensors_data_h output)
+{
+  check_feature_state ();
+
+  if (!single) {
+    ml_loge ("The first argument of ml_single_invoke_fast() is not valid. Please check the single handle.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!input) {
+    ml_loge ("The second argument of ml_single_invoke_fast() is not valid. Please check the input data handle.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!output) {
+    ml_loge ("The third argument of ml_single_invoke_fast() is not valid. Please check the output data handle.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  return ml_single_invoke_internal (single, input, NULL, output);
+}
+
+/**
+ * @brief Requests to invoke the model with the given input data, and returns without waiting for the output.
+ */
+int
+ml_single_invoke_async (ml_single_h single, const ml_tensors_data_h input,
+    ml_single_invoke_cb cb, void *user_data)
+{
+  ml_single *single_h;
+  ml_single_async_request *req;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!single || !input || !cb) {
+    ml_loge ("The given param is invalid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
+
+  if (!single_h->filter) {
+    ml_loge ("The tensor_filter element is not valid. It is not correctly created or already freed.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  status = ml_single_validate_input (single_h, (ml_tensors_data_s *) input);
+  if (status != ML_ERROR_NONE)
+    goto exit;
+
+  if (g_queue_get_length (&single_h->async_queue) >= ML_SINGLE_ASYNC_QUEUE_LIMIT) {
+    ml_logw ("The queue for async requests is full.");
+    status = ML_ERROR_TRY_AGAIN;
+    goto exit;
+  }
+
+  req = g_new0 (ml_single_async_request, 1);
+  if (req == NULL) {
+    ml_loge ("Failed to allocate the request.");
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto exit;
+  }
+
+  req->input = input;
+  req->cb = cb;
+  req->user_data = user_data;
+  if (single_h->timeout > 0)
+    req->end_time = g_get_monotonic_time () +
+        single_h->timeout * G_TIME_SPAN_MILLISECOND;
+  else
+    req->end_time = G_MAXINT64;
+
+  g_queue_push_tail (&single_h->async_queue, req);
+
+  /**
+   * Wake up the invoke thread only if it is idle.
+   * If running, the thread pops the request after the current one,
+   * and the caller of sync invoke should not be woken up.
+   */
+  if (single_h->state == IDLE)
+    g_cond_broadcast (&single_h->cond);
+
+exit:
+  ML_SINGLE_HANDLE_UNLOCK (single_h);
+  return status;
+}
+
 /**
  * @brief Gets the tensors info for the given handle.
  */
@@ -908,11 +1246,12 @@ ml_single_set_timeout (ml_single_h single, unsigned int timeout)
 
   check_feature_state ();
 
-  if (!single || timeout == 0)
+  if (!single)
     return ML_ERROR_INVALID_PARAMETER;
 
   ML_SINGLE_GET_VALID_HANDLE_LOCKED (single_h, single, 0);
 
+  /* 0 means no timeout, the model is invoked in the caller's thread. */
   single_h->timeout = (guint) timeout;
 
   ML_SINGLE_HANDLE_UNLOCK (single_h);
@@ -1109,3 +1448,338 @@ ml_single_get_property (ml_single_h single, const char *name, char **value)
   ML_SINGLE_HANDLE_UNLOCK (single_h);
   return status;
 }
+
+/**
+ * @brief Internal function to release the pool and the instances in it.
+ */
+static void
+ml_single_pool_free (ml_single_pool * pool_h)
+{
+  guint i;
+
+  for (i = 0; i < pool_h->num_instances; i++) {
+    if (pool_h->instances[i])
+      ml_single_close (pool_h->instances[i]);
+  }
+
+  g_free (pool_h->instances);
+  g_free (pool_h->busy);
+
+  if (pool_h->in_info)
+    ml_tensors_info_destroy (pool_h->in_info);
+  if (pool_h->out_info)
+    ml_tensors_info_destroy (pool_h->out_info);
+
+  g_cond_clear (&pool_h->cond);
+  g_mutex_clear (&pool_h->mutex);
+  g_free (pool_h);
+}
+
+/**
+ * @brief Opens an ML model with the pool of instances.
+ */
+int
+ml_single_pool_open (ml_single_pool_h * pool, const char *model,
+    const ml_tensors_info_h input_info, const ml_tensors_info_h output_info,
+    ml_nnfw_type_e nnfw, ml_nnfw_hw_e hw, unsigned int num_instances,
+    unsigned int max_waiting)
+{
+  ml_single_pool *pool_h;
+  guint i;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!pool || num_instances == 0) {
+    ml_loge ("The given param is invalid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  /* init null */
+  *pool = NULL;
+
+  pool_h = g_new0 (ml_single_pool, 1);
+  if (pool_h == NULL) {
+    ml_loge ("Failed to allocate the pool handle.");
+    return ML_ERROR_OUT_OF_MEMORY;
+  }
+
+  pool_h->instances = g_new0 (ml_single_h, num_instances);
+  pool_h->busy = g_new0 (gboolean, num_instances);
+  pool_h->num_instances = num_instances;
+  pool_h->max_waiting = max_waiting;
+  pool_h->timeout = SINGLE_DEFAULT_TIMEOUT;
+  g_queue_init (&pool_h->waiters);
+  g_mutex_init (&pool_h->mutex);
+  g_cond_init (&pool_h->cond);
+
+  /**
+   * Each instance has its own tensor_filter and invoke thread.
+   * @todo Share the model among the instances if the framework supports it.
+   */
+  for (i = 0; i < num_instances; i++) {
+    status = ml_single_open (&pool_h->instances[i], model, input_info,
+        output_info, nnfw, hw);
+    if (status != ML_ERROR_NONE) {
+      ml_loge ("Failed to open the %u-th instance in the pool.", i);
+      ml_single_pool_free (pool_h);
+      return status;
+    }
+  }
+
+  /**
+   * All instances have same model. Keep the info in the pool,
+   * not to call the instance's API (magic lock) with the pool's mutex.
+   */
+  status = ml_single_get_tensors_info (pool_h->instances[0], TRUE,
+      &pool_h->in_info);
+  if (status == ML_ERROR_NONE)
+    status = ml_single_get_tensors_info (pool_h->instances[0], FALSE,
+        &pool_h->out_info);
+  if (status != ML_ERROR_NONE) {
+    ml_loge ("Failed to get the tensors info of the model in the pool.");
+    ml_single_pool_free (pool_h);
+    return status;
+  }
+
+  pool_h->magic = ML_SINGLE_POOL_MAGIC;
+  *pool = pool_h;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Closes the pool handle.
+ */
+int
+ml_single_pool_close (ml_single_pool_h pool)
+{
+  ml_single_pool *pool_h;
+
+  check_feature_state ();
+
+  if (!pool) {
+    ml_loge ("The given param, pool is invalid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  ML_SINGLE_POOL_GET_VALID_HANDLE_LOCKED (pool_h, pool, 1);
+
+  /* wake up the waiting requests and wait for the running requests */
+  pool_h->closing = TRUE;
+  g_cond_broadcast (&pool_h->cond);
+
+  while (pool_h->num_busy > 0 || pool_h->num_waiting > 0)
+    g_cond_wait (&pool_h->cond, &pool_h->mutex);
+
+  g_mutex_unlock (&pool_h->mutex);
+
+  ml_single_pool_free (pool_h);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to release the instance, or hand it over to the oldest waiting request.
+ * @note This should be called with the pool's mutex.
+ */
+static void
+ml_single_pool_release_instance (ml_single_pool * pool_h, guint idx)
+{
+  ml_single_pool_waiter *waiter;
+
+  waiter = (ml_single_pool_waiter *) g_queue_pop_head (&pool_h->waiters);
+  if (waiter) {
+    /* the instance is still busy, serve the requests in arrival order */
+    waiter->idx = (gint) idx;
+  } else {
+    pool_h->busy[idx] = FALSE;
+    pool_h->num_busy--;
+  }
+
+  g_cond_broadcast (&pool_h->cond);
+}
+
+/**
+ * @brief Invokes the model with the given input data, using an idle instance in the pool.
+ */
+int
+ml_single_pool_invoke (ml_single_pool_h pool,
+    const ml_tensors_data_h input, ml_tensors_data_h * output)
+{
+  ml_single_pool *pool_h;
+  ml_single_pool_waiter waiter;
+  gint64 end_time, remaining;
+  guint i, idx;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!pool || !input || !output) {
+    ml_loge ("The given param is invalid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  /* init null */
+  *output = NULL;
+
+  ML_SINGLE_POOL_GET_VALID_HANDLE_LOCKED (pool_h, pool, 0);
+
+  /* the timeout covers both waiting for an idle instance and invoking */
+  end_time = g_get_monotonic_time () +
+      pool_h->timeout * G_TIME_SPAN_MILLISECOND;
+
+  if (pool_h->num_busy < pool_h->num_instances) {
+    /* no request is waiting if there is an idle instance */
+    for (idx = 0, i = 0; i < pool_h->num_instances; i++) {
+      if (!pool_h->busy[i]) {
+        idx = i;
+        break;
+      }
+    }
+
+    pool_h->busy[idx] = TRUE;
+    pool_h->num_busy++;
+  } else {
+    if (pool_h->num_waiting >= pool_h->max_waiting) {
+      ml_logw ("All instances in the pool are busy.");
+      pool_h->num_rejected++;
+      status = ML_ERROR_TRY_AGAIN;
+      goto exit;
+    }
+
+    /* wait until the instance is handed over */
+    waiter.idx = -1;
+    g_queue_push_tail (&pool_h->waiters, &waiter);
+    pool_h->num_waiting++;
+
+    while (!pool_h->closing && waiter.idx < 0) {
+      if (!g_cond_wait_until (&pool_h->cond, &pool_h->mutex, end_time))
+        break;
+    }
+
+    pool_h->num_waiting--;
+
+    if (waiter.idx < 0) {
+      g_queue_remove (&pool_h->waiters, &waiter);
+
+      if (pool_h->closing) {
+        ml_loge ("The pool is being closed.");
+        status = ML_ERROR_STREAMS_PIPE;
+      } else {
+        ml_logw ("Wait for an idle instance has timed out.");
+        pool_h->num_rejected++;
+        status = ML_ERROR_TIMED_OUT;
+      }
+      goto exit;
+    }
+
+    idx = (guint) waiter.idx;
+  }
+
+  g_mutex_unlock (&pool_h->mutex);
+
+  remaining = (end_time - g_get_monotonic_time ()) / G_TIME_SPAN_MILLISECOND;
+  if (remaining <= 0) {
+    ml_logw ("Wait for an idle instance has timed out.");
+    status = ML_ERROR_TIMED_OUT;
+  } else {
+    /* the instance is not shared until it is released */
+    status = ml_single_set_timeout (pool_h->instances[idx], (guint) remaining);
+    if (status == ML_ERROR_NONE)
+      status = ml_single_invoke (pool_h->instances[idx], input, output);
+  }
+
+  g_mutex_lock (&pool_h->mutex);
+  if (remaining <= 0)
+    pool_h->num_rejected++;
+  ml_single_pool_release_instance (pool_h, idx);
+
+exit:
+  /* notify close */
+  g_cond_broadcast (&pool_h->cond);
+  g_mutex_unlock (&pool_h->mutex);
+  return status;
+}
+
+/**
+ * @brief Sets the maximum amount of time to wait for an idle instance and an output, in milliseconds.
+ */
+int
+ml_single_pool_set_timeout (ml_single_pool_h pool, unsigned int timeout)
+{
+  ml_single_pool *pool_h;
+
+  check_feature_state ();
+
+  if (!pool || timeout == 0)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  ML_SINGLE_POOL_GET_VALID_HANDLE_LOCKED (pool_h, pool, 0);
+
+  /* applied to the instance when a request gets it */
+  pool_h->timeout = (guint) timeout;
+
+  g_mutex_unlock (&pool_h->mutex);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the information of input or output data for the model in the pool.
+ */
+int
+ml_single_pool_get_tensors_info (ml_single_pool_h pool, bool is_input,
+    ml_tensors_info_h * info)
+{
+  ml_single_pool *pool_h;
+  int status;
+
+  check_feature_state ();
+
+  if (!pool || !info)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  ML_SINGLE_POOL_GET_VALID_HANDLE_LOCKED (pool_h, pool, 0);
+
+  status = ml_tensors_info_create (info);
+  if (status == ML_ERROR_NONE) {
+    status = ml_tensors_info_clone (*info,
+        is_input ? pool_h->in_info : pool_h->out_info);
+
+    if (status != ML_ERROR_NONE) {
+      ml_tensors_info_destroy (*info);
+      *info = NULL;
+    }
+  }
+
+  g_mutex_unlock (&pool_h->mutex);
+  return status;
+}
+
+/**
+ * @brief Gets the utilization of the pool.
+ */
+int
+ml_single_pool_get_stats (ml_single_pool_h pool, unsigned int *num_instances,
+    unsigned int *num_busy, unsigned int *num_waiting,
+    unsigned int *num_rejected)
+{
+  ml_single_pool *pool_h;
+
+  check_feature_state ();
+
+  if (!pool)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  ML_SINGLE_POOL_GET_VALID_HANDLE_LOCKED (pool_h, pool, 0);
+
+  if (num_instances)
+    *num_instances = pool_h->num_instances;
+  if (num_busy)
+    *num_busy = pool_h->num_busy;
+  if (num_waiting)
+    *num_waiting = pool_h->num_waiting;
+  if (num_rejected)
+    *num_rejected = pool_h->num_rejected;
+
+  g_mutex_unlock (&pool_h->mutex);
+  return ML_ERROR_NONE;
+}
@@ -545,10 +545,16 @@ ml_tensors_data_destroy (ml_tensors_data_h data)
 
   _data = (ml_tensors_data_s *) data;
 
-  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
-    if (_data->tensors[i].tensor) {
-      g_free (_data->tensors[i].tensor);
-      _data->tensors[i].tensor = NULL;
+  if (_data->wrapped) {
+    /* the memory blocks are given by application */
+    if (_data->destroy)
+      _data->destroy (_data->user_data);
+  } else {
+    for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
+      if (_data->tensors[i].tensor) {
+        g_free (_data->tensors[i].tensor);
+        _data->tensors[i].tensor = NULL;
+      }
     }
   }
 
@@ -641,6 +647,53 @@ failed:
   return status;
 }
 
+/**
+ * @brief Creates a tensor data frame wrapping the memory blocks of the application. (more info in nnstreamer.h)
+ */
+int
+ml_tensors_data_create_from_ptr (const ml_tensors_info_h info,
+    void *const *raw_data, ml_tensors_data_destroy_cb destroy,
+    void *user_data, ml_tensors_data_h * data)
+{
+  ml_tensors_data_s *_data = NULL;
+  gint status;
+  guint i;
+
+  check_feature_state ();
+
+  if (info == NULL || raw_data == NULL || data == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* init null */
+  *data = NULL;
+
+  if (!ml_tensors_info_is_valid (info)) {
+    ml_loge ("The given param, tensors info is invalid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  status = ml_tensors_data_create_no_alloc (info, (ml_tensors_data_h *) &_data);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  for (i = 0; i < _data->num_tensors; i++) {
+    if (raw_data[i] == NULL) {
+      ml_loge ("The %u-th memory block is invalid.", i);
+      g_free (_data);
+      return ML_ERROR_INVALID_PARAMETER;
+    }
+
+    _data->tensors[i].tensor = raw_data[i];
+  }
+
+  _data->wrapped = TRUE;
+  _data->destroy = destroy;
+  _data->user_data = user_data;
+
+  *data = _data;
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Gets a tensor data of given handle.
  */
@@ -347,6 +347,7 @@ g_tensor_filter_single_invoke (GTensorFilterSingle * self,
   GstTensorFilterPrivate *priv;
   guint i;
   gboolean allocate_in_invoke;
+  gpointer given[NNS_TENSOR_SIZE_LIMIT] = { NULL, };
 
   priv = &self->priv;
 
@@ -365,11 +366,16 @@ g_tensor_filter_single_invoke (GTensorFilterSingle * self,
     priv->configured = TRUE;
   }
 
-  /** Setup output buffer */
+  /**
+   * Setup output buffer.
+   * If the caller gives the output buffer, the result is written in it.
+   */
   allocate_in_invoke = gst_tensor_filter_allocate_in_invoke (priv);
   for (i = 0; i < priv->prop.output_meta.num_tensors; i++) {
+    given[i] = output[i].data;
+
     /* allocate memory if allocate_in_invoke is FALSE */
-    if (allocate_in_invoke == FALSE) {
+    if (allocate_in_invoke == FALSE && given[i] == NULL) {
       output[i].data = g_malloc (output[i].size);
       if (!output[i].data) {
         g_critical ("Failed to allocate the output tensor.");
@@ -378,13 +384,29 @@ g_tensor_filter_single_invoke (GTensorFilterSingle * self,
     }
   }
 
-  if (priv->fw->invoke_NN (&priv->prop, &priv->privateData, input, output) == 0)
+  if (priv->fw->invoke_NN (&priv->prop, &priv->privateData, input, output) == 0) {
+    if (allocate_in_invoke) {
+      /* the framework allocated the output, copy it to the given buffer */
+      for (i = 0; i < priv->prop.output_meta.num_tensors; i++) {
+        if (given[i] && given[i] != output[i].data) {
+          memcpy (given[i], output[i].data, output[i].size);
+          g_free (output[i].data);
+          output[i].data = given[i];
+        }
+      }
+    }
     return TRUE;
+  }
 
 error:
-  if (allocate_in_invoke == FALSE)
-    for (i = 0; i < priv->prop.output_meta.num_tensors; i++)
-      g_free (output[i].data);
+  if (allocate_in_invoke == FALSE) {
+    for (i = 0; i < priv->prop.output_meta.num_tensors; i++) {
+      if (given[i] == NULL) {
+        g_free (output[i].data);
+        output[i].data = NULL;
+      }
+    }
+  }
   return FALSE;
 }
 
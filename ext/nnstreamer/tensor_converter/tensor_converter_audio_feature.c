@@ -0,0 +1,813 @@
+/**
+ * GStreamer / NNStreamer tensor_converter subplugin, "audio feature"
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	tensor_converter_audio_feature.c
+ * @date	18 Oct 2020
+ * @brief	NNStreamer tensor-converter subplugin, "audio feature",
+ *              which extracts log-mel spectrogram or MFCC from audio/x-raw.
+ *
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ * Select this sub-plugin with the property "mode" of tensor_converter.
+ *
+ * $ gst-launch-1.0 ... ! audio/x-raw,format=S16LE,channels=1,rate=16000 ! \
+ *     tensor_converter mode=audio_feature option=n_fft:512,hop:160,n_mels:40,frames:98 ! ...
+ *
+ * Options (comma-separated key:value):
+ * - n_fft : the length of a window and FFT, power of 2 (default 512)
+ * - hop : the number of samples between the windows, n_fft - hop samples overlap (default 160)
+ * - n_mels : the number of mel bands (default 40)
+ * - n_mfcc : the number of MFCC coefficients, 0 to get log-mel spectrogram (default 0)
+ * - frames : the number of feature frames in a tensor (default 1)
+ * - stride : the number of new feature frames between the tensors (default frames)
+ * - fmin, fmax : the range of frequency of mel bands (default 0 and rate / 2)
+ *
+ * The outgoing tensor is float32 with dimension n_mels:frames (or n_mfcc:frames),
+ * that is, [frames][n_mels or n_mfcc] in C array and the features of a frame are contiguous.
+ * The samples are kept in a ring buffer and each window is computed once.
+ * If stride is less than frames, the feature frames are kept in a ring buffer
+ * and shared by the overlapping tensors.
+ */
+
+#include <string.h>
+#include <math.h>
+#include <glib.h>
+#include <nnstreamer_plugin_api.h>
+#include <nnstreamer_plugin_api_converter.h>
+
+void init_audio_feature (void) __attribute__ ((constructor));
+void fini_audio_feature (void) __attribute__ ((destructor));
+
+#define AF_DEFAULT_N_FFT (512)
+#define AF_DEFAULT_HOP (160)
+#define AF_DEFAULT_N_MELS (40)
+#define AF_LOG_OFFSET (1e-6f)
+
+/**
+ * @brief Options of audio feature extraction.
+ */
+typedef struct
+{
+  guint n_fft; /**< window length and FFT size (power of 2) */
+  guint hop; /**< hop size in samples */
+  guint n_mels; /**< the number of mel bands */
+  guint n_mfcc; /**< the number of MFCC coefficients (0 for log-mel) */
+  guint frames; /**< feature frames in a tensor */
+  guint stride; /**< new feature frames between tensors */
+  gdouble fmin; /**< lowest frequency of mel bands */
+  gdouble fmax; /**< highest frequency of mel bands (0 for rate / 2) */
+} af_option;
+
+/**
+ * @brief Triangular mel filter (sparse).
+ */
+typedef struct
+{
+  guint start; /**< the first bin of the filter */
+  guint len; /**< the number of bins */
+  gfloat *weights; /**< the weights of the bins */
+} af_mel_filter;
+
+/**
+ * @brief Internal data of audio feature converter (per tensor_converter instance).
+ */
+typedef struct
+{
+  af_option opt; /**< options */
+  gint rate; /**< sampling rate */
+  gint channels; /**< the number of channels */
+  gboolean is_float; /**< TRUE if F32LE, FALSE if S16LE */
+  guint n_feat; /**< the number of features in a frame */
+
+  /* real FFT of size n_fft with complex FFT of size n_fft / 2 */
+  guint half; /**< n_fft / 2 */
+  guint *bitrev; /**< bit-reversal permutation (half) */
+  gfloat *tw_re; /**< twiddle factors of all stages (half) */
+  gfloat *tw_im; /**< twiddle factors of all stages (half) */
+  gfloat *post_re; /**< twiddle factors to split the real FFT (half) */
+  gfloat *post_im; /**< twiddle factors to split the real FFT (half) */
+  gfloat *z_re; /**< work buffer (half) */
+  gfloat *z_im; /**< work buffer (half) */
+  gfloat *frame; /**< windowed frame (n_fft) */
+  gfloat *power; /**< power spectrum (half + 1) */
+  gfloat *window; /**< Hann window (n_fft) */
+  af_mel_filter *mel; /**< mel filterbank (n_mels) */
+  gfloat *mel_energy; /**< log-mel energies (n_mels) */
+  gfloat *dct; /**< DCT-II matrix (n_mfcc x n_mels) */
+
+  /* sample ring buffer, the windows overlap by n_fft - hop samples */
+  gfloat *samples; /**< ring buffer of samples (n_fft) */
+  guint sample_pos; /**< write position in the ring */
+  guint64 sample_count; /**< total samples pushed into the ring */
+  guint hop_remain; /**< samples required for the next window */
+
+  /* feature ring buffer, shared by the overlapping tensors */
+  gfloat *features; /**< ring buffer of feature frames (frames x n_feat) */
+  guint feature_pos; /**< write position (frame index) in the ring */
+  guint64 feature_count; /**< total feature frames */
+  guint stride_remain; /**< feature frames required for the next tensor */
+
+  GstClockTime base_pts; /**< timestamp of the first sample */
+} af_data;
+
+G_DEFINE_QUARK (nnstreamer-converter-audio-feature, audio_feature);
+
+/**
+ * @brief Free the tables and buffers.
+ */
+static void
+af_clear (af_data * af)
+{
+  guint i;
+
+  if (af->mel) {
+    for (i = 0; i < af->opt.n_mels; i++)
+      g_free (af->mel[i].weights);
+    g_free (af->mel);
+  }
+
+  g_free (af->bitrev);
+  g_free (af->tw_re);
+  g_free (af->tw_im);
+  g_free (af->post_re);
+  g_free (af->post_im);
+  g_free (af->z_re);
+  g_free (af->z_im);
+  g_free (af->frame);
+  g_free (af->power);
+  g_free (af->window);
+  g_free (af->mel_energy);
+  g_free (af->dct);
+  g_free (af->samples);
+  g_free (af->features);
+
+  memset (af, 0, sizeof (af_data));
+}
+
+/**
+ * @brief Free the internal data.
+ */
+static void
+af_free (gpointer data)
+{
+  af_data *af = data;
+
+  af_clear (af);
+  g_free (af);
+}
+
+/**
+ * @brief Get the internal data of given tensor_converter instance.
+ */
+static af_data *
+af_get_data (GstTensorConverter * self)
+{
+  af_data *af;
+
+  af = g_object_get_qdata (G_OBJECT (self), audio_feature_quark ());
+  if (af == NULL) {
+    af = g_new0 (af_data, 1);
+    g_object_set_qdata_full (G_OBJECT (self), audio_feature_quark (), af,
+        af_free);
+  }
+
+  return af;
+}
+
+/**
+ * @brief Parse the option string (comma-separated key:value).
+ */
+static gboolean
+af_parse_option (const gchar * str, af_option * opt)
+{
+  gchar **options;
+  guint i;
+  gboolean ret = TRUE;
+
+  memset (opt, 0, sizeof (af_option));
+  opt->n_fft = AF_DEFAULT_N_FFT;
+  opt->hop = AF_DEFAULT_HOP;
+  opt->n_mels = AF_DEFAULT_N_MELS;
+  opt->frames = 1;
+
+  if (str == NULL || str[0] == '\0')
+    return TRUE;
+
+  options = g_strsplit (str, ",", -1);
+
+  for (i = 0; options[i] != NULL && ret; i++) {
+    gchar **kv = g_strsplit (options[i], ":", 2);
+
+    if (g_strv_length (kv) != 2) {
+      GST_ERROR ("Invalid option %s, should be key:value.", options[i]);
+      ret = FALSE;
+    } else {
+      const gchar *key = g_strstrip (kv[0]);
+      const gchar *val = g_strstrip (kv[1]);
+
+      if (g_ascii_strcasecmp (key, "n_fft") == 0) {
+        opt->n_fft = (guint) g_ascii_strtoull (val, NULL, 10);
+      } else if (g_ascii_strcasecmp (key, "hop") == 0) {
+        opt->hop = (guint) g_ascii_strtoull (val, NULL, 10);
+      } else if (g_ascii_strcasecmp (key, "n_mels") == 0) {
+        opt->n_mels = (guint) g_ascii_strtoull (val, NULL, 10);
+      } else if (g_ascii_strcasecmp (key, "n_mfcc") == 0) {
+        opt->n_mfcc = (guint) g_ascii_strtoull (val, NULL, 10);
+      } else if (g_ascii_strcasecmp (key, "frames") == 0) {
+        opt->frames = (guint) g_ascii_strtoull (val, NULL, 10);
+      } else if (g_ascii_strcasecmp (key, "stride") == 0) {
+        opt->stride = (guint) g_ascii_strtoull (val, NULL, 10);
+      } else if (g_ascii_strcasecmp (key, "fmin") == 0) {
+        opt->fmin = g_ascii_strtod (val, NULL);
+      } else if (g_ascii_strcasecmp (key, "fmax") == 0) {
+        opt->fmax = g_ascii_strtod (val, NULL);
+      } else {
+        GST_ERROR ("Unknown option %s.", key);
+        ret = FALSE;
+      }
+    }
+
+    g_strfreev (kv);
+  }
+
+  g_strfreev (options);
+
+  if (opt->stride == 0)
+    opt->stride = opt->frames;
+
+  if (ret) {
+    if (opt->n_fft < 4 || (opt->n_fft & (opt->n_fft - 1)) != 0) {
+      GST_ERROR ("Invalid n_fft %u, should be power of 2.", opt->n_fft);
+      ret = FALSE;
+    } else if (opt->hop == 0 || opt->hop > opt->n_fft) {
+      GST_ERROR ("Invalid hop %u, should be in [1, n_fft].", opt->hop);
+      ret = FALSE;
+    } else if (opt->n_mels == 0 || opt->n_mfcc > opt->n_mels) {
+      GST_ERROR ("Invalid n_mels %u or n_mfcc %u.", opt->n_mels, opt->n_mfcc);
+      ret = FALSE;
+    } else if (opt->frames == 0 || opt->stride > opt->frames) {
+      GST_ERROR ("Invalid frames %u or stride %u.", opt->frames, opt->stride);
+      ret = FALSE;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Convert frequency (Hz) to mel scale (HTK).
+ */
+static inline gdouble
+af_hz_to_mel (gdouble hz)
+{
+  return 2595.0 * log10 (1.0 + hz / 700.0);
+}
+
+/**
+ * @brief Convert mel scale (HTK) to frequency (Hz).
+ */
+static inline gdouble
+af_mel_to_hz (gdouble mel)
+{
+  return 700.0 * (pow (10.0, mel / 2595.0) - 1.0);
+}
+
+/**
+ * @brief Prepare the tables (FFT, window, mel filterbank and DCT) and buffers.
+ */
+static gboolean
+af_setup (af_data * af)
+{
+  const guint n = af->opt.n_fft;
+  const guint half = n / 2;
+  const guint bins = half + 1;
+  gdouble fmin, fmax, mel_min, mel_max;
+  gdouble *center;
+  guint i, j, m, bits, offset;
+
+  af->half = half;
+  af->n_feat = (af->opt.n_mfcc > 0) ? af->opt.n_mfcc : af->opt.n_mels;
+
+  /* bit-reversal permutation of complex FFT (half) */
+  af->bitrev = g_new0 (guint, half);
+  for (bits = 0; (1U << bits) < half; bits++);
+  for (i = 0; i < half; i++) {
+    guint r = 0;
+
+    for (j = 0; j < bits; j++)
+      r |= ((i >> j) & 1U) << (bits - 1 - j);
+    af->bitrev[i] = r;
+  }
+
+  /* twiddle factors, contiguous for each stage (m = 1, 2, 4, ...) */
+  af->tw_re = g_new0 (gfloat, half);
+  af->tw_im = g_new0 (gfloat, half);
+  for (m = 1, offset = 0; m < half; m <<= 1) {
+    for (j = 0; j < m; j++) {
+      gdouble theta = -G_PI * j / m;
+
+      af->tw_re[offset + j] = (gfloat) cos (theta);
+      af->tw_im[offset + j] = (gfloat) sin (theta);
+    }
+    offset += m;
+  }
+
+  /* twiddle factors to split the spectrum of real input */
+  af->post_re = g_new0 (gfloat, half);
+  af->post_im = g_new0 (gfloat, half);
+  for (i = 0; i < half; i++) {
+    gdouble theta = -2.0 * G_PI * i / n;
+
+    af->post_re[i] = (gfloat) cos (theta);
+    af->post_im[i] = (gfloat) sin (theta);
+  }
+
+  af->z_re = g_new0 (gfloat, half);
+  af->z_im = g_new0 (gfloat, half);
+  af->frame = g_new0 (gfloat, n);
+  af->power = g_new0 (gfloat, bins);
+
+  /* periodic Hann window */
+  af->window = g_new0 (gfloat, n);
+  for (i = 0; i < n; i++)
+    af->window[i] = (gfloat) (0.5 - 0.5 * cos (2.0 * G_PI * i / n));
+
+  /* mel filterbank */
+  fmin = MAX (af->opt.fmin, 0.0);
+  fmax = (af->opt.fmax > 0.0) ? af->opt.fmax : af->rate / 2.0;
+  fmax = MIN (fmax, af->rate / 2.0);
+  if (fmin >= fmax) {
+    GST_ERROR ("Invalid frequency range [%f, %f].", fmin, fmax);
+    return FALSE;
+  }
+
+  mel_min = af_hz_to_mel (fmin);
+  mel_max = af_hz_to_mel (fmax);
+
+  center = g_new0 (gdouble, af->opt.n_mels + 2);
+  for (m = 0; m < af->opt.n_mels + 2; m++) {
+    center[m] = af_mel_to_hz (mel_min +
+        (mel_max - mel_min) * m / (af->opt.n_mels + 1));
+  }
+
+  af->mel = g_new0 (af_mel_filter, af->opt.n_mels);
+  for (m = 0; m < af->opt.n_mels; m++) {
+    guint first = bins, last = 0;
+
+    for (i = 0; i < bins; i++) {
+      gdouble f = (gdouble) i * af->rate / n;
+
+      if (f > center[m] && f < center[m + 2]) {
+        first = MIN (first, i);
+        last = MAX (last, i);
+      }
+    }
+
+    if (first > last) {
+      /* too narrow band, use the nearest bin */
+      first = last = (guint) MIN (center[m + 1] * n / af->rate + 0.5,
+          (gdouble) half);
+    }
+
+    af->mel[m].start = first;
+    af->mel[m].len = last - first + 1;
+    af->mel[m].weights = g_new0 (gfloat, af->mel[m].len);
+
+    for (i = first; i <= last; i++) {
+      gdouble f = (gdouble) i * af->rate / n;
+      gdouble w;
+
+      if (f <= center[m + 1])
+        w = (f - center[m]) / (center[m + 1] - center[m]);
+      else
+        w = (center[m + 2] - f) / (center[m + 2] - center[m + 1]);
+
+      af->mel[m].weights[i - first] = (gfloat) CLAMP (w, 0.0, 1.0);
+    }
+
+    if (af->mel[m].len == 1 && af->mel[m].weights[0] == 0.0f)
+      af->mel[m].weights[0] = 1.0f;
+  }
+  g_free (center);
+
+  af->mel_energy = g_new0 (gfloat, af->opt.n_mels);
+
+  /* orthonormal DCT-II */
+  if (af->opt.n_mfcc > 0) {
+    const guint nm = af->opt.n_mels;
+
+    af->dct = g_new0 (gfloat, af->opt.n_mfcc * nm);
+    for (i = 0; i < af->opt.n_mfcc; i++) {
+      gdouble scale = (i == 0) ? sqrt (1.0 / nm) : sqrt (2.0 / nm);
+
+      for (j = 0; j < nm; j++) {
+        af->dct[i * nm + j] =
+            (gfloat) (scale * cos (G_PI * i * (2.0 * j + 1.0) / (2.0 * nm)));
+      }
+    }
+  }
+
+  /* ring buffers */
+  af->samples = g_new0 (gfloat, n);
+  af->features = g_new0 (gfloat, af->opt.frames * af->n_feat);
+
+  return TRUE;
+}
+
+/**
+ * @brief Reset the ring buffers (new stream).
+ */
+static void
+af_reset (af_data * af)
+{
+  af->sample_pos = 0;
+  af->sample_count = 0;
+  af->hop_remain = af->opt.n_fft;
+  af->feature_pos = 0;
+  af->feature_count = 0;
+  af->stride_remain = af->opt.frames;
+  af->base_pts = GST_CLOCK_TIME_NONE;
+}
+
+/**
+ * @brief Complex FFT (radix-2, in-place, split real and imaginary arrays).
+ * The butterflies of each stage run on contiguous twiddle factors, so that the compiler can vectorize the inner loop.
+ */
+static void
+af_fft (af_data * af, gfloat * re, gfloat * im)
+{
+  const guint n = af->half;
+  guint m, k, j, offset;
+
+  for (m = 1, offset = 0; m < n; m <<= 1) {
+    const gfloat *wr = af->tw_re + offset;
+    const gfloat *wi = af->tw_im + offset;
+
+    for (k = 0; k < n; k += (m << 1)) {
+      gfloat *ar = re + k;
+      gfloat *ai = im + k;
+      gfloat *br = re + k + m;
+      gfloat *bi = im + k + m;
+
+      for (j = 0; j < m; j++) {
+        gfloat tr = br[j] * wr[j] - bi[j] * wi[j];
+        gfloat ti = br[j] * wi[j] + bi[j] * wr[j];
+
+        br[j] = ar[j] - tr;
+        bi[j] = ai[j] - ti;
+        ar[j] = ar[j] + tr;
+        ai[j] = ai[j] + ti;
+      }
+    }
+
+    offset += m;
+  }
+}
+
+/**
+ * @brief Compute a feature frame from the samples in the ring buffer.
+ * @param out the feature frame to be filled (n_feat)
+ */
+static void
+af_compute_frame (af_data * af, gfloat * out)
+{
+  const guint n = af->opt.n_fft;
+  const guint half = af->half;
+  const guint tail = n - af->sample_pos;
+  gfloat *frame = af->frame;
+  guint i, m;
+
+  /* windowed frame, the oldest sample is at sample_pos */
+  for (i = 0; i < tail; i++)
+    frame[i] = af->samples[af->sample_pos + i] * af->window[i];
+  for (i = tail; i < n; i++)
+    frame[i] = af->samples[i - tail] * af->window[i];
+
+  /* pack the real frame into complex sequence of half length */
+  for (i = 0; i < half; i++) {
+    guint r = af->bitrev[i];
+
+    af->z_re[r] = frame[2 * i];
+    af->z_im[r] = frame[2 * i + 1];
+  }
+
+  af_fft (af, af->z_re, af->z_im);
+
+  /* split the spectrum and get the power (bins 0 ... half) */
+  for (i = 0; i < half; i++) {
+    const guint c = (half - i) & (half - 1);
+    const gfloat a = af->z_re[i], b = af->z_im[i];
+    const gfloat cr = af->z_re[c], ci = af->z_im[c];
+    const gfloat er = 0.5f * (a + cr), ei = 0.5f * (b - ci);
+    const gfloat or_ = 0.5f * (b + ci), oi = -0.5f * (a - cr);
+    const gfloat xr = er + af->post_re[i] * or_ - af->post_im[i] * oi;
+    const gfloat xi = ei + af->post_re[i] * oi + af->post_im[i] * or_;
+
+    af->power[i] = xr * xr + xi * xi;
+  }
+  af->power[half] = (af->z_re[0] - af->z_im[0]) * (af->z_re[0] - af->z_im[0]);
+
+  /* log-mel energies */
+  for (m = 0; m < af->opt.n_mels; m++) {
+    const af_mel_filter *f = &af->mel[m];
+    const gfloat *p = af->power + f->start;
+    gfloat sum = 0.0f;
+
+    for (i = 0; i < f->len; i++)
+      sum += p[i] * f->weights[i];
+
+    af->mel_energy[m] = logf (sum + AF_LOG_OFFSET);
+  }
+
+  if (af->opt.n_mfcc == 0) {
+    memcpy (out, af->mel_energy, sizeof (gfloat) * af->opt.n_mels);
+    return;
+  }
+
+  /* MFCC */
+  for (i = 0; i < af->opt.n_mfcc; i++) {
+    const gfloat *d = af->dct + i * af->opt.n_mels;
+    gfloat sum = 0.0f;
+
+    for (m = 0; m < af->opt.n_mels; m++)
+      sum += d[m] * af->mel_energy[m];
+
+    out[i] = sum;
+  }
+}
+
+/**
+ * @brief Write a tensor (latest feature frames in the ring) into given memory.
+ */
+static void
+af_write_tensor (af_data * af, gfloat * dest)
+{
+  const gsize frame_bytes = sizeof (gfloat) * af->n_feat;
+  const guint frames = af->opt.frames;
+  const guint oldest = af->feature_pos;
+
+  /* the oldest frame is at feature_pos (ring is full) */
+  memcpy (dest, af->features + oldest * af->n_feat,
+      (frames - oldest) * frame_bytes);
+  memcpy (dest + (frames - oldest) * af->n_feat, af->features,
+      oldest * frame_bytes);
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static GstBuffer *
+af_convert (GstTensorConverter * self, const GstBuffer * buf,
+    gsize * frame_size, guint * frames_in)
+{
+  af_data *af;
+  GstBuffer *inbuf = (GstBuffer *) buf;
+  GstBuffer *outbuf = NULL;
+  GstMapInfo info;
+  GstClockTime first_pts = GST_CLOCK_TIME_NONE;
+  gsize sample_size, num_samples, s;
+  guint tensors = 0;
+  gint c;
+
+  af = af_get_data (self);
+  g_assert (af->samples != NULL);
+
+  *frame_size = sizeof (gfloat) * af->n_feat * af->opt.frames;
+  *frames_in = 0;
+
+  if (!GST_CLOCK_TIME_IS_VALID (af->base_pts) ||
+      GST_BUFFER_IS_DISCONT (inbuf)) {
+    if (GST_BUFFER_PTS_IS_VALID (inbuf)) {
+      af->base_pts = GST_BUFFER_PTS (inbuf) -
+          MIN (GST_BUFFER_PTS (inbuf),
+          gst_util_uint64_scale_int (af->sample_count, GST_SECOND, af->rate));
+    }
+  }
+
+  if (!gst_buffer_map (inbuf, &info, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Failed to map the incoming buffer.");
+    *frame_size = 0;
+    return NULL;
+  }
+
+  sample_size = (af->is_float ? sizeof (gfloat) : sizeof (gint16)) *
+      af->channels;
+  num_samples = info.size / sample_size;
+
+  for (s = 0; s < num_samples;) {
+    gsize count = MIN (num_samples - s, (gsize) af->hop_remain);
+    gsize k;
+
+    /* push the samples into the ring (mono, float) */
+    for (k = 0; k < count; k++) {
+      gfloat v = 0.0f;
+
+      if (af->is_float) {
+        const gfloat *p = (const gfloat *) info.data + (s + k) * af->channels;
+
+        for (c = 0; c < af->channels; c++)
+          v += p[c];
+      } else {
+        const gint16 *p = (const gint16 *) info.data + (s + k) * af->channels;
+
+        for (c = 0; c < af->channels; c++)
+          v += p[c] / 32768.0f;
+      }
+
+      af->samples[af->sample_pos] = v / af->channels;
+      af->sample_pos = (af->sample_pos + 1) & (af->opt.n_fft - 1);
+    }
+
+    s += count;
+    af->sample_count += count;
+    af->hop_remain -= count;
+
+    if (af->hop_remain > 0)
+      break;
+
+    /* a new window, compute the feature frame once */
+    af_compute_frame (af, af->features + af->feature_pos * af->n_feat);
+    af->feature_pos = (af->feature_pos + 1) % af->opt.frames;
+    af->feature_count++;
+    af->hop_remain = af->opt.hop;
+
+    if (--af->stride_remain == 0) {
+      GstMemory *mem;
+      GstMapInfo out_info;
+
+      /* the ring is full, write a tensor */
+      mem = gst_allocator_alloc (NULL, *frame_size, NULL);
+      if (!gst_memory_map (mem, &out_info, GST_MAP_WRITE)) {
+        GST_ERROR_OBJECT (self, "Failed to map the outgoing memory.");
+        gst_memory_unref (mem);
+        gst_buffer_unmap (inbuf, &info);
+        if (outbuf)
+          gst_buffer_unref (outbuf);
+        *frame_size = 0;
+        return NULL;
+      }
+
+      af_write_tensor (af, (gfloat *) out_info.data);
+      gst_memory_unmap (mem, &out_info);
+
+      if (outbuf == NULL) {
+        guint64 first = (af->feature_count - af->opt.frames) * af->opt.hop;
+
+        outbuf = gst_buffer_new ();
+        if (GST_CLOCK_TIME_IS_VALID (af->base_pts)) {
+          first_pts = af->base_pts +
+              gst_util_uint64_scale_int (first, GST_SECOND, af->rate);
+        }
+      }
+
+      gst_buffer_append_memory (outbuf, mem);
+      af->stride_remain = af->opt.stride;
+      tensors++;
+    }
+  }
+
+  gst_buffer_unmap (inbuf, &info);
+
+  if (outbuf) {
+    GST_BUFFER_PTS (outbuf) = first_pts;
+    GST_BUFFER_DURATION (outbuf) =
+        gst_util_uint64_scale_int ((guint64) tensors * af->opt.stride *
+        af->opt.hop, GST_SECOND, af->rate);
+  }
+
+  *frames_in = tensors;
+  return outbuf;
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static gboolean
+af_get_caps (GstTensorConverter * self, const GstStructure * st,
+    GstTensorConfig * config)
+{
+  af_data *af;
+  af_option opt;
+  const gchar *format;
+  gchar *option = NULL;
+  gint rate, channels;
+  guint gcd;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+
+  if (!gst_structure_has_name (st, "audio/x-raw")) {
+    GST_ERROR_OBJECT (self, "audio_feature supports audio/x-raw only.");
+    return FALSE;
+  }
+
+  format = gst_structure_get_string (st, "format");
+  if (g_strcmp0 (format, "S16LE") != 0 && g_strcmp0 (format, "F32LE") != 0) {
+    GST_ERROR_OBJECT (self, "Unsupported audio format %s, use S16LE or F32LE.",
+        GST_STR_NULL (format));
+    return FALSE;
+  }
+
+  if (!gst_structure_get_int (st, "rate", &rate) || rate <= 0 ||
+      !gst_structure_get_int (st, "channels", &channels) || channels <= 0) {
+    GST_ERROR_OBJECT (self, "Failed to get the rate and channels of audio.");
+    return FALSE;
+  }
+
+  g_object_get (self, "option", &option, NULL);
+  if (!af_parse_option (option, &opt)) {
+    g_free (option);
+    return FALSE;
+  }
+  g_free (option);
+
+  af = af_get_data (self);
+  af_clear (af);
+
+  af->opt = opt;
+  af->rate = rate;
+  af->channels = channels;
+  af->is_float = g_str_equal (format, "F32LE");
+
+  if (!af_setup (af)) {
+    af_clear (af);
+    return FALSE;
+  }
+  af_reset (af);
+
+  gst_tensor_config_init (config);
+  config->info.type = _NNS_FLOAT32;
+  config->info.dimension[0] = af->n_feat;
+  config->info.dimension[1] = opt.frames;
+  config->info.dimension[2] = 1;
+  config->info.dimension[3] = 1;
+
+  /* a tensor for each (stride x hop) samples */
+  gcd = (guint) gst_util_greatest_common_divisor (rate, opt.stride * opt.hop);
+  config->rate_n = rate / gcd;
+  config->rate_d = (opt.stride * opt.hop) / gcd;
+
+  return TRUE;
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static gboolean
+af_query_caps (GstTensorConverter * self, const GstTensorConfig * config,
+    GstStructure * st)
+{
+  GValue list = G_VALUE_INIT;
+  GValue format = G_VALUE_INIT;
+
+  g_return_val_if_fail (st != NULL, FALSE);
+
+  if (!gst_structure_has_name (st, "audio/x-raw"))
+    return TRUE;
+
+  g_value_init (&list, GST_TYPE_LIST);
+  g_value_init (&format, G_TYPE_STRING);
+
+  g_value_set_string (&format, "S16LE");
+  gst_value_list_append_value (&list, &format);
+  g_value_set_string (&format, "F32LE");
+  gst_value_list_append_value (&list, &format);
+
+  gst_structure_set_value (st, "format", &list);
+
+  g_value_unset (&format);
+  g_value_unset (&list);
+  return TRUE;
+}
+
+static gchar converter_subplugin_audio_feature[] = "audio_feature";
+
+/** @brief Audio feature tensor converter sub-plugin */
+static NNStreamerExternalConverter audioFeature = {
+  .media_type_name = converter_subplugin_audio_feature,
+  .convert = af_convert,
+  .get_caps = af_get_caps,
+  .query_caps = af_query_caps
+};
+
+/** @brief Initialize this object for tensor converter sub-plugin */
+void
+init_audio_feature (void)
+{
+  registerExternalConverter (&audioFeature);
+}
+
+/** @brief Destruct this object for tensor converter sub-plugin */
+void
+fini_audio_feature (void)
+{
+  unregisterExternalConverter (audioFeature.media_type_name);
+}
@@ -0,0 +1,325 @@
+/**
+ * GStreamer / NNStreamer tensor_converter subplugin, "tensor record"
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	tensor_converter_record.c
+ * @date	18 Oct 2020
+ * @brief	NNStreamer tensor-converter subplugin, "tensor record",
+ *              which reads the recorded tensor stream (other/tensor-record).
+ *
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ * The payloads are pushed without memcpy. The outgoing buffer shares the
+ * memory of incoming buffer (e.g., the block read by filesrc), unless
+ * a record is split into multiple incoming buffers.
+ * Each record is pushed in its own buffer with the recorded timestamps.
+ *
+ * tensor_converter supports other/tensor only, thus the recorded stream
+ * with multiple tensors cannot be replayed with this sub-plugin.
+ */
+
+#include <string.h>
+#include <glib.h>
+#include <gst/base/gstadapter.h>
+#include <nnstreamer_plugin_api.h>
+#include <nnstreamer_plugin_api_converter.h>
+#include <tensor_record.h>
+
+void init_record_conv (void) __attribute__ ((constructor));
+void fini_record_conv (void) __attribute__ ((destructor));
+
+/**
+ * @brief Internal data of tensor-record converter (per tensor_converter instance).
+ */
+typedef struct
+{
+  GstAdapter *adapter; /**< adapter to collect the records */
+  gboolean header_parsed; /**< TRUE if the stream header is skipped */
+  gsize frame_size; /**< the size of a tensor */
+} record_conv_data;
+
+G_DEFINE_QUARK (nnstreamer-converter-record, record_conv);
+
+/**
+ * @brief Free the internal data.
+ */
+static void
+record_conv_data_free (gpointer data)
+{
+  record_conv_data *rdata = data;
+
+  g_object_unref (rdata->adapter);
+  g_free (rdata);
+}
+
+/**
+ * @brief Get the internal data of given tensor_converter instance.
+ */
+static record_conv_data *
+record_conv_get_data (GstTensorConverter * self)
+{
+  record_conv_data *rdata;
+
+  rdata = g_object_get_qdata (G_OBJECT (self), record_conv_quark ());
+  if (rdata == NULL) {
+    rdata = g_new0 (record_conv_data, 1);
+    rdata->adapter = gst_adapter_new ();
+
+    g_object_set_qdata_full (G_OBJECT (self), record_conv_quark (), rdata,
+        record_conv_data_free);
+  }
+
+  return rdata;
+}
+
+/**
+ * @brief Parse the stream header in the adapter.
+ * The writer may write the stream header again for a new stream, the tensor info should not be changed.
+ * @return TRUE if the stream header is valid
+ */
+static gboolean
+record_conv_parse_header (GstTensorConverter * self, record_conv_data * rdata)
+{
+  GstTensorsConfig config;
+  const guint8 *data;
+  gboolean valid;
+
+  data = gst_adapter_map (rdata->adapter,
+      sizeof (GstTensorRecordStreamHeader));
+  valid = gst_tensor_record_parse_stream_header (data,
+      sizeof (GstTensorRecordStreamHeader), &config);
+  gst_adapter_unmap (rdata->adapter);
+
+  if (!valid || config.info.num_tensors != 1 ||
+      gst_tensor_info_get_size (&config.info.info[0]) != rdata->frame_size) {
+    GST_ERROR_OBJECT (self, "The stream header is invalid or changed.");
+    return FALSE;
+  }
+
+  gst_adapter_flush (rdata->adapter, sizeof (GstTensorRecordStreamHeader));
+  rdata->header_parsed = TRUE;
+  return TRUE;
+}
+
+/**
+ * @brief Take a record from the adapter.
+ * @return the payload of a record (NULL if more data is required)
+ */
+static GstBuffer *
+record_conv_take (GstTensorConverter * self, record_conv_data * rdata,
+    gboolean * error)
+{
+  GstTensorRecordHeader header;
+  GstBuffer *payload;
+  gsize avail, header_size, record_size;
+  guint32 magic, size;
+
+  while (TRUE) {
+    avail = gst_adapter_available (rdata->adapter);
+    if (avail < sizeof (magic))
+      return NULL;
+
+    gst_adapter_copy (rdata->adapter, &magic, 0, sizeof (magic));
+    if (GUINT32_FROM_LE (magic) != NNS_TENSOR_RECORD_STREAM_MAGIC)
+      break;
+
+    /* stream header, at the start of the stream */
+    if (avail < sizeof (GstTensorRecordStreamHeader))
+      return NULL;
+
+    if (!record_conv_parse_header (self, rdata)) {
+      *error = TRUE;
+      return NULL;
+    }
+  }
+
+  header_size = gst_tensor_record_header_size (1);
+  if (avail < header_size)
+    return NULL;
+
+  gst_adapter_copy (rdata->adapter, &header, 0, sizeof (header));
+  gst_adapter_copy (rdata->adapter, &size, sizeof (header), sizeof (size));
+  size = GUINT32_FROM_LE (size);
+
+  if (!rdata->header_parsed ||
+      GUINT32_FROM_LE (header.magic) != NNS_TENSOR_RECORD_MAGIC ||
+      GUINT32_FROM_LE (header.num_tensors) != 1 || size != rdata->frame_size) {
+    *error = TRUE;
+    return NULL;
+  }
+
+  record_size = header_size + GST_ROUND_UP_8 (size);
+  if (avail < record_size)
+    return NULL;
+
+  /* payload (shares the memory if the record is in a single buffer) */
+  gst_adapter_flush (rdata->adapter, header_size);
+  payload = gst_adapter_take_buffer (rdata->adapter, size);
+  gst_adapter_flush (rdata->adapter, record_size - header_size - size);
+
+  GST_BUFFER_PTS (payload) = GUINT64_FROM_LE (header.pts);
+  GST_BUFFER_DTS (payload) = GUINT64_FROM_LE (header.dts);
+  GST_BUFFER_DURATION (payload) = GUINT64_FROM_LE (header.duration);
+
+  return payload;
+}
+
+/**
+ * @brief Take a record from the adapter with the recorded timestamps.
+ * @return the payload of a record (NULL if more data is required or the data is invalid)
+ */
+static GstBuffer *
+record_conv_take_record (GstTensorConverter * self, gsize * frame_size,
+    guint * frames_in)
+{
+  record_conv_data *rdata;
+  GstBuffer *payload;
+  gboolean error = FALSE;
+
+  rdata = record_conv_get_data (self);
+  payload = record_conv_take (self, rdata, &error);
+
+  if (error) {
+    /* drop invalid data and stop the pipeline */
+    gst_adapter_clear (rdata->adapter);
+    GST_ELEMENT_ERROR (self, STREAM, DECODE, (NULL),
+        ("Invalid header in the recorded tensor stream."));
+    *frame_size = 0;
+    *frames_in = 0;
+    return NULL;
+  }
+
+  *frame_size = rdata->frame_size;
+  *frames_in = (payload != NULL) ? 1 : 0;
+  return payload;
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static GstBuffer *
+record_conv_convert (GstTensorConverter * self, const GstBuffer * buf,
+    gsize * frame_size, guint * frames_in)
+{
+  record_conv_data *rdata;
+
+  rdata = record_conv_get_data (self);
+  gst_adapter_push (rdata->adapter, gst_buffer_ref ((GstBuffer *) buf));
+
+  /* push a record at once, the caller drains the next records in the adapter */
+  return record_conv_take_record (self, frame_size, frames_in);
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static GstBuffer *
+record_conv_drain (GstTensorConverter * self, gsize * frame_size,
+    guint * frames_in)
+{
+  return record_conv_take_record (self, frame_size, frames_in);
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static gboolean
+record_conv_get_caps (GstTensorConverter * self, const GstStructure * st,
+    GstTensorConfig * config)
+{
+  record_conv_data *rdata;
+  GstTensorsConfig tensors_config;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+
+  if (!gst_tensor_record_config_from_structure (&tensors_config, st) ||
+      !gst_tensors_config_validate (&tensors_config)) {
+    GST_ERROR_OBJECT (self, "Failed to get the tensor info from caps.");
+    return FALSE;
+  }
+
+  if (tensors_config.info.num_tensors != 1) {
+    GST_ERROR_OBJECT (self,
+        "The recorded stream has %u tensors, tensor_converter supports single tensor only.",
+        tensors_config.info.num_tensors);
+    return FALSE;
+  }
+
+  config->info = tensors_config.info.info[0];
+  config->rate_n = tensors_config.rate_n;
+  config->rate_d = tensors_config.rate_d;
+
+  /* new stream, reset the internal data */
+  rdata = record_conv_get_data (self);
+  gst_adapter_clear (rdata->adapter);
+  rdata->header_parsed = FALSE;
+  rdata->frame_size = gst_tensor_info_get_size (&config->info);
+
+  return TRUE;
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static gboolean
+record_conv_query_caps (GstTensorConverter * self,
+    const GstTensorConfig * config, GstStructure * st)
+{
+  GstTensorsConfig tensors_config;
+  GstCaps *caps;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+  g_return_val_if_fail (st != NULL, FALSE);
+
+  if (!gst_tensor_info_validate (&config->info))
+    return TRUE;
+
+  gst_tensors_config_init (&tensors_config);
+  tensors_config.info.num_tensors = 1;
+  tensors_config.info.info[0] = config->info;
+  tensors_config.rate_n = config->rate_n;
+  tensors_config.rate_d = config->rate_d;
+
+  /* narrow down the structure with the config of outgoing tensor */
+  caps = gst_tensor_record_caps_from_config (&tensors_config);
+  gst_structure_set_value (st, "num_tensors",
+      gst_structure_get_value (gst_caps_get_structure (caps, 0),
+          "num_tensors"));
+  gst_structure_set_value (st, "dimensions",
+      gst_structure_get_value (gst_caps_get_structure (caps, 0),
+          "dimensions"));
+  gst_structure_set_value (st, "types",
+      gst_structure_get_value (gst_caps_get_structure (caps, 0), "types"));
+  gst_caps_unref (caps);
+
+  return TRUE;
+}
+
+/** @brief Tensor-record tensor converter sub-plugin */
+static NNStreamerExternalConverter tensorRecord = {
+  .media_type_name = NNS_TENSOR_RECORD_MIMETYPE,
+  .convert = record_conv_convert,
+  .get_caps = record_conv_get_caps,
+  .query_caps = record_conv_query_caps,
+  .drain = record_conv_drain
+};
+
+/** @brief Initialize this object for tensor converter sub-plugin */
+void
+init_record_conv (void)
+{
+  registerExternalConverter (&tensorRecord);
+}
+
+/** @brief Destruct this object for tensor converter sub-plugin */
+void
+fini_record_conv (void)
+{
+  unregisterExternalConverter (tensorRecord.media_type_name);
+}
@@ -0,0 +1,912 @@
+/**
+ * GStreamer / NNStreamer tensor_converter subplugin, "text tokenizer"
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	tensor_converter_text_tokenizer.c
+ * @date	18 Oct 2020
+ * @brief	NNStreamer tensor-converter subplugin, "text tokenizer",
+ *              which converts text/x-raw to the input of BERT-style models (WordPiece).
+ *
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ * Select this sub-plugin with the property "mode" of tensor_converter.
+ *
+ * $ gst-launch-1.0 ... ! text/x-raw,format=utf8 ! \
+ *     tensor_converter mode=text_tokenizer option=vocab:/path/vocab.txt,seq_len:128 ! ...
+ *
+ * Options (comma-separated key:value):
+ * - vocab : the path of WordPiece vocabulary, a token in each line (line number is the id)
+ * - seq_len : the number of tokens in a tensor (default 128)
+ * - lower : convert to lower-case and strip the accents (default true)
+ * - pair : the text after the first tab is the second sentence (default false)
+ *
+ * The outgoing tensor is int32 [3][seq_len]:
+ * the token ids ([CLS] A [SEP] B [SEP] [PAD]...), the attention mask and the segment ids.
+ *
+ * The vocabulary is loaded once into a byte trie (sorted edges of each node
+ * in a flat array), so the longest-match of WordPiece is a single walk.
+ * The text is split with a byte class table, and the runs of word bytes
+ * (ASCII letters, digits and non-ASCII bytes) are scanned 8 bytes at a time.
+ * Spaces and punctuation are still classified byte by byte.
+ *
+ * The text with non-ASCII characters is normalized first, like BERT basic tokenizer:
+ * control characters are removed, Unicode spaces are replaced with a space,
+ * CJK characters and Unicode punctuation are split into single-character words,
+ * and the accents are stripped (NFD and removing non-spacing marks) if lower is true.
+ * The incoming text should be valid UTF-8, otherwise the buffer is rejected.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <glib.h>
+#include <nnstreamer_plugin_api.h>
+#include <nnstreamer_plugin_api_converter.h>
+
+void init_text_tokenizer (void) __attribute__ ((constructor));
+void fini_text_tokenizer (void) __attribute__ ((destructor));
+
+#define TOK_DEFAULT_SEQ_LEN (128)
+#define TOK_MAX_WORD_CHARS (100)
+#define TOK_NO_ID (-1)
+
+/**
+ * @brief Byte classes to split the text.
+ */
+typedef enum
+{
+  TOK_CLASS_WORD = 0,
+  TOK_CLASS_SPACE,
+  TOK_CLASS_PUNCT,
+  TOK_CLASS_CTRL,
+} tok_class;
+
+/**
+ * @brief Node of the vocabulary trie.
+ */
+typedef struct
+{
+  gint32 id; /**< token id, TOK_NO_ID if no token ends here */
+  guint32 first_edge; /**< index of the first edge (sorted by byte) */
+  guint32 num_edges; /**< the number of edges */
+} tok_node;
+
+/**
+ * @brief Edge of the vocabulary trie.
+ */
+typedef struct
+{
+  guint32 node; /**< index of the child node */
+  guint8 byte; /**< the byte of this edge */
+} tok_edge;
+
+/**
+ * @brief Options of text tokenizer.
+ */
+typedef struct
+{
+  gchar *vocab; /**< path of the vocabulary */
+  guint seq_len; /**< the number of tokens */
+  gboolean lower; /**< convert to lower-case */
+  gboolean pair; /**< sentence pair separated by tab */
+} tok_option;
+
+/**
+ * @brief Internal data of text tokenizer (per tensor_converter instance).
+ */
+typedef struct
+{
+  tok_option opt; /**< options */
+
+  gchar *vocab_path; /**< path of the loaded vocabulary */
+  tok_node *nodes; /**< trie nodes, the root is 0 */
+  tok_edge *edges; /**< trie edges */
+  guint32 cont_root; /**< node of the prefix "##", 0 if not exists */
+
+  gint32 cls_id; /**< id of [CLS] */
+  gint32 sep_id; /**< id of [SEP] */
+  gint32 unk_id; /**< id of [UNK] */
+  gint32 pad_id; /**< id of [PAD] */
+
+  guint8 *text; /**< work buffer (normalized text) */
+  gsize text_size; /**< size of work buffer */
+  GArray *tokens[2]; /**< token ids of the sentences */
+} tok_data;
+
+/**
+ * @brief Byte class table.
+ */
+static guint8 tok_class_table[256];
+
+/**
+ * @brief Lower-case table (ASCII).
+ */
+static guint8 tok_lower_table[256];
+
+G_DEFINE_QUARK (nnstreamer-converter-text-tokenizer, text_tokenizer);
+
+/**
+ * @brief Free the vocabulary trie.
+ */
+static void
+tok_clear_vocab (tok_data * tok)
+{
+  g_free (tok->vocab_path);
+  g_free (tok->nodes);
+  g_free (tok->edges);
+
+  tok->vocab_path = NULL;
+  tok->nodes = NULL;
+  tok->edges = NULL;
+  tok->cont_root = 0;
+}
+
+/**
+ * @brief Free the internal data.
+ */
+static void
+tok_free (gpointer data)
+{
+  tok_data *tok = data;
+
+  tok_clear_vocab (tok);
+  g_free (tok->opt.vocab);
+  g_free (tok->text);
+  g_array_free (tok->tokens[0], TRUE);
+  g_array_free (tok->tokens[1], TRUE);
+  g_free (tok);
+}
+
+/**
+ * @brief Get the internal data of given tensor_converter instance.
+ */
+static tok_data *
+tok_get_data (GstTensorConverter * self)
+{
+  tok_data *tok;
+
+  tok = g_object_get_qdata (G_OBJECT (self), text_tokenizer_quark ());
+  if (tok == NULL) {
+    tok = g_new0 (tok_data, 1);
+    tok->tokens[0] = g_array_new (FALSE, FALSE, sizeof (gint32));
+    tok->tokens[1] = g_array_new (FALSE, FALSE, sizeof (gint32));
+
+    g_object_set_qdata_full (G_OBJECT (self), text_tokenizer_quark (), tok,
+        tok_free);
+  }
+
+  return tok;
+}
+
+/**
+ * @brief Find the child node of given node with the byte.
+ * @return index of the child, 0 if not exists (the root is never a child)
+ */
+static inline guint32
+tok_trie_child (const tok_data * tok, guint32 node, guint8 byte)
+{
+  const tok_edge *e = tok->edges + tok->nodes[node].first_edge;
+  guint32 lo = 0, hi = tok->nodes[node].num_edges;
+
+  while (lo < hi) {
+    guint32 mid = (lo + hi) / 2;
+
+    if (e[mid].byte == byte)
+      return e[mid].node;
+
+    if (e[mid].byte < byte)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Find the node of given string from the node.
+ * @return index of the node, 0 if not exists
+ */
+static guint32
+tok_trie_walk (const tok_data * tok, guint32 node, const gchar * str)
+{
+  while (*str != '\0') {
+    node = tok_trie_child (tok, node, (guint8) * str++);
+    if (node == 0)
+      return 0;
+  }
+
+  return node;
+}
+
+/**
+ * @brief Get the id of the token.
+ */
+static gint32
+tok_trie_find (const tok_data * tok, const gchar * token)
+{
+  guint32 node = tok_trie_walk (tok, 0, token);
+
+  return (node > 0) ? tok->nodes[node].id : TOK_NO_ID;
+}
+
+/**
+ * @brief Node of the trie in building (children in a linked list).
+ */
+typedef struct
+{
+  gint32 id; /**< token id */
+  guint32 child; /**< the first child, 0 if no child */
+  guint32 sibling; /**< the next sibling, 0 if last */
+  guint8 byte; /**< the byte of the edge from parent */
+} tok_build_node;
+
+/**
+ * @brief Compare the edges with the byte.
+ */
+static gint
+tok_edge_compare (const void *a, const void *b)
+{
+  return (gint) ((const tok_edge *) a)->byte -
+      (gint) ((const tok_edge *) b)->byte;
+}
+
+/**
+ * @brief Load the vocabulary and build the trie.
+ */
+static gboolean
+tok_load_vocab (tok_data * tok, const gchar * path)
+{
+  GArray *build;
+  tok_build_node root = { TOK_NO_ID, 0, 0, 0 };
+  gchar *contents = NULL;
+  gsize length, pos, line_start;
+  gint32 id = 0;
+  guint32 i, num_edges;
+
+  if (!g_file_get_contents (path, &contents, &length, NULL)) {
+    GST_ERROR ("Failed to read the vocabulary %s.", path);
+    return FALSE;
+  }
+
+  tok_clear_vocab (tok);
+
+  build = g_array_new (FALSE, FALSE, sizeof (tok_build_node));
+  g_array_append_val (build, root);
+
+  /* a token in each line, the line number is the id */
+  for (pos = line_start = 0; pos <= length; pos++) {
+    gsize end, k;
+    guint32 node = 0;
+
+    if (pos < length && contents[pos] != '\n')
+      continue;
+
+    end = pos;
+    if (end > line_start && contents[end - 1] == '\r')
+      end--;
+
+    for (k = line_start; k < end; k++) {
+      guint8 byte = (guint8) contents[k];
+      tok_build_node *n = &g_array_index (build, tok_build_node, node);
+      guint32 c = n->child;
+
+      while (c != 0 && g_array_index (build, tok_build_node, c).byte != byte)
+        c = g_array_index (build, tok_build_node, c).sibling;
+
+      if (c == 0) {
+        tok_build_node child = { TOK_NO_ID, 0, n->child, byte };
+
+        c = build->len;
+        g_array_append_val (build, child);
+        g_array_index (build, tok_build_node, node).child = c;
+      }
+
+      node = c;
+    }
+
+    if (end > line_start || pos < length) {
+      /* the first one wins if duplicated */
+      if (node > 0 && g_array_index (build, tok_build_node, node).id < 0)
+        g_array_index (build, tok_build_node, node).id = id;
+      id++;
+    }
+
+    line_start = pos + 1;
+  }
+
+  g_free (contents);
+
+  /* flatten the trie, sorted edges of each node are contiguous */
+  tok->nodes = g_new0 (tok_node, build->len);
+  tok->edges = g_new0 (tok_edge, MAX (build->len, 1));
+
+  for (i = 0, num_edges = 0; i < build->len; i++) {
+    tok_build_node *n = &g_array_index (build, tok_build_node, i);
+    guint32 c;
+
+    tok->nodes[i].id = n->id;
+    tok->nodes[i].first_edge = num_edges;
+
+    for (c = n->child; c != 0;
+        c = g_array_index (build, tok_build_node, c).sibling) {
+      tok->edges[num_edges].node = c;
+      tok->edges[num_edges].byte = g_array_index (build, tok_build_node,
+          c).byte;
+      num_edges++;
+    }
+
+    tok->nodes[i].num_edges = num_edges - tok->nodes[i].first_edge;
+    qsort (tok->edges + tok->nodes[i].first_edge, tok->nodes[i].num_edges,
+        sizeof (tok_edge), tok_edge_compare);
+  }
+
+  g_array_free (build, TRUE);
+
+  tok->vocab_path = g_strdup (path);
+  tok->cont_root = tok_trie_walk (tok, 0, "##");
+
+  tok->cls_id = tok_trie_find (tok, "[CLS]");
+  tok->sep_id = tok_trie_find (tok, "[SEP]");
+  tok->unk_id = tok_trie_find (tok, "[UNK]");
+  tok->pad_id = tok_trie_find (tok, "[PAD]");
+
+  if (tok->cls_id < 0 || tok->sep_id < 0 || tok->unk_id < 0) {
+    GST_ERROR ("The vocabulary %s does not have [CLS], [SEP] or [UNK].", path);
+    tok_clear_vocab (tok);
+    return FALSE;
+  }
+
+  if (tok->pad_id < 0)
+    tok->pad_id = 0;
+
+  return TRUE;
+}
+
+/**
+ * @brief Parse the option string (comma-separated key:value).
+ */
+static gboolean
+tok_parse_option (const gchar * str, tok_option * opt)
+{
+  gchar **options;
+  guint i;
+  gboolean ret = TRUE;
+
+  g_free (opt->vocab);
+  memset (opt, 0, sizeof (tok_option));
+  opt->seq_len = TOK_DEFAULT_SEQ_LEN;
+  opt->lower = TRUE;
+
+  if (str == NULL || str[0] == '\0') {
+    GST_ERROR ("The option vocab is required.");
+    return FALSE;
+  }
+
+  options = g_strsplit (str, ",", -1);
+
+  for (i = 0; options[i] != NULL && ret; i++) {
+    gchar **kv = g_strsplit (options[i], ":", 2);
+
+    if (g_strv_length (kv) != 2) {
+      GST_ERROR ("Invalid option %s, should be key:value.", options[i]);
+      ret = FALSE;
+    } else {
+      const gchar *key = g_strstrip (kv[0]);
+      const gchar *val = g_strstrip (kv[1]);
+
+      if (g_ascii_strcasecmp (key, "vocab") == 0) {
+        g_free (opt->vocab);
+        opt->vocab = g_strdup (val);
+      } else if (g_ascii_strcasecmp (key, "seq_len") == 0) {
+        opt->seq_len = (guint) g_ascii_strtoull (val, NULL, 10);
+      } else if (g_ascii_strcasecmp (key, "lower") == 0) {
+        opt->lower = (g_ascii_strcasecmp (val, "true") == 0);
+      } else if (g_ascii_strcasecmp (key, "pair") == 0) {
+        opt->pair = (g_ascii_strcasecmp (val, "true") == 0);
+      } else {
+        GST_ERROR ("Unknown option %s.", key);
+        ret = FALSE;
+      }
+    }
+
+    g_strfreev (kv);
+  }
+
+  g_strfreev (options);
+
+  if (ret) {
+    if (opt->vocab == NULL || opt->vocab[0] == '\0') {
+      GST_ERROR ("The option vocab is required.");
+      ret = FALSE;
+    } else if (opt->seq_len < 3) {
+      GST_ERROR ("Invalid seq_len %u.", opt->seq_len);
+      ret = FALSE;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Get the number of leading word bytes (ASCII letters, digits and
+ * non-ASCII bytes, that is, TOK_CLASS_WORD of the class table), 8 bytes at a time.
+ */
+static inline gsize
+tok_scan_word (const guint8 * p, const guint8 * end)
+{
+  const guint64 ones = G_GUINT64_CONSTANT (0x0101010101010101);
+  const guint64 high = G_GUINT64_CONSTANT (0x8080808080808080);
+  const guint8 *start = p;
+
+  while (end - p >= 8) {
+    guint64 x, y, lower, upper, digit;
+
+    memcpy (&x, p, sizeof (x));
+
+    /* 7-bit value of each byte, the sums below do not carry to the next byte */
+    y = x & ~high;
+
+    /* the high bit of each byte is set if the byte is in the range */
+    lower = (y + ones * (128 - 'a')) & ~(y + ones * (127 - 'z'));
+    upper = (y + ones * (128 - 'A')) & ~(y + ones * (127 - 'Z'));
+    digit = (y + ones * (128 - '0')) & ~(y + ones * (127 - '9'));
+
+    if (((x | lower | upper | digit) & high) != high)
+      break;
+
+    p += 8;
+  }
+
+  return p - start;
+}
+
+/**
+ * @brief Check the text has ASCII characters only, 8 bytes at a time.
+ */
+static gboolean
+tok_is_ascii (const guint8 * p, gsize len)
+{
+  const guint64 high = G_GUINT64_CONSTANT (0x8080808080808080);
+  const guint8 *end = p + len;
+  guint64 x;
+
+  while (end - p >= 8) {
+    memcpy (&x, p, sizeof (x));
+    if (x & high)
+      return FALSE;
+    p += 8;
+  }
+
+  while (p < end) {
+    if (*p++ & 0x80)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Check the character is CJK ideograph (the ranges of BERT basic tokenizer).
+ */
+static gboolean
+tok_is_cjk (gunichar c)
+{
+  return ((c >= 0x4E00 && c <= 0x9FFF) || (c >= 0x3400 && c <= 0x4DBF) ||
+      (c >= 0x20000 && c <= 0x2A6DF) || (c >= 0x2A700 && c <= 0x2B73F) ||
+      (c >= 0x2B740 && c <= 0x2B81F) || (c >= 0x2B820 && c <= 0x2CEAF) ||
+      (c >= 0xF900 && c <= 0xFAFF) || (c >= 0x2F800 && c <= 0x2FA1F));
+}
+
+/**
+ * @brief Check the non-ASCII character is punctuation (Unicode category P).
+ */
+static gboolean
+tok_is_unicode_punct (gunichar c)
+{
+  switch (g_unichar_type (c)) {
+    case G_UNICODE_CONNECT_PUNCTUATION:
+    case G_UNICODE_DASH_PUNCTUATION:
+    case G_UNICODE_CLOSE_PUNCTUATION:
+    case G_UNICODE_FINAL_PUNCTUATION:
+    case G_UNICODE_INITIAL_PUNCTUATION:
+    case G_UNICODE_OTHER_PUNCTUATION:
+    case G_UNICODE_OPEN_PUNCTUATION:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/**
+ * @brief Normalize the text with non-ASCII characters (valid UTF-8) into the work buffer.
+ * The ASCII characters are passed to the byte class table of the tokenizer as they are.
+ * @return the length of the normalized text
+ */
+static gsize
+tok_normalize_unicode (tok_data * tok, const gchar * str, gsize len)
+{
+  GString *out;
+  gchar *lower = NULL, *nfd = NULL;
+  const gchar *p, *end;
+  gunichar c;
+
+  if (tok->opt.lower) {
+    /* lower-case, then decompose to strip the accents */
+    lower = g_utf8_strdown (str, len);
+    nfd = g_utf8_normalize (lower, -1, G_NORMALIZE_NFD);
+    g_free (lower);
+
+    p = nfd;
+    end = nfd + strlen (nfd);
+  } else {
+    p = str;
+    end = str + len;
+  }
+
+  out = g_string_sized_new (len + len / 2);
+
+  for (; p < end; p = g_utf8_next_char (p)) {
+    c = g_utf8_get_char (p);
+
+    if (c < 0x80) {
+      g_string_append_c (out, (gchar) c);
+      continue;
+    }
+
+    switch (g_unichar_type (c)) {
+      case G_UNICODE_CONTROL:
+      case G_UNICODE_FORMAT:
+        continue;
+      case G_UNICODE_NON_SPACING_MARK:
+        if (tok->opt.lower)
+          continue;
+        break;
+      default:
+        break;
+    }
+
+    if (c == 0xFFFD)
+      continue;
+
+    if (g_unichar_isspace (c)) {
+      g_string_append_c (out, ' ');
+    } else if (tok_is_cjk (c) || tok_is_unicode_punct (c)) {
+      /* a word of single character */
+      g_string_append_c (out, ' ');
+      g_string_append_unichar (out, c);
+      g_string_append_c (out, ' ');
+    } else {
+      g_string_append_unichar (out, c);
+    }
+  }
+
+  g_free (nfd);
+
+  if (tok->text_size < out->len) {
+    tok->text = g_realloc (tok->text, out->len);
+    tok->text_size = out->len;
+  }
+
+  len = out->len;
+  memcpy (tok->text, out->str, len);
+  g_string_free (out, TRUE);
+
+  return len;
+}
+
+/**
+ * @brief Split a word into WordPiece tokens (greedy longest-match first).
+ */
+static void
+tok_wordpiece (tok_data * tok, const guint8 * word, gsize len, GArray * out)
+{
+  guint added = 0;
+  gsize start = 0;
+
+  /* count the characters only if the word is long, a character has 1 byte at least */
+  if (len > TOK_MAX_WORD_CHARS &&
+      g_utf8_strlen ((const gchar *) word, len) > TOK_MAX_WORD_CHARS) {
+    g_array_append_val (out, tok->unk_id);
+    return;
+  }
+
+  while (start < len) {
+    guint32 node = (start == 0) ? 0 : tok->cont_root;
+    gint32 match = TOK_NO_ID;
+    gsize k, match_end = start;
+
+    if (start > 0 && node == 0)
+      break;
+
+    for (k = start; k < len; k++) {
+      node = tok_trie_child (tok, node, word[k]);
+      if (node == 0)
+        break;
+
+      if (tok->nodes[node].id >= 0) {
+        match = tok->nodes[node].id;
+        match_end = k + 1;
+      }
+    }
+
+    if (match < 0)
+      break;
+
+    g_array_append_val (out, match);
+    added++;
+    start = match_end;
+  }
+
+  if (start < len) {
+    /* the word cannot be tokenized */
+    g_array_set_size (out, out->len - added);
+    g_array_append_val (out, tok->unk_id);
+  }
+}
+
+/**
+ * @brief Split the text into words and tokenize.
+ */
+static void
+tok_tokenize (tok_data * tok, const guint8 * text, gsize len, GArray * out)
+{
+  const guint8 *end = text + len;
+  const guint8 *p = text;
+
+  while (p < end) {
+    const guint8 *word;
+
+    switch (tok_class_table[*p]) {
+      case TOK_CLASS_SPACE:
+      case TOK_CLASS_CTRL:
+        p++;
+        break;
+      case TOK_CLASS_PUNCT:
+        tok_wordpiece (tok, p, 1, out);
+        p++;
+        break;
+      default:
+        word = p;
+        p += tok_scan_word (p, end);
+        while (p < end && tok_class_table[*p] == TOK_CLASS_WORD)
+          p++;
+
+        tok_wordpiece (tok, word, p - word, out);
+        break;
+    }
+  }
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static GstBuffer *
+tok_convert (GstTensorConverter * self, const GstBuffer * buf,
+    gsize * frame_size, guint * frames_in)
+{
+  tok_data *tok;
+  GstBuffer *inbuf = (GstBuffer *) buf;
+  GstBuffer *outbuf;
+  GstMemory *mem;
+  GstMapInfo info, out_info;
+  gint32 *ids, *mask, *segment;
+  guint8 *second;
+  gsize len, k;
+  guint seq_len, budget, len_a, len_b, n, i;
+
+  tok = tok_get_data (self);
+  g_assert (tok->nodes != NULL);
+
+  seq_len = tok->opt.seq_len;
+  *frame_size = sizeof (gint32) * seq_len * 3;
+  *frames_in = 1;
+
+  if (!gst_buffer_map (inbuf, &info, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Failed to map the incoming buffer.");
+    *frame_size = 0;
+    return NULL;
+  }
+
+  /* normalize the text (null-terminated string or whole buffer) */
+  len = info.size;
+  second = memchr (info.data, '\0', len);
+  if (second)
+    len = second - info.data;
+
+  if (!tok_is_ascii (info.data, len)) {
+    if (!g_utf8_validate ((const gchar *) info.data, len, NULL)) {
+      GST_ERROR_OBJECT (self, "The incoming text is not valid UTF-8.");
+      gst_buffer_unmap (inbuf, &info);
+      *frame_size = 0;
+      return NULL;
+    }
+
+    len = tok_normalize_unicode (tok, (const gchar *) info.data, len);
+  } else {
+    if (tok->text_size < len) {
+      tok->text = g_realloc (tok->text, len);
+      tok->text_size = len;
+    }
+
+    if (tok->opt.lower) {
+      for (k = 0; k < len; k++)
+        tok->text[k] = tok_lower_table[info.data[k]];
+    } else {
+      memcpy (tok->text, info.data, len);
+    }
+  }
+
+  gst_buffer_unmap (inbuf, &info);
+
+  second = tok->opt.pair ? memchr (tok->text, '\t', len) : NULL;
+
+  g_array_set_size (tok->tokens[0], 0);
+  g_array_set_size (tok->tokens[1], 0);
+
+  if (second) {
+    tok_tokenize (tok, tok->text, second - tok->text, tok->tokens[0]);
+    tok_tokenize (tok, second + 1, len - (second - tok->text) - 1,
+        tok->tokens[1]);
+  } else {
+    tok_tokenize (tok, tok->text, len, tok->tokens[0]);
+  }
+
+  /* truncate the longer sentence first */
+  budget = seq_len - (second ? 3 : 2);
+  len_a = tok->tokens[0]->len;
+  len_b = tok->tokens[1]->len;
+  while (len_a + len_b > budget) {
+    if (len_a > len_b)
+      len_a--;
+    else
+      len_b--;
+  }
+
+  mem = gst_allocator_alloc (NULL, *frame_size, NULL);
+  if (!gst_memory_map (mem, &out_info, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (self, "Failed to map the outgoing memory.");
+    gst_memory_unref (mem);
+    *frame_size = 0;
+    return NULL;
+  }
+
+  ids = (gint32 *) out_info.data;
+  mask = ids + seq_len;
+  segment = mask + seq_len;
+
+  n = 0;
+  ids[n++] = tok->cls_id;
+  memcpy (ids + n, tok->tokens[0]->data, sizeof (gint32) * len_a);
+  n += len_a;
+  ids[n++] = tok->sep_id;
+  i = n;
+
+  if (second) {
+    memcpy (ids + n, tok->tokens[1]->data, sizeof (gint32) * len_b);
+    n += len_b;
+    ids[n++] = tok->sep_id;
+  }
+
+  for (k = n; k < seq_len; k++)
+    ids[k] = tok->pad_id;
+
+  for (k = 0; k < seq_len; k++) {
+    mask[k] = (k < n) ? 1 : 0;
+    segment[k] = (k >= i && k < n) ? 1 : 0;
+  }
+
+  gst_memory_unmap (mem, &out_info);
+
+  outbuf = gst_buffer_new ();
+  gst_buffer_append_memory (outbuf, mem);
+  gst_buffer_copy_into (outbuf, inbuf, GST_BUFFER_COPY_METADATA, 0, -1);
+
+  return outbuf;
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static gboolean
+tok_get_caps (GstTensorConverter * self, const GstStructure * st,
+    GstTensorConfig * config)
+{
+  tok_data *tok;
+  gchar *option = NULL;
+  gboolean ret;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+
+  if (!gst_structure_has_name (st, "text/x-raw")) {
+    GST_ERROR_OBJECT (self, "text_tokenizer supports text/x-raw only.");
+    return FALSE;
+  }
+
+  tok = tok_get_data (self);
+
+  g_object_get (self, "option", &option, NULL);
+  ret = tok_parse_option (option, &tok->opt);
+  g_free (option);
+
+  if (!ret)
+    return FALSE;
+
+  /* load the vocabulary once */
+  if (g_strcmp0 (tok->vocab_path, tok->opt.vocab) != 0 &&
+      !tok_load_vocab (tok, tok->opt.vocab)) {
+    return FALSE;
+  }
+
+  gst_tensor_config_init (config);
+  config->info.type = _NNS_INT32;
+  config->info.dimension[0] = tok->opt.seq_len;
+  config->info.dimension[1] = 3;
+  config->info.dimension[2] = 1;
+  config->info.dimension[3] = 1;
+
+  if (!gst_structure_get_fraction (st, "framerate", &config->rate_n,
+          &config->rate_d)) {
+    config->rate_n = 0;
+    config->rate_d = 1;
+  }
+
+  return TRUE;
+}
+
+/** @brief tensor converter plugin's NNStreamerExternalConverter callback */
+static gboolean
+tok_query_caps (GstTensorConverter * self, const GstTensorConfig * config,
+    GstStructure * st)
+{
+  /* nothing to narrow down, any utf8 text */
+  return TRUE;
+}
+
+static gchar converter_subplugin_text_tokenizer[] = "text_tokenizer";
+
+/** @brief Text tokenizer tensor converter sub-plugin */
+static NNStreamerExternalConverter textTokenizer = {
+  .media_type_name = converter_subplugin_text_tokenizer,
+  .convert = tok_convert,
+  .get_caps = tok_get_caps,
+  .query_caps = tok_query_caps
+};
+
+/** @brief Initialize this object for tensor converter sub-plugin */
+void
+init_text_tokenizer (void)
+{
+  guint c;
+
+  for (c = 0; c < 256; c++) {
+    tok_lower_table[c] = (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+      tok_class_table[c] = TOK_CLASS_SPACE;
+    else if (c < 0x20 || c == 0x7f)
+      tok_class_table[c] = TOK_CLASS_CTRL;
+    else if (c < 0x80 && g_ascii_ispunct (c))
+      tok_class_table[c] = TOK_CLASS_PUNCT;
+    else
+      tok_class_table[c] = TOK_CLASS_WORD;
+  }
+
+  registerExternalConverter (&textTokenizer);
+}
+
+/** @brief Destruct this object for tensor converter sub-plugin */
+void
+fini_text_tokenizer (void)
+{
+  unregisterExternalConverter (textTokenizer.media_type_name);
+}
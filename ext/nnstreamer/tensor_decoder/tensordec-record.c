@@ -0,0 +1,188 @@
+/**
+ * GStreamer / NNStreamer tensor_decoder subplugin, "tensor record"
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	tensordec-record.c
+ * @date	18 Oct 2020
+ * @brief	NNStreamer tensor-decoder subplugin, "tensor record",
+ *              which writes tensors into self-describing binary stream.
+ *
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ * The outgoing stream (other/tensor-record) can be saved with filesink,
+ * and replayed with the converter sub-plugin "tensor_record".
+ *
+ * $ gst-launch-1.0 ... ! tensor_decoder mode=tensor_record ! filesink location=session.nnsr
+ * $ gst-launch-1.0 filesrc location=session.nnsr ! typefind ! tensor_converter ! tensor_filter ...
+ */
+
+#include <string.h>
+#include <glib.h>
+#include <nnstreamer_plugin_api_decoder.h>
+#include <tensor_record.h>
+
+void init_record (void) __attribute__ ((constructor));
+void fini_record (void) __attribute__ ((destructor));
+
+/**
+ * @brief Internal data of tensor-record decoder.
+ */
+typedef struct
+{
+  gboolean header_written; /**< TRUE if the stream header is written */
+  GstTensorsConfig config; /**< tensors config in the stream header */
+} record_data;
+
+/** @brief tensordec-plugin's GstTensorDecoderDef callback */
+static int
+record_init (void **pdata)
+{
+  *pdata = g_new0 (record_data, 1);
+  return TRUE;
+}
+
+/** @brief tensordec-plugin's GstTensorDecoderDef callback */
+static void
+record_exit (void **pdata)
+{
+  g_free (*pdata);
+  *pdata = NULL;
+}
+
+/** @brief tensordec-plugin's GstTensorDecoderDef callback */
+static int
+record_setOption (void **pdata, int opNum, const char *param)
+{
+  /* We do not accept anything. */
+  return TRUE;
+}
+
+/** @brief tensordec-plugin's GstTensorDecoderDef callback */
+static GstCaps *
+record_getOutCaps (void **pdata, const GstTensorsConfig * config)
+{
+  g_return_val_if_fail (config != NULL, NULL);
+
+  return gst_tensor_record_caps_from_config (config);
+}
+
+/** @brief tensordec-plugin's GstTensorDecoderDef callback */
+static GstFlowReturn
+record_decode (void **pdata, const GstTensorsConfig * config,
+    const GstTensorMemory * input, GstBuffer * outbuf)
+{
+  record_data *rdata = *pdata;
+  GstTensorRecordHeader *header;
+  GstMemory *out_mem;
+  GstMapInfo out_info;
+  gsize offset, header_size, size;
+  guint32 *sizes;
+  guint i, num;
+
+  g_assert (outbuf);
+  g_assert (rdata);
+
+  num = config->info.num_tensors;
+  header_size = gst_tensor_record_header_size (num);
+
+  /* write the stream header again for a new stream (discont) or new config */
+  if (GST_BUFFER_FLAG_IS_SET (outbuf, GST_BUFFER_FLAG_DISCONT) ||
+      !gst_tensors_config_is_equal (&rdata->config, config))
+    rdata->header_written = FALSE;
+
+  /* stream header, record header, payloads (each padded to 8 bytes) */
+  size = rdata->header_written ? 0 : sizeof (GstTensorRecordStreamHeader);
+  size += header_size;
+  for (i = 0; i < num; i++)
+    size += GST_ROUND_UP_8 (input[i].size);
+
+  out_mem = gst_allocator_alloc (NULL, size, NULL);
+  if (!gst_memory_map (out_mem, &out_info, GST_MAP_WRITE)) {
+    GST_ERROR ("Cannot map output memory / tensordec-record.\n");
+    gst_memory_unref (out_mem);
+    return GST_FLOW_ERROR;
+  }
+
+  memset (out_info.data, 0, size);
+  offset = 0;
+
+  if (!rdata->header_written) {
+    if (!gst_tensor_record_set_stream_header ((GstTensorRecordStreamHeader *)
+            out_info.data, config)) {
+      GST_ERROR ("Invalid tensor config / tensordec-record.\n");
+      gst_memory_unmap (out_mem, &out_info);
+      gst_memory_unref (out_mem);
+      return GST_FLOW_ERROR;
+    }
+
+    offset += sizeof (GstTensorRecordStreamHeader);
+    rdata->config = *config;
+    rdata->header_written = TRUE;
+  }
+
+  /* outbuf has the timestamps of incoming buffer */
+  header = (GstTensorRecordHeader *) (out_info.data + offset);
+  header->magic = GUINT32_TO_LE (NNS_TENSOR_RECORD_MAGIC);
+  header->num_tensors = GUINT32_TO_LE (num);
+  header->pts = GUINT64_TO_LE (GST_BUFFER_PTS (outbuf));
+  header->dts = GUINT64_TO_LE (GST_BUFFER_DTS (outbuf));
+  header->duration = GUINT64_TO_LE (GST_BUFFER_DURATION (outbuf));
+
+  sizes = (guint32 *) (header + 1);
+  offset += header_size;
+
+  for (i = 0; i < num; i++) {
+    sizes[i] = GUINT32_TO_LE ((guint32) input[i].size);
+
+    memcpy (out_info.data + offset, input[i].data, input[i].size);
+    offset += GST_ROUND_UP_8 (input[i].size);
+  }
+
+  gst_memory_unmap (out_mem, &out_info);
+
+  if (gst_buffer_get_size (outbuf) > 0)
+    gst_buffer_remove_all_memory (outbuf);
+  gst_buffer_append_memory (outbuf, out_mem);
+
+  return GST_FLOW_OK;
+}
+
+static gchar decoder_subplugin_tensor_record[] = "tensor_record";
+
+/** @brief Tensor-record tensordec-plugin GstTensorDecoderDef instance */
+static GstTensorDecoderDef tensorRecord = {
+  .modename = decoder_subplugin_tensor_record,
+  .init = record_init,
+  .exit = record_exit,
+  .setOption = record_setOption,
+  .getOutCaps = record_getOutCaps,
+  .decode = record_decode
+};
+
+/** @brief Initialize this object for tensordec-plugin */
+void
+init_record (void)
+{
+  nnstreamer_decoder_probe (&tensorRecord);
+}
+
+/** @brief Destruct this object for tensordec-plugin */
+void
+fini_record (void)
+{
+  nnstreamer_decoder_exit (tensorRecord.modename);
+}
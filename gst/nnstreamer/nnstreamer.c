@@ -49,9 +49,11 @@
 
 #include "tensor_aggregator/tensor_aggregator.h"
 #include "tensor_converter/tensor_converter.h"
+#include "tensor_crop/gsttensorcrop.h"
 #include "tensor_decoder/tensordec.h"
 #include "tensor_demux/gsttensordemux.h"
 #include "tensor_filter/tensor_filter.h"
+#include "tensor_if/gsttensorif.h"
 #include "tensor_merge/gsttensormerge.h"
 #include "tensor_mux/gsttensormux.h"
 #include "tensor_repo/tensor_reposink.h"
@@ -62,6 +64,7 @@
 #endif /* __gnu_linux__ && !__ANDROID__ */
 #include "tensor_split/gsttensorsplit.h"
 #include "tensor_transform/tensor_transform.h"
+#include "tensor_record.h"
 
 #define NNSTREAMER_INIT(plugin,name,type) \
   do { \
@@ -79,9 +82,11 @@ gst_nnstreamer_init (GstPlugin * plugin)
 {
   NNSTREAMER_INIT (plugin, aggregator, AGGREGATOR);
   NNSTREAMER_INIT (plugin, converter, CONVERTER);
+  NNSTREAMER_INIT (plugin, crop, CROP);
   NNSTREAMER_INIT (plugin, decoder, DECODER);
   NNSTREAMER_INIT (plugin, demux, DEMUX);
   NNSTREAMER_INIT (plugin, filter, FILTER);
+  NNSTREAMER_INIT (plugin, if, IF);
   NNSTREAMER_INIT (plugin, merge, MERGE);
   NNSTREAMER_INIT (plugin, mux, MUX);
   NNSTREAMER_INIT (plugin, reposink, REPOSINK);
@@ -92,6 +97,12 @@ gst_nnstreamer_init (GstPlugin * plugin)
 #if defined(__gnu_linux__) && !defined(__ANDROID__)
   NNSTREAMER_INIT (plugin, src_iio, SRC_IIO);
 #endif /* __gnu_linux__ && !__ANDROID__ */
+
+  /* type-finder for the recorded tensor stream (other/tensor-record) */
+  if (!gst_tensor_record_register_typefind (plugin)) {
+    GST_ERROR ("Failed to register the type-finder of tensor record");
+    return FALSE;
+  }
   return TRUE;
 }
 
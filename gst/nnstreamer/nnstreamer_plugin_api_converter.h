@@ -35,11 +35,19 @@ extern "C" {
 * External Converters                          *
 ************************************************/
 
+typedef struct _GstTensorConverter GstTensorConverter;
+typedef struct _NNStreamerExternalConverter NNStreamerExternalConverter;
+
 /**
  * @brief Converter's subplugin implementation.
  */
 struct _NNStreamerExternalConverter {
   const char *media_type_name;
+      /**< The media type (caps name) to be handled, or the name of sub-plugin
+       * to be selected with the property "mode" of tensor_converter.
+       * With "mode", the sub-plugin handles any incoming media instead of the
+       * built-in conversion and may read the property "option" of given instance.
+       */
 
   /** 1. chain func, data handling. */
   GstBuffer * (*convert) (GstTensorConverter * self,
@@ -47,10 +55,11 @@ struct _NNStreamerExternalConverter {
       /**< Convert the given input stream to tensor/tensors stream.
        * @param[in/out] self A pointer designating "this".
        * @param[in] buf The input stream buffer
-       * @param[out] frame_size The size of each frame (output buffer)
+       * @param[out] frame_size The size of each frame (output buffer). Set 0 with NULL return if the data is invalid, then the caller returns GST_FLOW_ERROR.
        * @param[out] frames_in The number of frames in the given input buffer.
        * @retval Return inbuf if the data is to be kept untouched.
-       * @retval Retrun a new GstBuf if the data is to be modified.
+       * @retval Retrun a new GstBuf if the data is to be modified. The caller unrefs the given buffer.
+       * @retval Return NULL if more data is required (e.g., the frame is split into multiple buffers). The caller unrefs the given buffer, so the sub-plugin should keep its own reference to pending data.
        */
 
   /** 2. parse_caps (type conv, input(media) to output(tensor)) */
@@ -69,6 +78,19 @@ struct _NNStreamerExternalConverter {
        * @param[in] config The config of output tensor/tensors
        * @param[in/out] st The gstcap of input to be filtered with config.
        */
+
+  /** 4. drain pending frames (optional) */
+  GstBuffer * (*drain) (GstTensorConverter * self, gsize * frame_size,
+      guint * frames_in);
+      /**< Take the next pending frames of the sub-plugin. Set NULL if the sub-plugin returns all frames with convert().
+       * If this is set, the caller calls this after pushing the buffer of convert(), until NULL is returned.
+       * A sub-plugin may return the frames of an input buffer one by one with this, e.g., to keep the timestamps of each frame.
+       * @param[in/out] self A pointer designating "this".
+       * @param[out] frame_size The size of each frame (output buffer). Set 0 with NULL return if the data is invalid, then the caller returns GST_FLOW_ERROR.
+       * @param[out] frames_in The number of frames in the returned buffer.
+       * @retval Return a new GstBuf of the pending frames.
+       * @retval Return NULL if there is no pending frame.
+       */
 };
 
 
@@ -46,6 +46,15 @@ static GHashTable *subplugins[NNS_SUBPLUGIN_END] = { 0 };
 /** @brief Protects handles and subplugins */
 G_LOCK_DEFINE_STATIC (splock);
 
+/** @brief Serializes the loading of all sub-plugin libraries */
+G_LOCK_DEFINE_STATIC (loadlock);
+
+/**
+ * @brief The number of sub-plugins registered by the library being loaded in this thread (plus 1, NULL if not loading).
+ * The init function of a library is called in the thread which opens it.
+ */
+static GPrivate sp_loading = G_PRIVATE_INIT (NULL);
+
 /** @brief Private function for g_hash_table data destructor, GDestroyNotify */
 static void
 _spdata_destroy (gpointer _data)
@@ -124,6 +133,53 @@ _search_subplugin (subpluginType type, const gchar * name, const gchar * path)
   return spdata;
 }
 
+/**
+ * @brief Internal function to load sub-plugin library.
+ * @note The name of registered sub-plugin may be different from the file name. (e.g., media type of converter)
+ */
+static gboolean
+_load_subplugin (subpluginType type, const gchar * name, const gchar * path)
+{
+  GModule *module;
+  guint registered;
+
+  g_return_val_if_fail (name != NULL, FALSE);
+  g_return_val_if_fail (path != NULL, FALSE);
+
+  /* make sure the hash table is ready */
+  _get_subplugin_data (type, name);
+
+  /* count the sub-plugins registered by this library only */
+  g_private_set (&sp_loading, GUINT_TO_POINTER (1));
+  module = g_module_open (path, 0);
+  registered = GPOINTER_TO_UINT (g_private_get (&sp_loading)) - 1;
+  g_private_set (&sp_loading, NULL);
+
+  /* If this is a correct subplugin, it will register itself */
+  if (module == NULL) {
+    g_critical ("Cannot open %s(%s) with error %s.", name, path,
+        g_module_error ());
+    return FALSE;
+  }
+
+  if (registered > 0) {
+    G_LOCK (splock);
+    g_ptr_array_add (handles, (gpointer) module);
+    G_UNLOCK (splock);
+    module = NULL;
+  }
+
+  if (module) {
+    g_critical
+        ("nnstreamer_subplugin of %s(%s) is broken. It does not call register_subplugin with its init function.",
+        name, path);
+    g_module_close (module);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /** @brief Public function defined in the header */
 const void *
 get_subplugin (subpluginType type, const char *name)
@@ -132,6 +188,7 @@ get_subplugin (subpluginType type, const char *name)
 
   g_return_val_if_fail (name, NULL);
 
+  G_LOCK (loadlock);
   if (searchAlgorithm[type] == NNS_SEARCH_GETALL) {
     nnsconf_type_path conf_type = (nnsconf_type_path) type;
     subplugin_info_s info;
@@ -139,11 +196,12 @@ get_subplugin (subpluginType type, const char *name)
     guint ret = nnsconf_get_subplugin_info (conf_type, &info);
 
     for (i = 0; i < ret; i++) {
-      _search_subplugin (type, info.names[i], info.paths[i]);
+      _load_subplugin (type, info.names[i], info.paths[i]);
     }
 
     searchAlgorithm[type] = NNS_SEARCH_NO_OP;
   }
+  G_UNLOCK (loadlock);
 
   spdata = _get_subplugin_data (type, name);
   if (spdata == NULL && searchAlgorithm[type] == NNS_SEARCH_FILENAME) {
@@ -207,6 +265,12 @@ register_subplugin (subpluginType type, const char *name, const void *data)
   ret = g_hash_table_insert (subplugins[type], g_strdup (name), spdata);
   G_UNLOCK (splock);
 
+  /* registered while loading the library in this thread */
+  if (g_private_get (&sp_loading) != NULL) {
+    g_private_set (&sp_loading,
+        GUINT_TO_POINTER (GPOINTER_TO_UINT (g_private_get (&sp_loading)) + 1));
+  }
+
   return ret;
 }
 
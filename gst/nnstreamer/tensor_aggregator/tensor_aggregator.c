@@ -63,10 +63,12 @@
 #define silent_debug_config(c,msg) do { \
   if (DBG) { \
     if (c) { \
-      gchar *dim_str; \
-      dim_str = gst_tensor_get_dimension_string ((c)->info.dimension); \
-      GST_DEBUG_OBJECT (self, msg " type=%d dim=%s rate=%d/%d", (c)->info.type, dim_str, (c)->rate_n, (c)->rate_d); \
+      gchar *dim_str, *type_str; \
+      dim_str = gst_tensors_info_get_dimensions_string (&(c)->info); \
+      type_str = gst_tensors_info_get_types_string (&(c)->info); \
+      GST_DEBUG_OBJECT (self, msg " num=%u type=%s dim=%s rate=%d/%d", (c)->info.num_tensors, type_str, dim_str, (c)->rate_n, (c)->rate_d); \
       g_free (dim_str); \
+      g_free (type_str); \
     } \
   } \
 } while (0)
@@ -85,6 +87,8 @@ enum
   PROP_FRAMES_FLUSH,
   PROP_FRAMES_DIMENSION,
   PROP_CONCAT,
+  PROP_RING_BUFFER,
+  PROP_COPIED_BYTES,
   PROP_SILENT
 };
 
@@ -118,13 +122,18 @@ enum
  */
 #define DEFAULT_CONCAT TRUE
 
+/**
+ * @brief Flag to aggregate the frames in the ring buffer.
+ */
+#define DEFAULT_RING_BUFFER FALSE
+
 /**
  * @brief Template for sink pad.
  */
 static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
     GST_PAD_ALWAYS,
-    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT));
+    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT "; " GST_TENSORS_CAP_DEFAULT));
 
 /**
  * @brief Template for src pad.
@@ -132,7 +141,7 @@ static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
 static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
     GST_PAD_ALWAYS,
-    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT));
+    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT "; " GST_TENSORS_CAP_DEFAULT));
 
 #define gst_tensor_aggregator_parent_class parent_class
 G_DEFINE_TYPE (GstTensorAggregator, gst_tensor_aggregator, GST_TYPE_ELEMENT);
@@ -156,8 +165,16 @@ gst_tensor_aggregator_change_state (GstElement * element,
     GstStateChange transition);
 
 static void gst_tensor_aggregator_reset (GstTensorAggregator * self);
+static void gst_tensor_aggregator_write_frames (GstTensorAggregator * self,
+    guint8 * dest, const guint8 * base, gsize stride, guint head,
+    const GstTensorInfo * info);
+static void gst_tensor_aggregator_clear_ring (GstTensorAggregator * self);
+static GstFlowReturn gst_tensor_aggregator_ring_chain (GstTensorAggregator *
+    self, GstBuffer * buf);
 static GstCaps *gst_tensor_aggregator_query_caps (GstTensorAggregator * self,
     GstPad * pad, GstCaps * filter);
+static GstCaps *gst_tensor_aggregator_get_caps (GstTensorAggregator * self,
+    const GstTensorsConfig * config);
 static gboolean gst_tensor_aggregator_parse_caps (GstTensorAggregator * self,
     const GstCaps * caps);
 
@@ -238,6 +255,29 @@ gst_tensor_aggregator_class_init (GstTensorAggregatorClass * klass)
       g_param_spec_boolean ("concat", "Concat", "Concatenate output buffer",
           DEFAULT_CONCAT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorAggregator::ring-buffer:
+   *
+   * The flag to aggregate the frames in the ring buffer.
+   * The incoming frames are copied once into the ring buffer (frames-out frames), and each outgoing buffer is written
+   * with a single copy from the ring buffer (concatenated with frames-dim if needed), instead of merging and
+   * re-arranging the frames in GstAdapter for each outgoing buffer.
+   */
+  g_object_class_install_property (object_class, PROP_RING_BUFFER,
+      g_param_spec_boolean ("ring-buffer", "Ring buffer",
+          "Aggregate the frames in the ring buffer", DEFAULT_RING_BUFFER,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorAggregator::copied-bytes:
+   *
+   * The number of bytes copied in this element since the element started (read-only).
+   */
+  g_object_class_install_property (object_class, PROP_COPIED_BYTES,
+      g_param_spec_uint64 ("copied-bytes", "Copied bytes",
+          "The number of bytes copied in this element", 0, G_MAXUINT64, 0,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstTensorAggregator::silent:
    *
@@ -291,6 +331,13 @@ gst_tensor_aggregator_init (GstTensorAggregator * self)
   self->frames_flush = DEFAULT_FRAMES_FLUSH;
   self->frames_dim = DEFAULT_FRAMES_DIMENSION;
   self->concat = DEFAULT_CONCAT;
+  self->ring_buffer = DEFAULT_RING_BUFFER;
+
+  self->ring = NULL;
+  self->ring_pts = NULL;
+  self->ring_dts = NULL;
+  self->ring_frame_size = 0;
+  self->pool = NULL;
 
   self->adapter = gst_adapter_new ();
   gst_tensor_aggregator_reset (self);
@@ -313,6 +360,8 @@ gst_tensor_aggregator_finalize (GObject * object)
     self->adapter = NULL;
   }
 
+  gst_tensor_aggregator_clear_ring (self);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -343,6 +392,9 @@ gst_tensor_aggregator_set_property (GObject * object, guint prop_id,
     case PROP_CONCAT:
       self->concat = g_value_get_boolean (value);
       break;
+    case PROP_RING_BUFFER:
+      self->ring_buffer = g_value_get_boolean (value);
+      break;
     case PROP_SILENT:
       self->silent = g_value_get_boolean (value);
       break;
@@ -379,6 +431,15 @@ gst_tensor_aggregator_get_property (GObject * object, guint prop_id,
     case PROP_CONCAT:
       g_value_set_boolean (value, self->concat);
       break;
+    case PROP_RING_BUFFER:
+      g_value_set_boolean (value, self->ring_buffer);
+      break;
+    case PROP_COPIED_BYTES:
+      /* 64-bit value, updated in the streaming thread */
+      GST_OBJECT_LOCK (self);
+      g_value_set_uint64 (value, self->copied_bytes);
+      GST_OBJECT_UNLOCK (self);
+      break;
     case PROP_SILENT:
       g_value_set_boolean (value, self->silent);
       break;
@@ -412,7 +473,7 @@ gst_tensor_aggregator_sink_event (GstPad * pad, GstObject * parent,
       silent_debug_caps (in_caps, "in-caps");
 
       if (gst_tensor_aggregator_parse_caps (self, in_caps)) {
-        out_caps = gst_tensor_caps_from_config (&self->out_config);
+        out_caps = gst_tensor_aggregator_get_caps (self, &self->out_config);
         silent_debug_caps (out_caps, "out-caps");
 
         gst_pad_set_caps (self->srcpad, out_caps);
@@ -522,6 +583,17 @@ gst_tensor_aggregator_src_query (GstPad * pad, GstObject * parent,
   return gst_pad_query_default (pad, parent, query);
 }
 
+/**
+ * @brief Add the number of bytes copied in this element (property copied-bytes).
+ */
+static void
+gst_tensor_aggregator_add_copied_bytes (GstTensorAggregator * self, gsize size)
+{
+  GST_OBJECT_LOCK (self);
+  self->copied_bytes += size;
+  GST_OBJECT_UNLOCK (self);
+}
+
 /**
  * @brief Check tensor dimension and axis to concatenate data.
  * @param self this pointer to GstTensorAggregator
@@ -554,28 +626,40 @@ gst_tensor_aggregator_check_concat_axis (GstTensorAggregator * self,
 /**
  * @brief Change the data in buffer with given axis.
  * @param self this pointer to GstTensorAggregator
- * @param outbuf buffer to be concatenated
+ * @param buf buffer to be concatenated (the reference is taken)
  * @param info tensor info for one frame
+ * @return the concatenated buffer, NULL if failed
  */
-static void
-gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * outbuf,
+static GstBuffer *
+gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * buf,
     const GstTensorInfo * info)
 {
-  GstBuffer *srcbuf;
+  GstBuffer *outbuf;
+  GstMemory *mem;
   GstMapInfo src_info, dest_info;
-  guint f;
-  gsize block_size;
-  gsize src_idx, dest_idx;
   gsize frame_size;
 
   frame_size = gst_tensor_info_get_size (info);
   g_assert (frame_size > 0);
 
-  srcbuf = gst_buffer_copy (outbuf);
-  outbuf = gst_buffer_make_writable (outbuf);
+  /** the memory blocks are merged when mapping the buffer */
+  if (gst_buffer_n_memory (buf) > 1)
+    gst_tensor_aggregator_add_copied_bytes (self, gst_buffer_get_size (buf));
 
-  g_assert (gst_buffer_map (srcbuf, &src_info, GST_MAP_READ));
-  g_assert (gst_buffer_map (outbuf, &dest_info, GST_MAP_WRITE));
+  if (!gst_buffer_map (buf, &src_info, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Failed to map the buffer to be concatenated.");
+    gst_buffer_unref (buf);
+    return NULL;
+  }
+
+  mem = gst_allocator_alloc (NULL, src_info.size, NULL);
+  if (!gst_memory_map (mem, &dest_info, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (self, "Failed to map the outgoing memory.");
+    gst_memory_unref (mem);
+    gst_buffer_unmap (buf, &src_info);
+    gst_buffer_unref (buf);
+    return NULL;
+  }
 
   /**
    * Concatenate output buffer with given axis (frames-dim)
@@ -752,31 +836,81 @@ gst_tensor_aggregator_concat (GstTensorAggregator * self, GstBuffer * outbuf,
    ********************************************************************
    */
 
-  /** get block size */
-  block_size = gst_tensor_get_element_size (info->type);
-  for (f = 0; f <= self->frames_dim; f++) {
-    block_size *= info->dimension[f];
-  }
+  /** write the blocks of each frame into new memory, a single copy */
+  g_assert (src_info.size == frame_size * self->frames_out);
+  gst_tensor_aggregator_write_frames (self, dest_info.data, src_info.data,
+      frame_size, 0, info);
 
-  src_idx = dest_idx = 0;
+  gst_memory_unmap (mem, &dest_info);
+  gst_buffer_unmap (buf, &src_info);
+
+  outbuf = gst_buffer_new ();
+  gst_buffer_copy_into (outbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+  gst_buffer_append_memory (outbuf, mem);
+
+  gst_buffer_unref (buf);
+  return outbuf;
+}
 
-  do {
-    for (f = 0; f < self->frames_out; f++) {
-      nns_memcpy (dest_info.data + dest_idx,
-          src_info.data + src_idx + (frame_size * f), block_size);
-      dest_idx += block_size;
+/**
+ * @brief Write the frames into outgoing data. (Concatenate the frames with the axis frames-dim if needed)
+ * @param self this pointer to GstTensorAggregator
+ * @param dest the data of outgoing tensor
+ * @param base the data of the first frame slot
+ * @param stride the distance between the frame slots
+ * @param head the slot index of the oldest frame (the slots are in a ring of frames-out slots)
+ * @param info tensor info for one frame
+ */
+static void
+gst_tensor_aggregator_write_frames (GstTensorAggregator * self, guint8 * dest,
+    const guint8 * base, gsize stride, guint head, const GstTensorInfo * info)
+{
+  const guint frames_out = self->frames_out;
+  gsize frame_size, block_size, src_idx;
+  guint f;
+
+  frame_size = gst_tensor_info_get_size (info);
+
+  if (gst_tensor_aggregator_check_concat_axis (self, info)) {
+    /** write the blocks of each frame with the axis frames-dim (see gst_tensor_aggregator_concat) */
+    block_size = gst_tensor_get_element_size (info->type);
+    for (f = 0; f <= self->frames_dim; f++) {
+      block_size *= info->dimension[f];
     }
 
-    src_idx += block_size;
+    for (src_idx = 0; src_idx < frame_size; src_idx += block_size) {
+      for (f = 0; f < frames_out; f++) {
+        nns_memcpy (dest, base + ((head + f) % frames_out) * stride + src_idx,
+            block_size);
+        dest += block_size;
+      }
+    }
+  } else if (stride == frame_size) {
+    /** the frames from the oldest one, at most 2 blocks in the ring */
+    guint tail = frames_out - head;
 
-    g_assert (src_idx <= frame_size);
-    g_assert (dest_idx <= dest_info.size);
-  } while (src_idx < frame_size);
+    nns_memcpy (dest, base + head * frame_size, tail * frame_size);
+    nns_memcpy (dest + tail * frame_size, base, head * frame_size);
+  } else {
+    for (f = 0; f < frames_out; f++) {
+      nns_memcpy (dest + f * frame_size,
+          base + ((head + f) % frames_out) * stride, frame_size);
+    }
+  }
 
-  gst_buffer_unmap (srcbuf, &src_info);
-  gst_buffer_unmap (outbuf, &dest_info);
+  gst_tensor_aggregator_add_copied_bytes (self, frame_size * frames_out);
+}
 
-  gst_buffer_unref (srcbuf);
+/**
+ * @brief Get tensor info for one frame.
+ */
+static void
+gst_tensor_aggregator_get_frame_info (GstTensorAggregator * self, guint index,
+    GstTensorInfo * info)
+{
+  *info = self->out_config.info.info[index];
+  g_assert (self->frames_dim < NNS_TENSOR_RANK_LIMIT);
+  info->dimension[self->frames_dim] /= self->frames_out;
 }
 
 /**
@@ -789,17 +923,77 @@ gst_tensor_aggregator_push (GstTensorAggregator * self, GstBuffer * outbuf,
   GstTensorInfo info;
 
   /** tensor info for one frame */
-  info = self->out_config.info;
-  g_assert (self->frames_dim < NNS_TENSOR_RANK_LIMIT);
-  info.dimension[self->frames_dim] /= self->frames_out;
+  gst_tensor_aggregator_get_frame_info (self, 0, &info);
 
   g_assert (frame_size == gst_tensor_info_get_size (&info));
 
   if (gst_tensor_aggregator_check_concat_axis (self, &info)) {
     /** change data in buffer with given axis */
-    gst_tensor_aggregator_concat (self, outbuf, &info);
+    outbuf = gst_tensor_aggregator_concat (self, outbuf, &info);
+    if (outbuf == NULL)
+      return GST_FLOW_ERROR;
+  }
+
+  return gst_pad_push (self->srcpad, outbuf);
+}
+
+/**
+ * @brief Push the buffer with multiple tensors to source pad. (Concatenate each tensor if needed)
+ */
+static GstFlowReturn
+gst_tensor_aggregator_push_tensors (GstTensorAggregator * self,
+    GstBuffer * buf)
+{
+  GstBuffer *outbuf;
+  GstTensorInfo info;
+  guint i;
+
+  outbuf = gst_buffer_new ();
+  gst_buffer_copy_into (outbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+
+  for (i = 0; i < self->in_config.info.num_tensors; i++) {
+    GstMemory *mem = gst_buffer_peek_memory (buf, i);
+    GstMemory *out_mem;
+    GstMapInfo in_map, out_map;
+
+    gst_tensor_aggregator_get_frame_info (self, i, &info);
+
+    if (!gst_tensor_aggregator_check_concat_axis (self, &info)) {
+      /** nothing to do, share the memory */
+      gst_buffer_append_memory (outbuf, gst_memory_ref (mem));
+      continue;
+    }
+
+    out_mem = gst_allocator_alloc (NULL, gst_memory_get_sizes (mem, NULL,
+            NULL), NULL);
+
+    if (!gst_memory_map (mem, &in_map, GST_MAP_READ)) {
+      GST_ERROR_OBJECT (self, "Failed to map the incoming memory.");
+      gst_memory_unref (out_mem);
+      gst_buffer_unref (outbuf);
+      gst_buffer_unref (buf);
+      return GST_FLOW_ERROR;
+    }
+
+    if (!gst_memory_map (out_mem, &out_map, GST_MAP_WRITE)) {
+      GST_ERROR_OBJECT (self, "Failed to map the outgoing memory.");
+      gst_memory_unmap (mem, &in_map);
+      gst_memory_unref (out_mem);
+      gst_buffer_unref (outbuf);
+      gst_buffer_unref (buf);
+      return GST_FLOW_ERROR;
+    }
+
+    gst_tensor_aggregator_write_frames (self, out_map.data, in_map.data,
+        self->frame_size[i], 0, &info);
+
+    gst_memory_unmap (out_mem, &out_map);
+    gst_memory_unmap (mem, &in_map);
+
+    gst_buffer_append_memory (outbuf, out_mem);
   }
 
+  gst_buffer_unref (buf);
   return gst_pad_push (self->srcpad, outbuf);
 }
 
@@ -812,9 +1006,11 @@ gst_tensor_aggregator_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   GstTensorAggregator *self;
   GstFlowReturn ret = GST_FLOW_OK;
   GstAdapter *adapter;
+  GstTensorInfo frame_info;
   gsize avail, buf_size, frame_size, out_size;
   guint frames_in, frames_out, frames_flush;
   GstClockTime duration;
+  gboolean concat;
 
   self = GST_TENSOR_AGGREGATOR (parent);
   g_assert (self->tensor_configured);
@@ -825,6 +1021,23 @@ gst_tensor_aggregator_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   frames_in = self->frames_in;
   frames_out = self->frames_out;
   frames_flush = self->frames_flush;
+
+  if (self->is_tensors) {
+    /** each tensor in a memory block, aggregate the frames of all tensors in lockstep */
+    if (gst_buffer_n_memory (buf) != self->in_config.info.num_tensors) {
+      GST_ERROR_OBJECT (self, "The number of memory blocks (%u) is different from the number of tensors (%u).",
+          gst_buffer_n_memory (buf), self->in_config.info.num_tensors);
+      gst_buffer_unref (buf);
+      return GST_FLOW_ERROR;
+    }
+
+    if (frames_in == frames_out) {
+      return gst_tensor_aggregator_push_tensors (self, buf);
+    }
+
+    return gst_tensor_aggregator_ring_chain (self, buf);
+  }
+
   frame_size = buf_size / frames_in;
 
   if (frames_in == frames_out) {
@@ -832,9 +1045,16 @@ gst_tensor_aggregator_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
     return gst_tensor_aggregator_push (self, buf, frame_size);
   }
 
+  if (self->ring_buffer) {
+    return gst_tensor_aggregator_ring_chain (self, buf);
+  }
+
   adapter = self->adapter;
   g_assert (adapter != NULL);
 
+  gst_tensor_aggregator_get_frame_info (self, 0, &frame_info);
+  concat = gst_tensor_aggregator_check_concat_axis (self, &frame_info);
+
   duration = GST_BUFFER_DURATION (buf);
   if (GST_CLOCK_TIME_IS_VALID (duration)) {
     /** supposed same duration for incoming buffer */
@@ -881,9 +1101,21 @@ gst_tensor_aggregator_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       }
     }
 
-    outbuf = gst_adapter_get_buffer (adapter, out_size);
+    /** the memory blocks are not merged if outgoing buffer spans the incoming buffers */
+    outbuf = gst_adapter_get_buffer_fast (adapter, out_size);
     outbuf = gst_buffer_make_writable (outbuf);
 
+    if (gst_buffer_n_memory (outbuf) > 1 && !concat) {
+      gpointer data;
+      gsize size;
+
+      /** merge the frames here, the concatenation writes new memory anyway */
+      gst_buffer_extract_dup (outbuf, 0, out_size, &data, &size);
+      gst_buffer_replace_all_memory (outbuf,
+          gst_memory_new_wrapped (0, data, size, 0, size, data, g_free));
+      gst_tensor_aggregator_add_copied_bytes (self, size);
+    }
+
     /** set timestamp */
     GST_BUFFER_PTS (outbuf) = pts;
     GST_BUFFER_DTS (outbuf) = dts;
@@ -914,6 +1146,251 @@ gst_tensor_aggregator_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   return ret;
 }
 
+/**
+ * @brief Release the ring buffer and the buffer pool.
+ */
+static void
+gst_tensor_aggregator_clear_ring (GstTensorAggregator * self)
+{
+  if (self->pool) {
+    gst_buffer_pool_set_active (self->pool, FALSE);
+    gst_object_unref (self->pool);
+    self->pool = NULL;
+  }
+
+  g_free (self->ring);
+  g_free (self->ring_pts);
+  g_free (self->ring_dts);
+
+  self->ring = NULL;
+  self->ring_pts = NULL;
+  self->ring_dts = NULL;
+  self->ring_frame_size = 0;
+  self->ring_head = self->ring_count = 0;
+}
+
+/**
+ * @brief Prepare the ring buffer (frames-out frames) and the buffer pool for outgoing buffer.
+ * A slot of the ring buffer has a frame of each tensor, back-to-back.
+ */
+static gboolean
+gst_tensor_aggregator_setup_ring (GstTensorAggregator * self)
+{
+  GstStructure *config;
+  gsize frame_size = 0;
+  guint i;
+
+  gst_tensor_aggregator_clear_ring (self);
+
+  for (i = 0; i < self->in_config.info.num_tensors; i++)
+    frame_size += self->frame_size[i];
+
+  self->ring = g_try_malloc (frame_size * self->frames_out);
+  self->ring_pts = g_new (GstClockTime, self->frames_out);
+  self->ring_dts = g_new (GstClockTime, self->frames_out);
+
+  if (self->ring == NULL) {
+    GST_ERROR_OBJECT (self, "Failed to allocate the ring buffer.");
+    gst_tensor_aggregator_clear_ring (self);
+    return FALSE;
+  }
+
+  if (!self->is_tensors) {
+    /** outgoing buffer with single memory block */
+    self->pool = gst_buffer_pool_new ();
+
+    config = gst_buffer_pool_get_config (self->pool);
+    gst_buffer_pool_config_set_params (config, NULL,
+        frame_size * self->frames_out, 0, 0);
+
+    if (!gst_buffer_pool_set_config (self->pool, config) ||
+        !gst_buffer_pool_set_active (self->pool, TRUE)) {
+      GST_ERROR_OBJECT (self, "Failed to activate the buffer pool.");
+      gst_tensor_aggregator_clear_ring (self);
+      return FALSE;
+    }
+  }
+
+  self->ring_frame_size = frame_size;
+  return TRUE;
+}
+
+/**
+ * @brief Write the frames in the ring buffer into outgoing buffer and push it.
+ */
+static GstFlowReturn
+gst_tensor_aggregator_ring_push (GstTensorAggregator * self,
+    GstClockTime duration)
+{
+  GstBuffer *outbuf = NULL;
+  GstTensorInfo info;
+  GstMapInfo map;
+  gsize offset;
+  guint i;
+
+  if (self->pool) {
+    if (gst_buffer_pool_acquire_buffer (self->pool, &outbuf, NULL) !=
+        GST_FLOW_OK) {
+      GST_ERROR_OBJECT (self, "Failed to get the buffer from the pool.");
+      return GST_FLOW_ERROR;
+    }
+
+    if (!gst_buffer_map (outbuf, &map, GST_MAP_WRITE)) {
+      GST_ERROR_OBJECT (self, "Failed to map the outgoing buffer.");
+      gst_buffer_unref (outbuf);
+      return GST_FLOW_ERROR;
+    }
+
+    gst_tensor_aggregator_get_frame_info (self, 0, &info);
+    gst_tensor_aggregator_write_frames (self, map.data, self->ring,
+        self->ring_frame_size, self->ring_head, &info);
+
+    gst_buffer_unmap (outbuf, &map);
+  } else {
+    /** a memory block for each tensor */
+    outbuf = gst_buffer_new ();
+
+    for (i = 0, offset = 0; i < self->out_config.info.num_tensors; i++) {
+      GstMemory *mem;
+
+      mem = gst_allocator_alloc (NULL, self->frame_size[i] * self->frames_out,
+          NULL);
+
+      if (!gst_memory_map (mem, &map, GST_MAP_WRITE)) {
+        GST_ERROR_OBJECT (self, "Failed to map the outgoing memory.");
+        gst_memory_unref (mem);
+        gst_buffer_unref (outbuf);
+        return GST_FLOW_ERROR;
+      }
+
+      gst_tensor_aggregator_get_frame_info (self, i, &info);
+      gst_tensor_aggregator_write_frames (self, map.data, self->ring + offset,
+          self->ring_frame_size, self->ring_head, &info);
+
+      gst_memory_unmap (mem, &map);
+      gst_buffer_append_memory (outbuf, mem);
+
+      offset += self->frame_size[i];
+    }
+  }
+
+  /** set timestamp */
+  GST_BUFFER_PTS (outbuf) = self->ring_pts[self->ring_head];
+  GST_BUFFER_DTS (outbuf) = self->ring_dts[self->ring_head];
+  GST_BUFFER_DURATION (outbuf) = duration;
+
+  return gst_pad_push (self->srcpad, outbuf);
+}
+
+/**
+ * @brief Aggregate the frames in the ring buffer.
+ * Each incoming frame is copied once into the ring buffer, and each outgoing buffer is written once from the ring buffer.
+ * With other/tensors, the frames of all tensors are aggregated in lockstep and share the timestamp.
+ */
+static GstFlowReturn
+gst_tensor_aggregator_ring_chain (GstTensorAggregator * self, GstBuffer * buf)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstMapInfo map[NNS_TENSOR_SIZE_LIMIT];
+  GstClockTime pts, dts, duration, frame_duration;
+  const guint frames_out = self->frames_out;
+  guint num, f, i, flush;
+  gint fn, fd;
+
+  num = self->is_tensors ? self->in_config.info.num_tensors : 1;
+
+  if (self->ring == NULL && !gst_tensor_aggregator_setup_ring (self)) {
+    gst_buffer_unref (buf);
+    return GST_FLOW_ERROR;
+  }
+
+  duration = GST_BUFFER_DURATION (buf);
+  if (GST_CLOCK_TIME_IS_VALID (duration)) {
+    /** supposed same duration for incoming buffer */
+    duration = gst_util_uint64_scale_int (duration, frames_out,
+        self->frames_in);
+  }
+
+  /** timestamp of each frame in incoming buffer (same timestamp if framerate is not given) */
+  pts = GST_BUFFER_PTS (buf);
+  dts = GST_BUFFER_DTS (buf);
+  frame_duration = 0;
+
+  fn = self->in_config.rate_n;
+  fd = self->in_config.rate_d;
+  if (fn > 0 && fd > 0) {
+    frame_duration = gst_util_uint64_scale_int (fd, GST_SECOND, fn);
+  }
+
+  for (i = 0; i < num; i++) {
+    gboolean mapped;
+
+    if (self->is_tensors)
+      mapped = gst_memory_map (gst_buffer_peek_memory (buf, i), &map[i],
+          GST_MAP_READ);
+    else
+      mapped = gst_buffer_map (buf, &map[i], GST_MAP_READ);
+
+    if (!mapped || map[i].size < self->frame_size[i] * self->frames_in) {
+      GST_ERROR_OBJECT (self, "Failed to map the incoming buffer.");
+      if (mapped)
+        num = i + 1;
+      else
+        num = i;
+      ret = GST_FLOW_ERROR;
+      goto done;
+    }
+  }
+
+  for (f = 0; f < self->frames_in && ret == GST_FLOW_OK; f++) {
+    guint idx = (self->ring_head + self->ring_count) % frames_out;
+    guint8 *slot = self->ring + idx * self->ring_frame_size;
+
+    for (i = 0; i < num; i++) {
+      nns_memcpy (slot, map[i].data + f * self->frame_size[i],
+          self->frame_size[i]);
+      slot += self->frame_size[i];
+    }
+    gst_tensor_aggregator_add_copied_bytes (self, self->ring_frame_size);
+
+    self->ring_pts[idx] = GST_CLOCK_TIME_IS_VALID (pts) ?
+        pts + f * frame_duration : pts;
+    self->ring_dts[idx] = GST_CLOCK_TIME_IS_VALID (dts) ?
+        dts + f * frame_duration : dts;
+
+    if (++self->ring_count < frames_out)
+      continue;
+
+    ret = gst_tensor_aggregator_ring_push (self, duration);
+
+    /** flush frames, the overlapped frames are kept in the ring buffer */
+    flush = (self->frames_flush > 0) ? self->frames_flush : frames_out;
+
+    if (flush > frames_out) {
+      /**
+       * Same as flushing the adapter, skip the frames in incoming buffer.
+       * The frames not received yet are not skipped.
+       */
+      f += MIN (flush - frames_out, self->frames_in - f - 1);
+      flush = frames_out;
+    }
+
+    self->ring_head = (self->ring_head + flush) % frames_out;
+    self->ring_count -= flush;
+  }
+
+done:
+  for (i = 0; i < num; i++) {
+    if (self->is_tensors)
+      gst_memory_unmap (gst_buffer_peek_memory (buf, i), &map[i]);
+    else
+      gst_buffer_unmap (buf, &map[i]);
+  }
+
+  gst_buffer_unref (buf);
+  return ret;
+}
+
 /**
  * @brief Called to perform state change.
  */
@@ -957,9 +1434,36 @@ gst_tensor_aggregator_reset (GstTensorAggregator * self)
     gst_adapter_clear (self->adapter);
   }
 
+  self->ring_head = self->ring_count = 0;
+
+  GST_OBJECT_LOCK (self);
+  self->copied_bytes = 0;
+  GST_OBJECT_UNLOCK (self);
+
   self->tensor_configured = FALSE;
-  gst_tensor_config_init (&self->in_config);
-  gst_tensor_config_init (&self->out_config);
+  self->is_tensors = FALSE;
+  gst_tensors_config_init (&self->in_config);
+  gst_tensors_config_init (&self->out_config);
+}
+
+/**
+ * @brief Get caps from tensors config (other/tensor if the stream is a single tensor).
+ */
+static GstCaps *
+gst_tensor_aggregator_get_caps (GstTensorAggregator * self,
+    const GstTensorsConfig * config)
+{
+  GstTensorConfig c;
+
+  if (self->is_tensors)
+    return gst_tensors_caps_from_config (config);
+
+  gst_tensor_config_init (&c);
+  c.info = config->info.info[0];
+  c.rate_n = config->rate_n;
+  c.rate_d = config->rate_d;
+
+  return gst_tensor_caps_from_config (&c);
 }
 
 /**
@@ -970,7 +1474,7 @@ gst_tensor_aggregator_query_caps (GstTensorAggregator * self, GstPad * pad,
     GstCaps * filter)
 {
   GstCaps *caps;
-  GstTensorConfig config;
+  GstTensorsConfig config;
 
   /* tensor config info for given pad */
   if (pad == self->sinkpad) {
@@ -979,8 +1483,11 @@ gst_tensor_aggregator_query_caps (GstTensorAggregator * self, GstPad * pad,
     config = self->out_config;
   }
 
-  /* caps from tensor config info */
-  caps = gst_tensor_caps_from_config (&config);
+  /* caps from tensor config info, any tensor stream if not configured */
+  if (self->tensor_configured)
+    caps = gst_tensor_aggregator_get_caps (self, &config);
+  else
+    caps = gst_pad_get_pad_template_caps (pad);
 
   silent_debug_caps (caps, "caps");
   silent_debug_caps (filter, "filter");
@@ -1006,21 +1513,22 @@ gst_tensor_aggregator_parse_caps (GstTensorAggregator * self,
     const GstCaps * caps)
 {
   GstStructure *structure;
-  GstTensorConfig config;
+  GstTensorsConfig config;
   uint32_t per_frame;
-  guint count;
+  guint count, i;
 
   g_return_val_if_fail (caps != NULL, FALSE);
   g_return_val_if_fail (gst_caps_is_fixed (caps), FALSE);
 
   structure = gst_caps_get_structure (caps, 0);
-  if (!gst_structure_has_name (structure, "other/tensor")) {
+  if (!gst_structure_has_name (structure, "other/tensor") &&
+      !gst_structure_has_name (structure, "other/tensors")) {
     GST_ERROR_OBJECT (self, "Invalid caps");
     return FALSE;
   }
 
-  if (!gst_tensor_config_from_structure (&config, structure) ||
-      !gst_tensor_config_validate (&config)) {
+  if (!gst_tensors_config_from_structure (&config, structure) ||
+      !gst_tensors_config_validate (&config)) {
     GST_ERROR_OBJECT (self, "Cannot configure tensor info");
     return FALSE;
   }
@@ -1033,6 +1541,7 @@ gst_tensor_aggregator_parse_caps (GstTensorAggregator * self,
   count = (self->frames_out + self->frames_in - 1) / self->frames_in;
   g_assert (self->frames_in * count >= self->frames_flush);
 
+  self->is_tensors = gst_structure_has_name (structure, "other/tensors");
   self->in_config = config;
 
   /**
@@ -1040,16 +1549,31 @@ gst_tensor_aggregator_parse_caps (GstTensorAggregator * self,
    * e.g, in-dimension 2:200:200:1
    * if frames_out=10 and frames_dim=3, then out-dimension is 2:200:200:10.
    * if frames_out=10 and frames_dim=2, then out-dimension is 2:200:2000:1.
+   * With other/tensors, the frames of each tensor are aggregated with same frames-dim.
    */
   g_assert (self->frames_dim < NNS_TENSOR_RANK_LIMIT);
-  g_assert ((config.info.dimension[self->frames_dim] % self->frames_in) == 0);
-  per_frame = config.info.dimension[self->frames_dim] / self->frames_in;
 
-  config.info.dimension[self->frames_dim] = per_frame * self->frames_out;
+  for (i = 0; i < config.info.num_tensors; i++) {
+    GstTensorInfo *info = &config.info.info[i];
+
+    if ((info->dimension[self->frames_dim] % self->frames_in) != 0) {
+      GST_ERROR_OBJECT (self,
+          "The dimension of tensor %u should be multiple of frames-in.", i);
+      return FALSE;
+    }
+
+    per_frame = info->dimension[self->frames_dim] / self->frames_in;
+    self->frame_size[i] = gst_tensor_info_get_size (info) / self->frames_in;
+
+    info->dimension[self->frames_dim] = per_frame * self->frames_out;
+  }
 
   self->out_config = config;
   self->tensor_configured = TRUE;
 
+  /** the ring buffer is prepared with new frame size */
+  gst_tensor_aggregator_clear_ring (self);
+
   silent_debug_config (&self->in_config, "in-tensor");
   silent_debug_config (&self->out_config, "out-tensor");
   return TRUE;
@@ -66,9 +66,21 @@ struct _GstTensorAggregator
 
   GstAdapter *adapter; /**< adapt incoming tensor */
 
+  gboolean ring_buffer; /**< true to aggregate the frames in the ring buffer */
+  guint8 *ring; /**< ring buffer of the frames (frames-out frames) */
+  GstClockTime *ring_pts; /**< pts of the frames in the ring buffer */
+  GstClockTime *ring_dts; /**< dts of the frames in the ring buffer */
+  gsize ring_frame_size; /**< size of a frame in the ring buffer (all tensors) */
+  guint ring_head; /**< index of the oldest frame in the ring buffer */
+  guint ring_count; /**< the number of frames in the ring buffer */
+  GstBufferPool *pool; /**< buffer pool for outgoing buffer (ring buffer mode) */
+  guint64 copied_bytes; /**< the number of bytes copied in this element */
+
   gboolean tensor_configured; /**< True if already successfully configured tensor metadata */
-  GstTensorConfig in_config; /**< input tensor info */
-  GstTensorConfig out_config; /**< output tensor info */
+  gboolean is_tensors; /**< True if the stream is other/tensors */
+  GstTensorsConfig in_config; /**< input tensor info */
+  GstTensorsConfig out_config; /**< output tensor info */
+  gsize frame_size[NNS_TENSOR_SIZE_LIMIT]; /**< size of a frame of each tensor */
 };
 
 /**
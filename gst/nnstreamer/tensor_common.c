@@ -1176,9 +1176,30 @@ static const gchar *gst_tensor_time_sync_mode_string[] = {
   [SYNC_NOSYNC] = "nosync",
   [SYNC_SLOWEST] = "slowest",
   [SYNC_BASEPAD] = "basepad",
+  [SYNC_LATEST] = "latest",
+  [SYNC_TIMEOUT] = "timeout",
   [SYNC_END] = NULL
 };
 
+/**
+ * @brief Default timeout to wait for all pads in timeout mode.
+ */
+#define SYNC_TIMEOUT_DEFAULT (100 * GST_MSECOND)
+
+/**
+ * @brief Cancel the timer of current output. Call this with the lock of sync data.
+ */
+static void
+gst_tensor_time_sync_cancel_timeout (tensor_time_sync_data * sync)
+{
+  tensor_sync_timer *timer = &sync->timer;
+
+  if (timer->deadline != 0) {
+    timer->deadline = 0;
+    timer->seq++;
+  }
+}
+
 /**
  * @brief Get the corresponding mode from the string value.
  * @param[in] str The string value for the mode.
@@ -1212,9 +1233,20 @@ gst_tensor_time_sync_get_mode_string (tensor_time_sync_mode mode)
 gboolean
 gst_tensor_time_sync_set_option_data (tensor_time_sync_data * sync)
 {
-  if (sync->mode == SYNC_END || sync->option == NULL)
+  /* the timer of the old option should not expire with the new one */
+  g_mutex_lock (&sync->lock);
+  gst_tensor_time_sync_cancel_timeout (sync);
+  g_mutex_unlock (&sync->lock);
+
+  if (sync->mode == SYNC_END)
     return FALSE;
 
+  if (sync->option == NULL) {
+    /* latest and timeout mode can run with the default option */
+    if (sync->mode != SYNC_LATEST && sync->mode != SYNC_TIMEOUT)
+      return FALSE;
+  }
+
   switch (sync->mode) {
     case SYNC_NOSYNC:
       break;
@@ -1242,6 +1274,32 @@ gst_tensor_time_sync_set_option_data (tensor_time_sync_data * sync)
       g_strfreev (strv);
       break;
     }
+    case SYNC_LATEST:
+    {
+      gchar **strv;
+
+      strv = g_strsplit (sync->option ? sync->option : "", ":", 2);
+      if (strv[0] != NULL)
+        sync->data_latest.sink_id = (guint) g_ascii_strtoull (strv[0], NULL,
+            10);
+      else
+        sync->data_latest.sink_id = 0;
+
+      if (strv[0] != NULL && strv[1] != NULL)
+        sync->data_latest.max_staleness = g_ascii_strtoull (strv[1], NULL, 10);
+      else
+        sync->data_latest.max_staleness = GST_CLOCK_TIME_NONE;
+
+      g_strfreev (strv);
+      break;
+    }
+    case SYNC_TIMEOUT:
+      if (sync->option != NULL && sync->option[0] != '\0')
+        sync->data_timeout.timeout = g_ascii_strtoull (sync->option, NULL, 10);
+      else
+        sync->data_timeout.timeout = SYNC_TIMEOUT_DEFAULT;
+
+      break;
     default:
       /* unknown mode */
       GST_WARNING ("Unknown mode = %d", sync->mode);
@@ -1272,12 +1330,22 @@ gst_tensor_time_sync_get_current_time (GstCollectPads * collect,
     walk = g_slist_next (walk);
 
     if (buf == NULL) {
+      /* the pads except the base pad are not waiting in latest mode */
+      if ((sync->mode == SYNC_LATEST && count != sync->data_latest.sink_id) ||
+          (sync->mode == SYNC_TIMEOUT &&
+              !GST_COLLECT_PADS_STATE_IS_SET (data,
+                  GST_COLLECT_PADS_STATE_EOS))) {
+        count++;
+        continue;
+      }
+
       /* end-of-stream */
       return TRUE;
     }
 
     switch (sync->mode) {
       case SYNC_SLOWEST:
+      case SYNC_TIMEOUT:
         if (*current_time < GST_BUFFER_PTS (buf))
           *current_time = GST_BUFFER_PTS (buf);
         break;
@@ -1285,6 +1353,10 @@ gst_tensor_time_sync_get_current_time (GstCollectPads * collect,
         if (count == sync->data_basepad.sink_id)
           *current_time = GST_BUFFER_PTS (buf);
         break;
+      case SYNC_LATEST:
+        if (count == sync->data_latest.sink_id)
+          *current_time = GST_BUFFER_PTS (buf);
+        break;
       default:
         break;
     }
@@ -1296,6 +1368,227 @@ gst_tensor_time_sync_get_current_time (GstCollectPads * collect,
   return FALSE;
 }
 
+/**
+ * @brief Check the sync mode may change the waiting state of the collect pads.
+ */
+gboolean
+gst_tensor_time_sync_change_waiting (tensor_time_sync_data * sync)
+{
+  g_return_val_if_fail (sync != NULL, FALSE);
+
+  return (sync->mode == SYNC_LATEST || sync->mode == SYNC_TIMEOUT);
+}
+
+/**
+ * @brief Set the waiting state of the collect pads for the sync mode.
+ */
+void
+gst_tensor_time_sync_reset_waiting (GstCollectPads * collect,
+    tensor_time_sync_data * sync)
+{
+  GSList *walk;
+  guint count = 0;
+  gboolean locked = !gst_tensor_time_sync_change_waiting (sync);
+
+  for (walk = collect->data; walk; walk = g_slist_next (walk), count++) {
+    GstCollectData *data = (GstCollectData *) walk->data;
+    gboolean waiting = TRUE;
+
+    if (GST_COLLECT_PADS_STATE_IS_SET (data, GST_COLLECT_PADS_STATE_EOS))
+      continue;
+
+    if (sync->mode == SYNC_LATEST)
+      waiting = (count == sync->data_latest.sink_id);
+
+    /* the sync mode may be changed after the pad is added */
+    GST_COLLECT_PADS_STATE_UNSET (data, GST_COLLECT_PADS_STATE_LOCKED);
+    gst_collect_pads_set_waiting (collect, data, waiting);
+
+    if (locked)
+      GST_COLLECT_PADS_STATE_SET (data, GST_COLLECT_PADS_STATE_LOCKED);
+  }
+}
+
+/**
+ * @brief Thread of the timer in timeout mode, sets the late pads not waiting when the timer expires.
+ * @note The streaming thread of the queued buffer wakes up and generates an output with the most recent buffers of the late pads.
+ *       This thread does not call the collected function, so a slow downstream element does not stall the timer.
+ */
+static gpointer
+gst_tensor_time_sync_timer_thread (gpointer user_data)
+{
+  tensor_time_sync_data *sync = (tensor_time_sync_data *) user_data;
+  tensor_sync_timer *timer = &sync->timer;
+  GstCollectPads *collect;
+  GSList *walk;
+  guint seq;
+
+  g_mutex_lock (&sync->lock);
+  while (!timer->stop) {
+    if (timer->deadline == 0) {
+      g_cond_wait (&timer->cond, &sync->lock);
+      continue;
+    }
+
+    if (g_get_monotonic_time () < timer->deadline) {
+      g_cond_wait_until (&timer->cond, &sync->lock, timer->deadline);
+      continue;
+    }
+
+    /* the timer is still armed until the late pads are updated */
+    seq = timer->seq;
+    collect = timer->collect;
+    g_mutex_unlock (&sync->lock);
+
+    GST_COLLECT_PADS_STREAM_LOCK (collect);
+    g_mutex_lock (&sync->lock);
+
+    /* the timer may be cancelled or armed again while waiting for the lock */
+    if (timer->seq == seq && !timer->stop) {
+      timer->deadline = 0;
+      timer->seq++;
+
+      for (walk = collect->data; walk; walk = g_slist_next (walk)) {
+        GstCollectData *data = (GstCollectData *) walk->data;
+        GstBuffer *buf = gst_collect_pads_peek (collect, data);
+
+        /* this wakes up the streaming thread waiting in collect pads */
+        if (buf != NULL)
+          gst_buffer_unref (buf);
+        else if (!GST_COLLECT_PADS_STATE_IS_SET (data,
+                GST_COLLECT_PADS_STATE_EOS))
+          gst_collect_pads_set_waiting (collect, data, FALSE);
+      }
+    }
+
+    g_mutex_unlock (&sync->lock);
+    GST_COLLECT_PADS_STREAM_UNLOCK (collect);
+    g_mutex_lock (&sync->lock);
+  }
+  g_mutex_unlock (&sync->lock);
+
+  return NULL;
+}
+
+/**
+ * @brief Arm the timer of current output. Call this with the lock of sync data.
+ */
+static void
+gst_tensor_time_sync_arm_timeout (GstCollectPads * collect,
+    tensor_time_sync_data * sync)
+{
+  tensor_sync_timer *timer = &sync->timer;
+
+  timer->collect = collect;
+  timer->deadline = g_get_monotonic_time () +
+      GST_TIME_AS_USECONDS (sync->data_timeout.timeout);
+  timer->seq++;
+  g_cond_signal (&timer->cond);
+}
+
+/**
+ * @brief Start the timer of current output in timeout mode.
+ */
+void
+gst_tensor_time_sync_start_timeout (GstCollectPads * collect,
+    tensor_time_sync_data * sync)
+{
+  tensor_sync_timer *timer = &sync->timer;
+
+  if (sync->mode != SYNC_TIMEOUT)
+    return;
+
+  /* check and arm the timer at once, the pads may call this at the same time */
+  g_mutex_lock (&sync->lock);
+  if (timer->thread == NULL && !timer->stop) {
+    timer->thread = g_thread_try_new ("tensor_sync_timer",
+        gst_tensor_time_sync_timer_thread, sync, NULL);
+    if (timer->thread == NULL)
+      GST_WARNING_OBJECT (collect, "Failed to start the timer.");
+  }
+
+  if (timer->thread != NULL && timer->deadline == 0)
+    gst_tensor_time_sync_arm_timeout (collect, sync);
+  g_mutex_unlock (&sync->lock);
+}
+
+/**
+ * @brief Finish the timer of current output after the collected buffers are popped.
+ */
+static void
+gst_tensor_time_sync_finish_timeout (GstCollectPads * collect,
+    tensor_time_sync_data * sync)
+{
+  GSList *walk;
+
+  g_mutex_lock (&sync->lock);
+  gst_tensor_time_sync_cancel_timeout (sync);
+
+  /**
+   * A buffer for the next output may be queued before the timer is cancelled.
+   * Arm the timer again so that the buffer does not wait for the late pads forever.
+   */
+  for (walk = collect->data; walk; walk = g_slist_next (walk)) {
+    GstBuffer *buf = gst_collect_pads_peek (collect,
+        (GstCollectData *) walk->data);
+
+    if (buf != NULL) {
+      gst_buffer_unref (buf);
+
+      if (sync->timer.thread != NULL)
+        gst_tensor_time_sync_arm_timeout (collect, sync);
+      break;
+    }
+  }
+  g_mutex_unlock (&sync->lock);
+
+  gst_tensor_time_sync_reset_waiting (collect, sync);
+}
+
+/**
+ * @brief Stop the timer of current output and set all pads waiting.
+ */
+void
+gst_tensor_time_sync_stop_timeout (GstCollectPads * collect,
+    tensor_time_sync_data * sync)
+{
+  tensor_sync_timer *timer = &sync->timer;
+  GThread *thread;
+  GSList *walk;
+
+  /* the thread may be running even if the mode is changed */
+  g_mutex_lock (&sync->lock);
+  gst_tensor_time_sync_cancel_timeout (sync);
+  timer->stop = TRUE;
+  thread = timer->thread;
+  g_cond_signal (&timer->cond);
+  g_mutex_unlock (&sync->lock);
+
+  /* the thread takes the stream lock, join it without the lock */
+  if (thread)
+    g_thread_join (thread);
+
+  g_mutex_lock (&sync->lock);
+  gst_tensor_time_sync_cancel_timeout (sync);
+  timer->thread = NULL;
+  timer->stop = FALSE;
+  timer->collect = NULL;
+  g_mutex_unlock (&sync->lock);
+
+  /**
+   * The collect pads are stopped and the number of queued pads is cleared.
+   * Set the flag only, gst_tensor_time_sync_reset_waiting() updates the pads when the collect pads are started again.
+   */
+  GST_COLLECT_PADS_STREAM_LOCK (collect);
+  for (walk = collect->data; walk; walk = g_slist_next (walk)) {
+    GstCollectData *data = (GstCollectData *) walk->data;
+
+    if (!GST_COLLECT_PADS_STATE_IS_SET (data, GST_COLLECT_PADS_STATE_LOCKED))
+      GST_COLLECT_PADS_STATE_SET (data, GST_COLLECT_PADS_STATE_WAITING);
+  }
+  GST_COLLECT_PADS_STREAM_UNLOCK (collect);
+}
+
 /**
  * @brief A function call to make tensors from collected pads.
  * It decide which buffer is going to be used according to sync option.
@@ -1310,8 +1603,9 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
   gint old_numerator = G_MAXINT;
   gint old_denominator = G_MAXINT;
   gint counting = 0;
-  GstTensorsConfig in_configs;
+  GstTensorsConfig *in_configs;
   GstClockTime base = 0;
+  gboolean missing = FALSE;
   guint i = 0;
 
   walk = collect->data;
@@ -1339,6 +1633,12 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
                     GST_BUFFER_PTS (pad->buffer))) - 1);
       gst_buffer_unref (buf);
     }
+  } else if (sync->mode == SYNC_LATEST || sync->mode == SYNC_TIMEOUT) {
+    /* the output may be dropped before, get current time of the incoming buffers */
+    if (gst_tensor_time_sync_get_current_time (collect, sync, &current_time)) {
+      /* end-of-stream */
+      return TRUE;
+    }
   }
 
   walk = collect->data;
@@ -1346,19 +1646,33 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
   while (walk) {
     GstCollectData *data = (GstCollectData *) walk->data;
     GstTensorCollectPadData *pad = (GstTensorCollectPadData *) data;
-    GstCaps *caps = gst_pad_get_current_caps (pad->pad);
-    GstStructure *s = gst_caps_get_structure (caps, 0);
     GstBuffer *buf;
 
-    gst_tensors_config_from_structure (&in_configs, s);
-    g_assert (gst_tensors_config_validate (&in_configs));
+    in_configs = &pad->config;
+
+    if (!gst_tensors_config_validate (in_configs)) {
+      /* config is not updated with caps event yet */
+      GstCaps *caps = gst_pad_get_current_caps (pad->pad);
 
-    if (in_configs.rate_d < old_denominator)
-      old_denominator = in_configs.rate_d;
-    if (in_configs.rate_n < old_numerator)
-      old_numerator = in_configs.rate_n;
+      if (caps) {
+        gst_tensor_collect_pad_set_config (pad, caps);
+        gst_caps_unref (caps);
+      }
+    }
 
-    gst_caps_unref (caps);
+    if ((sync->mode == SYNC_LATEST || sync->mode == SYNC_TIMEOUT) &&
+        !gst_tensors_config_validate (in_configs)) {
+      /* no caps (and no data) from this pad yet, the output will be dropped */
+      missing = TRUE;
+      walk = g_slist_next (walk);
+      continue;
+    }
+    g_assert (gst_tensors_config_validate (in_configs));
+
+    if (in_configs->rate_d < old_denominator)
+      old_denominator = in_configs->rate_d;
+    if (in_configs->rate_n < old_numerator)
+      old_numerator = in_configs->rate_n;
 
     walk = g_slist_next (walk);
     buf = gst_collect_pads_peek (collect, data);
@@ -1425,6 +1739,33 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
           buf = pad->buffer;
         }
         break;
+      case SYNC_LATEST:
+      case SYNC_TIMEOUT:
+        /* keep the most recent buffer of the pad */
+        if (buf != NULL) {
+          gst_buffer_unref (buf);
+          if (pad->buffer != NULL)
+            gst_buffer_unref (pad->buffer);
+          pad->buffer = gst_collect_pads_pop (collect, data);
+        }
+
+        buf = pad->buffer;
+
+        if (buf != NULL && sync->mode == SYNC_LATEST &&
+            GST_CLOCK_TIME_IS_VALID (sync->data_latest.max_staleness) &&
+            current_time > GST_BUFFER_PTS (buf) &&
+            current_time - GST_BUFFER_PTS (buf) >
+            sync->data_latest.max_staleness) {
+          /* too old to be merged */
+          buf = NULL;
+        }
+
+        if (buf == NULL) {
+          /* no data from this pad, the output will be dropped */
+          missing = TRUE;
+          continue;
+        }
+        break;
       default:
         break;
     }
@@ -1432,13 +1773,13 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
     if (GST_IS_BUFFER (buf)) {
       guint n_mem = gst_buffer_n_memory (buf);
 
-      g_assert (n_mem == in_configs.info.num_tensors);
+      g_assert (n_mem == in_configs->info.num_tensors);
       g_assert ((counting + n_mem) < NNS_TENSOR_SIZE_LIMIT);
 
       for (i = 0; i < n_mem; ++i) {
         mem = gst_buffer_get_memory (buf, i);
         gst_buffer_append_memory (tensors_buf, mem);
-        configs->info.info[counting] = in_configs.info.info[i];
+        configs->info.info[counting] = in_configs->info.info[i];
         counting++;
       }
 
@@ -1451,6 +1792,14 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
     }
   }
 
+  if (sync->mode == SYNC_TIMEOUT)
+    gst_tensor_time_sync_finish_timeout (collect, sync);
+
+  if (missing) {
+    *need_buffer = TRUE;
+    return FALSE;
+  }
+
   configs->rate_d = old_denominator;
   configs->rate_n = old_numerator;
 
@@ -1458,6 +1807,24 @@ gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect,
   /* not eos */
   return FALSE;
 }
+
+/**
+ * @brief Update the tensors config of the collect pad with the caps.
+ */
+gboolean
+gst_tensor_collect_pad_set_config (GstTensorCollectPadData * pad,
+    const GstCaps * caps)
+{
+  GstStructure *structure;
+
+  g_return_val_if_fail (pad != NULL, FALSE);
+  g_return_val_if_fail (caps != NULL, FALSE);
+
+  structure = gst_caps_get_structure (caps, 0);
+  gst_tensors_config_from_structure (&pad->config, structure);
+
+  return gst_tensors_config_validate (&pad->config);
+}
 #endif
 /**
  * @brief Get the version of NNStreamer.
@@ -62,6 +62,8 @@ typedef enum
   SYNC_NOSYNC = 0,
   SYNC_SLOWEST = 1,
   SYNC_BASEPAD = 2,
+  SYNC_LATEST = 3,
+  SYNC_TIMEOUT = 4,
   SYNC_END,
 } tensor_time_sync_mode;
 
@@ -73,14 +75,48 @@ typedef struct _tensor_sync_basepad_data{
   GstClockTime duration;
 } tensor_sync_basepad_data;
 
+/**
+ * @brief Tensor Merge/Mux sync data for latest mode
+ * Emits when the base pad has data, with the most recent buffer of the other pads.
+ */
+typedef struct _tensor_sync_latest_data{
+  guint sink_id;
+  GstClockTime max_staleness; /**< max difference between the base and the other buffers, GST_CLOCK_TIME_NONE for no limit */
+} tensor_sync_latest_data;
+
+/**
+ * @brief Tensor Merge/Mux sync data for timeout mode
+ * Waits all pads until the timeout after the first buffer of each output, then emits with the most recent buffer of the late pads.
+ */
+typedef struct _tensor_sync_timeout_data{
+  GstClockTime timeout;
+} tensor_sync_timeout_data;
+
+/**
+ * @brief Tensor Merge/Mux timer of current output in timeout mode
+ * The timer is not in the union of the sync data, because the mode may be changed while the timer is armed.
+ */
+typedef struct _tensor_sync_timer{
+  GThread *thread; /**< thread to wake up the collect pads when the timer expires */
+  GCond cond; /**< condition to arm, cancel and stop the timer */
+  gint64 deadline; /**< monotonic time when the timer expires, 0 if the timer is not armed */
+  guint seq; /**< changed when the timer is armed or cancelled */
+  gboolean stop; /**< TRUE to stop the thread */
+  GstCollectPads *collect; /**< collect pads of the element */
+} tensor_sync_timer;
+
 /**
  * @brief Tensor Merge/Mux time sync data
  */
 typedef struct _tensor_time_sync_data {
   tensor_time_sync_mode mode;
   gchar *option;
+  GMutex lock; /**< lock for the timer in timeout mode, armed from the streaming thread of each sink pad */
+  tensor_sync_timer timer; /**< timer in timeout mode */
   union {
     tensor_sync_basepad_data data_basepad;
+    tensor_sync_latest_data data_latest;
+    tensor_sync_timeout_data data_timeout;
   };
 } tensor_time_sync_data;
 
@@ -94,6 +130,7 @@ typedef struct
   GstClockTime dts_timestamp;
   GstBuffer *buffer;
   GstPad *pad;
+  GstTensorsConfig config; /**< tensors config of the pad, updated with caps event */
 } GstTensorCollectPadData;
 
 /**
@@ -155,5 +192,55 @@ gst_tensor_time_sync_get_current_time (GstCollectPads * collect, tensor_time_syn
 extern gboolean
 gst_tensor_time_sync_buffer_from_collectpad (GstCollectPads * collect, tensor_time_sync_data * sync, GstClockTime current_time, gboolean * need_buffer, GstBuffer * tensors_buf, GstTensorsConfig * configs);
 
+/**
+ * @brief Check the sync mode may change the waiting state of the collect pads.
+ * Mux / merge adds the pad with gst_collect_pads_add_pad (lock=TRUE) if this returns FALSE.
+ * @param sync Synchronization Option
+ * @return TRUE in latest and timeout mode
+ */
+extern gboolean
+gst_tensor_time_sync_change_waiting (tensor_time_sync_data * sync);
+
+/**
+ * @brief Set the waiting state of the collect pads for the sync mode.
+ * In latest mode, only the base pad is waiting. Otherwise, all pads are waiting.
+ * The pads are locked (waiting state is not changed) in the modes which do not change the waiting state.
+ * Call this with the stream lock of collect pads.
+ * @param collect Collect pad.
+ * @param sync Synchronization Option
+ */
+extern void
+gst_tensor_time_sync_reset_waiting (GstCollectPads * collect, tensor_time_sync_data * sync);
+
+/**
+ * @brief Start the timer of current output in timeout mode. (Do nothing in other modes or if the timer is already started.)
+ * Mux / merge calls this when a buffer arrives (clip function of collect pads).
+ * Only one timer is armed at the same time, protected by the lock of sync data.
+ * When the timer expires, the thread of the timer sets the late pads not waiting, then the streaming thread of the queued buffer generates an output.
+ * @param collect Collect pad.
+ * @param sync Synchronization Option
+ */
+extern void
+gst_tensor_time_sync_start_timeout (GstCollectPads * collect, tensor_time_sync_data * sync);
+
+/**
+ * @brief Stop the timer of current output and the thread of the timer, and set all pads waiting.
+ * Call this without the stream lock of collect pads, after the collect pads are stopped (no buffer arrives).
+ * @param collect Collect pad.
+ * @param sync Synchronization Option
+ */
+extern void
+gst_tensor_time_sync_stop_timeout (GstCollectPads * collect, tensor_time_sync_data * sync);
+
+/**
+ * @brief Update the tensors config of the collect pad with the caps.
+ * Mux / merge calls this with the caps event, so that the caps are not parsed for each collected buffer.
+ * @return True if the config is valid.
+ * @param pad Collect pad data.
+ * @param caps Current caps of the pad.
+ */
+extern gboolean
+gst_tensor_collect_pad_set_config (GstTensorCollectPadData * pad, const GstCaps * caps);
+
 G_END_DECLS
 #endif /* __GST_TENSOR_COMMON_H__ */
@@ -25,8 +25,11 @@
 #ifndef __CONVERTER_MEDIA_INFO_H__
 #define __CONVERTER_MEDIA_INFO_H__
 
+#include <tensor_record.h>
+
 #ifndef NO_VIDEO
 #include <gst/video/video-info.h>
+#include <gst/video/gstvideometa.h>
 
 /**
  * @brief Caps string for supported video format
@@ -38,9 +41,25 @@
 #define append_video_caps_template(caps) \
     gst_caps_append (caps, gst_caps_from_string (VIDEO_CAPS_STR))
 
+/**
+ * @brief Supported video formats to be converted to RGB, BGR or GRAY8 (property video-format)
+ */
+#define VIDEO_CONVERT_FORMATS "{ NV12, NV21, I420, YV12, YUY2, UYVY }"
+
+/**
+ * @brief Caps string for the video formats to be converted
+ */
+#define VIDEO_CONVERT_CAPS_STR \
+    GST_VIDEO_CAPS_MAKE (VIDEO_CONVERT_FORMATS) \
+    ", views = (int) 1, interlace-mode = (string) progressive"
+
+#define append_video_convert_caps_template(caps) \
+    gst_caps_append (caps, gst_caps_from_string (VIDEO_CONVERT_CAPS_STR))
+
 #define is_video_supported(...) TRUE
 #else
 #define append_video_caps_template(caps)
+#define append_video_convert_caps_template(caps)
 #define is_video_supported(...) FALSE
 
 #define GstVideoInfo gsize
@@ -71,6 +90,18 @@ typedef enum {
 #define GST_VIDEO_INFO_SIZE(...) 0
 #define GST_VIDEO_INFO_FPS_N(...) 0
 #define GST_VIDEO_INFO_FPS_D(...) 1
+#define GST_VIDEO_INFO_PLANE_STRIDE(...) 0
+
+/**
+ * @brief Dummy video meta (strides and offsets of the planes)
+ */
+typedef struct {
+  gsize offset[4];
+  gint stride[4];
+} GstVideoMeta;
+
+#define GST_VIDEO_META_API_TYPE G_TYPE_NONE
+#define gst_buffer_get_video_meta(...) NULL
 #endif /* NO_VIDEO */
 
 #ifndef NO_AUDIO
@@ -131,4 +162,10 @@ typedef enum {
 #define append_octet_caps_template(caps) \
     gst_caps_append (caps, gst_caps_from_string (OCTET_CAPS_STR))
 
+/**
+ * @brief Caps string for the recorded tensor stream (handled by the converter sub-plugin "tensor_record")
+ */
+#define append_record_caps_template(caps) \
+    gst_caps_append (caps, gst_caps_from_string (NNS_TENSOR_RECORD_CAPS_STR))
+
 #endif /* __CONVERTER_MEDIA_INFO_H__ */
@@ -0,0 +1,581 @@
+/**
+ * NNStreamer video color-conversion and resize for tensor-converter
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ */
+
+/**
+ * @file  converter-video-convert.c
+ * @date  18 Oct 2020
+ * @brief Fused color-conversion (YUV to RGB/BGR/GRAY8) and resize of video frames for tensor-converter
+ * @see https://github.com/nnsuite/nnstreamer
+ * @author  agent <agent@local>
+ * @bug No known bugs except for NYI items
+ *
+ * The frame is converted in one pass per row. For each outgoing row, the
+ * components are sampled (nearest or bilinear, 8-bit fixed point weights)
+ * from the incoming planes into the line buffers, then the line buffers are
+ * converted to RGB/BGR/GRAY8 (BT.601, limited range) with simple loops
+ * which the compiler can vectorize. There is no intermediate frame.
+ */
+
+#include <string.h>
+#include <tensor_common.h>
+#include "converter-video-convert.h"
+#include "converter-media-info.h"
+
+#ifndef NO_VIDEO
+#include <gst/video/video.h>
+
+/**
+ * @brief Sampling table of a component along an axis.
+ */
+typedef struct
+{
+  guint *idx0; /**< first index (x: byte offset, y: row) */
+  guint *idx1; /**< second index (x: byte offset, y: row) */
+  guint *weight; /**< weight of second index (0 ~ 256) */
+} conv_video_sample_table;
+
+/**
+ * @brief Internal data structure of the video converter.
+ */
+struct _GstTensorVideoConvert
+{
+  GstVideoInfo in_info; /**< incoming video info */
+  GstTensorVideoConvertOption option; /**< options to convert */
+
+  guint channels; /**< the number of channels in outgoing tensor */
+  guint out_width; /**< width of outgoing tensor */
+  guint out_height; /**< height of outgoing tensor */
+  guint roi_x; /**< x offset of the scaled image (letterbox) */
+  guint roi_y; /**< y offset of the scaled image (letterbox) */
+  guint roi_w; /**< width of the scaled image */
+  guint roi_h; /**< height of the scaled image */
+
+  conv_video_sample_table table_x[3]; /**< sampling table (Y, U, V) along x */
+  conv_video_sample_table table_y[3]; /**< sampling table (Y, U, V) along y */
+
+  guint8 *line[3]; /**< sampled components of a row */
+  guint8 *line_rgb; /**< converted row, used for float32 output */
+};
+
+/**
+ * @brief Clip the value to uint8.
+ */
+#define CONV_CLIP(v) ((v) < 0 ? 0 : ((v) > 255 ? 255 : (v)))
+
+/**
+ * @brief Parse the color format of outgoing tensor.
+ */
+gint
+gst_tensor_video_convert_parse_format (const gchar * format_str)
+{
+  GstVideoFormat format;
+
+  if (format_str == NULL || format_str[0] == '\0')
+    return GST_VIDEO_FORMAT_UNKNOWN;
+
+  format = gst_video_format_from_string (format_str);
+  switch (format) {
+    case GST_VIDEO_FORMAT_RGB:
+    case GST_VIDEO_FORMAT_BGR:
+    case GST_VIDEO_FORMAT_GRAY8:
+      break;
+    default:
+      format = GST_VIDEO_FORMAT_UNKNOWN;
+      break;
+  }
+
+  return format;
+}
+
+/**
+ * @brief Get the string of the color format of outgoing tensor.
+ */
+const gchar *
+gst_tensor_video_convert_get_format_string (gint format)
+{
+  if (format == GST_VIDEO_FORMAT_UNKNOWN)
+    return "";
+
+  return gst_video_format_to_string ((GstVideoFormat) format);
+}
+
+/**
+ * @brief Parse the interpolation method.
+ */
+conv_video_resize_method
+gst_tensor_video_convert_parse_method (const gchar * method_str)
+{
+  if (method_str) {
+    if (g_ascii_strcasecmp (method_str, "nearest") == 0)
+      return CONV_VIDEO_RESIZE_NEAREST;
+    if (g_ascii_strcasecmp (method_str, "bilinear") == 0)
+      return CONV_VIDEO_RESIZE_BILINEAR;
+  }
+
+  return CONV_VIDEO_RESIZE_UNKNOWN;
+}
+
+/**
+ * @brief Get the string of the interpolation method.
+ */
+const gchar *
+gst_tensor_video_convert_get_method_string (conv_video_resize_method method)
+{
+  switch (method) {
+    case CONV_VIDEO_RESIZE_NEAREST:
+      return "nearest";
+    case CONV_VIDEO_RESIZE_BILINEAR:
+      return "bilinear";
+    default:
+      break;
+  }
+
+  return "unknown";
+}
+
+/**
+ * @brief Check the video format in caps should be converted.
+ */
+gboolean
+gst_tensor_video_convert_check_caps (const GstCaps * caps)
+{
+  GstCaps *yuv_caps;
+  gboolean ret;
+
+  g_return_val_if_fail (caps != NULL, FALSE);
+
+  yuv_caps = gst_caps_from_string ("video/x-raw, format = (string) "
+      VIDEO_CONVERT_FORMATS);
+  ret = gst_caps_is_subset (caps, yuv_caps);
+  gst_caps_unref (yuv_caps);
+
+  return ret;
+}
+
+/**
+ * @brief Remove the video formats to be converted from given caps.
+ */
+GstCaps *
+gst_tensor_video_convert_remove_caps (GstCaps * caps)
+{
+  GstCaps *yuv_caps, *result;
+
+  g_return_val_if_fail (caps != NULL, NULL);
+
+  yuv_caps = gst_caps_from_string ("video/x-raw, format = (string) "
+      VIDEO_CONVERT_FORMATS);
+  result = gst_caps_subtract (caps, yuv_caps);
+
+  gst_caps_unref (yuv_caps);
+  gst_caps_unref (caps);
+  return result;
+}
+
+/**
+ * @brief Initialize the sampling table.
+ * @param table sampling table to be initialized
+ * @param in_len the length of incoming image
+ * @param src_len the length of incoming component
+ * @param dest_len the length of outgoing image
+ * @param sub log2 of the subsampling factor of the component
+ * @param pstride pixel stride (1 for the rows)
+ * @param method interpolation method
+ */
+static void
+gst_tensor_video_convert_init_table (conv_video_sample_table * table,
+    guint in_len, guint src_len, guint dest_len, guint sub, guint pstride,
+    conv_video_resize_method method)
+{
+  gdouble scale, pos;
+  guint i, idx;
+
+  table->idx0 = g_new (guint, dest_len);
+  table->idx1 = g_new (guint, dest_len);
+  table->weight = g_new (guint, dest_len);
+
+  scale = (gdouble) in_len / dest_len;
+
+  for (i = 0; i < dest_len; i++) {
+    if (method == CONV_VIDEO_RESIZE_NEAREST) {
+      idx = (guint) (((i + 0.5) * scale) / (1 << sub));
+      idx = MIN (idx, src_len - 1);
+
+      table->idx0[i] = table->idx1[i] = idx * pstride;
+      table->weight[i] = 0;
+    } else {
+      pos = ((i + 0.5) * scale) / (1 << sub) - 0.5;
+      pos = CLAMP (pos, 0.0, (gdouble) (src_len - 1));
+      idx = (guint) pos;
+
+      table->idx0[i] = idx * pstride;
+      if (idx + 1 < src_len) {
+        table->idx1[i] = (idx + 1) * pstride;
+        table->weight[i] = (guint) ((pos - idx) * 256.0 + 0.5);
+      } else {
+        table->idx1[i] = idx * pstride;
+        table->weight[i] = 0;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Free the sampling table.
+ */
+static void
+gst_tensor_video_convert_free_table (conv_video_sample_table * table)
+{
+  g_free (table->idx0);
+  g_free (table->idx1);
+  g_free (table->weight);
+  table->idx0 = table->idx1 = table->weight = NULL;
+}
+
+/**
+ * @brief Create the converter with incoming caps and options.
+ */
+GstTensorVideoConvert *
+gst_tensor_video_convert_new (const GstCaps * caps,
+    const GstTensorVideoConvertOption * option, GstTensorInfo * info)
+{
+  GstTensorVideoConvert *conv;
+  const GstVideoFormatInfo *finfo;
+  guint in_w, in_h, c, n_comp;
+  guint i;
+
+  g_return_val_if_fail (caps != NULL, NULL);
+  g_return_val_if_fail (option != NULL, NULL);
+  g_return_val_if_fail (info != NULL, NULL);
+
+  if (option->format == GST_VIDEO_FORMAT_UNKNOWN) {
+    GST_ERROR ("The color format of outgoing tensor is not given.");
+    return NULL;
+  }
+
+  if (option->type != _NNS_UINT8 && option->type != _NNS_FLOAT32) {
+    GST_ERROR ("The type of outgoing tensor should be uint8 or float32.");
+    return NULL;
+  }
+
+  if (option->method == CONV_VIDEO_RESIZE_UNKNOWN) {
+    GST_ERROR ("Unknown interpolation method.");
+    return NULL;
+  }
+
+  conv = g_new0 (GstTensorVideoConvert, 1);
+  conv->option = *option;
+
+  gst_video_info_init (&conv->in_info);
+  if (!gst_video_info_from_caps (&conv->in_info, caps)) {
+    GST_ERROR ("Failed to get video info from caps.");
+    g_free (conv);
+    return NULL;
+  }
+
+  in_w = GST_VIDEO_INFO_WIDTH (&conv->in_info);
+  in_h = GST_VIDEO_INFO_HEIGHT (&conv->in_info);
+  finfo = conv->in_info.finfo;
+
+  conv->channels = (option->format == GST_VIDEO_FORMAT_GRAY8) ? 1 : 3;
+  conv->out_width = (option->width > 0) ? option->width : in_w;
+  conv->out_height = (option->height > 0) ? option->height : in_h;
+
+  conv->roi_x = conv->roi_y = 0;
+  conv->roi_w = conv->out_width;
+  conv->roi_h = conv->out_height;
+
+  if (option->letterbox) {
+    /* keep the aspect ratio, scale = min (out_w / in_w, out_h / in_h) */
+    if ((guint64) conv->out_width * in_h < (guint64) conv->out_height * in_w) {
+      conv->roi_h = MAX (1, (guint) ((guint64) in_h * conv->out_width / in_w));
+    } else {
+      conv->roi_w = MAX (1, (guint) ((guint64) in_w * conv->out_height / in_h));
+    }
+
+    conv->roi_x = (conv->out_width - conv->roi_w) / 2;
+    conv->roi_y = (conv->out_height - conv->roi_h) / 2;
+  }
+
+  /* Y only for GRAY8 */
+  n_comp = (conv->channels == 1) ? 1 : 3;
+
+  for (c = 0; c < n_comp; c++) {
+    gst_tensor_video_convert_init_table (&conv->table_x[c], in_w,
+        GST_VIDEO_INFO_COMP_WIDTH (&conv->in_info, c), conv->roi_w,
+        GST_VIDEO_FORMAT_INFO_W_SUB (finfo, c), GST_VIDEO_INFO_COMP_PSTRIDE
+        (&conv->in_info, c), option->method);
+    gst_tensor_video_convert_init_table (&conv->table_y[c], in_h,
+        GST_VIDEO_INFO_COMP_HEIGHT (&conv->in_info, c), conv->roi_h,
+        GST_VIDEO_FORMAT_INFO_H_SUB (finfo, c), 1, option->method);
+
+    conv->line[c] = g_malloc (conv->roi_w);
+  }
+
+  if (option->type == _NNS_FLOAT32)
+    conv->line_rgb = g_malloc (conv->roi_w * conv->channels);
+
+  /* [color][width][height][frames] */
+  gst_tensor_info_init (info);
+  info->type = option->type;
+  info->dimension[0] = conv->channels;
+  info->dimension[1] = conv->out_width;
+  info->dimension[2] = conv->out_height;
+  for (i = 3; i < NNS_TENSOR_RANK_LIMIT; i++)
+    info->dimension[i] = 1;
+
+  return conv;
+}
+
+/**
+ * @brief Free the converter.
+ */
+void
+gst_tensor_video_convert_free (GstTensorVideoConvert * conv)
+{
+  guint c;
+
+  if (conv == NULL)
+    return;
+
+  for (c = 0; c < 3; c++) {
+    gst_tensor_video_convert_free_table (&conv->table_x[c]);
+    gst_tensor_video_convert_free_table (&conv->table_y[c]);
+    g_free (conv->line[c]);
+  }
+
+  g_free (conv->line_rgb);
+  g_free (conv);
+}
+
+/**
+ * @brief Sample a row of the component.
+ */
+static inline void
+gst_tensor_video_convert_sample_line (guint8 * line, const guint8 * row0,
+    const guint8 * row1, guint wy, const conv_video_sample_table * tx,
+    guint len)
+{
+  guint x, wx, top, bottom;
+
+  for (x = 0; x < len; x++) {
+    wx = tx->weight[x];
+    top = row0[tx->idx0[x]] * (256 - wx) + row0[tx->idx1[x]] * wx;
+    bottom = row1[tx->idx0[x]] * (256 - wx) + row1[tx->idx1[x]] * wx;
+
+    line[x] = (guint8) ((top * (256 - wy) + bottom * wy + 32768) >> 16);
+  }
+}
+
+/**
+ * @brief Convert the sampled components (YUV) to RGB, BGR or GRAY8.
+ */
+static inline void
+gst_tensor_video_convert_color_line (GstTensorVideoConvert * conv,
+    guint8 * dest)
+{
+  const guint8 *ly, *lu, *lv;
+  guint x, r_idx, b_idx;
+  gint c, d, e;
+
+  ly = conv->line[0];
+  lu = conv->line[1];
+  lv = conv->line[2];
+
+  if (conv->channels == 1) {
+    for (x = 0; x < conv->roi_w; x++) {
+      c = ((gint) ly[x] - 16) * 298;
+      dest[x] = (guint8) CONV_CLIP ((c + 128) >> 8);
+    }
+    return;
+  }
+
+  if (conv->option.format == GST_VIDEO_FORMAT_BGR) {
+    r_idx = 2;
+    b_idx = 0;
+  } else {
+    r_idx = 0;
+    b_idx = 2;
+  }
+
+  for (x = 0; x < conv->roi_w; x++) {
+    c = ((gint) ly[x] - 16) * 298;
+    d = (gint) lu[x] - 128;
+    e = (gint) lv[x] - 128;
+
+    dest[x * 3 + r_idx] = (guint8) CONV_CLIP ((c + 409 * e + 128) >> 8);
+    dest[x * 3 + 1] = (guint8) CONV_CLIP ((c - 100 * d - 208 * e + 128) >> 8);
+    dest[x * 3 + b_idx] = (guint8) CONV_CLIP ((c + 516 * d + 128) >> 8);
+  }
+}
+
+/**
+ * @brief Convert a video frame and write the tensor into given memory.
+ */
+gboolean
+gst_tensor_video_convert_frame (GstTensorVideoConvert * conv,
+    GstBuffer * buf, guint8 * dest)
+{
+  GstVideoFrame frame;
+  gsize esize, pixel_size, row_size;
+  guint y, c, n_comp, i, len;
+  guint8 *dest_row;
+
+  g_return_val_if_fail (conv != NULL, FALSE);
+  g_return_val_if_fail (buf != NULL, FALSE);
+  g_return_val_if_fail (dest != NULL, FALSE);
+
+  /* the video meta (if exists) is used to get the stride and offset */
+  if (!gst_video_frame_map (&frame, &conv->in_info, buf, GST_MAP_READ)) {
+    GST_ERROR ("Failed to map the video frame.");
+    return FALSE;
+  }
+
+  esize = gst_tensor_get_element_size (conv->option.type);
+  pixel_size = conv->channels * esize;
+  row_size = conv->out_width * pixel_size;
+  n_comp = (conv->channels == 1) ? 1 : 3;
+  len = conv->roi_w * conv->channels;
+
+  /* letterbox, fill the borders (top and bottom) */
+  if (conv->roi_y > 0)
+    memset (dest, 0, conv->roi_y * row_size);
+
+  if (conv->roi_y + conv->roi_h < conv->out_height)
+    memset (dest + (conv->roi_y + conv->roi_h) * row_size, 0,
+        (conv->out_height - conv->roi_y - conv->roi_h) * row_size);
+
+  for (y = 0; y < conv->roi_h; y++) {
+    dest_row = dest + (conv->roi_y + y) * row_size;
+
+    /* letterbox, fill the borders (left and right) */
+    if (conv->roi_w < conv->out_width) {
+      memset (dest_row, 0, conv->roi_x * pixel_size);
+      memset (dest_row + (conv->roi_x + conv->roi_w) * pixel_size, 0,
+          (conv->out_width - conv->roi_x - conv->roi_w) * pixel_size);
+    }
+
+    dest_row += conv->roi_x * pixel_size;
+
+    for (c = 0; c < n_comp; c++) {
+      const guint8 *comp = GST_VIDEO_FRAME_COMP_DATA (&frame, c);
+      gint stride = GST_VIDEO_FRAME_COMP_STRIDE (&frame, c);
+      const conv_video_sample_table *ty = &conv->table_y[c];
+
+      gst_tensor_video_convert_sample_line (conv->line[c],
+          comp + ty->idx0[y] * stride, comp + ty->idx1[y] * stride,
+          ty->weight[y], &conv->table_x[c], conv->roi_w);
+    }
+
+    if (conv->option.type == _NNS_FLOAT32) {
+      float *dest_f = (float *) dest_row;
+
+      gst_tensor_video_convert_color_line (conv, conv->line_rgb);
+      for (i = 0; i < len; i++)
+        dest_f[i] = (float) conv->line_rgb[i];
+    } else {
+      gst_tensor_video_convert_color_line (conv, dest_row);
+    }
+  }
+
+  gst_video_frame_unmap (&frame);
+  return TRUE;
+}
+
+#else /* NO_VIDEO */
+
+/**
+ * @brief Parse the color format of outgoing tensor. (no video support)
+ */
+gint
+gst_tensor_video_convert_parse_format (const gchar * format_str)
+{
+  return GST_VIDEO_FORMAT_UNKNOWN;
+}
+
+/**
+ * @brief Get the string of the color format of outgoing tensor. (no video support)
+ */
+const gchar *
+gst_tensor_video_convert_get_format_string (gint format)
+{
+  return "";
+}
+
+/**
+ * @brief Parse the interpolation method. (no video support)
+ */
+conv_video_resize_method
+gst_tensor_video_convert_parse_method (const gchar * method_str)
+{
+  return CONV_VIDEO_RESIZE_UNKNOWN;
+}
+
+/**
+ * @brief Get the string of the interpolation method. (no video support)
+ */
+const gchar *
+gst_tensor_video_convert_get_method_string (conv_video_resize_method method)
+{
+  return "unknown";
+}
+
+/**
+ * @brief Check the video format in caps should be converted. (no video support)
+ */
+gboolean
+gst_tensor_video_convert_check_caps (const GstCaps * caps)
+{
+  return FALSE;
+}
+
+/**
+ * @brief Remove the video formats to be converted from given caps. (no video support)
+ */
+GstCaps *
+gst_tensor_video_convert_remove_caps (GstCaps * caps)
+{
+  return caps;
+}
+
+/**
+ * @brief Create the converter. (no video support)
+ */
+GstTensorVideoConvert *
+gst_tensor_video_convert_new (const GstCaps * caps,
+    const GstTensorVideoConvertOption * option, GstTensorInfo * info)
+{
+  return NULL;
+}
+
+/**
+ * @brief Free the converter. (no video support)
+ */
+void
+gst_tensor_video_convert_free (GstTensorVideoConvert * conv)
+{
+  return;
+}
+
+/**
+ * @brief Convert a video frame. (no video support)
+ */
+gboolean
+gst_tensor_video_convert_frame (GstTensorVideoConvert * conv,
+    GstBuffer * buf, guint8 * dest)
+{
+  return FALSE;
+}
+
+#endif /* NO_VIDEO */
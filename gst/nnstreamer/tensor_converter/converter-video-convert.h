@@ -0,0 +1,128 @@
+/**
+ * NNStreamer video color-conversion and resize for tensor-converter
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ */
+
+/**
+ * @file  converter-video-convert.h
+ * @date  18 Oct 2020
+ * @brief Fused color-conversion (YUV to RGB/BGR/GRAY8) and resize of video frames for tensor-converter
+ * @see https://github.com/nnsuite/nnstreamer
+ * @author  agent <agent@local>
+ * @bug No known bugs except for NYI items
+ */
+
+#ifndef __CONVERTER_VIDEO_CONVERT_H__
+#define __CONVERTER_VIDEO_CONVERT_H__
+
+#include <glib.h>
+#include <gst/gst.h>
+#include "tensor_typedef.h"
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Interpolation method to resize the video frame.
+ */
+typedef enum
+{
+  CONV_VIDEO_RESIZE_NEAREST = 0,
+  CONV_VIDEO_RESIZE_BILINEAR = 1,
+  CONV_VIDEO_RESIZE_UNKNOWN
+} conv_video_resize_method;
+
+/**
+ * @brief Options to convert the video frame.
+ */
+typedef struct
+{
+  gint format; /**< GstVideoFormat of outgoing tensor (RGB, BGR or GRAY8), 0 (unknown) to disable the conversion */
+  guint width; /**< width of outgoing tensor, 0 to keep incoming width */
+  guint height; /**< height of outgoing tensor, 0 to keep incoming height */
+  conv_video_resize_method method; /**< interpolation method */
+  gboolean letterbox; /**< true to keep the aspect ratio and fill the borders with zero */
+  tensor_type type; /**< type of outgoing tensor (uint8 or float32) */
+} GstTensorVideoConvertOption;
+
+typedef struct _GstTensorVideoConvert GstTensorVideoConvert;
+
+/**
+ * @brief Parse the color format of outgoing tensor.
+ * @return GstVideoFormat (0 if the format is not supported)
+ */
+extern gint
+gst_tensor_video_convert_parse_format (const gchar * format_str);
+
+/**
+ * @brief Get the string of the color format of outgoing tensor.
+ */
+extern const gchar *
+gst_tensor_video_convert_get_format_string (gint format);
+
+/**
+ * @brief Parse the interpolation method.
+ */
+extern conv_video_resize_method
+gst_tensor_video_convert_parse_method (const gchar * method_str);
+
+/**
+ * @brief Get the string of the interpolation method.
+ */
+extern const gchar *
+gst_tensor_video_convert_get_method_string (conv_video_resize_method method);
+
+/**
+ * @brief Check the video format in caps should be converted.
+ * @return TRUE if given caps is YUV video which can be converted.
+ */
+extern gboolean
+gst_tensor_video_convert_check_caps (const GstCaps * caps);
+
+/**
+ * @brief Remove the video formats to be converted from given caps.
+ * @param caps the caps to be updated, this function takes the ownership.
+ * @return the caps without YUV video.
+ */
+extern GstCaps *
+gst_tensor_video_convert_remove_caps (GstCaps * caps);
+
+/**
+ * @brief Create the converter with incoming caps and options.
+ * @param[in] caps incoming video caps (YUV)
+ * @param[in] option options to convert the video frame
+ * @param[out] info tensor info of outgoing frame ([color][width][height][1])
+ * @return converter handle, NULL if failed
+ */
+extern GstTensorVideoConvert *
+gst_tensor_video_convert_new (const GstCaps * caps,
+    const GstTensorVideoConvertOption * option, GstTensorInfo * info);
+
+/**
+ * @brief Free the converter.
+ */
+extern void
+gst_tensor_video_convert_free (GstTensorVideoConvert * conv);
+
+/**
+ * @brief Convert a video frame and write the tensor into given memory.
+ * @param[in] conv converter handle
+ * @param[in] buf incoming video buffer (a frame)
+ * @param[out] dest memory to be filled (size of a frame in outgoing tensor)
+ * @return TRUE if converted
+ */
+extern gboolean
+gst_tensor_video_convert_frame (GstTensorVideoConvert * conv,
+    GstBuffer * buf, guint8 * dest);
+
+G_END_DECLS
+#endif /* __CONVERTER_VIDEO_CONVERT_H__ */
@@ -105,6 +105,13 @@ enum
   PROP_INPUT_TYPE,
   PROP_FRAMES_PER_TENSOR,
   PROP_SET_TIMESTAMP,
+  PROP_VIDEO_FORMAT,
+  PROP_VIDEO_SIZE,
+  PROP_VIDEO_RESIZE,
+  PROP_VIDEO_LETTERBOX,
+  PROP_VIDEO_TYPE,
+  PROP_MODE,
+  PROP_OPTION,
   PROP_SILENT
 };
 
@@ -123,6 +130,16 @@ enum
  */
 #define DEFAULT_FRAMES_PER_TENSOR 1
 
+/**
+ * @brief Default interpolation method to resize the video.
+ */
+#define DEFAULT_VIDEO_RESIZE "bilinear"
+
+/**
+ * @brief Default type of the tensor converted from YUV video.
+ */
+#define DEFAULT_VIDEO_TYPE "uint8"
+
 #define gst_tensor_converter_parent_class parent_class
 G_DEFINE_TYPE (GstTensorConverter, gst_tensor_converter, GST_TYPE_ELEMENT);
 
@@ -145,6 +162,14 @@ gst_tensor_converter_change_state (GstElement * element,
     GstStateChange transition);
 
 static void gst_tensor_converter_reset (GstTensorConverter * self);
+static gboolean gst_tensor_converter_setup_pool (GstTensorConverter * self,
+    gsize size);
+static GstBuffer *gst_tensor_converter_video_frame (GstTensorConverter *
+    self, GstBuffer * buf, gsize frame_size);
+static GstFlowReturn gst_tensor_converter_batch_frames (GstTensorConverter *
+    self, GstBuffer * buf, gsize frame_size, guint frames_in);
+static GstFlowReturn gst_tensor_converter_push_frames (GstTensorConverter *
+    self, GstBuffer * inbuf, gsize frame_size, guint frames_in);
 static GstCaps *gst_tensor_converter_query_caps (GstTensorConverter * self,
     GstPad * pad, GstCaps * filter);
 static gboolean gst_tensor_converter_parse_caps (GstTensorConverter * self,
@@ -223,6 +248,81 @@ gst_tensor_converter_class_init (GstTensorConverterClass * klass)
           "The flag to set timestamp when received a buffer with invalid timestamp",
           DEFAULT_SET_TIMESTAMP, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorConverter::video-format:
+   *
+   * The color format of the tensor converted from YUV video (RGB, BGR or GRAY8).
+   * If this property is set, GstTensorConverter accepts YUV video (NV12, NV21, I420, YV12, YUY2 and UYVY)
+   * and converts the color format and size of the frame in one pass. (no videoconvert and videoscale)
+   */
+  g_object_class_install_property (object_class, PROP_VIDEO_FORMAT,
+      g_param_spec_string ("video-format", "Video format",
+          "The color format of the tensor converted from YUV video (RGB, BGR or GRAY8)",
+          "", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::video-size:
+   *
+   * The size (width:height) of the tensor converted from YUV video.
+   * If this property is not set, GstTensorConverter keeps the size of incoming video.
+   */
+  g_object_class_install_property (object_class, PROP_VIDEO_SIZE,
+      g_param_spec_string ("video-size", "Video size",
+          "The size (width:height) of the tensor converted from YUV video", "",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::video-resize:
+   *
+   * The interpolation method to resize YUV video (nearest or bilinear).
+   */
+  g_object_class_install_property (object_class, PROP_VIDEO_RESIZE,
+      g_param_spec_string ("video-resize", "Video resize",
+          "The interpolation method to resize YUV video (nearest or bilinear)",
+          DEFAULT_VIDEO_RESIZE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::video-letterbox:
+   *
+   * The flag to keep the aspect ratio of YUV video when resizing it.
+   * The borders of the tensor are filled with zero.
+   */
+  g_object_class_install_property (object_class, PROP_VIDEO_LETTERBOX,
+      g_param_spec_boolean ("video-letterbox", "Video letterbox",
+          "The flag to keep the aspect ratio of YUV video when resizing it",
+          FALSE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::video-type:
+   *
+   * The type of the tensor converted from YUV video (uint8 or float32).
+   */
+  g_object_class_install_property (object_class, PROP_VIDEO_TYPE,
+      g_param_spec_string ("video-type", "Video type",
+          "The type of the tensor converted from YUV video (uint8 or float32)",
+          DEFAULT_VIDEO_TYPE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::mode:
+   *
+   * The name of the converter sub-plugin to be used instead of the built-in conversion.
+   * The sub-plugin handles the incoming media (e.g., mode=audio_feature to extract the features of audio/x-raw).
+   */
+  g_object_class_install_property (object_class, PROP_MODE,
+      g_param_spec_string ("mode", "Mode",
+          "The name of the converter sub-plugin to be used instead of the built-in conversion",
+          "", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorConverter::option:
+   *
+   * The option string for the converter sub-plugin. Refer to the sub-plugin for the format.
+   */
+  g_object_class_install_property (object_class, PROP_OPTION,
+      g_param_spec_string ("option", "Option",
+          "The option string for the converter sub-plugin", "",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstTensorConverter::silent:
    *
@@ -246,9 +346,11 @@ gst_tensor_converter_class_init (GstTensorConverterClass * klass)
 
   /* append caps string for all media types */
   append_video_caps_template (pad_caps);
+  append_video_convert_caps_template (pad_caps);
   append_audio_caps_template (pad_caps);
   append_text_caps_template (pad_caps);
   append_octet_caps_template (pad_caps);
+  append_record_caps_template (pad_caps);
 
   pad_template = gst_pad_template_new ("sink", GST_PAD_SINK, GST_PAD_ALWAYS,
       pad_caps);
@@ -301,8 +403,20 @@ gst_tensor_converter_init (GstTensorConverter * self)
   self->in_media_type = _NNS_MEDIA_INVALID;
   self->frame_size = 0;
   self->remove_padding = FALSE;
+  self->row_size = self->row_stride = 0;
+  self->num_rows = 0;
+  self->pool = NULL;
+  self->batch = NULL;
+  self->mode = NULL;
+  self->option = NULL;
   gst_tensor_info_init (&self->tensor_info);
 
+  memset (&self->video_option, 0, sizeof (GstTensorVideoConvertOption));
+  self->video_option.method =
+      gst_tensor_video_convert_parse_method (DEFAULT_VIDEO_RESIZE);
+  self->video_option.type = gst_tensor_get_type (DEFAULT_VIDEO_TYPE);
+  self->video_convert = NULL;
+
   self->adapter = gst_adapter_new ();
   gst_tensor_converter_reset (self);
 }
@@ -324,6 +438,9 @@ gst_tensor_converter_finalize (GObject * object)
     self->adapter = NULL;
   }
 
+  g_free (self->mode);
+  g_free (self->option);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -357,6 +474,63 @@ gst_tensor_converter_set_property (GObject * object, guint prop_id,
       self->set_timestamp = g_value_get_boolean (value);
       silent_debug ("Set timestamp = %d", self->set_timestamp);
       break;
+    case PROP_VIDEO_FORMAT:
+    {
+      const gchar *format = g_value_get_string (value);
+
+      self->video_option.format =
+          gst_tensor_video_convert_parse_format (format);
+      if (format && format[0] != '\0' &&
+          self->video_option.format == GST_VIDEO_FORMAT_UNKNOWN)
+        GST_WARNING ("video format %s is not supported.", format);
+      break;
+    }
+    case PROP_VIDEO_SIZE:
+    {
+      const gchar *size = g_value_get_string (value);
+      tensor_dim dim;
+
+      self->video_option.width = self->video_option.height = 0;
+      if (size && size[0] != '\0') {
+        if (gst_tensor_parse_dimension (size, dim) == 2) {
+          self->video_option.width = dim[0];
+          self->video_option.height = dim[1];
+        } else {
+          GST_WARNING ("video size %s is invalid, set width:height.", size);
+        }
+      }
+      break;
+    }
+    case PROP_VIDEO_RESIZE:
+      self->video_option.method =
+          gst_tensor_video_convert_parse_method (g_value_get_string (value));
+      if (self->video_option.method == CONV_VIDEO_RESIZE_UNKNOWN)
+        GST_WARNING ("unknown interpolation method.");
+      break;
+    case PROP_VIDEO_LETTERBOX:
+      self->video_option.letterbox = g_value_get_boolean (value);
+      break;
+    case PROP_VIDEO_TYPE:
+      self->video_option.type =
+          gst_tensor_get_type (g_value_get_string (value));
+      if (self->video_option.type != _NNS_UINT8 &&
+          self->video_option.type != _NNS_FLOAT32)
+        GST_WARNING ("video type should be uint8 or float32.");
+      break;
+    case PROP_MODE:
+      g_free (self->mode);
+      self->mode = g_value_dup_string (value);
+      if (self->mode && self->mode[0] == '\0') {
+        g_free (self->mode);
+        self->mode = NULL;
+      }
+      silent_debug ("Set mode = %s", GST_STR_NULL (self->mode));
+      break;
+    case PROP_OPTION:
+      g_free (self->option);
+      self->option = g_value_dup_string (value);
+      silent_debug ("Set option = %s", GST_STR_NULL (self->option));
+      break;
     case PROP_SILENT:
       self->silent = g_value_get_boolean (value);
       silent_debug ("Set silent = %d", self->silent);
@@ -401,6 +575,41 @@ gst_tensor_converter_get_property (GObject * object, guint prop_id,
     case PROP_SET_TIMESTAMP:
       g_value_set_boolean (value, self->set_timestamp);
       break;
+    case PROP_VIDEO_FORMAT:
+      g_value_set_string (value,
+          gst_tensor_video_convert_get_format_string
+          (self->video_option.format));
+      break;
+    case PROP_VIDEO_SIZE:
+      if (self->video_option.width > 0 && self->video_option.height > 0) {
+        g_value_take_string (value, g_strdup_printf ("%u:%u",
+                self->video_option.width, self->video_option.height));
+      } else {
+        g_value_set_string (value, "");
+      }
+      break;
+    case PROP_VIDEO_RESIZE:
+      g_value_set_string (value,
+          gst_tensor_video_convert_get_method_string
+          (self->video_option.method));
+      break;
+    case PROP_VIDEO_LETTERBOX:
+      g_value_set_boolean (value, self->video_option.letterbox);
+      break;
+    case PROP_VIDEO_TYPE:
+      if (self->video_option.type != _NNS_END) {
+        g_value_set_string (value,
+            gst_tensor_get_type_string (self->video_option.type));
+      } else {
+        g_value_set_string (value, "");
+      }
+      break;
+    case PROP_MODE:
+      g_value_set_string (value, self->mode ? self->mode : "");
+      break;
+    case PROP_OPTION:
+      g_value_set_string (value, self->option ? self->option : "");
+      break;
     case PROP_SILENT:
       g_value_set_boolean (value, self->silent);
       break;
@@ -529,6 +738,25 @@ gst_tensor_converter_sink_query (GstPad * pad, GstObject * parent,
       gst_query_set_accept_caps_result (query, res);
       return TRUE;
     }
+    case GST_QUERY_ALLOCATION:
+    {
+      GstCaps *caps;
+      gboolean need_pool;
+
+      gst_query_parse_allocation (query, &caps, &need_pool);
+
+      /**
+       * Let upstream attach the video meta, then we can get the actual stride
+       * of the rows and avoid the copy if there is no padding.
+       */
+      if (caps && gst_caps_get_size (caps) > 0 &&
+          gst_tensor_media_type_from_structure (gst_caps_get_structure (caps,
+                  0)) == _NNS_VIDEO && is_video_supported (self)) {
+        gst_query_add_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
+        return TRUE;
+      }
+      break;
+    }
     default:
       break;
   }
@@ -578,13 +806,10 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 {
   GstTensorConverter *self;
   GstTensorConfig *config;
-  GstAdapter *adapter;
   GstBuffer *inbuf;
-  gsize avail, buf_size, frame_size, out_size;
-  guint frames_in, frames_out;
+  gsize buf_size, frame_size;
+  guint frames_in;
   GstFlowReturn ret = GST_FLOW_OK;
-  GstClockTime pts, dts, duration;
-  gboolean have_framerate;
 
   buf_size = gst_buffer_get_size (buf);
   g_return_val_if_fail (buf_size > 0, GST_FLOW_ERROR);
@@ -594,9 +819,6 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   g_assert (self->tensor_configured);
   config = &self->tensor_config;
 
-  have_framerate = (config->rate_n > 0 && config->rate_d > 0);
-
-  frames_out = self->frames_per_tensor;
   inbuf = buf;
 
   switch (self->in_media_type) {
@@ -613,47 +835,31 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       /** colorspace * width * height * type */
       frame_size = color * width * height * type;
 
-      /** supposed 1 frame in buffer */
-      g_assert ((buf_size / self->frame_size) == 1);
-      frames_in = 1;
-
-      if (self->remove_padding) {
-        GstMapInfo src_info, dest_info;
-        int d0, d1;
-        unsigned int src_idx = 0, dest_idx = 0;
-        size_t size, offset;
-
-        inbuf = gst_buffer_new_and_alloc (frame_size);
-        gst_buffer_memset (inbuf, 0, 0, frame_size);
-
-        g_assert (gst_buffer_map (buf, &src_info, GST_MAP_READ));
-        g_assert (gst_buffer_map (inbuf, &dest_info, GST_MAP_WRITE));
-
+      if (self->video_convert || self->remove_padding ||
+          gst_buffer_get_video_meta (buf)) {
         /**
-         * Refer: https://gstreamer.freedesktop.org/documentation/design/mediatype-video-raw.html
+         * supposed 1 frame in buffer,
+         * convert color format and size or remove the padding of the rows
          */
-        size = offset = color * width * type;
+        frames_in = 1;
 
-        g_assert (offset % 4);
-        if (offset % 4) {
-          offset += 4 - (offset % 4);
-        }
-
-        for (d0 = 0; d0 < frames_in; d0++) {
-          for (d1 = 0; d1 < height; d1++) {
-            memcpy (dest_info.data + dest_idx, src_info.data + src_idx, size);
-            dest_idx += size;
-            src_idx += offset;
+        if (!self->batch_in_place) {
+          inbuf = gst_tensor_converter_video_frame (self, buf, frame_size);
+          if (inbuf == NULL) {
+            GST_ERROR_OBJECT (self, "Failed to convert the video frame.");
+            return GST_FLOW_ERROR;
           }
         }
+      } else {
+        /** no padding, buffer may contain multiple frames */
+        if (buf_size % frame_size) {
+          GST_ERROR_OBJECT (self, "Invalid buffer size %" G_GSIZE_FORMAT
+              " (frame size %" G_GSIZE_FORMAT ").", buf_size, frame_size);
+          gst_buffer_unref (buf);
+          return GST_FLOW_ERROR;
+        }
 
-        gst_buffer_unmap (buf, &src_info);
-        gst_buffer_unmap (inbuf, &dest_info);
-
-        /** copy timestamps */
-        gst_buffer_copy_into (inbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
-
-        gst_buffer_unref (buf);
+        frames_in = buf_size / frame_size;
       }
       break;
     }
@@ -667,7 +873,7 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       frame_size = self->frame_size;
       frames_in = 1;
 
-      if (buf_size != frame_size) {
+      if (buf_size != frame_size && !self->batch_in_place) {
         GstMapInfo src_info, dest_info;
         gsize block_size = MIN (buf_size, frame_size);
 
@@ -697,16 +903,32 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       break;
     case _NNS_MEDIA_PLUGINS:
     {
-      if (self->externalConverter == NULL ||
-          self->externalConverter->convert == NULL)
+      const NNStreamerExternalConverter *ex = self->externalConverter;
+
+      if (ex == NULL || ex->convert == NULL)
         return GST_FLOW_NOT_SUPPORTED;
-      inbuf = self->externalConverter->convert (self, buf, &frame_size,
-          &frames_in);
+      inbuf = ex->convert (self, buf, &frame_size, &frames_in);
 
-      g_assert (inbuf != NULL);
-      g_assert (frame_size > 0);
-      g_assert ((buf_size % frame_size) == 0);
-      break;
+      if (inbuf != buf) {
+        /* the sub-plugin returns new buffer or needs more data */
+        gst_buffer_unref (buf);
+      }
+
+      /* push the converted frames, and the pending frames if the sub-plugin drains them */
+      while (inbuf != NULL) {
+        g_assert (frame_size > 0);
+        g_assert ((gst_buffer_get_size (inbuf) % frame_size) == 0);
+
+        ret = gst_tensor_converter_push_frames (self, inbuf, frame_size,
+            frames_in);
+        if (ret != GST_FLOW_OK || ex->drain == NULL)
+          return ret;
+
+        inbuf = ex->drain (self, &frame_size, &frames_in);
+      }
+
+      /* the sub-plugin sets frame size 0 if the data is invalid */
+      return (frame_size > 0) ? GST_FLOW_OK : GST_FLOW_ERROR;
     }
     default:
       GST_ERROR_OBJECT (self, "Unsupported type %d\n", self->in_media_type);
@@ -714,6 +936,33 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       return GST_FLOW_ERROR;
   }
 
+  return gst_tensor_converter_push_frames (self, inbuf, frame_size, frames_in);
+}
+
+/**
+ * @brief Push the converted frames, split or aggregate the frames with frames-per-tensor.
+ * @param self this pointer to GstTensorConverter
+ * @param inbuf the buffer of converted frames, this function takes the ownership
+ * @param frame_size the size of a frame in outgoing tensor
+ * @param frames_in the number of frames in the buffer
+ * @return GST_FLOW_OK if successfully pushed
+ */
+static GstFlowReturn
+gst_tensor_converter_push_frames (GstTensorConverter * self,
+    GstBuffer * inbuf, gsize frame_size, guint frames_in)
+{
+  GstTensorConfig *config;
+  GstAdapter *adapter;
+  gsize avail, out_size;
+  guint frames_out;
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstClockTime pts, dts, duration;
+  gboolean have_framerate;
+
+  config = &self->tensor_config;
+  have_framerate = (config->rate_n > 0 && config->rate_d > 0);
+  frames_out = self->frames_per_tensor;
+
   /* convert format (bytes > time) and push segment event */
   if (self->need_segment) {
     GstSegment seg;
@@ -785,6 +1034,12 @@ gst_tensor_converter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   /* update old timestamp */
   self->old_timestamp = GST_BUFFER_TIMESTAMP (inbuf);
 
+  if (self->batch_in_place) {
+    /** write the frames into the outgoing buffer, no adapter */
+    return gst_tensor_converter_batch_frames (self, inbuf, frame_size,
+        frames_in);
+  }
+
   if (frames_in == frames_out) {
     silent_debug_timestamp (inbuf);
 
@@ -879,6 +1134,282 @@ gst_tensor_converter_change_state (GstElement * element,
   return ret;
 }
 
+/**
+ * @brief Get the stride and offset of the video rows in the buffer.
+ */
+static void
+gst_tensor_converter_video_get_stride (GstTensorConverter * self,
+    GstBuffer * buf, gsize * stride, gsize * offset)
+{
+  GstVideoMeta *meta;
+
+  *stride = self->row_stride;
+  *offset = 0;
+
+  /**
+   * Upstream may set the actual stride of the rows with the video meta.
+   * Refer: https://gstreamer.freedesktop.org/documentation/design/mediatype-video-raw.html
+   */
+  meta = gst_buffer_get_video_meta (buf);
+  if (meta) {
+    *stride = meta->stride[0];
+    *offset = meta->offset[0];
+  }
+}
+
+/**
+ * @brief Write a video frame into given memory (color-conversion or padding removal).
+ * @param self this pointer to GstTensorConverter
+ * @param buf the incoming buffer (single frame)
+ * @param dest the memory to be filled (size of a frame in outgoing tensor)
+ * @return TRUE if successfully written
+ */
+static gboolean
+gst_tensor_converter_video_write_frame (GstTensorConverter * self,
+    GstBuffer * buf, guint8 * dest)
+{
+  GstMapInfo info;
+  gsize stride, offset;
+  guint row;
+
+  if (self->video_convert) {
+    return gst_tensor_video_convert_frame (self->video_convert, buf, dest);
+  }
+
+  gst_tensor_converter_video_get_stride (self, buf, &stride, &offset);
+
+  if (stride < self->row_size || gst_buffer_get_size (buf) <
+      offset + stride * (self->num_rows - 1) + self->row_size) {
+    GST_ERROR_OBJECT (self, "Invalid stride %" G_GSIZE_FORMAT
+        " of the video rows.", stride);
+    return FALSE;
+  }
+
+  if (!gst_buffer_map (buf, &info, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Failed to map the incoming buffer.");
+    return FALSE;
+  }
+
+  if (stride == self->row_size) {
+    nns_memcpy (dest, info.data + offset, self->row_size * self->num_rows);
+  } else {
+    for (row = 0; row < self->num_rows; row++) {
+      nns_memcpy (dest + row * self->row_size,
+          info.data + offset + row * stride, self->row_size);
+    }
+  }
+
+  gst_buffer_unmap (buf, &info);
+  return TRUE;
+}
+
+/**
+ * @brief Get the video frame without padding (or converted).
+ * @param self this pointer to GstTensorConverter
+ * @param buf the incoming buffer (single frame), this function takes the ownership
+ * @param frame_size the size of a frame in outgoing tensor
+ * @return the buffer to be pushed, NULL if failed
+ */
+static GstBuffer *
+gst_tensor_converter_video_frame (GstTensorConverter * self,
+    GstBuffer * buf, gsize frame_size)
+{
+  GstBuffer *outbuf = NULL;
+  GstMapInfo info;
+  gsize stride, offset;
+
+  if (!self->video_convert) {
+    gst_tensor_converter_video_get_stride (self, buf, &stride, &offset);
+
+    if (stride == self->row_size) {
+      /** rows are already packed, share the memory without copy */
+      if (offset == 0 && gst_buffer_get_size (buf) == frame_size)
+        return buf;
+
+      if (offset > gst_buffer_get_size (buf) ||
+          frame_size > gst_buffer_get_size (buf) - offset) {
+        GST_ERROR_OBJECT (self, "Invalid offset %" G_GSIZE_FORMAT
+            " of the video frame, buffer size %" G_GSIZE_FORMAT ".", offset,
+            gst_buffer_get_size (buf));
+        goto done;
+      }
+
+      outbuf = gst_buffer_copy_region (buf, GST_BUFFER_COPY_ALL, offset,
+          frame_size);
+      goto done;
+    }
+  }
+
+  if (!self->pool ||
+      gst_buffer_pool_acquire_buffer (self->pool, &outbuf, NULL) !=
+      GST_FLOW_OK) {
+    GST_ERROR_OBJECT (self, "Failed to get the buffer from the pool.");
+    outbuf = NULL;
+    goto done;
+  }
+
+  if (!gst_buffer_map (outbuf, &info, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (self, "Failed to map the outgoing buffer.");
+    gst_buffer_unref (outbuf);
+    outbuf = NULL;
+    goto done;
+  }
+
+  if (!gst_tensor_converter_video_write_frame (self, buf, info.data)) {
+    gst_buffer_unmap (outbuf, &info);
+    gst_buffer_unref (outbuf);
+    outbuf = NULL;
+    goto done;
+  }
+
+  gst_buffer_unmap (outbuf, &info);
+
+  /** copy timestamps (the video meta is not valid for the outgoing buffer) */
+  gst_buffer_copy_into (outbuf, buf,
+      GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_TIMESTAMPS, 0, -1);
+
+done:
+  gst_buffer_unref (buf);
+  return outbuf;
+}
+
+/**
+ * @brief Write the incoming frames into the slots of the outgoing buffer and push it when all slots are filled.
+ * @param self this pointer to GstTensorConverter
+ * @param buf the incoming buffer, this function takes the ownership
+ * @param frame_size the size of a frame in outgoing tensor
+ * @param frames_in the number of frames in the incoming buffer
+ * @return GST_FLOW_OK if successfully written and pushed
+ */
+static GstFlowReturn
+gst_tensor_converter_batch_frames (GstTensorConverter * self,
+    GstBuffer * buf, gsize frame_size, guint frames_in)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstMapInfo info;
+  GstClockTime pts, dts, frame_duration;
+  gsize buf_size, block_size;
+  guint8 *dest;
+  gboolean written;
+  guint f;
+
+  buf_size = gst_buffer_get_size (buf);
+  pts = GST_BUFFER_PTS (buf);
+  dts = GST_BUFFER_DTS (buf);
+
+  frame_duration = GST_BUFFER_DURATION (buf);
+  if (GST_CLOCK_TIME_IS_VALID (frame_duration))
+    frame_duration /= frames_in;
+
+  for (f = 0; f < frames_in && ret == GST_FLOW_OK; f++) {
+    if (self->batch == NULL) {
+      if (!self->pool ||
+          gst_buffer_pool_acquire_buffer (self->pool, &self->batch,
+              NULL) != GST_FLOW_OK) {
+        GST_ERROR_OBJECT (self, "Failed to get the buffer from the pool.");
+        self->batch = NULL;
+        ret = GST_FLOW_ERROR;
+        break;
+      }
+
+      /** timestamp of the first frame in the outgoing buffer */
+      self->batch_frames = 0;
+      GST_BUFFER_PTS (self->batch) = pts;
+      GST_BUFFER_DTS (self->batch) = dts;
+
+      if (f > 0 && GST_CLOCK_TIME_IS_VALID (frame_duration)) {
+        if (GST_CLOCK_TIME_IS_VALID (pts))
+          GST_BUFFER_PTS (self->batch) = pts + f * frame_duration;
+        if (GST_CLOCK_TIME_IS_VALID (dts))
+          GST_BUFFER_DTS (self->batch) = dts + f * frame_duration;
+      }
+    }
+
+    if (!gst_buffer_map (self->batch, &info, GST_MAP_WRITE)) {
+      GST_ERROR_OBJECT (self, "Failed to map the outgoing buffer.");
+      ret = GST_FLOW_ERROR;
+      break;
+    }
+
+    dest = info.data + self->batch_frames * frame_size;
+
+    switch (self->in_media_type) {
+      case _NNS_VIDEO:
+        if (self->video_convert || self->remove_padding ||
+            gst_buffer_get_video_meta (buf)) {
+          written = gst_tensor_converter_video_write_frame (self, buf, dest);
+        } else {
+          written = (gst_buffer_extract (buf, f * frame_size, dest,
+                  frame_size) == frame_size);
+        }
+        break;
+      case _NNS_TEXT:
+        /** pad or truncate the string */
+        block_size = MIN (buf_size, frame_size);
+        written = (gst_buffer_extract (buf, 0, dest, block_size) == block_size);
+
+        if (block_size < frame_size)
+          memset (dest + block_size, 0, frame_size - block_size);
+        break;
+      default:
+        written = FALSE;
+        break;
+    }
+
+    gst_buffer_unmap (self->batch, &info);
+
+    if (!written) {
+      GST_ERROR_OBJECT (self, "Failed to write the frame.");
+      ret = GST_FLOW_ERROR;
+      break;
+    }
+
+    if (++self->batch_frames == self->frames_per_tensor) {
+      GstBuffer *outbuf = self->batch;
+
+      self->batch = NULL;
+
+      if (GST_CLOCK_TIME_IS_VALID (frame_duration))
+        GST_BUFFER_DURATION (outbuf) = frame_duration * self->frames_per_tensor;
+
+      silent_debug_timestamp (outbuf);
+      ret = gst_pad_push (self->srcpad, outbuf);
+    }
+  }
+
+  gst_buffer_unref (buf);
+  return ret;
+}
+
+/**
+ * @brief Set up the buffer pool with given buffer size.
+ */
+static gboolean
+gst_tensor_converter_setup_pool (GstTensorConverter * self, gsize size)
+{
+  GstStructure *config;
+
+  if (self->pool) {
+    gst_buffer_pool_set_active (self->pool, FALSE);
+    gst_object_unref (self->pool);
+  }
+
+  self->pool = gst_buffer_pool_new ();
+
+  config = gst_buffer_pool_get_config (self->pool);
+  gst_buffer_pool_config_set_params (config, NULL, size, 0, 0);
+
+  if (!gst_buffer_pool_set_config (self->pool, config) ||
+      !gst_buffer_pool_set_active (self->pool, TRUE)) {
+    GST_ERROR_OBJECT (self, "Failed to activate the buffer pool.");
+    gst_object_unref (self->pool);
+    self->pool = NULL;
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief Clear and reset data.
  */
@@ -889,6 +1420,24 @@ gst_tensor_converter_reset (GstTensorConverter * self)
     gst_adapter_clear (self->adapter);
   }
 
+  if (self->batch) {
+    gst_buffer_unref (self->batch);
+    self->batch = NULL;
+  }
+  self->batch_frames = 0;
+  self->batch_in_place = FALSE;
+
+  if (self->pool) {
+    gst_buffer_pool_set_active (self->pool, FALSE);
+    gst_object_unref (self->pool);
+    self->pool = NULL;
+  }
+
+  if (self->video_convert) {
+    gst_tensor_video_convert_free (self->video_convert);
+    self->video_convert = NULL;
+  }
+
   self->tensor_configured = FALSE;
   gst_tensor_config_init (&self->tensor_config);
 
@@ -1217,10 +1766,20 @@ gst_tensor_converter_get_possible_media_caps (GstTensorConverter * self)
         st = gst_caps_get_structure (media_caps, i);
         type = gst_tensor_media_type_from_structure (st);
 
+        if (self->mode) {
+          /* the sub-plugin handles all media types */
+          type = _NNS_MEDIA_INVALID;
+        }
+
         switch (type) {
           case _NNS_VIDEO:
-            /* video caps from tensor info */
-            if (is_video_supported (self) && config.info.type == _NNS_UINT8) {
+            /**
+             * video caps from tensor info
+             * (any size and format if YUV video can be converted)
+             */
+            if (is_video_supported (self) &&
+                self->video_option.format == GST_VIDEO_FORMAT_UNKNOWN &&
+                config.info.type == _NNS_UINT8) {
               GValue supported_formats = G_VALUE_INIT;
               gint colorspace, width, height;
 
@@ -1317,7 +1876,8 @@ gst_tensor_converter_get_possible_media_caps (GstTensorConverter * self)
             break;
           case _NNS_MEDIA_INVALID:     /* this could be MEDIA_PLUGIN */
           {
-            const gchar *name = gst_structure_get_name (st);
+            const gchar *name = self->mode ? self->mode :
+                gst_structure_get_name (st);
             const NNStreamerExternalConverter *ex;
 
             if (name == NULL)
@@ -1376,6 +1936,11 @@ gst_tensor_converter_query_caps (GstTensorConverter * self, GstPad * pad,
 
       gst_caps_unref (media_caps);
     }
+
+    /* YUV video is supported only if the color format is given */
+    if (self->video_option.format == GST_VIDEO_FORMAT_UNKNOWN) {
+      caps = gst_tensor_video_convert_remove_caps (caps);
+    }
   }
 
   silent_debug_caps (caps, "caps");
@@ -1414,6 +1979,11 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
   in_type = gst_tensor_media_type_from_structure (structure);
   self->externalConverter = NULL;
 
+  if (self->mode) {
+    /* the sub-plugin handles the incoming media instead of the built-in conversion */
+    in_type = _NNS_MEDIA_INVALID;
+  }
+
   switch (in_type) {
     case _NNS_VIDEO:
       if (is_video_supported (self)) {
@@ -1425,12 +1995,46 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
           return FALSE;
         }
 
+        frames_dim = 3;
+        self->frame_size = GST_VIDEO_INFO_SIZE (&info);
+
+        if (self->video_convert) {
+          gst_tensor_video_convert_free (self->video_convert);
+          self->video_convert = NULL;
+        }
+
+        if (gst_tensor_video_convert_check_caps (caps)) {
+          /* YUV video, fused color-conversion and resize */
+          gst_tensor_config_init (&config);
+
+          self->video_convert = gst_tensor_video_convert_new (caps,
+              &self->video_option, &config.info);
+          if (self->video_convert == NULL) {
+            GST_ERROR_OBJECT (self, "Failed to convert the video format %s.",
+                GST_STR_NULL (gst_video_format_to_string
+                    (GST_VIDEO_INFO_FORMAT (&info))));
+            g_critical ("Please set the property video-format to convert.\n"
+                "For example, video-format=RGB video-size=224:224 to get RGB tensor.");
+            return FALSE;
+          }
+
+          config.rate_n = GST_VIDEO_INFO_FPS_N (&info);
+          config.rate_d = GST_VIDEO_INFO_FPS_D (&info);
+          break;
+        }
+
         if (!gst_tensor_converter_parse_video (self, &config, &info)) {
           GST_ERROR_OBJECT (self,
               "Failed to configure tensor from video info.");
           return FALSE;
         }
 
+        self->row_size = config.info.dimension[0] * config.info.dimension[1]
+            * gst_tensor_get_element_size (config.info.type);
+        self->row_stride = GST_VIDEO_INFO_PLANE_STRIDE (&info, 0);
+        self->num_rows = config.info.dimension[2];
+        self->remove_padding = FALSE;
+
         /**
          * Emit Warning if RSTRIDE = RU4 (3BPP) && Width % 4 > 0
          * @todo Add more conditions!
@@ -1445,9 +2049,6 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
               "\nYOUR STREAM CONFIGURATION INCURS PERFORMANCE DETERIORATION!\n"
               "Please use 4 x n as image width for inputs.\n");
         }
-
-        frames_dim = 3;
-        self->frame_size = GST_VIDEO_INFO_SIZE (&info);
       } else {
         g_critical
             ("\n This binary does not support video type. Please build NNStreamer with disable-video-support : false\n");
@@ -1525,7 +2126,8 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
     default:
     {
       /* if found, configure in_mdeia_type = _NNS_MEDIA_PLUGINS */
-      const gchar *name = gst_structure_get_name (structure);
+      const gchar *name = self->mode ? self->mode :
+          gst_structure_get_name (structure);
       if (name != NULL) {
         const NNStreamerExternalConverter *ex = findExternalConverter (name);
         if (ex != NULL) {
@@ -1543,6 +2145,13 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
           break;
         }
       }
+
+      if (self->mode) {
+        GST_ERROR_OBJECT (self, "Cannot find the converter sub-plugin %s.",
+            self->mode);
+        return FALSE;
+      }
+
       GST_ERROR_OBJECT (self, "Unsupported type %d\n", in_type);
       return FALSE;
     }
@@ -1567,6 +2176,25 @@ gst_tensor_converter_parse_caps (GstTensorConverter * self,
     }
   }
 
+  /**
+   * Write the frames directly into the slots of outgoing buffer (no adapter)
+   * if the tensor contains multiple frames and a frame is supposed in a buffer.
+   */
+  if (self->batch) {
+    gst_buffer_unref (self->batch);
+    self->batch = NULL;
+  }
+
+  self->batch_in_place = (self->frames_per_tensor > 1 &&
+      (in_type == _NNS_VIDEO || in_type == _NNS_TEXT));
+
+  if (in_type == _NNS_VIDEO || self->batch_in_place) {
+    if (!gst_tensor_converter_setup_pool (self,
+            gst_tensor_info_get_size (&config.info))) {
+      return FALSE;
+    }
+  }
+
   self->in_media_type = in_type;
   self->tensor_configured = TRUE;
   self->tensor_config = config;
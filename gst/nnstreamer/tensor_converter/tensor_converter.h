@@ -23,8 +23,9 @@
  *                Be careful: this filter assumes that the user has attached
  *               other GST converters as a preprocessor for this filter so that
  *               the incoming buffer is nicely aligned in the array of
- *               uint8[height][width][RGB]. Note that if rstride=RU4, you need
- *               to add the case in "remove_stride_padding_per_row".
+ *               uint8[height][width][RGB]. If the video rows are padded
+ *               (rstride=RU4 or GstVideoMeta with larger stride), the padding
+ *               is removed with a row copy into a pooled buffer.
  *
  * @see		https://github.com/nnsuite/nnstreamer
  * @author	MyungJoo Ham <myungjoo.ham@samsung.com>
@@ -37,6 +38,8 @@
 #include <gst/gst.h>
 #include <gst/base/gstadapter.h>
 #include <tensor_common.h>
+#include <nnstreamer_plugin_api_converter.h>
+#include "converter-video-convert.h"
 
 G_BEGIN_DECLS
 
@@ -51,9 +54,7 @@ G_BEGIN_DECLS
 #define GST_IS_TENSOR_CONVERTER_CLASS(klass) \
   (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_TENSOR_CONVERTER))
 
-typedef struct _GstTensorConverter GstTensorConverter;
 typedef struct _GstTensorConverterClass GstTensorConverterClass;
-typedef struct _NNStreamerExternalConverter NNStreamerExternalConverter;
 
 /**
  * @brief Internal data structure for tensor_converter instances.
@@ -75,9 +76,21 @@ struct _GstTensorConverter
   media_type in_media_type; /**< incoming media type */
   const NNStreamerExternalConverter *externalConverter;
       /**< used if in_media_type == _NNS_MEDIA_PLUGINS */
+  gchar *mode; /**< name of the converter sub-plugin to be used instead of the built-in conversion */
+  gchar *option; /**< option string for the converter sub-plugin */
 
   gsize frame_size; /**< size of one frame */
   gboolean remove_padding; /**< If true, zero-padding must be removed */
+  gsize row_size; /**< size of a video row without padding */
+  gsize row_stride; /**< default stride of a video row (from caps) */
+  guint num_rows; /**< the number of video rows in a frame */
+  GstBufferPool *pool; /**< pool of output buffers for the frames to be re-arranged */
+  gboolean batch_in_place; /**< True to write the frames into the slots of outgoing buffer (frames-per-tensor > 1) */
+  GstBuffer *batch; /**< outgoing buffer to be filled with the frames */
+  guint batch_frames; /**< the number of frames in the outgoing buffer */
+
+  GstTensorVideoConvertOption video_option; /**< options to convert YUV video to RGB, BGR or GRAY8 tensor */
+  GstTensorVideoConvert *video_convert; /**< fused color-conversion and resize, used if incoming video is YUV */
   gboolean tensor_configured; /**< True if already successfully configured tensor metadata */
   GstTensorConfig tensor_config; /**< output tensor info */
 
@@ -0,0 +1,1063 @@
+/**
+ * GStreamer
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	gsttensorcrop.c
+ * @date	18 Oct 2020
+ * @brief	GStreamer plugin to crop the regions of the tensor with the box stream
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ */
+
+/**
+ * SECTION:element-tensor_crop
+ *
+ * tensor_crop crops the regions of the raw tensor (e.g., a video frame [C:W:H:1]) at the boxes of the info tensor,
+ * and resizes each region (bilinear) to the size given with the property "size".
+ * The outgoing buffer has two tensors, the batch of crops [C:width:height:max-crops] and the number of valid crops (uint32).
+ * The slots after the valid crops are filled with zero.
+ *
+ * The info tensor has the coordinates of a box in each row [K:N] (K >= 4), a row of the box with zero size is ignored.
+ * If there is no valid box, the frame is dropped without touching the raw tensor.
+ *
+ * <refsect2>
+ * <title>Example launch line</title>
+ * |[
+ * gst-launch-1.0 videotestsrc ! video/x-raw,format=RGB,width=640,height=480 ! tensor_converter ! tee name=t \
+ *   t. ! queue ! crop.raw \
+ *   t. ! queue ! tensor_transform ... ! tensor_filter framework=tensorflow-lite model=detector.tflite ! crop.info \
+ *   tensor_crop name=crop size=224:224 max-crops=4 ! tensor_filter framework=tensorflow-lite model=classifier.tflite ! tensor_sink
+ * ]|
+ * </refsect2>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <math.h>
+#include <gst/gst.h>
+#include <glib.h>
+
+#include "gsttensorcrop.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_tensor_crop_debug);
+#define GST_CAT_DEFAULT gst_tensor_crop_debug
+
+/**
+ * @brief Macro for debug mode.
+ */
+#ifndef DBG
+#define DBG (!self->silent)
+#endif
+
+/**
+ * @brief Macro for debug message.
+ */
+#define silent_debug(...) do { \
+    if (DBG) { \
+      GST_DEBUG_OBJECT (self, __VA_ARGS__); \
+    } \
+  } while (0)
+
+/**
+ * @brief Default number of crops in outgoing tensor.
+ */
+#define DEFAULT_MAX_CROPS 8
+
+enum
+{
+  PROP_0,
+  PROP_SILENT,
+  PROP_SIZE,
+  PROP_MAX_CROPS,
+  PROP_BOX_FORMAT,
+  PROP_NORMALIZED
+};
+
+/**
+ * @brief The names of the box formats.
+ */
+static const gchar *tensor_crop_box_format_string[] = {
+  [CROP_BOX_XYWH] = "xywh",
+  [CROP_BOX_XYXY] = "xyxy",
+  [CROP_BOX_YXYX] = "yxyx",
+  [CROP_BOX_END] = NULL
+};
+
+/**
+ * @brief Default caps string for sink pads.
+ */
+#define CAPS_STRING_SINK GST_TENSOR_CAP_DEFAULT "; " GST_TENSORS_CAP_DEFAULT
+
+/**
+ * @brief the capabilities of the inputs and outputs.
+ */
+static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_TENSORS_CAP_DEFAULT)
+    );
+
+static GstStaticPadTemplate raw_templ = GST_STATIC_PAD_TEMPLATE ("raw",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (CAPS_STRING_SINK)
+    );
+
+static GstStaticPadTemplate info_templ = GST_STATIC_PAD_TEMPLATE ("info",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (CAPS_STRING_SINK)
+    );
+
+static gboolean gst_tensor_crop_src_event (GstPad * pad, GstObject * parent,
+    GstEvent * event);
+static gboolean gst_tensor_crop_sink_event (GstCollectPads * pads,
+    GstCollectData * data, GstEvent * event, GstTensorCrop * self);
+static GstFlowReturn gst_tensor_crop_collected (GstCollectPads * pads,
+    GstTensorCrop * self);
+static GstStateChangeReturn gst_tensor_crop_change_state (GstElement * element,
+    GstStateChange transition);
+static void gst_tensor_crop_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_tensor_crop_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+static void gst_tensor_crop_finalize (GObject * object);
+
+#define gst_tensor_crop_parent_class parent_class
+G_DEFINE_TYPE (GstTensorCrop, gst_tensor_crop, GST_TYPE_ELEMENT);
+
+/**
+ * @brief initialize the tensor_crop's class
+ */
+static void
+gst_tensor_crop_class_init (GstTensorCropClass * klass)
+{
+  GObjectClass *gobject_class;
+  GstElementClass *gstelement_class;
+
+  GST_DEBUG_CATEGORY_INIT (gst_tensor_crop_debug, "tensor_crop", 0,
+      "Element to crop the regions of the tensor");
+
+  gobject_class = (GObjectClass *) klass;
+  gstelement_class = (GstElementClass *) klass;
+
+  gobject_class->finalize = gst_tensor_crop_finalize;
+  gobject_class->get_property = gst_tensor_crop_get_property;
+  gobject_class->set_property = gst_tensor_crop_set_property;
+
+  g_object_class_install_property (gobject_class, PROP_SILENT,
+      g_param_spec_boolean ("silent", "Silent", "Produce verbose output ?",
+          TRUE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_SIZE,
+      g_param_spec_string ("size", "Size",
+          "The size (width:height) of the cropped region", "",
+          G_PARAM_READWRITE | GST_PARAM_MUTABLE_READY |
+          G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_MAX_CROPS,
+      g_param_spec_uint ("max-crops", "Max crops",
+          "The number of crops in outgoing tensor", 1, 1024,
+          DEFAULT_MAX_CROPS, G_PARAM_READWRITE | GST_PARAM_MUTABLE_READY |
+          G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_BOX_FORMAT,
+      g_param_spec_string ("box-format", "Box format",
+          "The order of the coordinates of a box (xywh, xyxy or yxyx)", "xywh",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_NORMALIZED,
+      g_param_spec_boolean ("normalized", "Normalized",
+          "The coordinates are normalized in [0, 1] with the size of raw tensor",
+          FALSE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  gstelement_class->change_state =
+      GST_DEBUG_FUNCPTR (gst_tensor_crop_change_state);
+
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&raw_templ));
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&info_templ));
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&src_templ));
+
+  gst_element_class_set_details_simple (gstelement_class,
+      "TensorCrop",
+      "Filter/Tensor",
+      "Crop and resize the regions of the tensor with the box stream",
+      "agent <agent@local>");
+}
+
+/**
+ * @brief Add the sink pad to the collect pads.
+ */
+static GstTensorCollectPadData *
+gst_tensor_crop_add_sink_pad (GstTensorCrop * self,
+    GstStaticPadTemplate * templ, const gchar * name)
+{
+  GstTensorCollectPadData *data;
+  GstPad *pad;
+
+  pad = gst_pad_new_from_static_template (templ, name);
+
+  data = (GstTensorCollectPadData *)
+      gst_collect_pads_add_pad (self->collect, pad,
+      sizeof (GstTensorCollectPadData), NULL, TRUE);
+  data->pad = pad;
+  gst_tensors_config_init (&data->config);
+
+  gst_element_add_pad (GST_ELEMENT_CAST (self), pad);
+  return data;
+}
+
+/**
+ * @brief initialize the new element
+ */
+static void
+gst_tensor_crop_init (GstTensorCrop * self)
+{
+  self->srcpad = gst_pad_new_from_static_template (&src_templ, "src");
+  gst_pad_set_event_function (self->srcpad,
+      GST_DEBUG_FUNCPTR (gst_tensor_crop_src_event));
+  gst_pad_use_fixed_caps (self->srcpad);
+  gst_element_add_pad (GST_ELEMENT_CAST (self), self->srcpad);
+
+  self->collect = gst_collect_pads_new ();
+  gst_collect_pads_set_event_function (self->collect,
+      (GstCollectPadsEventFunction)
+      GST_DEBUG_FUNCPTR (gst_tensor_crop_sink_event), self);
+  gst_collect_pads_set_function (self->collect,
+      (GstCollectPadsFunction) GST_DEBUG_FUNCPTR (gst_tensor_crop_collected),
+      self);
+
+  self->raw = gst_tensor_crop_add_sink_pad (self, &raw_templ, "raw");
+  self->info = gst_tensor_crop_add_sink_pad (self, &info_templ, "info");
+
+  self->silent = TRUE;
+  self->negotiated = FALSE;
+  self->need_stream_start = TRUE;
+  self->need_segment = TRUE;
+  self->out_width = 0;
+  self->out_height = 0;
+  self->max_crops = DEFAULT_MAX_CROPS;
+  self->box_format = CROP_BOX_XYWH;
+  self->normalized = FALSE;
+
+  gst_tensors_config_init (&self->out_config);
+  self->boxes = NULL;
+  self->idx_x0 = self->idx_x1 = self->weight_x = NULL;
+  self->fweight_x = NULL;
+  self->line[0] = self->line[1] = NULL;
+}
+
+/**
+ * @brief Free the tables to crop the regions.
+ */
+static void
+gst_tensor_crop_free_tables (GstTensorCrop * self)
+{
+  g_free (self->boxes);
+  g_free (self->idx_x0);
+  g_free (self->idx_x1);
+  g_free (self->weight_x);
+  g_free (self->fweight_x);
+  g_free (self->line[0]);
+  g_free (self->line[1]);
+
+  self->boxes = NULL;
+  self->idx_x0 = self->idx_x1 = self->weight_x = NULL;
+  self->fweight_x = NULL;
+  self->line[0] = self->line[1] = NULL;
+}
+
+/**
+ * @brief finalize vmethod
+ */
+static void
+gst_tensor_crop_finalize (GObject * object)
+{
+  GstTensorCrop *self = GST_TENSOR_CROP (object);
+
+  gst_tensor_crop_free_tables (self);
+
+  if (self->collect) {
+    gst_object_unref (self->collect);
+    self->collect = NULL;
+  }
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+/**
+ * @brief src event vmethod
+ */
+static gboolean
+gst_tensor_crop_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
+{
+  g_return_val_if_fail (event != NULL, FALSE);
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_SEEK:
+      gst_event_unref (event);
+      return FALSE;
+    default:
+      break;
+  }
+
+  return gst_pad_event_default (pad, parent, event);
+}
+
+/**
+ * @brief sink event vmethod
+ */
+static gboolean
+gst_tensor_crop_sink_event (GstCollectPads * pads, GstCollectData * data,
+    GstEvent * event, GstTensorCrop * self)
+{
+  g_return_val_if_fail (event != NULL, FALSE);
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_FLUSH_STOP:
+      self->need_segment = TRUE;
+      break;
+    case GST_EVENT_CAPS:
+    {
+      GstCaps *caps;
+
+      gst_event_parse_caps (event, &caps);
+      if (!gst_tensor_collect_pad_set_config ((GstTensorCollectPadData *) data,
+              caps)) {
+        GST_ERROR_OBJECT (self, "Invalid caps %" GST_PTR_FORMAT, caps);
+      }
+
+      /* validate the tensors again with next buffer */
+      self->negotiated = FALSE;
+
+      gst_event_unref (event);
+      return TRUE;
+    }
+    default:
+      break;
+  }
+
+  return gst_collect_pads_event_default (pads, data, event, FALSE);
+}
+
+/**
+ * @brief Validate the incoming tensors and set the caps of src pad.
+ */
+static gboolean
+gst_tensor_crop_negotiate (GstTensorCrop * self)
+{
+  GstTensorsConfig *raw_config, *info_config;
+  GstTensorInfo *raw_info, *out_info;
+  GstCaps *caps;
+  gboolean ret;
+  guint channels;
+
+  raw_config = &self->raw->config;
+  info_config = &self->info->config;
+
+  if (!gst_tensors_config_validate (raw_config) ||
+      !gst_tensors_config_validate (info_config)) {
+    GST_ERROR_OBJECT (self, "The tensor info of sink pads is not configured.");
+    return FALSE;
+  }
+
+  if (self->out_width == 0 || self->out_height == 0) {
+    GST_ERROR_OBJECT (self, "The size of the cropped region is not given.");
+    return FALSE;
+  }
+
+  raw_info = &raw_config->info.info[0];
+
+  if (raw_config->info.num_tensors != 1 || raw_info->dimension[3] != 1) {
+    GST_ERROR_OBJECT (self, "The raw tensor should be a frame [C:W:H:1].");
+    return FALSE;
+  }
+
+  if (raw_info->type != _NNS_UINT8 && raw_info->type != _NNS_FLOAT32) {
+    GST_ERROR_OBJECT (self, "The type of raw tensor should be uint8 or float32.");
+    return FALSE;
+  }
+
+  if (info_config->info.info[0].dimension[0] < 4) {
+    GST_ERROR_OBJECT (self, "The info tensor should have 4 coordinates [K:N] (K >= 4).");
+    return FALSE;
+  }
+
+  channels = raw_info->dimension[0];
+
+  /* crops [C:width:height:max-crops] and count [1] */
+  gst_tensors_config_init (&self->out_config);
+  self->out_config.info.num_tensors = 2;
+  self->out_config.rate_n = raw_config->rate_n;
+  self->out_config.rate_d = raw_config->rate_d;
+
+  out_info = &self->out_config.info.info[0];
+  out_info->type = raw_info->type;
+  out_info->dimension[0] = channels;
+  out_info->dimension[1] = self->out_width;
+  out_info->dimension[2] = self->out_height;
+  out_info->dimension[3] = self->max_crops;
+
+  out_info = &self->out_config.info.info[1];
+  out_info->type = _NNS_UINT32;
+  out_info->dimension[0] = out_info->dimension[1] = 1;
+  out_info->dimension[2] = out_info->dimension[3] = 1;
+
+  /* tables to crop the regions */
+  gst_tensor_crop_free_tables (self);
+
+  self->boxes = g_new0 (tensor_crop_box, self->max_crops);
+  self->idx_x0 = g_new0 (guint, self->out_width);
+  self->idx_x1 = g_new0 (guint, self->out_width);
+  self->weight_x = g_new0 (guint, self->out_width);
+  self->fweight_x = g_new0 (gfloat, self->out_width);
+
+  if (raw_info->type == _NNS_UINT8) {
+    self->line[0] = g_new0 (guint32, self->out_width * channels);
+    self->line[1] = g_new0 (guint32, self->out_width * channels);
+  } else {
+    self->line[0] = g_new0 (gfloat, self->out_width * channels);
+    self->line[1] = g_new0 (gfloat, self->out_width * channels);
+  }
+
+  caps = gst_tensors_caps_from_config (&self->out_config);
+  ret = gst_pad_set_caps (self->srcpad, caps);
+  gst_caps_unref (caps);
+
+  self->negotiated = ret;
+  return ret;
+}
+
+/**
+ * @brief Get the value of the tensor as double.
+ */
+static gdouble
+gst_tensor_crop_get_value (tensor_type type, const guint8 * data, gsize idx)
+{
+  switch (type) {
+    case _NNS_INT32:
+      return (gdouble) ((const int32_t *) data)[idx];
+    case _NNS_UINT32:
+      return (gdouble) ((const uint32_t *) data)[idx];
+    case _NNS_INT16:
+      return (gdouble) ((const int16_t *) data)[idx];
+    case _NNS_UINT16:
+      return (gdouble) ((const uint16_t *) data)[idx];
+    case _NNS_INT8:
+      return (gdouble) ((const int8_t *) data)[idx];
+    case _NNS_UINT8:
+      return (gdouble) ((const uint8_t *) data)[idx];
+    case _NNS_FLOAT64:
+      return ((const double *) data)[idx];
+    case _NNS_FLOAT32:
+      return (gdouble) ((const float *) data)[idx];
+    case _NNS_INT64:
+      return (gdouble) ((const int64_t *) data)[idx];
+    case _NNS_UINT64:
+      return (gdouble) ((const uint64_t *) data)[idx];
+    default:
+      break;
+  }
+
+  return 0.0;
+}
+
+/**
+ * @brief Parse the boxes in the info tensor.
+ * @return the number of valid boxes (up to max-crops)
+ */
+static guint
+gst_tensor_crop_get_boxes (GstTensorCrop * self, GstBuffer * info_buf)
+{
+  GstTensorInfo *raw_info, *info;
+  GstMemory *mem = NULL;
+  GstMapInfo map;
+  gdouble v[4], x0, y0, x1, y1;
+  gdouble raw_w, raw_h;
+  gsize rows, stride, i;
+  guint k, max_crops, count = 0;
+  gint left, top, right, bottom;
+
+  raw_info = &self->raw->config.info.info[0];
+  info = &self->info->config.info.info[0];
+  /* the boxes are allocated with the negotiated max-crops */
+  max_crops = self->out_config.info.info[0].dimension[3];
+
+  if (self->info->config.info.num_tensors > 1) {
+    mem = gst_buffer_peek_memory (info_buf, 0);
+    if (!gst_memory_map (mem, &map, GST_MAP_READ))
+      goto map_error;
+  } else {
+    if (!gst_buffer_map (info_buf, &map, GST_MAP_READ))
+      goto map_error;
+  }
+
+  if (map.size < gst_tensor_info_get_size (info)) {
+    GST_ERROR_OBJECT (self, "Invalid size of the info tensor (%"
+        G_GSIZE_FORMAT ").", map.size);
+    goto done;
+  }
+
+  raw_w = raw_info->dimension[1];
+  raw_h = raw_info->dimension[2];
+  stride = info->dimension[0];
+  rows = gst_tensor_get_element_count (info->dimension) / stride;
+
+  for (i = 0; i < rows && count < max_crops; i++) {
+    for (k = 0; k < 4; k++)
+      v[k] = gst_tensor_crop_get_value (info->type, map.data, i * stride + k);
+
+    switch (self->box_format) {
+      case CROP_BOX_XYXY:
+        x0 = v[0];
+        y0 = v[1];
+        x1 = v[2];
+        y1 = v[3];
+        break;
+      case CROP_BOX_YXYX:
+        y0 = v[0];
+        x0 = v[1];
+        y1 = v[2];
+        x1 = v[3];
+        break;
+      default:
+        x0 = v[0];
+        y0 = v[1];
+        x1 = v[0] + v[2];
+        y1 = v[1] + v[3];
+        break;
+    }
+
+    if (!isfinite (x0) || !isfinite (y0) || !isfinite (x1) || !isfinite (y1)) {
+      GST_WARNING_OBJECT (self, "Ignore the box with non-finite coordinates.");
+      continue;
+    }
+
+    if (self->normalized) {
+      x0 *= raw_w;
+      x1 *= raw_w;
+      y0 *= raw_h;
+      y1 *= raw_h;
+    }
+
+    /* clip the region in the raw tensor */
+    left = (gint) CLAMP (floor (x0), 0.0, raw_w);
+    top = (gint) CLAMP (floor (y0), 0.0, raw_h);
+    right = (gint) CLAMP (ceil (x1), 0.0, raw_w);
+    bottom = (gint) CLAMP (ceil (y1), 0.0, raw_h);
+
+    /* empty row (padding) */
+    if (right <= left || bottom <= top)
+      continue;
+
+    self->boxes[count].x = left;
+    self->boxes[count].y = top;
+    self->boxes[count].w = right - left;
+    self->boxes[count].h = bottom - top;
+    count++;
+  }
+
+done:
+  if (mem)
+    gst_memory_unmap (mem, &map);
+  else
+    gst_buffer_unmap (info_buf, &map);
+
+  return count;
+
+map_error:
+  GST_ERROR_OBJECT (self, "Failed to map the info tensor.");
+  return 0;
+}
+
+/**
+ * @brief Get the position of the sampled pixel in the box (bilinear).
+ * @param start the start of the box
+ * @param len the length of the box
+ * @param i the index of the outgoing pixel
+ * @param out_len the length of the outgoing region
+ * @param[out] i0 the first index
+ * @param[out] i1 the second index
+ * @return the weight of the second index (0 ~ 1)
+ */
+static inline gdouble
+gst_tensor_crop_sample_pos (guint start, guint len, guint i, guint out_len,
+    guint * i0, guint * i1)
+{
+  gdouble pos;
+  guint idx;
+
+  pos = (i + 0.5) * len / out_len - 0.5;
+  pos = CLAMP (pos, 0.0, (gdouble) (len - 1));
+  idx = (guint) pos;
+
+  *i0 = start + idx;
+  *i1 = start + MIN (idx + 1, len - 1);
+  return pos - idx;
+}
+
+/**
+ * @brief Interpolate a row of uint8 tensor along x (8-bit fixed point).
+ */
+static inline void
+gst_tensor_crop_interpolate_row_uint8 (GstTensorCrop * self,
+    const guint8 * s, guint32 * line, guint channels)
+{
+  guint x, c;
+
+  for (x = 0; x < self->out_width; x++) {
+    const guint32 wx = self->weight_x[x];
+    const guint8 *p0 = s + self->idx_x0[x];
+    const guint8 *p1 = s + self->idx_x1[x];
+
+    for (c = 0; c < channels; c++)
+      line[x * channels + c] = p0[c] * (256 - wx) + p1[c] * wx;
+  }
+}
+
+/**
+ * @brief Crop and resize a region of uint8 tensor.
+ * Two incoming rows are interpolated along x and kept for the next line, then blended along y with a simple loop which the compiler can vectorize.
+ */
+static void
+gst_tensor_crop_resize_uint8 (GstTensorCrop * self, const guint8 * src,
+    guint8 * dest, const tensor_crop_box * box)
+{
+  const guint channels = self->out_config.info.info[0].dimension[0];
+  const guint out_w = self->out_config.info.info[0].dimension[1];
+  const guint out_h = self->out_config.info.info[0].dimension[2];
+  const gsize src_stride = (gsize) channels *
+      self->raw->config.info.info[0].dimension[1];
+  const gsize len = (gsize) channels * out_w;
+  guint32 *l0 = (guint32 *) self->line[0];
+  guint32 *l1 = (guint32 *) self->line[1];
+  guint32 *tmp, wy;
+  guint x, y, y0, y1, row0, row1;
+  gsize i;
+
+  for (x = 0; x < out_w; x++) {
+    gdouble w = gst_tensor_crop_sample_pos (box->x, box->w, x,
+        out_w, &self->idx_x0[x], &self->idx_x1[x]);
+
+    self->idx_x0[x] *= channels;
+    self->idx_x1[x] *= channels;
+    self->weight_x[x] = (guint) (w * 256.0 + 0.5);
+  }
+
+  /* the incoming rows in l0 and l1 */
+  row0 = row1 = G_MAXUINT;
+
+  for (y = 0; y < out_h; y++) {
+    wy = (guint32) (gst_tensor_crop_sample_pos (box->y, box->h, y,
+            out_h, &y0, &y1) * 256.0 + 0.5);
+
+    if (y0 != row0) {
+      if (y0 == row1) {
+        /* reuse the second row of previous line */
+        tmp = l0;
+        l0 = l1;
+        l1 = tmp;
+        row1 = row0;
+      } else {
+        gst_tensor_crop_interpolate_row_uint8 (self, src + y0 * src_stride,
+            l0, channels);
+      }
+      row0 = y0;
+    }
+
+    if (y1 != row1) {
+      gst_tensor_crop_interpolate_row_uint8 (self, src + y1 * src_stride,
+          l1, channels);
+      row1 = y1;
+    }
+
+    /* blend the rows along y */
+    for (i = 0; i < len; i++)
+      dest[i] = (guint8) ((l0[i] * (256 - wy) + l1[i] * wy + 32768) >> 16);
+
+    dest += len;
+  }
+
+  self->line[0] = l0;
+  self->line[1] = l1;
+}
+
+/**
+ * @brief Crop and resize a region of float32 tensor.
+ */
+static void
+gst_tensor_crop_resize_float32 (GstTensorCrop * self, const gfloat * src,
+    gfloat * dest, const tensor_crop_box * box)
+{
+  const guint channels = self->out_config.info.info[0].dimension[0];
+  const guint out_w = self->out_config.info.info[0].dimension[1];
+  const guint out_h = self->out_config.info.info[0].dimension[2];
+  const gsize src_stride = (gsize) channels *
+      self->raw->config.info.info[0].dimension[1];
+  const gsize len = (gsize) channels * out_w;
+  gfloat *l0 = (gfloat *) self->line[0];
+  gfloat *l1 = (gfloat *) self->line[1];
+  gfloat wy;
+  guint x, y, c, y0, y1;
+  gsize i;
+
+  for (x = 0; x < out_w; x++) {
+    self->fweight_x[x] = (gfloat) gst_tensor_crop_sample_pos (box->x, box->w,
+        x, out_w, &self->idx_x0[x], &self->idx_x1[x]);
+
+    self->idx_x0[x] *= channels;
+    self->idx_x1[x] *= channels;
+  }
+
+  for (y = 0; y < out_h; y++) {
+    const gfloat *s0, *s1;
+
+    wy = (gfloat) gst_tensor_crop_sample_pos (box->y, box->h, y,
+        out_h, &y0, &y1);
+
+    s0 = src + y0 * src_stride;
+    s1 = src + y1 * src_stride;
+
+    for (x = 0; x < out_w; x++) {
+      const gfloat wx = self->fweight_x[x];
+      for (c = 0; c < channels; c++) {
+        l0[x * channels + c] = s0[self->idx_x0[x] + c] * (1.0f - wx) +
+            s0[self->idx_x1[x] + c] * wx;
+        l1[x * channels + c] = s1[self->idx_x0[x] + c] * (1.0f - wx) +
+            s1[self->idx_x1[x] + c] * wx;
+      }
+    }
+
+    for (i = 0; i < len; i++)
+      dest[i] = l0[i] * (1.0f - wy) + l1[i] * wy;
+
+    dest += len;
+  }
+}
+
+/**
+ * @brief Crop the regions and generate outgoing buffer.
+ * @return outgoing buffer, NULL if failed to map the tensors
+ */
+static GstBuffer *
+gst_tensor_crop_process (GstTensorCrop * self, GstBuffer * raw_buf,
+    guint count)
+{
+  GstTensorInfo *crop_info = &self->out_config.info.info[0];
+  const guint max_crops = crop_info->dimension[3];
+  GstBuffer *outbuf;
+  GstMemory *mem;
+  GstMapInfo in_map, out_map;
+  gsize crop_size, frame_size;
+  guint i;
+
+  frame_size = gst_tensor_info_get_size (&self->raw->config.info.info[0]);
+  crop_size = gst_tensor_info_get_size (crop_info) / max_crops;
+
+  if (!gst_buffer_map (raw_buf, &in_map, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (self, "Failed to map the raw tensor.");
+    return NULL;
+  }
+
+  if (in_map.size < frame_size) {
+    GST_ERROR_OBJECT (self, "Invalid size of the raw tensor (%"
+        G_GSIZE_FORMAT ").", in_map.size);
+    gst_buffer_unmap (raw_buf, &in_map);
+    return NULL;
+  }
+
+  outbuf = gst_buffer_new ();
+
+  /* crops */
+  mem = gst_allocator_alloc (NULL, crop_size * max_crops, NULL);
+  if (!gst_memory_map (mem, &out_map, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (self, "Failed to map the memory for the crops.");
+    gst_memory_unref (mem);
+    gst_buffer_unref (outbuf);
+    gst_buffer_unmap (raw_buf, &in_map);
+    return NULL;
+  }
+
+  for (i = 0; i < count; i++) {
+    if (crop_info->type == _NNS_UINT8) {
+      gst_tensor_crop_resize_uint8 (self, in_map.data,
+          out_map.data + i * crop_size, &self->boxes[i]);
+    } else {
+      gst_tensor_crop_resize_float32 (self, (const gfloat *) in_map.data,
+          (gfloat *) (out_map.data + i * crop_size), &self->boxes[i]);
+    }
+  }
+
+  if (count < max_crops)
+    memset (out_map.data + count * crop_size, 0,
+        (max_crops - count) * crop_size);
+
+  gst_memory_unmap (mem, &out_map);
+  gst_buffer_append_memory (outbuf, mem);
+  gst_buffer_unmap (raw_buf, &in_map);
+
+  /* the number of crops */
+  mem = gst_allocator_alloc (NULL, sizeof (guint32), NULL);
+  if (!gst_memory_map (mem, &out_map, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (self, "Failed to map the memory for the number of crops.");
+    gst_memory_unref (mem);
+    gst_buffer_unref (outbuf);
+    return NULL;
+  }
+  *((guint32 *) out_map.data) = count;
+  gst_memory_unmap (mem, &out_map);
+  gst_buffer_append_memory (outbuf, mem);
+
+  gst_buffer_copy_into (outbuf, raw_buf, GST_BUFFER_COPY_METADATA, 0, -1);
+  return outbuf;
+}
+
+/**
+ * @brief Gst Collect Pads Function which is called once collect pads done.
+ */
+static GstFlowReturn
+gst_tensor_crop_collected (GstCollectPads * pads, GstTensorCrop * self)
+{
+  GstBuffer *raw_buf, *info_buf, *outbuf;
+  GstClockTime raw_pts, info_pts;
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint count;
+
+  if (self->need_stream_start) {
+    gchar s_id[32];
+
+    g_snprintf (s_id, sizeof (s_id), " tensorcrop - %08x ", g_random_int ());
+    gst_pad_push_event (self->srcpad, gst_event_new_stream_start (s_id));
+    self->need_stream_start = FALSE;
+  }
+
+  raw_buf = gst_collect_pads_peek (pads, (GstCollectData *) self->raw);
+  info_buf = gst_collect_pads_peek (pads, (GstCollectData *) self->info);
+
+  if (raw_buf == NULL || info_buf == NULL) {
+    /* end-of-stream */
+    if (raw_buf)
+      gst_buffer_unref (raw_buf);
+    if (info_buf)
+      gst_buffer_unref (info_buf);
+
+    gst_pad_push_event (self->srcpad, gst_event_new_eos ());
+    return GST_FLOW_EOS;
+  }
+
+  raw_pts = GST_BUFFER_PTS (raw_buf);
+  info_pts = GST_BUFFER_PTS (info_buf);
+  gst_buffer_unref (raw_buf);
+  gst_buffer_unref (info_buf);
+
+  /* drop the older one and wait for the next, if the boxes are not of this frame */
+  if (GST_CLOCK_TIME_IS_VALID (raw_pts) && GST_CLOCK_TIME_IS_VALID (info_pts) &&
+      raw_pts != info_pts) {
+    GstCollectData *old = (GstCollectData *)
+        ((raw_pts < info_pts) ? self->raw : self->info);
+
+    silent_debug ("Drop the buffer of %s pad (raw %" GST_TIME_FORMAT
+        ", info %" GST_TIME_FORMAT ")", (raw_pts < info_pts) ? "raw" : "info",
+        GST_TIME_ARGS (raw_pts), GST_TIME_ARGS (info_pts));
+    gst_buffer_unref (gst_collect_pads_pop (pads, old));
+    return GST_FLOW_OK;
+  }
+
+  raw_buf = gst_collect_pads_pop (pads, (GstCollectData *) self->raw);
+  info_buf = gst_collect_pads_pop (pads, (GstCollectData *) self->info);
+
+  if (!self->negotiated && !gst_tensor_crop_negotiate (self)) {
+    GST_ELEMENT_ERROR (self, CORE, NEGOTIATION, (NULL),
+        ("Failed to configure the tensor info to crop the regions."));
+    ret = GST_FLOW_NOT_NEGOTIATED;
+    goto done;
+  }
+
+  if (self->need_segment) {
+    GstSegment segment;
+
+    gst_segment_init (&segment, GST_FORMAT_TIME);
+    if (GST_CLOCK_TIME_IS_VALID (raw_pts))
+      segment.start = raw_pts;
+    gst_pad_push_event (self->srcpad, gst_event_new_segment (&segment));
+    self->need_segment = FALSE;
+  }
+
+  count = gst_tensor_crop_get_boxes (self, info_buf);
+  silent_debug ("The number of crops %u", count);
+
+  if (count == 0) {
+    /* drop the frame without detections */
+    if (GST_CLOCK_TIME_IS_VALID (raw_pts)) {
+      gst_pad_push_event (self->srcpad,
+          gst_event_new_gap (raw_pts, GST_BUFFER_DURATION (raw_buf)));
+    }
+    goto done;
+  }
+
+  outbuf = gst_tensor_crop_process (self, raw_buf, count);
+  if (outbuf == NULL) {
+    GST_ELEMENT_ERROR (self, STREAM, FAILED, (NULL),
+        ("Failed to crop the regions."));
+    ret = GST_FLOW_ERROR;
+    goto done;
+  }
+
+  ret = gst_pad_push (self->srcpad, outbuf);
+  if (ret != GST_FLOW_OK) {
+    GST_WARNING_OBJECT (self, "pushed outbuf, result = %s",
+        gst_flow_get_name (ret));
+  }
+
+done:
+  gst_buffer_unref (raw_buf);
+  gst_buffer_unref (info_buf);
+  return ret;
+}
+
+/**
+ * @brief change state (gst element vmethod)
+ */
+static GstStateChangeReturn
+gst_tensor_crop_change_state (GstElement * element, GstStateChange transition)
+{
+  GstTensorCrop *self = GST_TENSOR_CROP (element);
+  GstStateChangeReturn ret;
+
+  switch (transition) {
+    case GST_STATE_CHANGE_READY_TO_PAUSED:
+      self->need_stream_start = TRUE;
+      self->need_segment = TRUE;
+      self->negotiated = FALSE;
+      gst_collect_pads_start (self->collect);
+      break;
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+      gst_collect_pads_stop (self->collect);
+      break;
+    default:
+      break;
+  }
+
+  ret = GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
+  if (ret == GST_STATE_CHANGE_FAILURE)
+    return ret;
+
+  switch (transition) {
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+      gst_tensor_crop_free_tables (self);
+      break;
+    default:
+      break;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Set property (gst element vmethod)
+ */
+static void
+gst_tensor_crop_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstTensorCrop *self = GST_TENSOR_CROP (object);
+
+  switch (prop_id) {
+    case PROP_SILENT:
+      self->silent = g_value_get_boolean (value);
+      break;
+    case PROP_SIZE:
+    {
+      const gchar *str = g_value_get_string (value);
+      gchar **strv;
+
+      self->out_width = self->out_height = 0;
+      if (str == NULL)
+        break;
+
+      strv = g_strsplit (str, ":", 2);
+      if (strv[0] != NULL && strv[1] != NULL) {
+        self->out_width = (guint) g_ascii_strtoull (strv[0], NULL, 10);
+        self->out_height = (guint) g_ascii_strtoull (strv[1], NULL, 10);
+      } else {
+        GST_ERROR_OBJECT (self, "Invalid size %s (width:height).", str);
+      }
+      g_strfreev (strv);
+      break;
+    }
+    case PROP_MAX_CROPS:
+      self->max_crops = g_value_get_uint (value);
+      break;
+    case PROP_BOX_FORMAT:
+    {
+      const gchar *str = g_value_get_string (value);
+      gint idx = (str) ? find_key_strv (tensor_crop_box_format_string, str) : -1;
+
+      if (idx < 0) {
+        GST_ERROR_OBJECT (self, "Invalid box format %s.", GST_STR_NULL (str));
+      } else {
+        self->box_format = (tensor_crop_box_format) idx;
+      }
+      break;
+    }
+    case PROP_NORMALIZED:
+      self->normalized = g_value_get_boolean (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+/**
+ * @brief Get property (gst element vmethod)
+ */
+static void
+gst_tensor_crop_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstTensorCrop *self = GST_TENSOR_CROP (object);
+
+  switch (prop_id) {
+    case PROP_SILENT:
+      g_value_set_boolean (value, self->silent);
+      break;
+    case PROP_SIZE:
+      g_value_take_string (value, g_strdup_printf ("%u:%u", self->out_width,
+              self->out_height));
+      break;
+    case PROP_MAX_CROPS:
+      g_value_set_uint (value, self->max_crops);
+      break;
+    case PROP_BOX_FORMAT:
+      g_value_set_string (value,
+          tensor_crop_box_format_string[self->box_format]);
+      break;
+    case PROP_NORMALIZED:
+      g_value_set_boolean (value, self->normalized);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
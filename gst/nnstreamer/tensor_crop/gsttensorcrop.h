@@ -0,0 +1,113 @@
+/**
+ * GStreamer
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	gsttensorcrop.h
+ * @date	18 Oct 2020
+ * @brief	GStreamer plugin to crop the regions of the tensor with the box stream
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ */
+
+#ifndef __GST_TENSOR_CROP_H__
+#define __GST_TENSOR_CROP_H__
+
+#include <gst/gst.h>
+#include <gst/base/gstcollectpads.h>
+#include <tensor_common.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_TENSOR_CROP (gst_tensor_crop_get_type ())
+#define GST_TENSOR_CROP(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), GST_TYPE_TENSOR_CROP, GstTensorCrop))
+#define GST_TENSOR_CROP_CLASS(klass) (G_TYPE_CHECK_CLASS_CAST ((klass), GST_TYPE_TENSOR_CROP, GstTensorCropClass))
+#define GST_IS_TENSOR_CROP(obj) (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_TENSOR_CROP))
+#define GST_IS_TENSOR_CROP_CLASS(klass) (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_TENSOR_CROP))
+
+typedef struct _GstTensorCrop GstTensorCrop;
+typedef struct _GstTensorCropClass GstTensorCropClass;
+
+/**
+ * @brief The order of the coordinates of a box in the info tensor.
+ */
+typedef enum
+{
+  CROP_BOX_XYWH = 0, /**< x, y, width, height */
+  CROP_BOX_XYXY, /**< left, top, right, bottom */
+  CROP_BOX_YXYX, /**< top, left, bottom, right (e.g., ssd post-processing) */
+  CROP_BOX_END
+} tensor_crop_box_format;
+
+/**
+ * @brief The region of a box in the raw tensor (pixel).
+ */
+typedef struct
+{
+  guint x; /**< left */
+  guint y; /**< top */
+  guint w; /**< width (larger than 0) */
+  guint h; /**< height (larger than 0) */
+} tensor_crop_box;
+
+/**
+ * @brief Tensor Crop data structure
+ */
+struct _GstTensorCrop
+{
+  GstElement element; /**< parent object */
+
+  gboolean silent; /**< true to print minimized log */
+  GstPad *srcpad; /**< src pad */
+  GstCollectPads *collect; /**< collect pads (raw and info) */
+  GstTensorCollectPadData *raw; /**< collect data of the raw tensor */
+  GstTensorCollectPadData *info; /**< collect data of the box tensor */
+
+  gboolean negotiated; /**< true if the src caps is set */
+  gboolean need_stream_start; /**< true to push stream-start event */
+  gboolean need_segment; /**< true to push segment event */
+
+  guint out_width; /**< width of the cropped region */
+  guint out_height; /**< height of the cropped region */
+  guint max_crops; /**< the number of crops in outgoing tensor */
+  tensor_crop_box_format box_format; /**< order of the coordinates */
+  gboolean normalized; /**< true if the coordinates are in [0, 1] */
+
+  GstTensorsConfig out_config; /**< output tensors info (crops and count) */
+  tensor_crop_box *boxes; /**< boxes of current frame (max-crops) */
+  guint *idx_x0; /**< first index of the sampled pixel along x (out-width) */
+  guint *idx_x1; /**< second index of the sampled pixel along x (out-width) */
+  guint *weight_x; /**< weight of the second pixel (0 ~ 256, uint8) */
+  gfloat *fweight_x; /**< weight of the second pixel (0 ~ 1, float32) */
+  gpointer line[2]; /**< horizontally interpolated rows */
+};
+
+/**
+ * @brief GstTensorCropClass inherits GstElementClass
+ */
+struct _GstTensorCropClass
+{
+  GstElementClass parent_class; /**< parent class */
+};
+
+/**
+ * @brief Get Type function required for gst elements
+ */
+GType gst_tensor_crop_get_type (void);
+
+G_END_DECLS
+
+#endif /** __GST_TENSOR_CROP_H__ */
@@ -0,0 +1,1090 @@
+/**
+ * GStreamer
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	gsttensorif.c
+ * @date	18 Oct 2020
+ * @brief	GStreamer plugin to route the tensor stream with the condition on its content
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ */
+
+/**
+ * SECTION:element-tensor_if
+ *
+ * tensor_if evaluates a condition on a tensor of each incoming buffer,
+ * and routes the buffer to "then" (src_0) or "else" (src_1) source pad.
+ * With this, an expensive stage (e.g., a classifier after a detector) runs only for the buffers satisfying the condition.
+ *
+ * The condition is "compared-value operator supplied-value".
+ * The compared value is an element or a reduction (average, max, min, sum or count) of the tensor chosen with "compared-value-option".
+ * Each branch pushes the incoming buffer (passthrough), drops it (skip), or pushes the chosen tensors (tensorpick).
+ * The buffer and its memory blocks are pushed without memcpy.
+ * The other branch gets a gap event so that the elements downstream keep running (e.g., preroll of the sink).
+ *
+ * <refsect2>
+ * <title>Example launch line</title>
+ * |[
+ * gst-launch-1.0 ... ! tensor_filter framework=tensorflow-lite model=detector.tflite ! \
+ *   tensor_if name=tif compared-value=TENSOR_MAX_VALUE compared-value-option=1 operator=GT supplied-value=0.6 \
+ *     then=TENSORPICK then-option=0 else=SKIP \
+ *   tif.src_0 ! queue ! tensor_filter framework=tensorflow-lite model=classifier.tflite ! tensor_sink \
+ *   tif.src_1 ! queue ! fakesink
+ * ]|
+ * </refsect2>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <gst/gst.h>
+#include <glib.h>
+
+#include "gsttensorif.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_tensor_if_debug);
+#define GST_CAT_DEFAULT gst_tensor_if_debug
+
+/**
+ * @brief Macro for debug mode.
+ */
+#ifndef DBG
+#define DBG (!self->silent)
+#endif
+
+/**
+ * @brief Macro for debug message.
+ */
+#define silent_debug(...) do { \
+    if (DBG) { \
+      GST_DEBUG_OBJECT (self, __VA_ARGS__); \
+    } \
+  } while (0)
+
+enum
+{
+  PROP_0,
+  PROP_SILENT,
+  PROP_CV,
+  PROP_CV_OPTION,
+  PROP_OP,
+  PROP_SV,
+  PROP_THEN,
+  PROP_THEN_OPTION,
+  PROP_ELSE,
+  PROP_ELSE_OPTION
+};
+
+/**
+ * @brief The names of the compared values.
+ */
+static const gchar *tensor_if_cv_string[] = {
+  [TIFCV_A_VALUE] = "A_VALUE",
+  [TIFCV_TENSOR_AVERAGE_VALUE] = "TENSOR_AVERAGE_VALUE",
+  [TIFCV_TENSOR_MAX_VALUE] = "TENSOR_MAX_VALUE",
+  [TIFCV_TENSOR_MIN_VALUE] = "TENSOR_MIN_VALUE",
+  [TIFCV_TENSOR_SUM_VALUE] = "TENSOR_SUM_VALUE",
+  [TIFCV_TENSOR_COUNT] = "TENSOR_COUNT",
+  [TIFCV_END] = NULL
+};
+
+/**
+ * @brief The names of the operators.
+ */
+static const gchar *tensor_if_op_string[] = {
+  [TIFOP_EQ] = "EQ",
+  [TIFOP_NE] = "NE",
+  [TIFOP_GT] = "GT",
+  [TIFOP_GE] = "GE",
+  [TIFOP_LT] = "LT",
+  [TIFOP_LE] = "LE",
+  [TIFOP_RANGE_INCLUSIVE] = "RANGE_INCLUSIVE",
+  [TIFOP_RANGE_EXCLUSIVE] = "RANGE_EXCLUSIVE",
+  [TIFOP_NOT_IN_RANGE_INCLUSIVE] = "NOT_IN_RANGE_INCLUSIVE",
+  [TIFOP_NOT_IN_RANGE_EXCLUSIVE] = "NOT_IN_RANGE_EXCLUSIVE",
+  [TIFOP_END] = NULL
+};
+
+/**
+ * @brief The names of the behaviors of the branch.
+ */
+static const gchar *tensor_if_behavior_string[] = {
+  [TIFB_PASSTHROUGH] = "PASSTHROUGH",
+  [TIFB_SKIP] = "SKIP",
+  [TIFB_TENSORPICK] = "TENSORPICK",
+  [TIFB_END] = NULL
+};
+
+/**
+ * @brief The capabilities of the inputs and outputs.
+ */
+static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src_%u",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT "; " GST_TENSORS_CAP_DEFAULT)
+    );
+
+static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_TENSOR_CAP_DEFAULT "; " GST_TENSORS_CAP_DEFAULT)
+    );
+
+static GstFlowReturn gst_tensor_if_chain (GstPad * pad, GstObject * parent,
+    GstBuffer * buf);
+static gboolean gst_tensor_if_event (GstPad * pad, GstObject * parent,
+    GstEvent * event);
+static GstStateChangeReturn gst_tensor_if_change_state (GstElement * element,
+    GstStateChange transition);
+static void gst_tensor_if_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_tensor_if_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+static void gst_tensor_if_finalize (GObject * object);
+
+#define gst_tensor_if_parent_class parent_class
+G_DEFINE_TYPE (GstTensorIf, gst_tensor_if, GST_TYPE_ELEMENT);
+
+/**
+ * @brief initialize the tensor_if's class
+ */
+static void
+gst_tensor_if_class_init (GstTensorIfClass * klass)
+{
+  GObjectClass *gobject_class;
+  GstElementClass *gstelement_class;
+
+  GST_DEBUG_CATEGORY_INIT (gst_tensor_if_debug, "tensor_if", 0,
+      "Element to route tensor stream with the condition");
+
+  gobject_class = (GObjectClass *) klass;
+  gstelement_class = (GstElementClass *) klass;
+
+  gobject_class->finalize = gst_tensor_if_finalize;
+  gobject_class->get_property = gst_tensor_if_get_property;
+  gobject_class->set_property = gst_tensor_if_set_property;
+
+  g_object_class_install_property (gobject_class, PROP_SILENT,
+      g_param_spec_boolean ("silent", "Silent", "Produce verbose output ?",
+          TRUE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_CV,
+      g_param_spec_string ("compared-value", "CV",
+          "The value compared with the supplied value (A_VALUE, "
+          "TENSOR_AVERAGE_VALUE, TENSOR_MAX_VALUE, TENSOR_MIN_VALUE, "
+          "TENSOR_SUM_VALUE or TENSOR_COUNT)", "A_VALUE",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_CV_OPTION,
+      g_param_spec_string ("compared-value-option", "CV_OPTION",
+          "The index of the tensor (nth). With A_VALUE, the index of the "
+          "element and the tensor (d0:d1:d2:d3,nth). With TENSOR_COUNT, "
+          "the tensor and the threshold of the elements (nth,threshold)", "",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_OP,
+      g_param_spec_string ("operator", "OP",
+          "The operator (EQ, NE, GT, GE, LT, LE, RANGE_INCLUSIVE, "
+          "RANGE_EXCLUSIVE, NOT_IN_RANGE_INCLUSIVE or NOT_IN_RANGE_EXCLUSIVE)",
+          "", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_SV,
+      g_param_spec_string ("supplied-value", "SV",
+          "The supplied value (two values sv0,sv1 for the range operators)",
+          "", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_THEN,
+      g_param_spec_string ("then", "THEN",
+          "The behavior if the condition is true (PASSTHROUGH, SKIP or "
+          "TENSORPICK)", "PASSTHROUGH",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_THEN_OPTION,
+      g_param_spec_string ("then-option", "THEN_OPTION",
+          "The index of tensors to be pushed with TENSORPICK (e.g., 0,2)", "",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_ELSE,
+      g_param_spec_string ("else", "ELSE",
+          "The behavior if the condition is false (PASSTHROUGH, SKIP or "
+          "TENSORPICK)", "SKIP", G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_ELSE_OPTION,
+      g_param_spec_string ("else-option", "ELSE_OPTION",
+          "The index of tensors to be pushed with TENSORPICK (e.g., 0,2)", "",
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  gstelement_class->change_state =
+      GST_DEBUG_FUNCPTR (gst_tensor_if_change_state);
+
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&sink_templ));
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&src_templ));
+
+  gst_element_class_set_details_simple (gstelement_class,
+      "TensorIf",
+      "Filter/Tensor",
+      "Route tensor stream to then/else pads with the condition on its content",
+      "agent <agent@local>");
+}
+
+/**
+ * @brief initialize the new element
+ */
+static void
+gst_tensor_if_init (GstTensorIf * self)
+{
+  guint i;
+
+  self->sinkpad = gst_pad_new_from_static_template (&sink_templ, "sink");
+  gst_element_add_pad (GST_ELEMENT_CAST (self), self->sinkpad);
+  gst_pad_set_chain_function (self->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_tensor_if_chain));
+  gst_pad_set_event_function (self->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_tensor_if_event));
+
+  /** src_0 for then, src_1 for else */
+  for (i = 0; i < 2; i++) {
+    GstTensorIfBranch *branch = &self->branch[i];
+    gchar *name;
+
+    name = g_strdup_printf ("src_%u", i);
+    branch->pad = gst_pad_new_from_static_template (&src_templ, name);
+    g_free (name);
+
+    gst_pad_use_fixed_caps (branch->pad);
+    gst_element_add_pad (GST_ELEMENT_CAST (self), branch->pad);
+
+    branch->last_ret = GST_FLOW_OK;
+    branch->option = NULL;
+    branch->num_picks = 0;
+    gst_tensors_config_init (&branch->config);
+  }
+
+  self->branch[TIF_THEN].behavior = TIFB_PASSTHROUGH;
+  self->branch[TIF_ELSE].behavior = TIFB_SKIP;
+
+  self->silent = TRUE;
+  self->cv = TIFCV_A_VALUE;
+  self->cv_option = NULL;
+  self->cv_nth = 0;
+  memset (self->cv_index, 0, sizeof (tensor_dim));
+  self->cv_threshold = 0.0;
+  self->cv_offset = 0;
+  self->op = TIFOP_END;
+  self->sv_str = NULL;
+  self->sv[0] = self->sv[1] = 0.0;
+  self->num_sv = 0;
+  self->configured = FALSE;
+  self->is_tensors = FALSE;
+  gst_tensors_config_init (&self->in_config);
+}
+
+/**
+ * @brief finalize vmethod
+ */
+static void
+gst_tensor_if_finalize (GObject * object)
+{
+  GstTensorIf *self = GST_TENSOR_IF (object);
+
+  g_free (self->cv_option);
+  g_free (self->sv_str);
+  g_free (self->branch[TIF_THEN].option);
+  g_free (self->branch[TIF_ELSE].option);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+/**
+ * @brief Parse the option of the compared value.
+ */
+static void
+gst_tensor_if_parse_cv_option (GstTensorIf * self)
+{
+  gchar **strv;
+  guint i;
+
+  self->cv_nth = 0;
+  memset (self->cv_index, 0, sizeof (tensor_dim));
+  self->cv_threshold = 0.0;
+
+  if (self->cv_option == NULL)
+    return;
+
+  strv = g_strsplit (self->cv_option, ",", -1);
+
+  if (self->cv == TIFCV_A_VALUE) {
+    /* d0:d1:d2:d3,nth */
+    if (strv[0] != NULL) {
+      gchar **idx = g_strsplit (strv[0], ":", NNS_TENSOR_RANK_LIMIT);
+
+      for (i = 0; i < NNS_TENSOR_RANK_LIMIT && idx[i] != NULL; i++)
+        self->cv_index[i] = (uint32_t) g_ascii_strtoull (idx[i], NULL, 10);
+
+      g_strfreev (idx);
+
+      if (strv[1] != NULL)
+        self->cv_nth = (guint) g_ascii_strtoull (strv[1], NULL, 10);
+    }
+  } else {
+    /* nth or nth,threshold */
+    if (strv[0] != NULL) {
+      self->cv_nth = (guint) g_ascii_strtoull (strv[0], NULL, 10);
+
+      if (strv[1] != NULL)
+        self->cv_threshold = g_ascii_strtod (strv[1], NULL);
+    }
+  }
+
+  g_strfreev (strv);
+}
+
+/**
+ * @brief Parse the supplied value.
+ */
+static void
+gst_tensor_if_parse_sv (GstTensorIf * self)
+{
+  gchar **strv;
+  guint i;
+
+  self->num_sv = 0;
+  self->sv[0] = self->sv[1] = 0.0;
+
+  if (self->sv_str == NULL)
+    return;
+
+  strv = g_strsplit (self->sv_str, ",", -1);
+
+  for (i = 0; i < 2 && strv[i] != NULL; i++) {
+    self->sv[i] = g_ascii_strtod (strv[i], NULL);
+    self->num_sv++;
+  }
+
+  g_strfreev (strv);
+}
+
+/**
+ * @brief Parse the option of the branch (the index of tensors with tensorpick).
+ */
+static void
+gst_tensor_if_parse_branch_option (GstTensorIfBranch * branch)
+{
+  gchar **strv;
+  guint i, num;
+
+  branch->num_picks = 0;
+
+  if (branch->option == NULL)
+    return;
+
+  strv = g_strsplit_set (branch->option, ",.;/", -1);
+  num = g_strv_length (strv);
+
+  for (i = 0; i < num && branch->num_picks < NNS_TENSOR_SIZE_LIMIT; i++) {
+    if (strv[i][0] == '\0')
+      continue;
+
+    branch->picks[branch->num_picks++] =
+        (guint) g_ascii_strtoull (strv[i], NULL, 10);
+  }
+
+  g_strfreev (strv);
+}
+
+/**
+ * @brief Get the index of the string in the list (case-insensitive).
+ * @return The index or -1 if the string is not found
+ */
+static gint
+gst_tensor_if_get_index (const gchar ** strv, const gchar * str)
+{
+  if (str == NULL)
+    return -1;
+
+  return find_key_strv (strv, str);
+}
+
+/**
+ * @brief Get the caps of the branch.
+ */
+static GstCaps *
+gst_tensor_if_get_branch_caps (GstTensorIf * self, GstTensorIfBranch * branch)
+{
+  if (!self->is_tensors) {
+    GstTensorConfig config;
+
+    gst_tensor_config_init (&config);
+    config.info = branch->config.info.info[0];
+    config.rate_n = branch->config.rate_n;
+    config.rate_d = branch->config.rate_d;
+
+    return gst_tensor_caps_from_config (&config);
+  }
+
+  return gst_tensors_caps_from_config (&branch->config);
+}
+
+/**
+ * @brief Validate the condition and the branches with the incoming caps.
+ * @return TRUE if the condition is valid and the caps of src pads are set
+ */
+static gboolean
+gst_tensor_if_configure (GstTensorIf * self, const GstCaps * caps)
+{
+  GstStructure *structure;
+  GstTensorsConfig config;
+  GstTensorInfo *info;
+  guint i, k;
+
+  self->configured = FALSE;
+
+  structure = gst_caps_get_structure (caps, 0);
+  if (!gst_tensors_config_from_structure (&config, structure) ||
+      !gst_tensors_config_validate (&config)) {
+    GST_ERROR_OBJECT (self, "Failed to get the tensors info from caps.");
+    return FALSE;
+  }
+
+  self->is_tensors = gst_structure_has_name (structure, "other/tensors");
+  self->in_config = config;
+
+  if (self->cv >= TIFCV_END) {
+    GST_ERROR_OBJECT (self, "Invalid compared value.");
+    return FALSE;
+  }
+
+  if (self->op >= TIFOP_END) {
+    GST_ERROR_OBJECT (self, "The operator is not given or invalid.");
+    return FALSE;
+  }
+
+  switch (self->op) {
+    case TIFOP_RANGE_INCLUSIVE:
+    case TIFOP_RANGE_EXCLUSIVE:
+    case TIFOP_NOT_IN_RANGE_INCLUSIVE:
+    case TIFOP_NOT_IN_RANGE_EXCLUSIVE:
+      if (self->num_sv < 2) {
+        GST_ERROR_OBJECT (self, "The range operator requires two values.");
+        return FALSE;
+      }
+      break;
+    default:
+      if (self->num_sv < 1) {
+        GST_ERROR_OBJECT (self, "The supplied value is not given.");
+        return FALSE;
+      }
+      break;
+  }
+
+  if (self->cv_nth >= config.info.num_tensors) {
+    GST_ERROR_OBJECT (self, "Invalid index of the tensor to be compared (%u).",
+        self->cv_nth);
+    return FALSE;
+  }
+
+  info = &config.info.info[self->cv_nth];
+
+  if (self->cv == TIFCV_A_VALUE) {
+    gsize offset = 0;
+
+    for (i = NNS_TENSOR_RANK_LIMIT; i > 0; i--) {
+      if (self->cv_index[i - 1] >= info->dimension[i - 1]) {
+        GST_ERROR_OBJECT (self, "Invalid index of the element (%u:%u).",
+            i - 1, self->cv_index[i - 1]);
+        return FALSE;
+      }
+
+      offset = offset * info->dimension[i - 1] + self->cv_index[i - 1];
+    }
+
+    self->cv_offset = offset;
+  }
+
+  for (i = 0; i < 2; i++) {
+    GstTensorIfBranch *branch = &self->branch[i];
+    GstCaps *branch_caps;
+
+    if (branch->behavior >= TIFB_END) {
+      GST_ERROR_OBJECT (self, "Invalid behavior of %s.",
+          (i == TIF_THEN) ? "then" : "else");
+      return FALSE;
+    }
+
+    branch->config = config;
+
+    if (branch->behavior == TIFB_TENSORPICK) {
+      if (branch->num_picks == 0) {
+        GST_ERROR_OBJECT (self, "TENSORPICK of %s requires the option.",
+            (i == TIF_THEN) ? "then" : "else");
+        return FALSE;
+      }
+
+      if (!self->is_tensors && branch->num_picks > 1) {
+        GST_ERROR_OBJECT (self, "Cannot pick %u tensors from other/tensor.",
+            branch->num_picks);
+        return FALSE;
+      }
+
+      branch->config.info.num_tensors = branch->num_picks;
+      for (k = 0; k < branch->num_picks; k++) {
+        if (branch->picks[k] >= config.info.num_tensors) {
+          GST_ERROR_OBJECT (self, "Invalid index of the tensor to pick (%u).",
+              branch->picks[k]);
+          return FALSE;
+        }
+
+        branch->config.info.info[k] = config.info.info[branch->picks[k]];
+      }
+    }
+
+    branch_caps = gst_tensor_if_get_branch_caps (self, branch);
+    gst_pad_set_caps (branch->pad, branch_caps);
+    gst_caps_unref (branch_caps);
+  }
+
+  self->configured = TRUE;
+  silent_debug ("Configured the condition %s %s with %u tensors.",
+      tensor_if_cv_string[self->cv], tensor_if_op_string[self->op],
+      config.info.num_tensors);
+  return TRUE;
+}
+
+/**
+ * @brief event function for sink (gst element vmethod)
+ */
+static gboolean
+gst_tensor_if_event (GstPad * pad, GstObject * parent, GstEvent * event)
+{
+  GstTensorIf *self = GST_TENSOR_IF (parent);
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_CAPS:
+    {
+      GstCaps *caps;
+      gboolean ret;
+
+      gst_event_parse_caps (event, &caps);
+      ret = gst_tensor_if_configure (self, caps);
+      gst_event_unref (event);
+
+      if (!ret) {
+        GST_ELEMENT_ERROR (self, CORE, NEGOTIATION, (NULL),
+            ("Failed to configure the condition with the caps."));
+      }
+      return ret;
+    }
+    default:
+      break;
+  }
+
+  return gst_pad_event_default (pad, parent, event);
+}
+
+/**
+ * @brief The number of independent accumulators in the reduction.
+ * Each lane is updated separately, so that the compiler can vectorize the loop without reordering the operations.
+ */
+#define TIF_LANES (8)
+
+/**
+ * @brief Macro to get an element of the tensor.
+ */
+#define tif_a_value(type) do { \
+    result = (gdouble) ((const type *) data)[self->cv_offset]; \
+  } while (0)
+
+/**
+ * @brief Macro to get the sum of the elements.
+ */
+#define tif_reduce_sum(type) do { \
+    const type *p = (const type *) data; \
+    gdouble lane[TIF_LANES] = { 0 }; \
+    for (i = 0; i + TIF_LANES <= count; i += TIF_LANES) \
+      for (j = 0; j < TIF_LANES; j++) \
+        lane[j] += (gdouble) p[i + j]; \
+    for (; i < count; i++) \
+      lane[0] += (gdouble) p[i]; \
+    for (j = 0; j < TIF_LANES; j++) \
+      result += lane[j]; \
+  } while (0)
+
+/**
+ * @brief Macro to get the max or min of the elements.
+ */
+#define tif_reduce_minmax(type,op) do { \
+    const type *p = (const type *) data; \
+    type lane[TIF_LANES]; \
+    type m; \
+    for (j = 0; j < TIF_LANES; j++) \
+      lane[j] = p[0]; \
+    for (i = 0; i + TIF_LANES <= count; i += TIF_LANES) \
+      for (j = 0; j < TIF_LANES; j++) \
+        lane[j] = op (lane[j], p[i + j]); \
+    for (; i < count; i++) \
+      lane[0] = op (lane[0], p[i]); \
+    m = lane[0]; \
+    for (j = 1; j < TIF_LANES; j++) \
+      m = op (m, lane[j]); \
+    result = (gdouble) m; \
+  } while (0)
+
+#define tif_reduce_max(type) tif_reduce_minmax (type, MAX)
+#define tif_reduce_min(type) tif_reduce_minmax (type, MIN)
+
+/**
+ * @brief Macro to count the elements greater than the threshold.
+ */
+#define tif_reduce_count(type) do { \
+    const type *p = (const type *) data; \
+    const gdouble thr = self->cv_threshold; \
+    guint64 lane[TIF_LANES] = { 0 }; \
+    for (i = 0; i + TIF_LANES <= count; i += TIF_LANES) \
+      for (j = 0; j < TIF_LANES; j++) \
+        lane[j] += ((gdouble) p[i + j] > thr); \
+    for (; i < count; i++) \
+      lane[0] += ((gdouble) p[i] > thr); \
+    for (j = 0; j < TIF_LANES; j++) \
+      result += (gdouble) lane[j]; \
+  } while (0)
+
+/**
+ * @brief Macro to run the operation with each tensor type.
+ */
+#define tif_type_case(nns_type,type,op) \
+    case nns_type: \
+      op (type); \
+      break
+
+/**
+ * @brief Macro to run the operation with the type of tensor.
+ */
+#define tif_switch_type(t,op) do { \
+    switch (t) { \
+      tif_type_case (_NNS_INT32, int32_t, op); \
+      tif_type_case (_NNS_UINT32, uint32_t, op); \
+      tif_type_case (_NNS_INT16, int16_t, op); \
+      tif_type_case (_NNS_UINT16, uint16_t, op); \
+      tif_type_case (_NNS_INT8, int8_t, op); \
+      tif_type_case (_NNS_UINT8, uint8_t, op); \
+      tif_type_case (_NNS_FLOAT64, double, op); \
+      tif_type_case (_NNS_FLOAT32, float, op); \
+      tif_type_case (_NNS_INT64, int64_t, op); \
+      tif_type_case (_NNS_UINT64, uint64_t, op); \
+      default: \
+        g_assert_not_reached (); \
+        break; \
+    } \
+  } while (0)
+
+/**
+ * @brief Get the compared value from the tensor data.
+ * @param self "this" pointer
+ * @param type tensor type
+ * @param data tensor data
+ * @param count the number of elements in the tensor (should be larger than 0)
+ * @return the compared value
+ */
+static gdouble
+gst_tensor_if_get_value (GstTensorIf * self, tensor_type type,
+    const guint8 * data, gsize count)
+{
+  gdouble result = 0.0;
+  gsize i;
+  guint j;
+
+  switch (self->cv) {
+    case TIFCV_A_VALUE:
+      tif_switch_type (type, tif_a_value);
+      break;
+    case TIFCV_TENSOR_AVERAGE_VALUE:
+      tif_switch_type (type, tif_reduce_sum);
+      result /= (gdouble) count;
+      break;
+    case TIFCV_TENSOR_MAX_VALUE:
+      tif_switch_type (type, tif_reduce_max);
+      break;
+    case TIFCV_TENSOR_MIN_VALUE:
+      tif_switch_type (type, tif_reduce_min);
+      break;
+    case TIFCV_TENSOR_SUM_VALUE:
+      tif_switch_type (type, tif_reduce_sum);
+      break;
+    case TIFCV_TENSOR_COUNT:
+      tif_switch_type (type, tif_reduce_count);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+
+  return result;
+}
+
+/**
+ * @brief Compare the value with the supplied value.
+ */
+static gboolean
+gst_tensor_if_compare (GstTensorIf * self, gdouble cv)
+{
+  const gdouble *sv = self->sv;
+
+  switch (self->op) {
+    case TIFOP_EQ:
+      return (cv == sv[0]);
+    case TIFOP_NE:
+      return (cv != sv[0]);
+    case TIFOP_GT:
+      return (cv > sv[0]);
+    case TIFOP_GE:
+      return (cv >= sv[0]);
+    case TIFOP_LT:
+      return (cv < sv[0]);
+    case TIFOP_LE:
+      return (cv <= sv[0]);
+    case TIFOP_RANGE_INCLUSIVE:
+      return (sv[0] <= cv && cv <= sv[1]);
+    case TIFOP_RANGE_EXCLUSIVE:
+      return (sv[0] < cv && cv < sv[1]);
+    case TIFOP_NOT_IN_RANGE_INCLUSIVE:
+      return (cv < sv[0] || sv[1] < cv);
+    case TIFOP_NOT_IN_RANGE_EXCLUSIVE:
+      return (cv <= sv[0] || sv[1] <= cv);
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+
+  return FALSE;
+}
+
+/**
+ * @brief Evaluate the condition with the incoming buffer.
+ * @param self "this" pointer
+ * @param buf incoming buffer
+ * @param[out] result the result of the condition
+ * @return TRUE if the condition is evaluated
+ */
+static gboolean
+gst_tensor_if_check_condition (GstTensorIf * self, GstBuffer * buf,
+    gboolean * result)
+{
+  GstTensorInfo *info;
+  GstMemory *mem = NULL;
+  GstMapInfo map;
+  gboolean mapped;
+  gsize count;
+  gdouble cv;
+
+  info = &self->in_config.info.info[self->cv_nth];
+
+  if (self->is_tensors) {
+    /* supposed n memory blocks in buffer */
+    if (gst_buffer_n_memory (buf) != self->in_config.info.num_tensors) {
+      GST_ERROR_OBJECT (self, "The number of memory blocks (%u) is different "
+          "from the number of tensors (%u).", gst_buffer_n_memory (buf),
+          self->in_config.info.num_tensors);
+      return FALSE;
+    }
+
+    mem = gst_buffer_peek_memory (buf, self->cv_nth);
+    mapped = gst_memory_map (mem, &map, GST_MAP_READ);
+  } else {
+    mapped = gst_buffer_map (buf, &map, GST_MAP_READ);
+  }
+
+  if (!mapped) {
+    GST_ERROR_OBJECT (self, "Failed to map the tensor %u.", self->cv_nth);
+    return FALSE;
+  }
+
+  mapped = (map.size >= gst_tensor_info_get_size (info));
+  if (mapped) {
+    count = gst_tensor_get_element_count (info->dimension);
+    cv = gst_tensor_if_get_value (self, info->type, map.data, count);
+    *result = gst_tensor_if_compare (self, cv);
+
+    silent_debug ("Compared value %f, result %d", cv, *result);
+  } else {
+    GST_ERROR_OBJECT (self, "Invalid size of the tensor %u (%" G_GSIZE_FORMAT ").",
+        self->cv_nth, map.size);
+  }
+
+  if (mem)
+    gst_memory_unmap (mem, &map);
+  else
+    gst_buffer_unmap (buf, &map);
+
+  return mapped;
+}
+
+/**
+ * @brief Push the gap event to the branch which does not get the buffer.
+ */
+static void
+gst_tensor_if_push_gap (GstTensorIf * self, GstTensorIfBranch * branch,
+    GstBuffer * buf)
+{
+  GstClockTime pts = GST_BUFFER_PTS (buf);
+
+  if (!GST_CLOCK_TIME_IS_VALID (pts))
+    return;
+
+  gst_pad_push_event (branch->pad,
+      gst_event_new_gap (pts, GST_BUFFER_DURATION (buf)));
+}
+
+/**
+ * @brief Push the buffer to the branch with its behavior. This takes the ownership of the buffer.
+ */
+static GstFlowReturn
+gst_tensor_if_push (GstTensorIf * self, GstTensorIfBranch * branch,
+    GstTensorIfBranch * other, GstBuffer * buf)
+{
+  GstBuffer *outbuf;
+  GstFlowReturn ret;
+  guint i;
+
+  switch (branch->behavior) {
+    case TIFB_SKIP:
+      gst_tensor_if_push_gap (self, branch, buf);
+      gst_buffer_unref (buf);
+      return GST_FLOW_OK;
+    case TIFB_TENSORPICK:
+      if (self->is_tensors) {
+        /* share the memory blocks of the chosen tensors */
+        outbuf = gst_buffer_new ();
+        for (i = 0; i < branch->num_picks; i++) {
+          gst_buffer_append_memory (outbuf,
+              gst_memory_ref (gst_buffer_peek_memory (buf, branch->picks[i])));
+        }
+
+        gst_buffer_copy_into (outbuf, buf, GST_BUFFER_COPY_METADATA, 0, -1);
+        gst_buffer_unref (buf);
+      } else {
+        /* other/tensor, the single tensor is picked. */
+        outbuf = buf;
+      }
+      break;
+    default:
+      outbuf = buf;
+      break;
+  }
+
+  ret = gst_pad_push (branch->pad, outbuf);
+  branch->last_ret = ret;
+
+  /* a branch may be left unlinked intentionally */
+  if (ret == GST_FLOW_NOT_LINKED && other->last_ret != GST_FLOW_NOT_LINKED)
+    ret = GST_FLOW_OK;
+
+  return ret;
+}
+
+/**
+ * @brief chain function for sink (gst element vmethod)
+ */
+static GstFlowReturn
+gst_tensor_if_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
+{
+  GstTensorIf *self = GST_TENSOR_IF (parent);
+  gboolean result = FALSE;
+  guint taken;
+
+  if (!self->configured) {
+    GST_ELEMENT_ERROR (self, CORE, NEGOTIATION, (NULL),
+        ("The condition is not configured."));
+    gst_buffer_unref (buf);
+    return GST_FLOW_NOT_NEGOTIATED;
+  }
+
+  if (!gst_tensor_if_check_condition (self, buf, &result)) {
+    GST_ELEMENT_ERROR (self, STREAM, FAILED, (NULL),
+        ("Failed to evaluate the condition."));
+    gst_buffer_unref (buf);
+    return GST_FLOW_ERROR;
+  }
+
+  taken = result ? TIF_THEN : TIF_ELSE;
+
+  gst_tensor_if_push_gap (self, &self->branch[1 - taken], buf);
+  return gst_tensor_if_push (self, &self->branch[taken],
+      &self->branch[1 - taken], buf);
+}
+
+/**
+ * @brief change state (gst element vmethod)
+ */
+static GstStateChangeReturn
+gst_tensor_if_change_state (GstElement * element, GstStateChange transition)
+{
+  GstTensorIf *self = GST_TENSOR_IF (element);
+  GstStateChangeReturn ret;
+
+  ret = GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
+  if (ret == GST_STATE_CHANGE_FAILURE)
+    return ret;
+
+  switch (transition) {
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+      self->configured = FALSE;
+      self->branch[TIF_THEN].last_ret = GST_FLOW_OK;
+      self->branch[TIF_ELSE].last_ret = GST_FLOW_OK;
+      break;
+    default:
+      break;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Set the behavior of the branch.
+ */
+static void
+gst_tensor_if_set_behavior (GstTensorIf * self, GstTensorIfBranch * branch,
+    const gchar * str)
+{
+  gint idx = gst_tensor_if_get_index (tensor_if_behavior_string, str);
+
+  if (idx < 0) {
+    GST_ERROR_OBJECT (self, "Invalid behavior %s.", GST_STR_NULL (str));
+    branch->behavior = TIFB_END;
+  } else {
+    branch->behavior = (tensor_if_behavior) idx;
+  }
+}
+
+/**
+ * @brief Set property (gst element vmethod)
+ */
+static void
+gst_tensor_if_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstTensorIf *self = GST_TENSOR_IF (object);
+  gint idx;
+
+  switch (prop_id) {
+    case PROP_SILENT:
+      self->silent = g_value_get_boolean (value);
+      break;
+    case PROP_CV:
+      idx = gst_tensor_if_get_index (tensor_if_cv_string,
+          g_value_get_string (value));
+      if (idx < 0) {
+        GST_ERROR_OBJECT (self, "Invalid compared value %s.",
+            GST_STR_NULL (g_value_get_string (value)));
+        self->cv = TIFCV_END;
+      } else {
+        self->cv = (tensor_if_compared_value) idx;
+      }
+      gst_tensor_if_parse_cv_option (self);
+      break;
+    case PROP_CV_OPTION:
+      g_free (self->cv_option);
+      self->cv_option = g_value_dup_string (value);
+      gst_tensor_if_parse_cv_option (self);
+      break;
+    case PROP_OP:
+      idx = gst_tensor_if_get_index (tensor_if_op_string,
+          g_value_get_string (value));
+      if (idx < 0) {
+        GST_ERROR_OBJECT (self, "Invalid operator %s.",
+            GST_STR_NULL (g_value_get_string (value)));
+        self->op = TIFOP_END;
+      } else {
+        self->op = (tensor_if_operator) idx;
+      }
+      break;
+    case PROP_SV:
+      g_free (self->sv_str);
+      self->sv_str = g_value_dup_string (value);
+      gst_tensor_if_parse_sv (self);
+      break;
+    case PROP_THEN:
+      gst_tensor_if_set_behavior (self, &self->branch[TIF_THEN],
+          g_value_get_string (value));
+      break;
+    case PROP_THEN_OPTION:
+      g_free (self->branch[TIF_THEN].option);
+      self->branch[TIF_THEN].option = g_value_dup_string (value);
+      gst_tensor_if_parse_branch_option (&self->branch[TIF_THEN]);
+      break;
+    case PROP_ELSE:
+      gst_tensor_if_set_behavior (self, &self->branch[TIF_ELSE],
+          g_value_get_string (value));
+      break;
+    case PROP_ELSE_OPTION:
+      g_free (self->branch[TIF_ELSE].option);
+      self->branch[TIF_ELSE].option = g_value_dup_string (value);
+      gst_tensor_if_parse_branch_option (&self->branch[TIF_ELSE]);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+/**
+ * @brief Get property (gst element vmethod)
+ */
+static void
+gst_tensor_if_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstTensorIf *self = GST_TENSOR_IF (object);
+
+  switch (prop_id) {
+    case PROP_SILENT:
+      g_value_set_boolean (value, self->silent);
+      break;
+    case PROP_CV:
+      g_value_set_string (value, tensor_if_cv_string[self->cv]);
+      break;
+    case PROP_CV_OPTION:
+      g_value_set_string (value, self->cv_option);
+      break;
+    case PROP_OP:
+      g_value_set_string (value, tensor_if_op_string[self->op]);
+      break;
+    case PROP_SV:
+      g_value_set_string (value, self->sv_str);
+      break;
+    case PROP_THEN:
+      g_value_set_string (value,
+          tensor_if_behavior_string[self->branch[TIF_THEN].behavior]);
+      break;
+    case PROP_THEN_OPTION:
+      g_value_set_string (value, self->branch[TIF_THEN].option);
+      break;
+    case PROP_ELSE:
+      g_value_set_string (value,
+          tensor_if_behavior_string[self->branch[TIF_ELSE].behavior]);
+      break;
+    case PROP_ELSE_OPTION:
+      g_value_set_string (value, self->branch[TIF_ELSE].option);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
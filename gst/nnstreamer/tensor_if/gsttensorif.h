@@ -0,0 +1,149 @@
+/**
+ * GStreamer
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	gsttensorif.h
+ * @date	18 Oct 2020
+ * @brief	GStreamer plugin to route the tensor stream with the condition on its content
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ */
+
+#ifndef __GST_TENSOR_IF_H__
+#define __GST_TENSOR_IF_H__
+
+#include <gst/gst.h>
+#include <tensor_common.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_TENSOR_IF (gst_tensor_if_get_type ())
+#define GST_TENSOR_IF(obj) (G_TYPE_CHECK_INSTANCE_CAST ((obj), GST_TYPE_TENSOR_IF, GstTensorIf))
+#define GST_TENSOR_IF_CLASS(klass) (G_TYPE_CHECK_CLASS_CAST ((klass), GST_TYPE_TENSOR_IF, GstTensorIfClass))
+#define GST_IS_TENSOR_IF(obj) (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_TENSOR_IF))
+#define GST_IS_TENSOR_IF_CLASS(klass) (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_TENSOR_IF))
+
+typedef struct _GstTensorIf GstTensorIf;
+typedef struct _GstTensorIfClass GstTensorIfClass;
+
+/**
+ * @brief The value compared with the supplied value.
+ */
+typedef enum
+{
+  TIFCV_A_VALUE = 0, /**< an element of the tensor */
+  TIFCV_TENSOR_AVERAGE_VALUE, /**< average of the elements */
+  TIFCV_TENSOR_MAX_VALUE, /**< max of the elements */
+  TIFCV_TENSOR_MIN_VALUE, /**< min of the elements */
+  TIFCV_TENSOR_SUM_VALUE, /**< sum of the elements */
+  TIFCV_TENSOR_COUNT, /**< the number of elements greater than the threshold */
+  TIFCV_END
+} tensor_if_compared_value;
+
+/**
+ * @brief The operator to compare the values.
+ */
+typedef enum
+{
+  TIFOP_EQ = 0, /**< cv == sv */
+  TIFOP_NE, /**< cv != sv */
+  TIFOP_GT, /**< cv > sv */
+  TIFOP_GE, /**< cv >= sv */
+  TIFOP_LT, /**< cv < sv */
+  TIFOP_LE, /**< cv <= sv */
+  TIFOP_RANGE_INCLUSIVE, /**< sv0 <= cv <= sv1 */
+  TIFOP_RANGE_EXCLUSIVE, /**< sv0 < cv < sv1 */
+  TIFOP_NOT_IN_RANGE_INCLUSIVE, /**< cv < sv0 or sv1 < cv */
+  TIFOP_NOT_IN_RANGE_EXCLUSIVE, /**< cv <= sv0 or sv1 <= cv */
+  TIFOP_END
+} tensor_if_operator;
+
+/**
+ * @brief The behavior of the branch (then or else).
+ */
+typedef enum
+{
+  TIFB_PASSTHROUGH = 0, /**< push the incoming buffer */
+  TIFB_SKIP, /**< drop the incoming buffer */
+  TIFB_TENSORPICK, /**< push the chosen tensors of the incoming buffer */
+  TIFB_END
+} tensor_if_behavior;
+
+/**
+ * @brief The source pad and the behavior of a branch.
+ */
+typedef struct
+{
+  GstPad *pad; /**< src pad of the branch */
+  GstFlowReturn last_ret; /**< last return of the pushed buffer */
+  tensor_if_behavior behavior; /**< behavior of the branch */
+  gchar *option; /**< option string of the behavior */
+  guint num_picks; /**< the number of chosen tensors (tensorpick) */
+  guint picks[NNS_TENSOR_SIZE_LIMIT]; /**< the index of chosen tensors (tensorpick) */
+  GstTensorsConfig config; /**< output tensors info */
+} GstTensorIfBranch;
+
+/**
+ * @brief Index of the branches.
+ */
+#define TIF_THEN (0)
+#define TIF_ELSE (1)
+
+/**
+ * @brief Tensor If data structure
+ */
+struct _GstTensorIf
+{
+  GstElement element; /**< parent object */
+
+  gboolean silent; /**< true to print minimized log */
+  GstPad *sinkpad; /**< sink pad */
+  GstTensorIfBranch branch[2]; /**< then (src_0) and else (src_1) */
+
+  tensor_if_compared_value cv; /**< compared value */
+  gchar *cv_option; /**< option string of the compared value */
+  guint cv_nth; /**< index of the tensor to be compared */
+  tensor_dim cv_index; /**< index of the element (a_value) */
+  gdouble cv_threshold; /**< threshold to count the elements (tensor_count) */
+  gsize cv_offset; /**< offset of the element (a_value), set when caps is negotiated */
+
+  tensor_if_operator op; /**< operator */
+  gchar *sv_str; /**< supplied value string */
+  gdouble sv[2]; /**< supplied values */
+  guint num_sv; /**< the number of supplied values */
+
+  gboolean configured; /**< true if the condition is validated with the caps */
+  gboolean is_tensors; /**< true if the stream is other/tensors */
+  GstTensorsConfig in_config; /**< input tensors info */
+};
+
+/**
+ * @brief GstTensorIfClass inherits GstElementClass
+ */
+struct _GstTensorIfClass
+{
+  GstElementClass parent_class; /**< parent class */
+};
+
+/**
+ * @brief Get Type function required for gst elements
+ */
+GType gst_tensor_if_get_type (void);
+
+G_END_DECLS
+
+#endif /** __GST_TENSOR_IF_H__ */
@@ -46,6 +46,15 @@
  * multifilesrc location="testsequence_%1d.png" index=0 caps="image/png, framerate=(fraction)30/1" ! pngdec ! tensor_converter ! merge.sink_0
  * multifilesrc location="testsequence_%1d.png" index=0 caps="image/png, framerate=(fraction)30/1" ! pngdec ! tensor_converter ! merge.sink_1
  * multifilesrc location="testsequence_%1d.png" index=0 caps="image/png, framerate=(fraction)30/1" ! pngdec ! tensor_converter ! merge.sink_2
+ * ]|
+ *
+ * With mode=reduce, the tensors with the same dimension and type are reduced elementwise (option=sum, mean or max),
+ * e.g., to average the outputs of the models in an ensemble.
+ * |[
+ * gst-launch -v -m tensor_merge name=merge mode=reduce option=mean ! tensor_sink
+ * ... ! tensor_filter framework=tensorflow-lite model=a.tflite ! merge.sink_0
+ * ... ! tensor_filter framework=tensorflow-lite model=b.tflite ! merge.sink_1
+ * ]|
  *
  * </refsect2>
  *
@@ -117,6 +126,9 @@ static gboolean gst_tensor_merge_sink_event (GstCollectPads * pads,
     GstCollectData * data, GstEvent * event, GstTensorMerge * tensor_merge);
 static GstFlowReturn gst_tensor_merge_collected (GstCollectPads * pads,
     GstTensorMerge * tensor_merge);
+static GstFlowReturn gst_tensor_merge_clip (GstCollectPads * pads,
+    GstCollectData * data, GstBuffer * inbuf, GstBuffer ** outbuf,
+    GstTensorMerge * tensor_merge);
 
 static void gst_tensor_merge_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
@@ -210,20 +222,27 @@ gst_tensor_merge_init (GstTensorMerge * tensor_merge)
   gst_collect_pads_set_function (tensor_merge->collect,
       (GstCollectPadsFunction) GST_DEBUG_FUNCPTR (gst_tensor_merge_collected),
       tensor_merge);
+  gst_collect_pads_set_clip_function (tensor_merge->collect,
+      (GstCollectPadsClipFunction) GST_DEBUG_FUNCPTR (gst_tensor_merge_clip),
+      tensor_merge);
 
   tensor_merge->silent = TRUE;
   tensor_merge->sync.mode = SYNC_NOSYNC;
   tensor_merge->sync.option = NULL;
+  g_mutex_init (&tensor_merge->sync.lock);
+  g_cond_init (&tensor_merge->sync.timer.cond);
   gst_tensors_config_init (&tensor_merge->tensors_config);
   tensor_merge->mode = GTT_END;
   tensor_merge->loaded = FALSE;
   tensor_merge->need_buffer = FALSE;
   tensor_merge->current_time = 0;
   tensor_merge->need_set_time = TRUE;
+  tensor_merge->pool = NULL;
 }
 
 static const gchar *gst_tensor_merge_mode_string[] = {
   [GTT_LINEAR] = "linear",
+  [GTT_REDUCE] = "reduce",
   [GTT_END] = "error",
 };
 
@@ -235,6 +254,56 @@ static const gchar *gst_tensor_merge_linear_string[] = {
   [LINEAR_END] = NULL,
 };
 
+static const gchar *gst_tensor_merge_reduce_string[] = {
+  [REDUCE_SUM] = "sum",
+  [REDUCE_MEAN] = "mean",
+  [REDUCE_MAX] = "max",
+  [REDUCE_END] = NULL,
+};
+
+/**
+ * @brief Release the buffer pool for outgoing buffer.
+ */
+static void
+gst_tensor_merge_clear_pool (GstTensorMerge * tensor_merge)
+{
+  if (tensor_merge->pool) {
+    gst_buffer_pool_set_active (tensor_merge->pool, FALSE);
+    gst_object_unref (tensor_merge->pool);
+    tensor_merge->pool = NULL;
+  }
+}
+
+/**
+ * @brief Prepare the buffer pool for outgoing buffer.
+ * @param tensor_merge tensor merger
+ * @param caps negotiated caps of source pad
+ * @param size size of outgoing buffer
+ * @return TRUE if the pool is activated
+ */
+static gboolean
+gst_tensor_merge_setup_pool (GstTensorMerge * tensor_merge, GstCaps * caps,
+    gsize size)
+{
+  GstStructure *config;
+
+  gst_tensor_merge_clear_pool (tensor_merge);
+
+  tensor_merge->pool = gst_buffer_pool_new ();
+
+  config = gst_buffer_pool_get_config (tensor_merge->pool);
+  gst_buffer_pool_config_set_params (config, caps, size, 0, 0);
+
+  if (!gst_buffer_pool_set_config (tensor_merge->pool, config) ||
+      !gst_buffer_pool_set_active (tensor_merge->pool, TRUE)) {
+    GST_ERROR_OBJECT (tensor_merge, "Failed to activate the buffer pool.");
+    gst_tensor_merge_clear_pool (tensor_merge);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief Get the corresponding mode from the string value
  * @param[in] str The string value for the mode
@@ -266,6 +335,9 @@ gst_tensor_merge_finalize (GObject * object)
     tensor_merge->collect = NULL;
   }
 
+  g_cond_clear (&tensor_merge->sync.timer.cond);
+  g_mutex_clear (&tensor_merge->sync.lock);
+
   if (tensor_merge->option) {
     g_free (tensor_merge->option);
     tensor_merge->option = NULL;
@@ -276,6 +348,8 @@ gst_tensor_merge_finalize (GObject * object)
     tensor_merge->sync.option = NULL;
   }
 
+  gst_tensor_merge_clear_pool (tensor_merge);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -314,9 +388,11 @@ gst_tensor_merge_request_new_pad (GstElement * element, GstPadTemplate * templ,
 
     tensormergepad = (GstTensorCollectPadData *)
         gst_collect_pads_add_pad (tensor_merge->collect, newpad,
-        sizeof (GstTensorCollectPadData), NULL, TRUE);
+        sizeof (GstTensorCollectPadData), NULL,
+        !gst_tensor_time_sync_change_waiting (&tensor_merge->sync));
 
     tensormergepad->pad = newpad;
+    gst_tensors_config_init (&tensormergepad->config);
     gst_pad_set_element_private (newpad, tensormergepad);
     tensor_merge->tensors_config.info.num_tensors++;
     gst_element_add_pad (element, newpad);
@@ -358,6 +434,17 @@ gst_tensor_merge_sink_event (GstCollectPads * pads, GstCollectData * data,
     case GST_EVENT_FLUSH_STOP:
       tensor_merge->need_segment = TRUE;
       break;
+    case GST_EVENT_CAPS:
+    {
+      GstCaps *caps;
+
+      gst_event_parse_caps (event, &caps);
+      if (!gst_tensor_collect_pad_set_config ((GstTensorCollectPadData *) data,
+              caps)) {
+        GST_ERROR_OBJECT (tensor_merge, "Invalid caps %" GST_PTR_FORMAT, caps);
+      }
+      break;
+    }
     default:
       break;
   }
@@ -365,6 +452,20 @@ gst_tensor_merge_sink_event (GstCollectPads * pads, GstCollectData * data,
   return gst_collect_pads_event_default (pads, data, event, FALSE);
 }
 
+/**
+ * @brief clip function of collect pads, called when a buffer arrives
+ */
+static GstFlowReturn
+gst_tensor_merge_clip (GstCollectPads * pads, GstCollectData * data,
+    GstBuffer * inbuf, GstBuffer ** outbuf, GstTensorMerge * tensor_merge)
+{
+  /* start to wait for the other pads in timeout mode */
+  gst_tensor_time_sync_start_timeout (pads, &tensor_merge->sync);
+
+  *outbuf = inbuf;
+  return GST_FLOW_OK;
+}
+
 /**
  * @brief Generate TensorConfig with TensorsConfig
  * @param tensor_merge tensor merger
@@ -410,6 +511,30 @@ gst_tensor_merge_get_merged_config (GstTensorMerge * tensor_merge,
       ret = TRUE;
     }
       break;
+    case GTT_REDUCE:
+    {
+      if (!tensor_merge->loaded) {
+        GST_ERROR_OBJECT (tensor_merge,
+            "The reduce option is not set or invalid, cannot reduce the tensors.");
+        return FALSE;
+      }
+
+      for (i = 1; i < configs->info.num_tensors; i++) {
+        if (memcmp (&dim, &configs->info.info[i].dimension,
+                sizeof (tensor_dim)) != 0) {
+          GST_ERROR_OBJECT (tensor_merge,
+              "The dimension of %dth tensor is different, cannot reduce the tensors.",
+              i);
+          return FALSE;
+        }
+      }
+      config->info.type = type;
+      memcpy (&config->info.dimension, &dim, sizeof (tensor_dim));
+      config->rate_d = configs->rate_d;
+      config->rate_n = configs->rate_n;
+      ret = TRUE;
+    }
+      break;
     default:
       ret = FALSE;
   }
@@ -456,149 +581,219 @@ gst_tensor_merge_collect_buffer (GstTensorMerge * tensor_merge,
 }
 
 
+/**
+ * @brief Concatenate the tensors with the axis (linear mode).
+ * @param tensor_merge tensor merger
+ * @param in mapped input tensors
+ * @param out output data
+ * @note The inputs are concatenated with a memcpy for each contiguous block (the axis and inner dimensions).
+ *       With the outermost axis, there is a single memcpy for each input.
+ */
+static void
+gst_tensor_merge_linear (GstTensorMerge * tensor_merge, GstMapInfo * in,
+    guint8 * out)
+{
+  GstTensorInfo *info = tensor_merge->tensors_config.info.info;
+  guint num = tensor_merge->tensors_config.info.num_tensors;
+  guint direction = tensor_merge->data_linear.direction;
+  gsize element_size, block[NNS_TENSOR_SIZE_LIMIT];
+  guint i, k, o, outer;
+
+  element_size = gst_tensor_get_element_size (info[0].type);
+
+  for (k = 0; k < num; k++) {
+    block[k] = element_size;
+    for (i = 0; i <= direction; i++)
+      block[k] *= info[k].dimension[i];
+  }
+
+  outer = 1;
+  for (i = direction + 1; i < NNS_TENSOR_RANK_LIMIT; i++)
+    outer *= info[0].dimension[i];
+
+  for (o = 0; o < outer; o++) {
+    for (k = 0; k < num; k++) {
+      nns_memcpy (out, in[k].data + o * block[k], block[k]);
+      out += block[k];
+    }
+  }
+}
+
+/**
+ * @brief Macro for elementwise reduction in the type of tensor (sum, max, and mean of floating point).
+ */
+#define reduce_elementwise(type) do { \
+    type *o = (type *) out; \
+    const type *s; \
+    nns_memcpy (o, in[0].data, count * sizeof (type)); \
+    for (k = 1; k < num; k++) { \
+      s = (const type *) in[k].data; \
+      if (mode == REDUCE_MAX) { \
+        for (i = 0; i < count; i++) \
+          o[i] = MAX (o[i], s[i]); \
+      } else { \
+        for (i = 0; i < count; i++) \
+          o[i] += s[i]; \
+      } \
+    } \
+    if (mode == REDUCE_MEAN) { \
+      for (i = 0; i < count; i++) \
+        o[i] /= (type) num; \
+    } \
+  } while (0)
+
+/**
+ * @brief The number of elements in a block to get the mean of integers.
+ */
+#define REDUCE_BLOCK_SIZE (256)
+
+/**
+ * @brief Macro for elementwise mean of integers, accumulated in double to prevent overflow.
+ */
+#define reduce_mean_integer(type) do { \
+    type *o = (type *) out; \
+    const type *s; \
+    gdouble acc[REDUCE_BLOCK_SIZE]; \
+    gsize b, n; \
+    for (b = 0; b < count; b += REDUCE_BLOCK_SIZE) { \
+      n = MIN (REDUCE_BLOCK_SIZE, count - b); \
+      s = ((const type *) in[0].data) + b; \
+      for (i = 0; i < n; i++) \
+        acc[i] = s[i]; \
+      for (k = 1; k < num; k++) { \
+        s = ((const type *) in[k].data) + b; \
+        for (i = 0; i < n; i++) \
+          acc[i] += s[i]; \
+      } \
+      for (i = 0; i < n; i++) \
+        o[b + i] = (type) (acc[i] / num); \
+    } \
+  } while (0)
+
+/**
+ * @brief Macro for reduction of each tensor type.
+ */
+#define reduce_case(nns_type, type, is_float) \
+    case nns_type: \
+      if (mode == REDUCE_MEAN && !is_float) \
+        reduce_mean_integer (type); \
+      else \
+        reduce_elementwise (type); \
+      break
+
+/**
+ * @brief Reduce the tensors elementwise (reduce mode).
+ * @param tensor_merge tensor merger
+ * @param in mapped input tensors
+ * @param out output data
+ * @note Each input is processed with a loop over the whole tensor, so that the compiler can vectorize it.
+ *       The sum of integers wraps around in the type of tensor.
+ */
+static void
+gst_tensor_merge_reduce (GstTensorMerge * tensor_merge, GstMapInfo * in,
+    guint8 * out)
+{
+  GstTensorInfo *info = tensor_merge->tensors_config.info.info;
+  guint num = tensor_merge->tensors_config.info.num_tensors;
+  tensor_merge_reduce_mode mode = tensor_merge->data_reduce.mode;
+  gsize i, count;
+  guint k;
+
+  count = gst_tensor_get_element_count (info[0].dimension);
+
+  switch (info[0].type) {
+      reduce_case (_NNS_INT32, int32_t, FALSE);
+      reduce_case (_NNS_UINT32, uint32_t, FALSE);
+      reduce_case (_NNS_INT16, int16_t, FALSE);
+      reduce_case (_NNS_UINT16, uint16_t, FALSE);
+      reduce_case (_NNS_INT8, int8_t, FALSE);
+      reduce_case (_NNS_UINT8, uint8_t, FALSE);
+      reduce_case (_NNS_FLOAT64, double, TRUE);
+      reduce_case (_NNS_FLOAT32, float, TRUE);
+      reduce_case (_NNS_INT64, int64_t, FALSE);
+      reduce_case (_NNS_UINT64, uint64_t, FALSE);
+    default:
+      GST_ERROR_OBJECT (tensor_merge, "Unsupported tensor type %d.",
+          info[0].type);
+      g_assert (0);
+      break;
+  }
+}
+
 /**
  * @brief Generate Output GstMemory
  * @param tensor_merge tensor merger
  * @param tensors_buf collected tensors buffer
- * @param tensor_buf output tensor buffer
- * @return boolean
+ * @param[out] tensor_buf output tensor buffer (from the buffer pool)
+ * @return GST_FLOW_OK if the output buffer is generated
  */
 static GstFlowReturn
 gst_tensor_merge_generate_mem (GstTensorMerge * tensor_merge,
-    GstBuffer * tensors_buf, GstBuffer * tensor_buf)
+    GstBuffer * tensors_buf, GstBuffer ** tensor_buf)
 {
-  GstFlowReturn ret = GST_FLOW_OK;
+  GstFlowReturn ret = GST_FLOW_ERROR;
   GstMapInfo mInfo[NNS_TENSOR_SIZE_LIMIT];
   GstMemory *mem[NNS_TENSOR_SIZE_LIMIT];
   GstMapInfo outInfo;
-  GstMemory *outMem;
-  uint8_t *inptr, *outptr;
-  int num_mem = tensor_merge->tensors_config.info.num_tensors;
-  int i, j, k, l;
-  gsize outSize = 0;
-  gsize element_size;
-  tensor_dim dim;
-  tensor_type type;
-
-  memcpy (&dim, &tensor_merge->tensors_config.info.info[0].dimension,
-      sizeof (tensor_dim));
-  type = tensor_merge->tensors_config.info.info[0].type;
-  element_size = gst_tensor_get_element_size (type);
+  GstBuffer *outbuf = NULL;
+  guint num_mem = tensor_merge->tensors_config.info.num_tensors;
+  guint i, mapped = 0;
+
+  if (gst_buffer_n_memory (tensors_buf) != num_mem) {
+    GST_ERROR_OBJECT (tensor_merge, "Invalid number of tensors %u (%u).",
+        gst_buffer_n_memory (tensors_buf), num_mem);
+    return GST_FLOW_ERROR;
+  }
 
   for (i = 0; i < num_mem; i++) {
     mem[i] = gst_buffer_peek_memory (tensors_buf, i);
-    g_assert (gst_memory_map (mem[i], &mInfo[i], GST_MAP_READ));
-    outSize += mInfo[i].size;
+    if (!gst_memory_map (mem[i], &mInfo[i], GST_MAP_READ)) {
+      GST_ERROR_OBJECT (tensor_merge, "Failed to map %uth tensor.", i);
+      goto done;
+    }
+    mapped++;
+
+    if (mInfo[i].size !=
+        gst_tensor_info_get_size (&tensor_merge->tensors_config.info.info[i])) {
+      GST_ERROR_OBJECT (tensor_merge, "Invalid size of %uth tensor %"
+          G_GSIZE_FORMAT ".", i, mInfo[i].size);
+      goto done;
+    }
+  }
+
+  ret = gst_buffer_pool_acquire_buffer (tensor_merge->pool, &outbuf, NULL);
+  if (ret != GST_FLOW_OK) {
+    GST_ERROR_OBJECT (tensor_merge, "Failed to get the buffer from the pool.");
+    goto done;
   }
 
-  outMem = gst_allocator_alloc (NULL, outSize, NULL);
-  g_assert (gst_memory_map (outMem, &outInfo, GST_MAP_WRITE));
-  outptr = outInfo.data;
+  if (!gst_buffer_map (outbuf, &outInfo, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (tensor_merge, "Failed to map the outgoing buffer.");
+    gst_buffer_unref (outbuf);
+    ret = GST_FLOW_ERROR;
+    goto done;
+  }
 
   switch (tensor_merge->mode) {
     case GTT_LINEAR:
-    {
-      switch (tensor_merge->data_linear.direction) {
-        case LINEAR_FIRST:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (i = 0; i < dim[2]; i++) {
-              for (j = 0; j < dim[1]; j++) {
-                for (k = 0; k < num_mem; k++) {
-                  size_t c =
-                      tensor_merge->tensors_config.info.info[k].dimension[0];
-                  size_t s = element_size * c;
-                  inptr =
-                      mInfo[k].data + (l * dim[2] * dim[1] + i * dim[1] +
-                      j) * s;
-                  memcpy (outptr, inptr, s);
-                  outptr += s;
-                }
-              }
-            }
-
-          }
-          ret = TRUE;
-        }
-          break;
-        case LINEAR_SECOND:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (i = 0; i < dim[2]; i++) {
-              for (k = 0; k < num_mem; k++) {
-                size_t c, s;
-
-                c = 1;
-                for (j = 0; j < LINEAR_SECOND + 1; j++)
-                  c *= tensor_merge->tensors_config.info.info[k].dimension[j];
-
-                s = element_size * c;
-
-                inptr = mInfo[k].data + (l * dim[2] + i) * s;
-
-                memcpy (outptr, inptr, s);
-                outptr += s;
-              }
-            }
-          }
-          ret = TRUE;
-        }
-          break;
-        case LINEAR_THIRD:
-        {
-          for (l = 0; l < dim[3]; l++) {
-            for (k = 0; k < num_mem; k++) {
-              size_t c, s;
-
-              c = 1;
-              for (j = 0; j < LINEAR_THIRD + 1; j++)
-                c *= tensor_merge->tensors_config.info.info[k].dimension[j];
-
-              s = element_size * c;
-
-              inptr = mInfo[k].data + l * s;
-
-              memcpy (outptr, inptr, s);
-              outptr += s;
-            }
-          }
-          ret = TRUE;
-        }
-          break;
-        case LINEAR_FOURTH:
-        {
-          for (k = 0; k < num_mem; k++) {
-            size_t c, s;
-
-            c = 1;
-            for (j = 0; j < LINEAR_FOURTH + 1; j++)
-              c *= tensor_merge->tensors_config.info.info[k].dimension[j];
-
-            s = element_size * c;
-
-            inptr = mInfo[k].data;
-            memcpy (outptr, inptr, s);
-            outptr += s;
-          }
-
-          ret = TRUE;
-        }
-          break;
-        default:
-          ret = FALSE;
-      }
-    }
+      gst_tensor_merge_linear (tensor_merge, mInfo, outInfo.data);
+      break;
+    case GTT_REDUCE:
+      gst_tensor_merge_reduce (tensor_merge, mInfo, outInfo.data);
       break;
     default:
-      ret = FALSE;
+      g_assert (0);
+      break;
   }
 
-  gst_buffer_append_memory (tensor_buf, outMem);
-  gst_buffer_copy_into (tensor_buf, tensors_buf, GST_BUFFER_COPY_TIMESTAMPS, 0,
+  gst_buffer_unmap (outbuf, &outInfo);
+  gst_buffer_copy_into (outbuf, tensors_buf, GST_BUFFER_COPY_TIMESTAMPS, 0,
       -1);
-  for (i = 0; i < num_mem; i++)
+  *tensor_buf = outbuf;
+
+done:
+  for (i = 0; i < mapped; i++)
     gst_memory_unmap (mem[i], &mInfo[i]);
-  gst_memory_unmap (outMem, &outInfo);
 
   return ret;
 }
@@ -659,7 +854,9 @@ gst_tensor_merge_collected (GstCollectPads * pads,
       goto nego_error;
     }
 
-    if (!gst_pad_set_caps (tensor_merge->srcpad, newcaps)) {
+    if (!gst_pad_set_caps (tensor_merge->srcpad, newcaps) ||
+        !gst_tensor_merge_setup_pool (tensor_merge, newcaps,
+            gst_tensor_info_get_size (&config.info))) {
       gst_caps_unref (newcaps);
       goto nego_error;
     }
@@ -685,10 +882,9 @@ gst_tensor_merge_collected (GstCollectPads * pads,
     tensor_merge->need_segment = FALSE;
   }
 
-  tensor_buf = gst_buffer_new ();
-  g_assert (tensor_buf != NULL);
-
-  gst_tensor_merge_generate_mem (tensor_merge, tensors_buf, tensor_buf);
+  ret = gst_tensor_merge_generate_mem (tensor_merge, tensors_buf, &tensor_buf);
+  if (ret != GST_FLOW_OK)
+    goto beach;
 
   ret = gst_pad_push (tensor_merge->srcpad, tensor_buf);
   tensor_merge->need_set_time = TRUE;
@@ -719,6 +915,10 @@ gst_tensor_merge_ready_to_paused (GstTensorMerge * tensor_merge)
   tensor_merge->need_segment = TRUE;
   tensor_merge->negotiated = FALSE;
   gst_collect_pads_start (tensor_merge->collect);
+
+  GST_COLLECT_PADS_STREAM_LOCK (tensor_merge->collect);
+  gst_tensor_time_sync_reset_waiting (tensor_merge->collect, &tensor_merge->sync);
+  GST_COLLECT_PADS_STREAM_UNLOCK (tensor_merge->collect);
 }
 
 /**
@@ -736,6 +936,9 @@ gst_tensor_merge_change_state (GstElement * element, GstStateChange transition)
       break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       gst_collect_pads_stop (tensor_merge->collect);
+      /* no buffer arrives after the collect pads are stopped */
+      gst_tensor_time_sync_stop_timeout (tensor_merge->collect, &tensor_merge->sync);
+      gst_tensor_merge_clear_pool (tensor_merge);
       break;
     default:
       break;
@@ -772,6 +975,20 @@ gst_tensor_merge_set_option_data (GstTensorMerge * filter)
       filter->loaded = TRUE;
     }
       break;
+    case GTT_REDUCE:
+    {
+      filter->data_reduce.mode =
+          find_key_strv (gst_tensor_merge_reduce_string, filter->option);
+      if (filter->data_reduce.mode < 0) {
+        GST_ERROR_OBJECT (filter,
+            "Invalid reduce option %s, it should be sum, mean or max.",
+            filter->option);
+        filter->loaded = FALSE;
+        break;
+      }
+      filter->loaded = TRUE;
+    }
+      break;
     default:
       GST_ERROR_OBJECT (filter, "Cannot identify mode\n");
       g_assert (0);
@@ -45,6 +45,7 @@ typedef struct _GstTensorMergeClass GstTensorMergeClass;
 typedef enum
 {
   GTT_LINEAR = 0,               /* Dimension Change. "dimchg" */
+  GTT_REDUCE,                   /* Elementwise reduction. "reduce" */
   GTT_END,
 } tensor_merge_mode;
 
@@ -57,6 +58,14 @@ typedef enum
   LINEAR_END,
 } tensor_merge_linear_mode;
 
+typedef enum
+{
+  REDUCE_SUM = 0,
+  REDUCE_MEAN = 1,
+  REDUCE_MAX = 2,
+  REDUCE_END,
+} tensor_merge_reduce_mode;
+
 
 /**
  * @brief Internal data structure for linear mode.
@@ -65,6 +74,13 @@ typedef struct _tensor_merge_linear {
   tensor_merge_linear_mode direction;
 } tensor_merge_linear;
 
+/**
+ * @brief Internal data structure for reduce mode.
+ */
+typedef struct _tensor_merge_reduce {
+  tensor_merge_reduce_mode mode;
+} tensor_merge_reduce;
+
 /**
  * @brief Tensor Merge data structure
  */
@@ -79,6 +95,7 @@ struct _GstTensorMerge
   tensor_merge_mode mode;
   union{
     tensor_merge_linear data_linear;
+    tensor_merge_reduce data_reduce;
   };
 
   gboolean loaded;
@@ -92,6 +109,7 @@ struct _GstTensorMerge
   GstClockTime current_time;
   gboolean need_set_time;
   GstTensorsConfig tensors_config; /**< output tensors info */
+  GstBufferPool *pool; /**< buffer pool for outgoing buffer */
 };
 
 /**
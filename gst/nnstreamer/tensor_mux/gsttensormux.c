@@ -122,6 +122,9 @@ static gboolean gst_tensor_mux_sink_event (GstCollectPads * pads,
     GstCollectData * data, GstEvent * event, GstTensorMux * tensor_mux);
 static GstFlowReturn gst_tensor_mux_collected (GstCollectPads * pads,
     GstTensorMux * tesnor_mux);
+static GstFlowReturn gst_tensor_mux_clip (GstCollectPads * pads,
+    GstCollectData * data, GstBuffer * inbuf, GstBuffer ** outbuf,
+    GstTensorMux * tensor_mux);
 
 static void gst_tensor_mux_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
@@ -208,10 +211,15 @@ gst_tensor_mux_init (GstTensorMux * tensor_mux)
   gst_collect_pads_set_function (tensor_mux->collect,
       (GstCollectPadsFunction) GST_DEBUG_FUNCPTR (gst_tensor_mux_collected),
       tensor_mux);
+  gst_collect_pads_set_clip_function (tensor_mux->collect,
+      (GstCollectPadsClipFunction) GST_DEBUG_FUNCPTR (gst_tensor_mux_clip),
+      tensor_mux);
 
   tensor_mux->silent = TRUE;
   tensor_mux->sync.mode = SYNC_NOSYNC;
   tensor_mux->sync.option = NULL;
+  g_mutex_init (&tensor_mux->sync.lock);
+  g_cond_init (&tensor_mux->sync.timer.cond);
   tensor_mux->need_buffer = FALSE;
   tensor_mux->current_time = 0;
   tensor_mux->need_set_time = TRUE;
@@ -233,6 +241,9 @@ gst_tensor_mux_finalize (GObject * object)
     tensor_mux->collect = NULL;
   }
 
+  g_cond_clear (&tensor_mux->sync.timer.cond);
+  g_mutex_clear (&tensor_mux->sync.lock);
+
   if (tensor_mux->sync.option) {
     g_free (tensor_mux->sync.option);
     tensor_mux->sync.option = NULL;
@@ -267,8 +278,10 @@ gst_tensor_mux_request_new_pad (GstElement * element, GstPadTemplate * templ,
     GstTensorCollectPadData *tensormuxpad;
     tensormuxpad = (GstTensorCollectPadData *)
         gst_collect_pads_add_pad (tensor_mux->collect, newpad,
-        sizeof (GstTensorCollectPadData), NULL, TRUE);
+        sizeof (GstTensorCollectPadData), NULL,
+        !gst_tensor_time_sync_change_waiting (&tensor_mux->sync));
     tensormuxpad->pad = newpad;
+    gst_tensors_config_init (&tensormuxpad->config);
     gst_pad_set_element_private (newpad, tensormuxpad);
     gst_element_add_pad (element, newpad);
   } else {
@@ -309,6 +322,17 @@ gst_tensor_mux_sink_event (GstCollectPads * pads, GstCollectData * data,
     case GST_EVENT_FLUSH_STOP:
       tensor_mux->need_segment = TRUE;
       break;
+    case GST_EVENT_CAPS:
+    {
+      GstCaps *caps;
+
+      gst_event_parse_caps (event, &caps);
+      if (!gst_tensor_collect_pad_set_config ((GstTensorCollectPadData *) data,
+              caps)) {
+        GST_ERROR_OBJECT (tensor_mux, "Invalid caps %" GST_PTR_FORMAT, caps);
+      }
+      break;
+    }
     default:
       break;
   }
@@ -316,6 +340,20 @@ gst_tensor_mux_sink_event (GstCollectPads * pads, GstCollectData * data,
   return gst_collect_pads_event_default (pads, data, event, FALSE);
 }
 
+/**
+ * @brief clip function of collect pads, called when a buffer arrives
+ */
+static GstFlowReturn
+gst_tensor_mux_clip (GstCollectPads * pads, GstCollectData * data,
+    GstBuffer * inbuf, GstBuffer ** outbuf, GstTensorMux * tensor_mux)
+{
+  /* start to wait for the other pads in timeout mode */
+  gst_tensor_time_sync_start_timeout (pads, &tensor_mux->sync);
+
+  *outbuf = inbuf;
+  return GST_FLOW_OK;
+}
+
 /**
  * @brief Looping to generete outbut buffer for srcpad
  * @param tensor_mux tensor muxer
@@ -467,6 +505,10 @@ gst_tensor_mux_ready_to_paused (GstTensorMux * tensor_mux)
   tensor_mux->need_segment = TRUE;
   tensor_mux->negotiated = FALSE;
   gst_collect_pads_start (tensor_mux->collect);
+
+  GST_COLLECT_PADS_STREAM_LOCK (tensor_mux->collect);
+  gst_tensor_time_sync_reset_waiting (tensor_mux->collect, &tensor_mux->sync);
+  GST_COLLECT_PADS_STREAM_UNLOCK (tensor_mux->collect);
 }
 
 /**
@@ -484,6 +526,8 @@ gst_tensor_mux_change_state (GstElement * element, GstStateChange transition)
       break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       gst_collect_pads_stop (tensor_mux->collect);
+      /* no buffer arrives after the collect pads are stopped */
+      gst_tensor_time_sync_stop_timeout (tensor_mux->collect, &tensor_mux->sync);
       break;
     default:
       break;
@@ -0,0 +1,191 @@
+/**
+ * NNStreamer binary format to record and replay tensor streams
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file  tensor_record.c
+ * @date  18 Oct 2020
+ * @brief Self-describing binary format of tensor stream (other/tensor-record)
+ * @see https://github.com/nnsuite/nnstreamer
+ * @author  agent <agent@local>
+ * @bug No known bugs except for NYI items
+ */
+
+#include <string.h>
+#include <tensor_common.h>
+#include "tensor_record.h"
+
+G_STATIC_ASSERT (sizeof (GstTensorRecordStreamHeader) % 8 == 0);
+G_STATIC_ASSERT (sizeof (GstTensorRecordHeader) == 32);
+
+/**
+ * @brief Fill the stream header with given config.
+ */
+gboolean
+gst_tensor_record_set_stream_header (GstTensorRecordStreamHeader * header,
+    const GstTensorsConfig * config)
+{
+  guint i, j;
+
+  g_return_val_if_fail (header != NULL, FALSE);
+  g_return_val_if_fail (config != NULL, FALSE);
+  g_return_val_if_fail (gst_tensors_info_validate (&config->info), FALSE);
+
+  memset (header, 0, sizeof (GstTensorRecordStreamHeader));
+
+  header->magic = GUINT32_TO_LE (NNS_TENSOR_RECORD_STREAM_MAGIC);
+  header->version = GUINT32_TO_LE (NNS_TENSOR_RECORD_VERSION);
+  header->num_tensors = GUINT32_TO_LE (config->info.num_tensors);
+  header->rate_n = GINT32_TO_LE (config->rate_n);
+  header->rate_d = GINT32_TO_LE (config->rate_d);
+
+  for (i = 0; i < config->info.num_tensors; i++) {
+    header->info[i].type = GUINT32_TO_LE (config->info.info[i].type);
+
+    for (j = 0; j < NNS_TENSOR_RANK_LIMIT; j++) {
+      header->info[i].dimension[j] =
+          GUINT32_TO_LE (config->info.info[i].dimension[j]);
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Parse the stream header and get the tensors config.
+ */
+gboolean
+gst_tensor_record_parse_stream_header (const guint8 * data, gsize size,
+    GstTensorsConfig * config)
+{
+  GstTensorRecordStreamHeader header;
+  guint i, j;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+  gst_tensors_config_init (config);
+
+  if (data == NULL || size < sizeof (GstTensorRecordStreamHeader))
+    return FALSE;
+
+  /* the data may not be aligned */
+  memcpy (&header, data, sizeof (GstTensorRecordStreamHeader));
+
+  if (GUINT32_FROM_LE (header.magic) != NNS_TENSOR_RECORD_STREAM_MAGIC ||
+      GUINT32_FROM_LE (header.version) != NNS_TENSOR_RECORD_VERSION)
+    return FALSE;
+
+  config->info.num_tensors = GUINT32_FROM_LE (header.num_tensors);
+  if (config->info.num_tensors == 0 ||
+      config->info.num_tensors > NNS_TENSOR_SIZE_LIMIT)
+    return FALSE;
+
+  config->rate_n = GINT32_FROM_LE (header.rate_n);
+  config->rate_d = GINT32_FROM_LE (header.rate_d);
+
+  for (i = 0; i < config->info.num_tensors; i++) {
+    config->info.info[i].type =
+        (tensor_type) GUINT32_FROM_LE (header.info[i].type);
+
+    for (j = 0; j < NNS_TENSOR_RANK_LIMIT; j++) {
+      config->info.info[i].dimension[j] =
+          GUINT32_FROM_LE (header.info[i].dimension[j]);
+    }
+  }
+
+  return gst_tensors_config_validate (config);
+}
+
+/**
+ * @brief Get caps of the recorded tensor stream from tensors config.
+ */
+GstCaps *
+gst_tensor_record_caps_from_config (const GstTensorsConfig * config)
+{
+  GstCaps *caps;
+
+  g_return_val_if_fail (config != NULL, NULL);
+
+  /* same fields with other/tensors */
+  caps = gst_tensors_caps_from_config (config);
+  caps = gst_caps_make_writable (caps);
+
+  gst_structure_set_name (gst_caps_get_structure (caps, 0),
+      NNS_TENSOR_RECORD_MIMETYPE);
+  return caps;
+}
+
+/**
+ * @brief Parse the structure (other/tensor-record) and get the tensors config.
+ */
+gboolean
+gst_tensor_record_config_from_structure (GstTensorsConfig * config,
+    const GstStructure * structure)
+{
+  GstStructure *st;
+  gboolean ret;
+
+  g_return_val_if_fail (config != NULL, FALSE);
+  gst_tensors_config_init (config);
+
+  g_return_val_if_fail (structure != NULL, FALSE);
+
+  if (!gst_structure_has_name (structure, NNS_TENSOR_RECORD_MIMETYPE))
+    return FALSE;
+
+  /* same fields with other/tensors */
+  st = gst_structure_copy (structure);
+  gst_structure_set_name (st, "other/tensors");
+
+  ret = gst_tensors_config_from_structure (config, st);
+  gst_structure_free (st);
+
+  return ret;
+}
+
+/**
+ * @brief Type-finder of the recorded tensor stream.
+ */
+static void
+gst_tensor_record_typefind (GstTypeFind * tf, gpointer user_data)
+{
+  const guint8 *data;
+  GstTensorsConfig config;
+  GstCaps *caps;
+
+  data = gst_type_find_peek (tf, 0, sizeof (GstTensorRecordStreamHeader));
+
+  if (gst_tensor_record_parse_stream_header (data,
+          sizeof (GstTensorRecordStreamHeader), &config)) {
+    caps = gst_tensor_record_caps_from_config (&config);
+    gst_type_find_suggest (tf, GST_TYPE_FIND_MAXIMUM, caps);
+    gst_caps_unref (caps);
+  }
+}
+
+/**
+ * @brief Register the type-finder of the recorded tensor stream.
+ */
+gboolean
+gst_tensor_record_register_typefind (GstPlugin * plugin)
+{
+  GstCaps *caps;
+  gboolean ret;
+
+  caps = gst_caps_from_string (NNS_TENSOR_RECORD_MIMETYPE);
+  ret = gst_type_find_register (plugin, NNS_TENSOR_RECORD_MIMETYPE,
+      GST_RANK_PRIMARY, gst_tensor_record_typefind, "nnsr", caps, NULL, NULL);
+  gst_caps_unref (caps);
+
+  return ret;
+}
@@ -0,0 +1,149 @@
+/**
+ * NNStreamer binary format to record and replay tensor streams
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file  tensor_record.h
+ * @date  18 Oct 2020
+ * @brief Self-describing binary format of tensor stream (other/tensor-record)
+ * @see https://github.com/nnsuite/nnstreamer
+ * @author  agent <agent@local>
+ * @bug No known bugs except for NYI items
+ *
+ * A recorded stream consists of a stream header and the records.
+ *
+ *   [stream header][record header][payload][record header][payload]...
+ *
+ * - The stream header describes the tensors (GstTensorsInfo) and framerate.
+ *   The writer writes it again for a new stream (e.g., after discont) or
+ *   when the tensors config is changed.
+ * - Each record header has the timestamps and the sizes of the tensors.
+ *   The payloads of the tensors follow the record header.
+ * - All fields are little-endian. The record header and each payload are
+ *   padded to 8 bytes, so that every payload is aligned in the memory.
+ *
+ * The sub-plugins "tensor_record" of tensor_decoder (writer) and
+ * tensor_converter (reader) handle this format.
+ */
+#ifndef __NNS_TENSOR_RECORD_H__
+#define __NNS_TENSOR_RECORD_H__
+
+#include <glib.h>
+#include <gst/gst.h>
+#include "tensor_typedef.h"
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Media type of the recorded tensor stream.
+ */
+#define NNS_TENSOR_RECORD_MIMETYPE "other/tensor-record"
+
+/**
+ * @brief Caps string of the recorded tensor stream.
+ */
+#define NNS_TENSOR_RECORD_CAPS_STR \
+    NNS_TENSOR_RECORD_MIMETYPE ", " \
+    "num_tensors = " GST_TENSOR_NUM_TENSORS_RANGE ", " \
+    "framerate = " GST_TENSOR_RATE_RANGE
+
+#define NNS_TENSOR_RECORD_STREAM_MAGIC (0x5253534EU) /**< "NNSR" */
+#define NNS_TENSOR_RECORD_MAGIC (0x4253534EU) /**< "NNSB" */
+#define NNS_TENSOR_RECORD_VERSION (1U)
+
+/**
+ * @brief Stream header, written once at the start of the stream.
+ */
+typedef struct
+{
+  guint32 magic; /**< NNS_TENSOR_RECORD_STREAM_MAGIC */
+  guint32 version; /**< NNS_TENSOR_RECORD_VERSION */
+  guint32 num_tensors; /**< the number of tensors */
+  guint32 reserved; /**< reserved, should be 0 */
+  gint32 rate_n; /**< framerate is in fraction, which is numerator/denominator */
+  gint32 rate_d; /**< framerate is in fraction, which is numerator/denominator */
+  struct
+  {
+    guint32 type; /**< tensor_type */
+    guint32 dimension[NNS_TENSOR_RANK_LIMIT]; /**< tensor_dim */
+  } info[NNS_TENSOR_SIZE_LIMIT]; /**< tensor info */
+} GstTensorRecordStreamHeader;
+
+/**
+ * @brief Record header, followed by the sizes of the tensors (guint32 x num_tensors, padded to 8 bytes) and the payloads.
+ */
+typedef struct
+{
+  guint32 magic; /**< NNS_TENSOR_RECORD_MAGIC */
+  guint32 num_tensors; /**< the number of tensors in this record */
+  guint64 pts; /**< presentation timestamp, GST_CLOCK_TIME_NONE if invalid */
+  guint64 dts; /**< decoding timestamp, GST_CLOCK_TIME_NONE if invalid */
+  guint64 duration; /**< duration, GST_CLOCK_TIME_NONE if invalid */
+} GstTensorRecordHeader;
+
+/**
+ * @brief The size of the record header including the sizes of the tensors.
+ */
+#define gst_tensor_record_header_size(n) \
+    (sizeof (GstTensorRecordHeader) + GST_ROUND_UP_8 ((n) * sizeof (guint32)))
+
+/**
+ * @brief Fill the stream header with given config.
+ * @param[out] header the stream header to be filled
+ * @param[in] config tensors config
+ * @return TRUE if config is valid
+ */
+extern gboolean
+gst_tensor_record_set_stream_header (GstTensorRecordStreamHeader * header,
+    const GstTensorsConfig * config);
+
+/**
+ * @brief Parse the stream header and get the tensors config.
+ * @param[in] data the data of the stream header
+ * @param[in] size the size of data
+ * @param[out] config tensors config to be filled
+ * @return TRUE if the data is valid stream header
+ */
+extern gboolean
+gst_tensor_record_parse_stream_header (const guint8 * data, gsize size,
+    GstTensorsConfig * config);
+
+/**
+ * @brief Get caps of the recorded tensor stream from tensors config.
+ * @param config tensors config
+ * @return caps (other/tensor-record), caller should unref it.
+ */
+extern GstCaps *
+gst_tensor_record_caps_from_config (const GstTensorsConfig * config);
+
+/**
+ * @brief Parse the structure (other/tensor-record) and get the tensors config.
+ * @param config tensors config to be filled
+ * @param structure structure to be interpreted
+ * @return TRUE if no error
+ */
+extern gboolean
+gst_tensor_record_config_from_structure (GstTensorsConfig * config,
+    const GstStructure * structure);
+
+/**
+ * @brief Register the type-finder of the recorded tensor stream.
+ * @param plugin the plugin to register the type-finder
+ * @return TRUE if registered
+ */
+extern gboolean
+gst_tensor_record_register_typefind (GstPlugin * plugin);
+
+G_END_DECLS
+#endif /* __NNS_TENSOR_RECORD_H__ */
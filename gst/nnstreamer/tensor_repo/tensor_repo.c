@@ -42,6 +42,15 @@ static GstTensorRepo _repo = {.num_data = 0,.initialized = FALSE };
 #define GST_REPO_WAIT() (g_cond_wait(&_repo.repo_cond, &_repo.repo_lock))
 #define GST_REPO_BROADCAST() (g_cond_broadcast (&_repo.repo_cond))
 
+/**
+ * @brief Macro for the lock of the hash table.
+ * The lookup of the slot takes the reader lock, so the slots are not serialized.
+ */
+#define GST_REPO_READ_LOCK() (g_rw_lock_reader_lock (&_repo.hash_lock))
+#define GST_REPO_READ_UNLOCK() (g_rw_lock_reader_unlock (&_repo.hash_lock))
+#define GST_REPO_WRITE_LOCK() (g_rw_lock_writer_lock (&_repo.hash_lock))
+#define GST_REPO_WRITE_UNLOCK() (g_rw_lock_writer_unlock (&_repo.hash_lock))
+
 /**
  * @brief Define tensor_repo meta data type to register.
  */
@@ -83,7 +92,7 @@ gst_meta_repo_transform (GstBuffer * transbuf, GstMeta * meta,
 {
   GstMetaRepo *dest_meta = GST_META_REPO_ADD (transbuf);
   GstMetaRepo *src_meta = (GstMetaRepo *) meta;
-  dest_meta->caps = src_meta->caps;
+  gst_caps_replace (&dest_meta->caps, src_meta->caps);
   return TRUE;
 }
 
@@ -94,7 +103,7 @@ static void
 gst_meta_repo_free (GstMeta * meta, GstBuffer * buffer)
 {
   GstMetaRepo *emeta = (GstMetaRepo *) meta;
-  emeta->caps = NULL;
+  gst_caps_replace (&emeta->caps, NULL);
 }
 
 /**
@@ -140,7 +149,9 @@ gst_tensor_repo_get_repodata (guint nth)
 
   g_return_val_if_fail (_repo.initialized, NULL);
 
+  GST_REPO_READ_LOCK ();
   p = g_hash_table_lookup (_repo.hash, GINT_TO_POINTER (nth));
+  GST_REPO_READ_UNLOCK ();
 
   return (GstTensorRepoData *) p;
 }
@@ -218,7 +229,10 @@ gst_tensor_repo_add_repodata (guint nth, gboolean is_sink)
   }
 
   data->eos = FALSE;
-  data->buffer = NULL;
+  g_queue_init (&data->queue);
+  data->max_buffers = REPO_DEFAULT_MAX_BUFFERS;
+  data->policy = REPO_POLICY_BLOCK;
+  data->num_pushed = data->num_dropped = 0;
   g_cond_init (&data->cond_push);
   g_cond_init (&data->cond_pull);
   g_mutex_init (&data->lock);
@@ -226,7 +240,18 @@ gst_tensor_repo_add_repodata (guint nth, gboolean is_sink)
   data->src_changed = FALSE;
   data->pushed = FALSE;
 
-  GST_REPO_LOCK ();
+  GST_REPO_WRITE_LOCK ();
+  if (g_hash_table_contains (_repo.hash, GINT_TO_POINTER (nth))) {
+    /* added by other element */
+    GST_REPO_WRITE_UNLOCK ();
+
+    g_mutex_clear (&data->lock);
+    g_cond_clear (&data->cond_pull);
+    g_cond_clear (&data->cond_push);
+    g_free (data);
+    return TRUE;
+  }
+
   ret = g_hash_table_insert (_repo.hash, GINT_TO_POINTER (nth), data);
   g_assert (ret);
 
@@ -237,7 +262,7 @@ gst_tensor_repo_add_repodata (guint nth, gboolean is_sink)
       GST_DEBUG ("Successfully added in hash table with key[%d]", nth);
   }
 
-  GST_REPO_UNLOCK ();
+  GST_REPO_WRITE_UNLOCK ();
   return ret;
 }
 
@@ -250,6 +275,7 @@ gst_tensor_repo_set_buffer (guint nth, guint o_nth, GstBuffer * buffer,
 {
   GstTensorRepoData *data;
   GstMetaRepo *meta;
+  GstBuffer *buf;
 
   data = gst_tensor_repo_get_repodata (nth);
 
@@ -257,9 +283,22 @@ gst_tensor_repo_set_buffer (guint nth, guint o_nth, GstBuffer * buffer,
 
   g_mutex_lock (&data->lock);
 
-  while (data->buffer != NULL && !data->eos) {
-    /* wait pull */
-    g_cond_wait (&data->cond_pull, &data->lock);
+  while (g_queue_get_length (&data->queue) >= data->max_buffers &&
+      !data->eos) {
+    if (data->policy == REPO_POLICY_DROP_OLDEST) {
+      gst_buffer_unref (GST_BUFFER (g_queue_pop_head (&data->queue)));
+      data->num_dropped++;
+    } else if (data->policy == REPO_POLICY_DROP_NEWEST) {
+      data->num_dropped++;
+      if (DBG)
+        GST_DEBUG ("Dropped [%d] (queue is full)\n", nth);
+
+      g_mutex_unlock (&data->lock);
+      return TRUE;
+    } else {
+      /* wait pull */
+      g_cond_wait (&data->cond_pull, &data->lock);
+    }
   }
 
   if (data->eos) {
@@ -267,15 +306,23 @@ gst_tensor_repo_set_buffer (guint nth, guint o_nth, GstBuffer * buffer,
     return FALSE;
   }
 
-  data->buffer = gst_buffer_copy (buffer);
+  /**
+   * Shallow copy to add the meta, the memory blocks are shared (no memcpy).
+   * The memory is copied when an element maps it writable (copy-on-write).
+   */
+  buf = gst_buffer_copy (buffer);
 
-  meta = GST_META_REPO_ADD (data->buffer);
+  meta = GST_META_REPO_ADD (buf);
 
   gst_caps_replace (&meta->caps, caps);
 
+  g_queue_push_tail (&data->queue, buf);
+  data->num_pushed++;
+
   if (DBG) {
-    unsigned long size = gst_buffer_get_size (data->buffer);
-    GST_DEBUG ("Pushed [%d] (size : %lu)\n", nth, size);
+    unsigned long size = gst_buffer_get_size (buf);
+    GST_DEBUG ("Pushed [%d] (size : %lu, level : %u)\n", nth, size,
+        g_queue_get_length (&data->queue));
   }
 
   /* signal push */
@@ -304,6 +351,60 @@ gst_tensor_repo_check_eos (guint nth)
   return FALSE;
 }
 
+/**
+ * @brief Set the number of buffers and the policy when the queue of slot is full.
+ */
+gboolean
+gst_tensor_repo_set_queue (guint nth, guint max_buffers,
+    GstTensorRepoPolicy policy)
+{
+  GstTensorRepoData *data;
+
+  g_return_val_if_fail (max_buffers > 0, FALSE);
+  g_return_val_if_fail (policy < REPO_POLICY_END, FALSE);
+
+  data = gst_tensor_repo_get_repodata (nth);
+
+  g_return_val_if_fail (data != NULL, FALSE);
+
+  g_mutex_lock (&data->lock);
+
+  data->max_buffers = max_buffers;
+  data->policy = policy;
+
+  /* the writer may wait for the queue */
+  g_cond_signal (&data->cond_pull);
+
+  g_mutex_unlock (&data->lock);
+  return TRUE;
+}
+
+/**
+ * @brief Get the occupancy and the counters of slot.
+ */
+gboolean
+gst_tensor_repo_get_stats (guint nth, guint * level, guint64 * pushed,
+    guint64 * dropped)
+{
+  GstTensorRepoData *data;
+
+  data = gst_tensor_repo_get_repodata (nth);
+
+  g_return_val_if_fail (data != NULL, FALSE);
+
+  g_mutex_lock (&data->lock);
+
+  if (level)
+    *level = g_queue_get_length (&data->queue);
+  if (pushed)
+    *pushed = data->num_pushed;
+  if (dropped)
+    *dropped = data->num_dropped;
+
+  g_mutex_unlock (&data->lock);
+  return TRUE;
+}
+
 /**
  * @brief Check repo data is changed.
  */
@@ -374,7 +475,7 @@ gst_tensor_repo_get_buffer (guint nth, guint o_nth, gboolean * eos,
 
   g_mutex_lock (&data->lock);
 
-  while (!data->buffer) {
+  while (g_queue_is_empty (&data->queue)) {
     if (gst_tensor_repo_check_changed (nth, newid, FALSE)) {
       buf = NULL;
       goto done;
@@ -390,15 +491,14 @@ gst_tensor_repo_get_buffer (guint nth, guint o_nth, gboolean * eos,
     g_cond_wait (&data->cond_push, &data->lock);
   }
 
-  buf = gst_buffer_copy_deep (data->buffer);
-  gst_buffer_unref (data->buffer);
+  /* hand off the buffer in the slot */
+  buf = GST_BUFFER (g_queue_pop_head (&data->queue));
   if (DBG) {
     unsigned long size = gst_buffer_get_size (buf);
     GST_DEBUG ("Popped [ %d ] (size: %lu)\n", nth, size);
   }
 
 done:
-  data->buffer = NULL;
   /* signal pull */
   g_cond_signal (&data->cond_pull);
   g_mutex_unlock (&data->lock);
@@ -416,10 +516,13 @@ gst_tensor_repo_remove_repodata (guint nth)
 
   g_return_val_if_fail (_repo.initialized, FALSE);
 
-  GST_REPO_LOCK ();
-  data = gst_tensor_repo_get_repodata (nth);
+  GST_REPO_WRITE_LOCK ();
+  data = g_hash_table_lookup (_repo.hash, GINT_TO_POINTER (nth));
 
   if (data) {
+    while (!g_queue_is_empty (&data->queue))
+      gst_buffer_unref (GST_BUFFER (g_queue_pop_head (&data->queue)));
+
     g_mutex_clear (&data->lock);
     g_cond_clear (&data->cond_pull);
     g_cond_clear (&data->cond_push);
@@ -433,7 +536,7 @@ gst_tensor_repo_remove_repodata (guint nth)
     }
   }
 
-  GST_REPO_UNLOCK ();
+  GST_REPO_WRITE_UNLOCK ();
   return ret;
 }
 
@@ -449,9 +552,10 @@ gst_tensor_repo_init (void)
   _repo.num_data = 0;
   g_mutex_init (&_repo.repo_lock);
   g_cond_init (&_repo.repo_cond);
+  g_rw_lock_init (&_repo.hash_lock);
   GST_REPO_LOCK ();
   _repo.hash = g_hash_table_new (g_direct_hash, g_direct_equal);
-  _repo.initialized = TRUE;
+  g_atomic_int_set (&_repo.initialized, TRUE);
   GST_REPO_BROADCAST ();
   GST_REPO_UNLOCK ();
 }
@@ -462,6 +566,10 @@ gst_tensor_repo_init (void)
 gboolean
 gst_tensor_repo_wait (void)
 {
+  /* tensor_reposrc calls this for each buffer, do not take the lock once initialized */
+  if (g_atomic_int_get (&_repo.initialized))
+    return TRUE;
+
   GST_REPO_LOCK ();
   while (!_repo.initialized)
     GST_REPO_WAIT ();
@@ -70,6 +70,22 @@ GstMetaRepo *gst_buffer_add_meta_repo (GstBuffer * buffer);
 #define GST_META_REPO_GET(buf) ((GstMetaRepo*) gst_buffer_get_meta_repo(buf))
 #define GST_META_REPO_ADD(buf) ((GstMetaRepo*) gst_buffer_add_meta_repo(buf))
 
+/**
+ * @brief The policy when the queue of the slot is full.
+ */
+typedef enum
+{
+  REPO_POLICY_BLOCK = 0, /**< wait until the reader pulls a buffer */
+  REPO_POLICY_DROP_OLDEST, /**< drop the oldest buffer in the queue */
+  REPO_POLICY_DROP_NEWEST, /**< drop the incoming buffer */
+  REPO_POLICY_END
+} GstTensorRepoPolicy;
+
+/**
+ * @brief Default number of buffers in a slot.
+ */
+#define REPO_DEFAULT_MAX_BUFFERS (1)
+
 /**
  * @brief GstTensorRepo internal data structure.
  *
@@ -77,7 +93,11 @@ GstMetaRepo *gst_buffer_add_meta_repo (GstBuffer * buffer);
  */
 typedef struct
 {
-  GstBuffer *buffer;
+  GQueue queue; /**< buffers in the slot (ring of max_buffers) */
+  guint max_buffers; /**< the number of buffers in the slot */
+  GstTensorRepoPolicy policy; /**< policy when the queue is full */
+  guint64 num_pushed; /**< the number of buffers pushed into the slot */
+  guint64 num_dropped; /**< the number of buffers dropped with the policy */
   GCond cond_push;
   GCond cond_pull;
   GMutex lock;
@@ -97,6 +117,7 @@ typedef struct
   guint num_data;
   GMutex repo_lock;
   GCond repo_cond;
+  GRWLock hash_lock; /**< lock of the hash table (read-mostly, the slot has its own lock) */
   GHashTable* hash;
   gboolean initialized;
 } GstTensorRepo;
@@ -125,6 +146,18 @@ gst_tensor_repo_set_buffer (guint nth, guint o_nth, GstBuffer * buffer, GstCaps
 gboolean
 gst_tensor_repo_check_eos (guint nth);
 
+/**
+ * @brief Set the number of buffers and the policy when the queue of slot is full.
+ */
+gboolean
+gst_tensor_repo_set_queue (guint nth, guint max_buffers, GstTensorRepoPolicy policy);
+
+/**
+ * @brief Get the occupancy and the counters of slot.
+ */
+gboolean
+gst_tensor_repo_get_stats (guint nth, guint * level, guint64 * pushed, guint64 * dropped);
+
 /**
  * @brief Set EOS (End-of-Stream) of slot.
  */
@@ -155,6 +188,84 @@ gst_tensor_repo_check_changed (guint nth, guint *newid, gboolean is_sink);
 gboolean
 gst_tensor_repo_remove_repodata (guint nth);
 
+/**
+ * @brief Handle of the shared memory to connect the pipelines in different processes.
+ */
+typedef struct _GstTensorRepoShm GstTensorRepoShm;
+
+/**
+ * @brief The result of getting the buffer from the shared memory.
+ */
+typedef enum
+{
+  REPO_SHM_OK = 0, /**< got the buffer */
+  REPO_SHM_EOS, /**< the writer set EOS and all buffers are pulled */
+  REPO_SHM_FLUSHING, /**< stopped waiting with the flushing state */
+  REPO_SHM_DISCONNECTED, /**< the writer is dead or created the shared memory again, open it again */
+  REPO_SHM_INVALID /**< the shared memory is broken */
+} GstTensorRepoShmStatus;
+
+/**
+ * @brief Create the shared memory with the caps (writer).
+ * @param max_buffers The number of buffers not pulled yet. The shared memory has more slots for the buffers the reader holds.
+ */
+GstTensorRepoShm *
+gst_tensor_repo_shm_create (const gchar * name, guint max_buffers, const GstCaps * caps);
+
+/**
+ * @brief Open the shared memory created by the writer (reader).
+ */
+GstTensorRepoShm *
+gst_tensor_repo_shm_open (const gchar * name);
+
+/**
+ * @brief Close the shared memory. The writer sets EOS and removes the name.
+ */
+void
+gst_tensor_repo_shm_close (GstTensorRepoShm * shm);
+
+/**
+ * @brief Get the caps in the header of the shared memory.
+ */
+GstCaps *
+gst_tensor_repo_shm_get_caps (GstTensorRepoShm * shm);
+
+/**
+ * @brief Get the tensors info in the header of the shared memory.
+ */
+gboolean
+gst_tensor_repo_shm_get_info (GstTensorRepoShm * shm, GstTensorsInfo * info);
+
+/**
+ * @brief Set the flushing state, to stop waiting for the slot.
+ */
+void
+gst_tensor_repo_shm_set_flushing (GstTensorRepoShm * shm, gboolean flushing);
+
+/**
+ * @brief Copy the buffer into the slot of shared memory (writer).
+ */
+gboolean
+gst_tensor_repo_shm_set_buffer (GstTensorRepoShm * shm, GstBuffer * buffer, GstTensorRepoPolicy policy);
+
+/**
+ * @brief Get the buffer in the slot of shared memory (reader).
+ */
+GstBuffer *
+gst_tensor_repo_shm_get_buffer (GstTensorRepoShm * shm, GstTensorRepoShmStatus * status);
+
+/**
+ * @brief Set EOS (End-of-Stream) of shared memory.
+ */
+void
+gst_tensor_repo_shm_set_eos (GstTensorRepoShm * shm);
+
+/**
+ * @brief Get the occupancy and the counters of shared memory.
+ */
+gboolean
+gst_tensor_repo_shm_get_stats (GstTensorRepoShm * shm, guint * level, guint64 * pushed, guint64 * dropped);
+
 /**
  * @brief GstTensorRepo initialization.
  */
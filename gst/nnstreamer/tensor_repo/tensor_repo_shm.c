@@ -0,0 +1,1325 @@
+/**
+ * NNStreamer Tensor Repo with shared memory
+ * Copyright (C) 2020 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ */
+/**
+ * @file	tensor_repo_shm.c
+ * @date	18 Oct 2020
+ * @brief	tensor repo backed by shared memory, to connect the pipelines in different processes
+ * @see		https://github.com/nnsuite/nnstreamer
+ * @author	agent <agent@local>
+ * @bug		No known bugs except for NYI items
+ *
+ * The shared memory has a header (caps, tensors info and the queue of slot indices) and the slots.
+ * The writer (tensor_reposink) copies a buffer into a free slot, and the reader (tensor_reposrc) wraps the memory of the slot without memcpy.
+ * The slot is released when the reader's buffer is freed.
+ * There are REPO_SHM_READER_SLOTS slots more than max-buffers, and the reader copies out the buffer if it holds too many slots, so the writer always finds a free slot.
+ * The writer and the reader hold a robust mutex in the header while the handle is alive (in a thread of the handle), so the other side can check it with trylock.
+ * The kernel releases the mutex of a dead process (EOWNERDEAD), which works across PID namespaces unlike the process ids.
+ */
+
+#include <string.h>
+#include "tensor_repo.h"
+
+#if defined(__gnu_linux__) && !defined(__ANDROID__)
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifndef DBG
+#define DBG FALSE
+#endif
+
+/**
+ * @brief Magic number and version of the shared memory ("NNSR").
+ */
+#define REPO_SHM_MAGIC (0x4E4E5352U)
+#define REPO_SHM_VERSION (3U)
+
+/**
+ * @brief Max length of caps string in the header.
+ */
+#define REPO_SHM_CAPS_LEN (2048)
+
+/**
+ * @brief The number of slots for the reader, in addition to max-buffers.
+ * The reader wraps the slot without memcpy while it holds less than (REPO_SHM_READER_SLOTS - 1) slots (e.g., the last sample of basesink and the buffer in flight).
+ * Otherwise it copies out the buffer with the last one, and releases the slot at once.
+ */
+#define REPO_SHM_READER_SLOTS (4U)
+
+/**
+ * @brief Max number of slots, to check the header.
+ */
+#define REPO_SHM_MAX_SLOTS (1024U)
+
+/**
+ * @brief Alignment of the slots.
+ */
+#define REPO_SHM_ALIGN (64)
+#define REPO_SHM_ALIGN_SIZE(s) (((s) + REPO_SHM_ALIGN - 1) & ~((gsize) REPO_SHM_ALIGN - 1))
+
+/**
+ * @brief Timeout to check the flushing state and the peer while waiting (100 ms).
+ */
+#define REPO_SHM_WAIT_NS (100 * 1000 * 1000)
+
+/**
+ * @brief The state of the slot.
+ */
+typedef enum
+{
+  REPO_SHM_SLOT_FREE = 0, /**< the writer can copy a buffer */
+  REPO_SHM_SLOT_WRITING, /**< the writer is copying a buffer */
+  REPO_SHM_SLOT_READY, /**< the buffer is not pulled yet */
+  REPO_SHM_SLOT_READING /**< the reader holds the buffer */
+} repo_shm_slot_state;
+
+/**
+ * @brief The tensors info in the header (without pointer).
+ */
+typedef struct
+{
+  guint32 num_tensors; /**< the number of tensors */
+  guint32 type[NNS_TENSOR_SIZE_LIMIT]; /**< type of each tensor */
+  tensor_dim dimension[NNS_TENSOR_SIZE_LIMIT]; /**< dimension of each tensor */
+} repo_shm_tensors_info;
+
+/**
+ * @brief The slot in the shared memory.
+ */
+typedef struct
+{
+  guint32 state; /**< repo_shm_slot_state */
+  guint32 num_mems; /**< the number of memory blocks */
+  guint64 mem_size[NNS_TENSOR_SIZE_LIMIT]; /**< size of each memory block */
+  guint64 pts; /**< presentation timestamp */
+  guint64 dts; /**< decoding timestamp */
+  guint64 duration; /**< duration */
+} repo_shm_slot;
+
+/**
+ * @brief The header of the shared memory.
+ * The queue of slot indices (num_slots of guint32) follows the slots.
+ */
+typedef struct
+{
+  guint32 magic; /**< REPO_SHM_MAGIC */
+  guint32 version; /**< REPO_SHM_VERSION */
+  gint ready; /**< set when the header is initialized */
+  guint32 eos; /**< end-of-stream */
+  pthread_mutex_t lock; /**< process-shared robust mutex */
+  pthread_cond_t cond; /**< signaled when the slot is changed */
+  guint32 num_slots; /**< the number of slots (max_buffers + REPO_SHM_READER_SLOTS) */
+  guint32 max_buffers; /**< the number of buffers not pulled yet */
+  guint64 slot_size; /**< size of a slot */
+  guint64 data_offset; /**< offset of the first slot */
+  guint64 write_idx; /**< the number of buffers written */
+  guint64 read_idx; /**< the number of buffers read (or dropped) */
+  guint64 num_pushed; /**< the number of buffers pushed */
+  guint64 num_dropped; /**< the number of buffers dropped with the policy */
+  pthread_mutex_t writer_lock; /**< process-shared robust mutex held while the writer is alive */
+  pthread_mutex_t reader_lock; /**< process-shared robust mutex held while the reader is alive */
+  guint32 num_reading; /**< the number of slots the reader holds */
+  guint32 reserved; /**< padding */
+  repo_shm_tensors_info info; /**< tensors info */
+  gchar caps[REPO_SHM_CAPS_LEN]; /**< caps string */
+  repo_shm_slot slots[]; /**< slots (num_slots) */
+} repo_shm_header;
+
+/**
+ * @brief The handle of the shared memory.
+ * The layout is copied from the header and checked when opening it, so that a broken header cannot make the reader access out of the mapped memory.
+ */
+struct _GstTensorRepoShm
+{
+  gint refcount; /**< reference count (the handle and the buffers of the reader) */
+  gchar *name; /**< name of the shared memory */
+  gboolean owner; /**< true if the writer created the shared memory */
+  gint flushing; /**< true to stop waiting */
+  gsize size; /**< size of the mapped memory */
+  repo_shm_header *header; /**< mapped memory */
+  guint32 *queue; /**< the queue of slot indices */
+  guint8 *data; /**< the first slot */
+  guint num_slots; /**< the number of slots */
+  guint max_buffers; /**< the number of buffers not pulled yet */
+  gsize slot_size; /**< size of a slot */
+  dev_t dev; /**< device of the shared memory, to detect the restarted writer */
+  ino_t ino; /**< inode of the shared memory, to detect the restarted writer */
+  GThread *presence; /**< thread holding the writer_lock or reader_lock in the header */
+  GMutex presence_lock; /**< lock for the presence thread */
+  GCond presence_cond; /**< condition for the presence thread */
+  gint presence_state; /**< 0 while starting, 1 if the lock is held, -1 if failed */
+  gboolean presence_stop; /**< true to release the lock and stop the presence thread */
+};
+
+/**
+ * @brief The data to release the slot when the buffer of the reader is freed.
+ */
+typedef struct
+{
+  GstTensorRepoShm *shm; /**< the handle */
+  guint index; /**< index of the slot */
+  gint remained; /**< the number of memory blocks not freed */
+} repo_shm_release_data;
+
+/**
+ * @brief Get the name of the shared memory (starts with '/').
+ */
+static gchar *
+repo_shm_get_name (const gchar * name)
+{
+  if (name[0] == '/')
+    return g_strdup (name);
+
+  return g_strdup_printf ("/%s", name);
+}
+
+/**
+ * @brief Get the size of the header including the slots and the queue.
+ */
+static gsize
+repo_shm_get_header_size (guint num_slots)
+{
+  return REPO_SHM_ALIGN_SIZE (sizeof (repo_shm_header) +
+      (gsize) num_slots * (sizeof (repo_shm_slot) + sizeof (guint32)));
+}
+
+/**
+ * @brief Initialize the process-shared robust mutex in the header.
+ */
+static void
+repo_shm_init_mutex (pthread_mutex_t * lock)
+{
+  pthread_mutexattr_t mattr;
+
+  pthread_mutexattr_init (&mattr);
+  pthread_mutexattr_setpshared (&mattr, PTHREAD_PROCESS_SHARED);
+  pthread_mutexattr_setrobust (&mattr, PTHREAD_MUTEX_ROBUST);
+  pthread_mutex_init (lock, &mattr);
+  pthread_mutexattr_destroy (&mattr);
+}
+
+/**
+ * @brief Check the writer or the reader holding the mutex is alive.
+ * @return FALSE if the mutex is not held, or the owner is dead (EOWNERDEAD)
+ */
+static gboolean
+repo_shm_is_alive (pthread_mutex_t * lock)
+{
+  gint err;
+
+  err = pthread_mutex_trylock (lock);
+  if (err == EBUSY)
+    return TRUE;
+
+  if (err == EOWNERDEAD)
+    pthread_mutex_consistent (lock);
+  if (err == 0 || err == EOWNERDEAD)
+    pthread_mutex_unlock (lock);
+
+  return FALSE;
+}
+
+/**
+ * @brief Thread to hold the mutex in the header while the handle is alive.
+ * The robust mutex is owned by the thread, so it should not be locked in the streaming thread which may exit before the handle.
+ */
+static gpointer
+repo_shm_presence_thread (gpointer user_data)
+{
+  GstTensorRepoShm *shm = (GstTensorRepoShm *) user_data;
+  pthread_mutex_t *lock;
+  gint err;
+
+  lock = shm->owner ? &shm->header->writer_lock : &shm->header->reader_lock;
+
+  err = pthread_mutex_trylock (lock);
+  if (err == EOWNERDEAD) {
+    /* the previous owner is dead */
+    pthread_mutex_consistent (lock);
+    err = 0;
+  }
+
+  g_mutex_lock (&shm->presence_lock);
+  shm->presence_state = (err == 0) ? 1 : -1;
+  g_cond_broadcast (&shm->presence_cond);
+
+  while (err == 0 && !shm->presence_stop)
+    g_cond_wait (&shm->presence_cond, &shm->presence_lock);
+  g_mutex_unlock (&shm->presence_lock);
+
+  if (err == 0)
+    pthread_mutex_unlock (lock);
+
+  return NULL;
+}
+
+/**
+ * @brief Start the presence thread and wait until it holds the mutex.
+ * @return FALSE if the mutex is held by another (alive) writer or reader
+ */
+static gboolean
+repo_shm_start_presence (GstTensorRepoShm * shm)
+{
+  gint state;
+
+  shm->presence = g_thread_try_new ("tensor_repo_shm",
+      repo_shm_presence_thread, shm, NULL);
+  if (shm->presence == NULL)
+    return FALSE;
+
+  g_mutex_lock (&shm->presence_lock);
+  while (shm->presence_state == 0)
+    g_cond_wait (&shm->presence_cond, &shm->presence_lock);
+  state = shm->presence_state;
+  g_mutex_unlock (&shm->presence_lock);
+
+  if (state < 0) {
+    g_thread_join (shm->presence);
+    shm->presence = NULL;
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Release the mutex and stop the presence thread.
+ */
+static void
+repo_shm_stop_presence (GstTensorRepoShm * shm)
+{
+  if (shm->presence == NULL)
+    return;
+
+  g_mutex_lock (&shm->presence_lock);
+  shm->presence_stop = TRUE;
+  g_cond_broadcast (&shm->presence_cond);
+  g_mutex_unlock (&shm->presence_lock);
+
+  g_thread_join (shm->presence);
+  shm->presence = NULL;
+}
+
+/**
+ * @brief Lock the header. Recover the mutex if the owner is dead.
+ */
+static void
+repo_shm_lock (GstTensorRepoShm * shm)
+{
+  if (pthread_mutex_lock (&shm->header->lock) == EOWNERDEAD) {
+    GST_WARNING ("The owner of repo shm %s is dead.", shm->name);
+    pthread_mutex_consistent (&shm->header->lock);
+  }
+}
+
+/**
+ * @brief Unlock the header.
+ */
+static void
+repo_shm_unlock (GstTensorRepoShm * shm)
+{
+  pthread_mutex_unlock (&shm->header->lock);
+}
+
+/**
+ * @brief Broadcast the change of the slots.
+ */
+static void
+repo_shm_broadcast (GstTensorRepoShm * shm)
+{
+  pthread_cond_broadcast (&shm->header->cond);
+}
+
+/**
+ * @brief Wait for the change of the slots.
+ * @return FALSE if flushing
+ */
+static gboolean
+repo_shm_wait (GstTensorRepoShm * shm)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  ts.tv_nsec += REPO_SHM_WAIT_NS;
+  if (ts.tv_nsec >= 1000000000L) {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000L;
+  }
+
+  if (pthread_cond_timedwait (&shm->header->cond, &shm->header->lock,
+          &ts) == EOWNERDEAD) {
+    GST_WARNING ("The owner of repo shm %s is dead.", shm->name);
+    pthread_mutex_consistent (&shm->header->lock);
+  }
+
+  return !g_atomic_int_get (&shm->flushing);
+}
+
+/**
+ * @brief Release the slots held by the reader if it is dead or closed. Call this with lock.
+ * The reader holds reader_lock until all the buffers wrapping the slots are freed, so the slots of a live reader are never released.
+ */
+static void
+repo_shm_reclaim_reader (GstTensorRepoShm * shm)
+{
+  repo_shm_header *header = shm->header;
+  guint i;
+
+  if (header->num_reading == 0 || repo_shm_is_alive (&header->reader_lock))
+    return;
+
+  if (header->num_reading > 0) {
+    GST_WARNING ("The reader of repo shm %s is dead, release %u slots.",
+        shm->name, header->num_reading);
+  }
+
+  for (i = 0; i < shm->num_slots; i++) {
+    if (header->slots[i].state == REPO_SHM_SLOT_READING)
+      header->slots[i].state = REPO_SHM_SLOT_FREE;
+  }
+
+  header->num_reading = 0;
+  repo_shm_broadcast (shm);
+}
+
+/**
+ * @brief Check the writer is alive and the name still refers to this shared memory (reader).
+ * @return FALSE if the writer is dead or created the shared memory again
+ */
+static gboolean
+repo_shm_check_writer (GstTensorRepoShm * shm)
+{
+  struct stat st;
+  gboolean valid;
+  gint fd;
+
+  if (!repo_shm_is_alive (&shm->header->writer_lock))
+    return FALSE;
+
+  fd = shm_open (shm->name, O_RDONLY, 0);
+  if (fd < 0)
+    return FALSE;
+
+  valid = (fstat (fd, &st) == 0 && st.st_dev == shm->dev &&
+      st.st_ino == shm->ino);
+  close (fd);
+
+  return valid;
+}
+
+/**
+ * @brief Map the shared memory.
+ */
+static GstTensorRepoShm *
+repo_shm_map (const gchar * name, gint fd, gsize size, gboolean owner)
+{
+  GstTensorRepoShm *shm;
+  gpointer addr;
+
+  addr = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+
+  if (addr == MAP_FAILED) {
+    GST_ERROR ("Failed to map repo shm %s (%d).", name, errno);
+    return NULL;
+  }
+
+  shm = g_new0 (GstTensorRepoShm, 1);
+  shm->refcount = 1;
+  shm->name = g_strdup (name);
+  shm->owner = owner;
+  shm->flushing = FALSE;
+  shm->size = size;
+  shm->header = (repo_shm_header *) addr;
+  g_mutex_init (&shm->presence_lock);
+  g_cond_init (&shm->presence_cond);
+
+  return shm;
+}
+
+/**
+ * @brief Set the layout of the shared memory in the handle.
+ */
+static void
+repo_shm_set_layout (GstTensorRepoShm * shm, guint num_slots,
+    guint max_buffers, gsize slot_size, gsize data_offset)
+{
+  shm->num_slots = num_slots;
+  shm->max_buffers = max_buffers;
+  shm->slot_size = slot_size;
+  shm->queue = (guint32 *) (shm->header->slots + num_slots);
+  shm->data = (guint8 *) shm->header + data_offset;
+}
+
+/**
+ * @brief Increase the reference count of the handle.
+ */
+static GstTensorRepoShm *
+repo_shm_ref (GstTensorRepoShm * shm)
+{
+  g_atomic_int_inc (&shm->refcount);
+  return shm;
+}
+
+/**
+ * @brief Decrease the reference count and unmap the shared memory.
+ */
+static void
+repo_shm_unref (GstTensorRepoShm * shm)
+{
+  if (!g_atomic_int_dec_and_test (&shm->refcount))
+    return;
+
+  repo_shm_stop_presence (shm);
+  g_cond_clear (&shm->presence_cond);
+  g_mutex_clear (&shm->presence_lock);
+
+  munmap (shm->header, shm->size);
+  g_free (shm->name);
+  g_free (shm);
+}
+
+/**
+ * @brief Check the existing shared memory is left by the writer which is dead or closed.
+ * @return FALSE if the writer is alive, or the header cannot be checked (e.g., the writer is creating it)
+ */
+static gboolean
+repo_shm_is_stale (const gchar * name)
+{
+  repo_shm_header *header;
+  struct stat st;
+  gpointer addr;
+  gboolean stale = FALSE;
+  gint fd;
+
+  fd = shm_open (name, O_RDWR, 0);
+  if (fd < 0)
+    return (errno == ENOENT);
+
+  if (fstat (fd, &st) != 0 || (gsize) st.st_size < sizeof (repo_shm_header)) {
+    close (fd);
+    return FALSE;
+  }
+
+  addr = mmap (NULL, sizeof (repo_shm_header), PROT_READ | PROT_WRITE,
+      MAP_SHARED, fd, 0);
+  close (fd);
+
+  if (addr == MAP_FAILED)
+    return FALSE;
+
+  header = (repo_shm_header *) addr;
+  if (g_atomic_int_get (&header->ready) && header->magic == REPO_SHM_MAGIC &&
+      header->version == REPO_SHM_VERSION)
+    stale = !repo_shm_is_alive (&header->writer_lock);
+
+  munmap (addr, sizeof (repo_shm_header));
+  return stale;
+}
+
+/**
+ * @brief Create the shared memory with the caps (writer).
+ */
+GstTensorRepoShm *
+gst_tensor_repo_shm_create (const gchar * name, guint max_buffers,
+    const GstCaps * caps)
+{
+  GstTensorRepoShm *shm;
+  GstTensorsConfig config;
+  repo_shm_header *header;
+  pthread_condattr_t cattr;
+  gchar *shm_name, *caps_str;
+  gsize header_size, slot_size, size;
+  guint i, num_slots;
+  gint fd;
+
+  g_return_val_if_fail (name != NULL, NULL);
+  g_return_val_if_fail (max_buffers > 0, NULL);
+  g_return_val_if_fail (caps != NULL, NULL);
+
+  if (max_buffers > REPO_SHM_MAX_SLOTS - REPO_SHM_READER_SLOTS) {
+    GST_ERROR ("Too many buffers (%u) for the shared memory.", max_buffers);
+    return NULL;
+  }
+
+  if (!gst_tensors_config_from_structure (&config,
+          gst_caps_get_structure (caps, 0)) ||
+      !gst_tensors_config_validate (&config)) {
+    GST_ERROR ("Cannot get the tensors info from caps %" GST_PTR_FORMAT, caps);
+    gst_tensors_info_free (&config.info);
+    return NULL;
+  }
+
+  caps_str = gst_caps_to_string (caps);
+  if (strlen (caps_str) >= REPO_SHM_CAPS_LEN) {
+    GST_ERROR ("The caps string is too long to share.");
+    g_free (caps_str);
+    gst_tensors_info_free (&config.info);
+    return NULL;
+  }
+
+  slot_size = 0;
+  for (i = 0; i < config.info.num_tensors; i++)
+    slot_size +=
+        REPO_SHM_ALIGN_SIZE (gst_tensor_info_get_size (&config.info.info[i]));
+
+  num_slots = max_buffers + REPO_SHM_READER_SLOTS;
+  header_size = repo_shm_get_header_size (num_slots);
+  size = header_size + num_slots * slot_size;
+
+  shm_name = repo_shm_get_name (name);
+
+  fd = shm_open (shm_name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd < 0 && errno == EEXIST && repo_shm_is_stale (shm_name)) {
+    /* remove the stale memory of the writer which is dead */
+    GST_WARNING ("Remove the stale repo shm %s.", shm_name);
+    shm_unlink (shm_name);
+    fd = shm_open (shm_name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  }
+
+  if (fd < 0 && errno == EEXIST) {
+    GST_ERROR ("Repo shm %s is used by another writer. "
+        "Remove it manually if no writer is running.", shm_name);
+    shm = NULL;
+    goto done;
+  }
+
+  if (fd < 0 || ftruncate (fd, size) != 0) {
+    GST_ERROR ("Failed to create repo shm %s (%d).", shm_name, errno);
+    if (fd >= 0) {
+      close (fd);
+      shm_unlink (shm_name);
+    }
+    shm = NULL;
+    goto done;
+  }
+
+  shm = repo_shm_map (shm_name, fd, size, TRUE);
+  if (shm == NULL) {
+    shm_unlink (shm_name);
+    goto done;
+  }
+
+  header = shm->header;
+  memset (header, 0, header_size);
+
+  repo_shm_init_mutex (&header->lock);
+  repo_shm_init_mutex (&header->writer_lock);
+  repo_shm_init_mutex (&header->reader_lock);
+
+  pthread_condattr_init (&cattr);
+  pthread_condattr_setpshared (&cattr, PTHREAD_PROCESS_SHARED);
+  pthread_condattr_setclock (&cattr, CLOCK_MONOTONIC);
+  pthread_cond_init (&header->cond, &cattr);
+  pthread_condattr_destroy (&cattr);
+
+  header->magic = REPO_SHM_MAGIC;
+  header->version = REPO_SHM_VERSION;
+  header->num_slots = num_slots;
+  header->max_buffers = max_buffers;
+  header->slot_size = slot_size;
+  header->data_offset = header_size;
+
+  header->info.num_tensors = config.info.num_tensors;
+  for (i = 0; i < config.info.num_tensors; i++) {
+    header->info.type[i] = config.info.info[i].type;
+    memcpy (header->info.dimension[i], config.info.info[i].dimension,
+        sizeof (tensor_dim));
+  }
+  g_strlcpy (header->caps, caps_str, REPO_SHM_CAPS_LEN);
+
+  repo_shm_set_layout (shm, num_slots, max_buffers, slot_size, header_size);
+
+  if (!repo_shm_start_presence (shm)) {
+    GST_ERROR ("Failed to start the writer of repo shm %s.", shm_name);
+    shm_unlink (shm_name);
+    repo_shm_unref (shm);
+    shm = NULL;
+    goto done;
+  }
+
+  /* the reader may wait for the header */
+  g_atomic_int_set (&header->ready, 1);
+
+  if (DBG)
+    GST_DEBUG ("Created repo shm %s (%u slots, slot size %" G_GSIZE_FORMAT ")",
+        shm_name, num_slots, slot_size);
+
+done:
+  g_free (shm_name);
+  g_free (caps_str);
+  gst_tensors_info_free (&config.info);
+  return shm;
+}
+
+/**
+ * @brief Check the layout in the header with the size of the mapped memory.
+ */
+static gboolean
+repo_shm_validate_header (GstTensorRepoShm * shm)
+{
+  repo_shm_header *header = shm->header;
+  guint64 num_slots, max_buffers, slot_size, data_offset;
+
+  if (header->magic != REPO_SHM_MAGIC || header->version != REPO_SHM_VERSION)
+    return FALSE;
+
+  num_slots = header->num_slots;
+  max_buffers = header->max_buffers;
+  slot_size = header->slot_size;
+  data_offset = header->data_offset;
+
+  if (max_buffers == 0 || num_slots > REPO_SHM_MAX_SLOTS ||
+      num_slots != max_buffers + REPO_SHM_READER_SLOTS)
+    return FALSE;
+
+  /* the slots and the queue, then the data of the slots */
+  if (data_offset < repo_shm_get_header_size (num_slots) ||
+      data_offset > shm->size ||
+      slot_size > (shm->size - data_offset) / num_slots)
+    return FALSE;
+
+  if (header->info.num_tensors == 0 ||
+      header->info.num_tensors > NNS_TENSOR_SIZE_LIMIT)
+    return FALSE;
+
+  if (memchr (header->caps, '\0', REPO_SHM_CAPS_LEN) == NULL)
+    return FALSE;
+
+  repo_shm_set_layout (shm, num_slots, max_buffers, slot_size, data_offset);
+  return TRUE;
+}
+
+/**
+ * @brief Open the shared memory created by the writer (reader).
+ * @return NULL if the writer does not create the shared memory yet
+ */
+GstTensorRepoShm *
+gst_tensor_repo_shm_open (const gchar * name)
+{
+  GstTensorRepoShm *shm = NULL;
+  repo_shm_header *header;
+  struct stat st;
+  gchar *shm_name;
+  gint fd;
+
+  g_return_val_if_fail (name != NULL, NULL);
+
+  shm_name = repo_shm_get_name (name);
+  fd = shm_open (shm_name, O_RDWR, 0);
+  if (fd < 0)
+    goto done;
+
+  if (fstat (fd, &st) != 0 || (gsize) st.st_size < sizeof (repo_shm_header)) {
+    /* the writer is creating the shared memory */
+    close (fd);
+    goto done;
+  }
+
+  shm = repo_shm_map (shm_name, fd, st.st_size, FALSE);
+  if (shm == NULL)
+    goto done;
+
+  shm->dev = st.st_dev;
+  shm->ino = st.st_ino;
+
+  header = shm->header;
+  if (!g_atomic_int_get (&header->ready)) {
+    repo_shm_unref (shm);
+    shm = NULL;
+    goto done;
+  }
+
+  if (!repo_shm_validate_header (shm)) {
+    GST_ERROR ("Invalid repo shm %s.", shm_name);
+    repo_shm_unref (shm);
+    shm = NULL;
+    goto done;
+  }
+
+  repo_shm_lock (shm);
+
+  if (!repo_shm_is_alive (&header->writer_lock)) {
+    /* stale memory of the writer which is killed, wait for the new one */
+    repo_shm_unlock (shm);
+    repo_shm_unref (shm);
+    shm = NULL;
+    goto done;
+  }
+
+  /* release the slots of the previous reader, then hold reader_lock */
+  repo_shm_reclaim_reader (shm);
+  if (!repo_shm_start_presence (shm)) {
+    GST_ERROR ("Repo shm %s is used by another reader.", shm_name);
+    repo_shm_unlock (shm);
+    repo_shm_unref (shm);
+    shm = NULL;
+    goto done;
+  }
+
+  repo_shm_unlock (shm);
+
+done:
+  g_free (shm_name);
+  return shm;
+}
+
+/**
+ * @brief Close the shared memory. The writer sets EOS and removes the name.
+ */
+void
+gst_tensor_repo_shm_close (GstTensorRepoShm * shm)
+{
+  g_return_if_fail (shm != NULL);
+
+  if (shm->owner) {
+    gst_tensor_repo_shm_set_eos (shm);
+    shm_unlink (shm->name);
+  }
+
+  repo_shm_unref (shm);
+}
+
+/**
+ * @brief Get the caps in the header of the shared memory.
+ */
+GstCaps *
+gst_tensor_repo_shm_get_caps (GstTensorRepoShm * shm)
+{
+  GstCaps *caps;
+  gchar *caps_str;
+
+  g_return_val_if_fail (shm != NULL, NULL);
+
+  caps_str = g_strndup (shm->header->caps, REPO_SHM_CAPS_LEN - 1);
+  caps = gst_caps_from_string (caps_str);
+  g_free (caps_str);
+
+  return caps;
+}
+
+/**
+ * @brief Get the tensors info in the header of the shared memory.
+ */
+gboolean
+gst_tensor_repo_shm_get_info (GstTensorRepoShm * shm, GstTensorsInfo * info)
+{
+  repo_shm_tensors_info *shm_info;
+  guint i;
+
+  g_return_val_if_fail (shm != NULL, FALSE);
+  g_return_val_if_fail (info != NULL, FALSE);
+
+  shm_info = &shm->header->info;
+  if (shm_info->num_tensors > NNS_TENSOR_SIZE_LIMIT)
+    return FALSE;
+
+  gst_tensors_info_init (info);
+  info->num_tensors = shm_info->num_tensors;
+  for (i = 0; i < shm_info->num_tensors; i++) {
+    info->info[i].type = (tensor_type) shm_info->type[i];
+    memcpy (info->info[i].dimension, shm_info->dimension[i],
+        sizeof (tensor_dim));
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Set the flushing state, to stop waiting for the slot.
+ */
+void
+gst_tensor_repo_shm_set_flushing (GstTensorRepoShm * shm, gboolean flushing)
+{
+  g_return_if_fail (shm != NULL);
+
+  g_atomic_int_set (&shm->flushing, flushing);
+}
+
+/**
+ * @brief Find a free slot. Call this with lock.
+ * @return index of the slot, num_slots if there is no free slot
+ */
+static guint
+repo_shm_find_free_slot (GstTensorRepoShm * shm)
+{
+  guint i;
+
+  for (i = 0; i < shm->num_slots; i++) {
+    if (shm->header->slots[i].state == REPO_SHM_SLOT_FREE)
+      break;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Copy the buffer into the slot of shared memory (writer).
+ */
+gboolean
+gst_tensor_repo_shm_set_buffer (GstTensorRepoShm * shm, GstBuffer * buffer,
+    GstTensorRepoPolicy policy)
+{
+  repo_shm_header *header;
+  repo_shm_slot *slot;
+  GstMemory *mem;
+  GstMapInfo map;
+  guint8 *dest;
+  gsize total, offset;
+  guint i, n_mems, index;
+
+  g_return_val_if_fail (shm != NULL, FALSE);
+  g_return_val_if_fail (GST_IS_BUFFER (buffer), FALSE);
+
+  header = shm->header;
+  n_mems = gst_buffer_n_memory (buffer);
+
+  if (n_mems > NNS_TENSOR_SIZE_LIMIT) {
+    GST_ERROR ("Too many memory blocks (%u) in the buffer.", n_mems);
+    return FALSE;
+  }
+
+  total = 0;
+  for (i = 0; i < n_mems; i++)
+    total += REPO_SHM_ALIGN_SIZE (gst_buffer_peek_memory (buffer, i)->size);
+
+  if (total > shm->slot_size) {
+    GST_ERROR ("The buffer (%" G_GSIZE_FORMAT ") is larger than the slot.",
+        total);
+    return FALSE;
+  }
+
+  repo_shm_lock (shm);
+
+  index = shm->num_slots;
+  while (!header->eos) {
+    repo_shm_reclaim_reader (shm);
+
+    if (header->write_idx - header->read_idx < shm->max_buffers) {
+      /**
+       * The reader holds less than REPO_SHM_READER_SLOTS slots,
+       * there is a free slot unless the reader does not release the slot which is copied out.
+       */
+      index = repo_shm_find_free_slot (shm);
+      if (index < shm->num_slots)
+        break;
+    } else if (policy == REPO_POLICY_DROP_NEWEST) {
+      header->num_dropped++;
+      repo_shm_unlock (shm);
+      return TRUE;
+    } else if (policy == REPO_POLICY_DROP_OLDEST) {
+      /* the oldest buffer which the reader does not pull */
+      slot = &header->slots[shm->queue[header->read_idx % shm->num_slots]];
+      slot->state = REPO_SHM_SLOT_FREE;
+      header->read_idx++;
+      header->num_dropped++;
+      continue;
+    }
+
+    if (!repo_shm_wait (shm)) {
+      repo_shm_unlock (shm);
+      return FALSE;
+    }
+  }
+
+  if (header->eos) {
+    repo_shm_unlock (shm);
+    return FALSE;
+  }
+
+  slot = &header->slots[index];
+  slot->state = REPO_SHM_SLOT_WRITING;
+  repo_shm_unlock (shm);
+
+  /* copy the memory blocks without lock */
+  dest = shm->data + (gsize) index * shm->slot_size;
+  offset = 0;
+
+  for (i = 0; i < n_mems; i++) {
+    mem = gst_buffer_peek_memory (buffer, i);
+
+    if (!gst_memory_map (mem, &map, GST_MAP_READ)) {
+      GST_ERROR ("Failed to map the memory of the buffer.");
+      repo_shm_lock (shm);
+      slot->state = REPO_SHM_SLOT_FREE;
+      repo_shm_unlock (shm);
+      return FALSE;
+    }
+
+    memcpy (dest + offset, map.data, map.size);
+    slot->mem_size[i] = map.size;
+    offset += REPO_SHM_ALIGN_SIZE (map.size);
+
+    gst_memory_unmap (mem, &map);
+  }
+
+  slot->num_mems = n_mems;
+  slot->pts = GST_BUFFER_PTS (buffer);
+  slot->dts = GST_BUFFER_DTS (buffer);
+  slot->duration = GST_BUFFER_DURATION (buffer);
+
+  repo_shm_lock (shm);
+  slot->state = REPO_SHM_SLOT_READY;
+  shm->queue[header->write_idx % shm->num_slots] = index;
+  header->write_idx++;
+  header->num_pushed++;
+  repo_shm_broadcast (shm);
+  repo_shm_unlock (shm);
+
+  if (DBG)
+    GST_DEBUG ("Pushed [%s:%u] (size : %" G_GSIZE_FORMAT ")", shm->name, index,
+        offset);
+  return TRUE;
+}
+
+/**
+ * @brief Set the slot free (reader).
+ */
+static void
+repo_shm_free_slot (GstTensorRepoShm * shm, guint index)
+{
+  repo_shm_header *header = shm->header;
+
+  repo_shm_lock (shm);
+
+  /* the writer may have released the slot if it regarded the reader as dead */
+  if (header->slots[index].state == REPO_SHM_SLOT_READING) {
+    header->slots[index].state = REPO_SHM_SLOT_FREE;
+    if (header->num_reading > 0)
+      header->num_reading--;
+  }
+
+  repo_shm_broadcast (shm);
+  repo_shm_unlock (shm);
+}
+
+/**
+ * @brief Release the slot when all memory blocks of the buffer are freed.
+ */
+static void
+repo_shm_release_slot (gpointer user_data)
+{
+  repo_shm_release_data *data = (repo_shm_release_data *) user_data;
+  GstTensorRepoShm *shm = data->shm;
+
+  if (!g_atomic_int_dec_and_test (&data->remained))
+    return;
+
+  repo_shm_free_slot (shm, data->index);
+
+  repo_shm_unref (shm);
+  g_free (data);
+}
+
+/**
+ * @brief Get the buffer in the slot of shared memory (reader).
+ * The memory blocks of the buffer are the slot itself (no memcpy), the slot is released when the buffer is freed.
+ * If the reader holds (REPO_SHM_READER_SLOTS - 1) slots, the buffer is copied out and the slot is released at once.
+ */
+GstBuffer *
+gst_tensor_repo_shm_get_buffer (GstTensorRepoShm * shm,
+    GstTensorRepoShmStatus * status)
+{
+  repo_shm_header *header;
+  repo_shm_slot *slot;
+  repo_shm_release_data *data;
+  GstTensorRepoShmStatus ret = REPO_SHM_OK;
+  GstBuffer *buf;
+  GstMemory *mem;
+  GstMapInfo map;
+  guint64 mem_size[NNS_TENSOR_SIZE_LIMIT];
+  GstClockTime pts, dts, duration;
+  guint8 *src;
+  gsize offset;
+  guint i, index, num_mems;
+  gboolean copy_out;
+
+  g_return_val_if_fail (shm != NULL, NULL);
+
+  header = shm->header;
+
+  repo_shm_lock (shm);
+
+  while (header->read_idx == header->write_idx && !header->eos) {
+    if (!repo_shm_check_writer (shm)) {
+      ret = REPO_SHM_DISCONNECTED;
+      goto error;
+    }
+
+    if (!repo_shm_wait (shm)) {
+      ret = REPO_SHM_FLUSHING;
+      goto error;
+    }
+  }
+
+  if (header->read_idx == header->write_idx) {
+    /* drained all buffers */
+    ret = REPO_SHM_EOS;
+    goto error;
+  }
+
+  /* check the queue and the slot written by other process */
+  index = shm->queue[header->read_idx % shm->num_slots];
+  if (header->write_idx - header->read_idx > shm->max_buffers ||
+      index >= shm->num_slots) {
+    GST_ERROR ("Invalid queue of repo shm %s.", shm->name);
+    ret = REPO_SHM_INVALID;
+    goto error;
+  }
+
+  slot = &header->slots[index];
+  num_mems = slot->num_mems;
+  if (num_mems > NNS_TENSOR_SIZE_LIMIT) {
+    GST_ERROR ("Invalid slot of repo shm %s.", shm->name);
+    ret = REPO_SHM_INVALID;
+    goto error;
+  }
+
+  offset = 0;
+  for (i = 0; i < num_mems; i++) {
+    mem_size[i] = slot->mem_size[i];
+
+    if (mem_size[i] > shm->slot_size - offset ||
+        REPO_SHM_ALIGN_SIZE (mem_size[i]) > shm->slot_size - offset) {
+      GST_ERROR ("Invalid slot of repo shm %s.", shm->name);
+      ret = REPO_SHM_INVALID;
+      goto error;
+    }
+
+    offset += REPO_SHM_ALIGN_SIZE (mem_size[i]);
+  }
+
+  pts = slot->pts;
+  dts = slot->dts;
+  duration = slot->duration;
+
+  copy_out = (header->num_reading >= REPO_SHM_READER_SLOTS - 1);
+  slot->state = REPO_SHM_SLOT_READING;
+  header->num_reading++;
+  header->read_idx++;
+
+  /* the writer may wait for the slot */
+  repo_shm_broadcast (shm);
+  repo_shm_unlock (shm);
+
+  buf = gst_buffer_new ();
+  GST_BUFFER_PTS (buf) = pts;
+  GST_BUFFER_DTS (buf) = dts;
+  GST_BUFFER_DURATION (buf) = duration;
+
+  src = shm->data + (gsize) index * shm->slot_size;
+  offset = 0;
+
+  if (copy_out) {
+    for (i = 0; i < num_mems; i++) {
+      mem = gst_allocator_alloc (NULL, mem_size[i], NULL);
+
+      if (!gst_memory_map (mem, &map, GST_MAP_WRITE)) {
+        GST_ERROR ("Failed to map the memory to copy out the slot.");
+        gst_memory_unref (mem);
+        gst_buffer_unref (buf);
+        repo_shm_free_slot (shm, index);
+
+        if (status)
+          *status = REPO_SHM_INVALID;
+        return NULL;
+      }
+
+      memcpy (map.data, src + offset, mem_size[i]);
+      gst_memory_unmap (mem, &map);
+      gst_buffer_append_memory (buf, mem);
+
+      offset += REPO_SHM_ALIGN_SIZE (mem_size[i]);
+    }
+
+    repo_shm_free_slot (shm, index);
+  } else {
+    data = g_new0 (repo_shm_release_data, 1);
+    data->shm = repo_shm_ref (shm);
+    data->index = index;
+    data->remained = num_mems + 1;
+
+    for (i = 0; i < num_mems; i++) {
+      mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, src + offset,
+          mem_size[i], 0, mem_size[i], data, repo_shm_release_slot);
+      gst_buffer_append_memory (buf, mem);
+
+      offset += REPO_SHM_ALIGN_SIZE (mem_size[i]);
+    }
+
+    /* release the reference for the buffer without memory */
+    repo_shm_release_slot (data);
+  }
+
+  if (DBG)
+    GST_DEBUG ("Popped [%s:%u] (size: %" G_GSIZE_FORMAT ", copied: %d)",
+        shm->name, index, gst_buffer_get_size (buf), copy_out);
+
+  if (status)
+    *status = REPO_SHM_OK;
+  return buf;
+
+error:
+  repo_shm_unlock (shm);
+
+  if (status)
+    *status = ret;
+  return NULL;
+}
+
+/**
+ * @brief Set EOS (End-of-Stream) of shared memory.
+ */
+void
+gst_tensor_repo_shm_set_eos (GstTensorRepoShm * shm)
+{
+  g_return_if_fail (shm != NULL);
+
+  repo_shm_lock (shm);
+  shm->header->eos = TRUE;
+  repo_shm_broadcast (shm);
+  repo_shm_unlock (shm);
+}
+
+/**
+ * @brief Get the occupancy and the counters of shared memory.
+ */
+gboolean
+gst_tensor_repo_shm_get_stats (GstTensorRepoShm * shm, guint * level,
+    guint64 * pushed, guint64 * dropped)
+{
+  repo_shm_header *header;
+
+  g_return_val_if_fail (shm != NULL, FALSE);
+
+  header = shm->header;
+
+  repo_shm_lock (shm);
+
+  if (level)
+    *level = (guint) (header->write_idx - header->read_idx);
+  if (pushed)
+    *pushed = header->num_pushed;
+  if (dropped)
+    *dropped = header->num_dropped;
+
+  repo_shm_unlock (shm);
+  return TRUE;
+}
+
+#else /* __gnu_linux__ && !__ANDROID__ */
+
+/**
+ * @brief Create the shared memory with the caps (writer). NYI for this platform.
+ */
+GstTensorRepoShm *
+gst_tensor_repo_shm_create (const gchar * name, guint max_buffers,
+    const GstCaps * caps)
+{
+  GST_ERROR ("The shared memory of tensor repo is not supported.");
+  return NULL;
+}
+
+/**
+ * @brief Open the shared memory created by the writer (reader). NYI for this platform.
+ */
+GstTensorRepoShm *
+gst_tensor_repo_shm_open (const gchar * name)
+{
+  GST_ERROR ("The shared memory of tensor repo is not supported.");
+  return NULL;
+}
+
+/**
+ * @brief Close the shared memory. NYI for this platform.
+ */
+void
+gst_tensor_repo_shm_close (GstTensorRepoShm * shm)
+{
+}
+
+/**
+ * @brief Get the caps in the header of the shared memory. NYI for this platform.
+ */
+GstCaps *
+gst_tensor_repo_shm_get_caps (GstTensorRepoShm * shm)
+{
+  return NULL;
+}
+
+/**
+ * @brief Get the tensors info in the header of the shared memory. NYI for this platform.
+ */
+gboolean
+gst_tensor_repo_shm_get_info (GstTensorRepoShm * shm, GstTensorsInfo * info)
+{
+  return FALSE;
+}
+
+/**
+ * @brief Set the flushing state. NYI for this platform.
+ */
+void
+gst_tensor_repo_shm_set_flushing (GstTensorRepoShm * shm, gboolean flushing)
+{
+}
+
+/**
+ * @brief Copy the buffer into the slot of shared memory. NYI for this platform.
+ */
+gboolean
+gst_tensor_repo_shm_set_buffer (GstTensorRepoShm * shm, GstBuffer * buffer,
+    GstTensorRepoPolicy policy)
+{
+  return FALSE;
+}
+
+/**
+ * @brief Get the buffer in the slot of shared memory. NYI for this platform.
+ */
+GstBuffer *
+gst_tensor_repo_shm_get_buffer (GstTensorRepoShm * shm,
+    GstTensorRepoShmStatus * status)
+{
+  if (status)
+    *status = REPO_SHM_INVALID;
+  return NULL;
+}
+
+/**
+ * @brief Set EOS (End-of-Stream) of shared memory. NYI for this platform.
+ */
+void
+gst_tensor_repo_shm_set_eos (GstTensorRepoShm * shm)
+{
+}
+
+/**
+ * @brief Get the occupancy and the counters of shared memory. NYI for this platform.
+ */
+gboolean
+gst_tensor_repo_shm_get_stats (GstTensorRepoShm * shm, guint * level,
+    guint64 * pushed, guint64 * dropped)
+{
+  return FALSE;
+}
+
+#endif /* __gnu_linux__ && !__ANDROID__ */
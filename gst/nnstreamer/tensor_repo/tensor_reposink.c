@@ -46,13 +46,29 @@ enum
   PROP_0,
   PROP_SIGNAL_RATE,
   PROP_SLOT,
-  PROP_SILENT
+  PROP_SILENT,
+  PROP_MAX_BUFFERS,
+  PROP_POLICY,
+  PROP_CURRENT_LEVEL,
+  PROP_DROPPED,
+  PROP_SHM_NAME
 };
 
 #define DEFAULT_SIGNAL_RATE 0
 #define DEFAULT_SILENT TRUE
 #define DEFAULT_QOS TRUE
 #define DEFAULT_INDEX 0
+#define DEFAULT_POLICY "block"
+
+/**
+ * @brief The names of the policies when the slot is full.
+ */
+static const gchar *repo_policy_string[] = {
+  [REPO_POLICY_BLOCK] = "block",
+  [REPO_POLICY_DROP_OLDEST] = "drop-oldest",
+  [REPO_POLICY_DROP_NEWEST] = "drop-newest",
+  [REPO_POLICY_END] = NULL
+};
 
 /**
  * @brief tensor_reposink sink template
@@ -70,6 +86,8 @@ static void gst_tensor_reposink_dispose (GObject * object);
 
 static gboolean gst_tensor_reposink_start (GstBaseSink * sink);
 static gboolean gst_tensor_reposink_stop (GstBaseSink * sink);
+static gboolean gst_tensor_reposink_unlock (GstBaseSink * sink);
+static gboolean gst_tensor_reposink_unlock_stop (GstBaseSink * sink);
 static gboolean gst_tensor_reposink_event (GstBaseSink * sink,
     GstEvent * event);
 static gboolean gst_tensor_reposink_query (GstBaseSink * sink,
@@ -121,6 +139,33 @@ gst_tensor_reposink_class_init (GstTensorRepoSinkClass * klass)
       g_param_spec_boolean ("silent", "Silent", "Produce verbose output",
           DEFAULT_SILENT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class, PROP_MAX_BUFFERS,
+      g_param_spec_uint ("max-buffers", "Max buffers",
+          "The number of buffers in the repository slot", 1, G_MAXUINT,
+          REPO_DEFAULT_MAX_BUFFERS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_POLICY,
+      g_param_spec_string ("drop-policy", "Drop policy",
+          "The policy when the slot is full (block, drop-oldest or drop-newest)",
+          DEFAULT_POLICY, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_CURRENT_LEVEL,
+      g_param_spec_uint ("current-level", "Current level",
+          "The number of buffers in the repository slot", 0, G_MAXUINT, 0,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_DROPPED,
+      g_param_spec_uint64 ("dropped", "Dropped",
+          "The number of buffers dropped with the policy", 0, G_MAXUINT64, 0,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_SHM_NAME,
+      g_param_spec_string ("shm-name", "Shared memory name",
+          "The name of the shared memory to push the buffers to tensor_reposrc "
+          "in other process (slot-index is ignored)", NULL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (element_class,
       "TensorRepoSink",
       "Set/TensorRepo",
@@ -131,6 +176,9 @@ gst_tensor_reposink_class_init (GstTensorRepoSinkClass * klass)
 
   basesink_class->start = GST_DEBUG_FUNCPTR (gst_tensor_reposink_start);
   basesink_class->stop = GST_DEBUG_FUNCPTR (gst_tensor_reposink_stop);
+  basesink_class->unlock = GST_DEBUG_FUNCPTR (gst_tensor_reposink_unlock);
+  basesink_class->unlock_stop =
+      GST_DEBUG_FUNCPTR (gst_tensor_reposink_unlock_stop);
   basesink_class->event = GST_DEBUG_FUNCPTR (gst_tensor_reposink_event);
   basesink_class->query = GST_DEBUG_FUNCPTR (gst_tensor_reposink_query);
   basesink_class->render = GST_DEBUG_FUNCPTR (gst_tensor_reposink_render);
@@ -159,10 +207,29 @@ gst_tensor_reposink_init (GstTensorRepoSink * self)
   self->last_render_time = GST_CLOCK_TIME_NONE;
   self->set_startid = FALSE;
   self->in_caps = NULL;
+  self->max_buffers = REPO_DEFAULT_MAX_BUFFERS;
+  self->policy = REPO_POLICY_BLOCK;
+  self->shm_name = NULL;
+  self->shm = NULL;
 
   gst_base_sink_set_qos_enabled (basesink, DEFAULT_QOS);
 }
 
+/**
+ * @brief Set the queue of the repository slot.
+ */
+static void
+gst_tensor_reposink_set_queue (GstTensorRepoSink * self)
+{
+  if (!self->set_startid)
+    return;
+
+  if (!gst_tensor_repo_set_queue (self->myid, self->max_buffers,
+          self->policy)) {
+    GST_WARNING_OBJECT (self, "Cannot set the queue of slot %u", self->myid);
+  }
+}
+
 /**
  * @brief set property vmethod
  */
@@ -192,9 +259,32 @@ gst_tensor_reposink_set_property (GObject * object, guint prop_id,
         self->set_startid = TRUE;
       }
 
+      gst_tensor_reposink_set_queue (self);
+
       if (self->o_myid != self->myid)
         gst_tensor_repo_set_changed (self->o_myid, self->myid, TRUE);
       break;
+    case PROP_MAX_BUFFERS:
+      self->max_buffers = g_value_get_uint (value);
+      gst_tensor_reposink_set_queue (self);
+      break;
+    case PROP_POLICY:
+    {
+      const gchar *str = g_value_get_string (value);
+      gint idx = (str) ? find_key_strv (repo_policy_string, str) : -1;
+
+      if (idx < 0) {
+        GST_ERROR_OBJECT (self, "Invalid drop policy %s.", GST_STR_NULL (str));
+      } else {
+        self->policy = (GstTensorRepoPolicy) idx;
+        gst_tensor_reposink_set_queue (self);
+      }
+      break;
+    }
+    case PROP_SHM_NAME:
+      g_free (self->shm_name);
+      self->shm_name = g_value_dup_string (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -222,6 +312,37 @@ gst_tensor_reposink_get_property (GObject * object, guint prop_id,
     case PROP_SLOT:
       g_value_set_uint (value, self->myid);
       break;
+    case PROP_MAX_BUFFERS:
+      g_value_set_uint (value, self->max_buffers);
+      break;
+    case PROP_POLICY:
+      g_value_set_string (value, repo_policy_string[self->policy]);
+      break;
+    case PROP_CURRENT_LEVEL:
+    {
+      guint level = 0;
+
+      if (self->shm)
+        gst_tensor_repo_shm_get_stats (self->shm, &level, NULL, NULL);
+      else if (self->set_startid)
+        gst_tensor_repo_get_stats (self->myid, &level, NULL, NULL);
+      g_value_set_uint (value, level);
+      break;
+    }
+    case PROP_DROPPED:
+    {
+      guint64 dropped = 0;
+
+      if (self->shm)
+        gst_tensor_repo_shm_get_stats (self->shm, NULL, NULL, &dropped);
+      else if (self->set_startid)
+        gst_tensor_repo_get_stats (self->myid, NULL, NULL, &dropped);
+      g_value_set_uint64 (value, dropped);
+      break;
+    }
+    case PROP_SHM_NAME:
+      g_value_set_string (value, self->shm_name);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -241,6 +362,9 @@ gst_tensor_reposink_dispose (GObject * object)
   if (self->in_caps)
     gst_caps_unref (self->in_caps);
 
+  g_free (self->shm_name);
+  self->shm_name = NULL;
+
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
@@ -259,6 +383,42 @@ gst_tensor_reposink_start (GstBaseSink * sink)
 static gboolean
 gst_tensor_reposink_stop (GstBaseSink * sink)
 {
+  GstTensorRepoSink *self = GST_TENSOR_REPOSINK (sink);
+
+  if (self->shm) {
+    /* set EOS, so that tensor_reposrc does not wait for the removed memory */
+    gst_tensor_repo_shm_close (self->shm);
+    self->shm = NULL;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief unlock vmethod implementation
+ */
+static gboolean
+gst_tensor_reposink_unlock (GstBaseSink * sink)
+{
+  GstTensorRepoSink *self = GST_TENSOR_REPOSINK (sink);
+
+  if (self->shm)
+    gst_tensor_repo_shm_set_flushing (self->shm, TRUE);
+
+  return TRUE;
+}
+
+/**
+ * @brief unlock_stop vmethod implementation
+ */
+static gboolean
+gst_tensor_reposink_unlock_stop (GstBaseSink * sink)
+{
+  GstTensorRepoSink *self = GST_TENSOR_REPOSINK (sink);
+
+  if (self->shm)
+    gst_tensor_repo_shm_set_flushing (self->shm, FALSE);
+
   return TRUE;
 }
 
@@ -280,7 +440,10 @@ gst_tensor_reposink_event (GstBaseSink * sink, GstEvent * event)
 
   switch (type) {
     case GST_EVENT_EOS:
-      gst_tensor_repo_set_eos (self->myid);
+      if (self->shm)
+        gst_tensor_repo_shm_set_eos (self->shm);
+      else
+        gst_tensor_repo_set_eos (self->myid);
       break;
     default:
       break;
@@ -353,6 +516,21 @@ gst_tensor_reposink_render_buffer (GstTensorRepoSink * self, GstBuffer * buffer)
   if (notify) {
     self->last_render_time = now;
 
+    if (self->shm_name) {
+      if (!self->shm) {
+        self->shm = gst_tensor_repo_shm_create (self->shm_name,
+            self->max_buffers, self->in_caps);
+      }
+
+      if (!self->shm || !gst_tensor_repo_shm_set_buffer (self->shm, buffer,
+              self->policy)) {
+        GST_ELEMENT_ERROR (self, RESOURCE, WRITE,
+            ("Cannot Set buffer into shared memory [name: %s]",
+                self->shm_name), NULL);
+      }
+      return;
+    }
+
     if (!gst_tensor_repo_set_buffer (self->myid, self->o_myid, buffer,
             self->in_caps)) {
       GST_ELEMENT_ERROR (self, RESOURCE, WRITE,
@@ -29,6 +29,7 @@
 
 #include <gst/gst.h>
 #include <gst/base/gstbasesink.h>
+#include "tensor_repo.h"
 
 G_BEGIN_DECLS
 
@@ -62,6 +63,10 @@ struct _GstTensorRepoSink
   gboolean set_startid;
   guint myid;
   guint o_myid;
+  guint max_buffers; /**< the number of buffers in the slot */
+  GstTensorRepoPolicy policy; /**< policy when the slot is full */
+  gchar *shm_name; /**< name of the shared memory (other process) */
+  GstTensorRepoShm *shm; /**< handle of the shared memory */
 };
 
 /**
@@ -48,12 +48,18 @@ enum
   PROP_0,
   PROP_CAPS,
   PROP_SLOT_ID,
-  PROP_SILENT
+  PROP_SILENT,
+  PROP_SHM_NAME
 };
 
 #define DEFAULT_SILENT TRUE
 #define DEFAULT_INDEX 0
 
+/**
+ * @brief Interval to check the shared memory created by tensor_reposink (10 ms).
+ */
+#define SHM_OPEN_INTERVAL_US (10000)
+
 /**
  * @brief tensor_reposrc src template
  */
@@ -70,6 +76,10 @@ static void gst_tensor_reposrc_dispose (GObject * object);
 static GstCaps *gst_tensor_reposrc_getcaps (GstBaseSrc * src, GstCaps * filter);
 static GstFlowReturn gst_tensor_reposrc_create (GstPushSrc * src,
     GstBuffer ** buffer);
+static gboolean gst_tensor_reposrc_negotiate (GstBaseSrc * src);
+static gboolean gst_tensor_reposrc_stop (GstBaseSrc * src);
+static gboolean gst_tensor_reposrc_unlock (GstBaseSrc * src);
+static gboolean gst_tensor_reposrc_unlock_stop (GstBaseSrc * src);
 
 #define gst_tensor_reposrc_parent_class parent_class
 G_DEFINE_TYPE (GstTensorRepoSrc, gst_tensor_reposrc, GST_TYPE_PUSH_SRC);
@@ -106,7 +116,17 @@ gst_tensor_reposrc_class_init (GstTensorRepoSrcClass * klass)
           0, UINT_MAX, DEFAULT_INDEX,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class, PROP_SHM_NAME,
+      g_param_spec_string ("shm-name", "Shared memory name",
+          "The name of the shared memory to pull the buffers from "
+          "tensor_reposink in other process (caps is optional)", NULL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   basesrc_class->get_caps = gst_tensor_reposrc_getcaps;
+  basesrc_class->negotiate = gst_tensor_reposrc_negotiate;
+  basesrc_class->stop = gst_tensor_reposrc_stop;
+  basesrc_class->unlock = gst_tensor_reposrc_unlock;
+  basesrc_class->unlock_stop = gst_tensor_reposrc_unlock_stop;
   pushsrc_class->create = gst_tensor_reposrc_create;
 
   gst_element_class_set_static_metadata (element_class,
@@ -130,6 +150,9 @@ gst_tensor_reposrc_init (GstTensorRepoSrc * self)
   gst_tensors_config_init (&self->config);
   self->caps = NULL;
   self->set_startid = FALSE;
+  self->shm_name = NULL;
+  self->shm = NULL;
+  self->flushing = FALSE;
 }
 
 /**
@@ -140,13 +163,16 @@ gst_tensor_reposrc_dispose (GObject * object)
 {
   GstTensorRepoSrc *self = GST_TENSOR_REPOSRC (object);
 
-  if (!gst_tensor_repo_remove_repodata (self->myid))
+  if (self->set_startid && !gst_tensor_repo_remove_repodata (self->myid))
     GST_ELEMENT_ERROR (self, RESOURCE, WRITE,
         ("Cannot remove [key: %d] in repo", self->myid), NULL);
 
   if (self->caps)
     gst_caps_unref (self->caps);
 
+  g_free (self->shm_name);
+  self->shm_name = NULL;
+
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
@@ -162,7 +188,17 @@ gst_tensor_reposrc_getcaps (GstBaseSrc * src, GstCaps * filter)
 
   GST_DEBUG_OBJECT (self, "returning %" GST_PTR_FORMAT, self->caps);
 
-  if (self->caps) {
+  if (self->caps == NULL && self->shm) {
+    /* caps in the header of the shared memory */
+    GstCaps *shm_caps = gst_tensor_repo_shm_get_caps (self->shm);
+
+    if (filter) {
+      cap = gst_caps_intersect_full (filter, shm_caps,
+          GST_CAPS_INTERSECT_FIRST);
+      gst_caps_unref (shm_caps);
+    } else
+      cap = shm_caps;
+  } else if (self->caps) {
     if (filter) {
       cap = gst_caps_intersect_full (filter, self->caps,
           GST_CAPS_INTERSECT_FIRST);
@@ -219,6 +255,10 @@ gst_tensor_reposrc_set_property (GObject * object, guint prop_id,
       if (self->o_myid != self->myid)
         gst_tensor_repo_set_changed (self->o_myid, self->myid, FALSE);
       break;
+    case PROP_SHM_NAME:
+      g_free (self->shm_name);
+      self->shm_name = g_value_dup_string (value);
+      break;
     case PROP_CAPS:
     {
       GstStructure *st = NULL;
@@ -271,6 +311,9 @@ gst_tensor_reposrc_get_property (GObject * object, guint prop_id,
     case PROP_CAPS:
       gst_value_set_caps (value, self->caps);
       break;
+    case PROP_SHM_NAME:
+      g_value_set_string (value, self->shm_name);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -306,6 +349,136 @@ gst_tensor_reposrc_gen_dummy_buffer (GstTensorRepoSrc * self)
   return buf;
 }
 
+/**
+ * @brief negotiate vmethod, negotiation with the shared memory is delayed until tensor_reposink creates it.
+ */
+static gboolean
+gst_tensor_reposrc_negotiate (GstBaseSrc * src)
+{
+  GstTensorRepoSrc *self = GST_TENSOR_REPOSRC (src);
+
+  if (self->shm_name && self->shm == NULL && self->caps == NULL)
+    return TRUE;
+
+  return GST_BASE_SRC_CLASS (parent_class)->negotiate (src);
+}
+
+/**
+ * @brief stop vmethod implementation
+ */
+static gboolean
+gst_tensor_reposrc_stop (GstBaseSrc * src)
+{
+  GstTensorRepoSrc *self = GST_TENSOR_REPOSRC (src);
+
+  if (self->shm) {
+    gst_tensor_repo_shm_close (self->shm);
+    self->shm = NULL;
+  }
+
+  self->negotiation = FALSE;
+  return TRUE;
+}
+
+/**
+ * @brief unlock vmethod implementation
+ */
+static gboolean
+gst_tensor_reposrc_unlock (GstBaseSrc * src)
+{
+  GstTensorRepoSrc *self = GST_TENSOR_REPOSRC (src);
+
+  g_atomic_int_set (&self->flushing, TRUE);
+  if (self->shm)
+    gst_tensor_repo_shm_set_flushing (self->shm, TRUE);
+
+  return TRUE;
+}
+
+/**
+ * @brief unlock_stop vmethod implementation
+ */
+static gboolean
+gst_tensor_reposrc_unlock_stop (GstBaseSrc * src)
+{
+  GstTensorRepoSrc *self = GST_TENSOR_REPOSRC (src);
+
+  g_atomic_int_set (&self->flushing, FALSE);
+  if (self->shm)
+    gst_tensor_repo_shm_set_flushing (self->shm, FALSE);
+
+  return TRUE;
+}
+
+/**
+ * @brief create func of tensor_reposrc with the shared memory
+ */
+static GstFlowReturn
+gst_tensor_reposrc_create_shm (GstTensorRepoSrc * self, GstBuffer ** buffer)
+{
+  GstBuffer *buf;
+  GstTensorRepoShmStatus status;
+
+again:
+  /* wait for tensor_reposink in other process */
+  while (self->shm == NULL) {
+    if (g_atomic_int_get (&self->flushing))
+      return GST_FLOW_FLUSHING;
+
+    self->shm = gst_tensor_repo_shm_open (self->shm_name);
+    if (self->shm == NULL)
+      g_usleep (SHM_OPEN_INTERVAL_US);
+    else if (g_atomic_int_get (&self->flushing))
+      gst_tensor_repo_shm_set_flushing (self->shm, TRUE);
+  }
+
+  if (!self->negotiation) {
+    GstCaps *shm_caps = gst_tensor_repo_shm_get_caps (self->shm);
+    gboolean ret;
+
+    if (self->caps) {
+      ret = gst_caps_can_intersect (self->caps, shm_caps);
+    } else {
+      ret = gst_base_src_set_caps (GST_BASE_SRC (self), shm_caps);
+    }
+    gst_caps_unref (shm_caps);
+
+    if (!ret) {
+      GST_ELEMENT_ERROR (GST_ELEMENT (self), CORE, NEGOTIATION,
+          ("Negotiation Failed! : repo_sink & repos_src"), (NULL));
+      return GST_FLOW_NOT_NEGOTIATED;
+    }
+
+    self->negotiation = TRUE;
+  }
+
+  buf = gst_tensor_repo_shm_get_buffer (self->shm, &status);
+
+  switch (status) {
+    case REPO_SHM_OK:
+      *buffer = buf;
+      return GST_FLOW_OK;
+    case REPO_SHM_EOS:
+      return GST_FLOW_EOS;
+    case REPO_SHM_DISCONNECTED:
+      /* the writer is killed or restarted, wait for the new shared memory */
+      GST_WARNING_OBJECT (self, "Lost the writer of shared memory %s.",
+          self->shm_name);
+      gst_tensor_repo_shm_close (self->shm);
+      self->shm = NULL;
+      self->negotiation = FALSE;
+      goto again;
+    case REPO_SHM_INVALID:
+      GST_ELEMENT_ERROR (GST_ELEMENT (self), RESOURCE, READ,
+          ("Invalid shared memory [name: %s]", self->shm_name), (NULL));
+      return GST_FLOW_ERROR;
+    default:
+      break;
+  }
+
+  return GST_FLOW_FLUSHING;
+}
+
 /**
  * @brief create func of tensor_reposrc
  */
@@ -319,6 +492,10 @@ gst_tensor_reposrc_create (GstPushSrc * src, GstBuffer ** buffer)
   guint newid;
 
   self = GST_TENSOR_REPOSRC (src);
+
+  if (self->shm_name)
+    return gst_tensor_reposrc_create_shm (self, buffer);
+
   gst_tensor_repo_wait ();
 
   if (!self->ini) {
@@ -29,6 +29,7 @@
 
 #include <gst/gst.h>
 #include <gst/base/gstpushsrc.h>
+#include "tensor_repo.h"
 
 G_BEGIN_DECLS
 
@@ -64,6 +65,9 @@ struct _GstTensorRepoSrc
   gint fps_d;
   gboolean negotiation;
   gboolean set_startid;
+  gchar *shm_name; /**< name of the shared memory (other process) */
+  GstTensorRepoShm *shm; /**< handle of the shared memory */
+  gboolean flushing; /**< true to stop waiting for the shared memory */
 };
 
 /**
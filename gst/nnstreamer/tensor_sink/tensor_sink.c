@@ -59,6 +59,7 @@ GST_DEBUG_CATEGORY_STATIC (gst_tensor_sink_debug);
 enum
 {
   SIGNAL_NEW_DATA,
+  SIGNAL_NEW_DATA_LIST,
   SIGNAL_STREAM_START,
   SIGNAL_EOS,
   LAST_SIGNAL
@@ -72,6 +73,8 @@ enum
   PROP_0,
   PROP_SIGNAL_RATE,
   PROP_EMIT_SIGNAL,
+  PROP_BATCH_SIZE,
+  PROP_BATCH_TIMEOUT,
   PROP_SILENT
 };
 
@@ -85,6 +88,21 @@ enum
  */
 #define DEFAULT_SIGNAL_RATE 0
 
+/**
+ * @brief Max number of buffers in a new-data-list signal (0 to disable batching).
+ */
+#define DEFAULT_BATCH_SIZE 0
+
+/**
+ * @brief Max batch size.
+ */
+#define MAX_BATCH_SIZE 1024
+
+/**
+ * @brief Max time (ms) to hold the buffers in the batch (0 for no limit).
+ */
+#define DEFAULT_BATCH_TIMEOUT 0
+
 /**
  * @brief Flag to print minimized log.
  */
@@ -124,6 +142,9 @@ static GstFlowReturn gst_tensor_sink_render (GstBaseSink * sink,
     GstBuffer * buffer);
 static GstFlowReturn gst_tensor_sink_render_list (GstBaseSink * sink,
     GstBufferList * buffer_list);
+static gboolean gst_tensor_sink_stop (GstBaseSink * sink);
+static gboolean gst_tensor_sink_unlock (GstBaseSink * sink);
+static gboolean gst_tensor_sink_unlock_stop (GstBaseSink * sink);
 
 /** internal functions */
 static void gst_tensor_sink_render_buffer (GstTensorSink * self,
@@ -136,6 +157,10 @@ static guint gst_tensor_sink_get_signal_rate (GstTensorSink * self);
 static void gst_tensor_sink_set_emit_signal (GstTensorSink * self,
     gboolean emit);
 static gboolean gst_tensor_sink_get_emit_signal (GstTensorSink * self);
+static gboolean gst_tensor_sink_push_batch (GstTensorSink * self,
+    GstBuffer * buffer);
+static void gst_tensor_sink_flush_batch (GstTensorSink * self, gboolean emit);
+static void gst_tensor_sink_stop_batch_thread (GstTensorSink * self);
 static void gst_tensor_sink_set_silent (GstTensorSink * self, gboolean silent);
 static gboolean gst_tensor_sink_get_silent (GstTensorSink * self);
 
@@ -189,6 +214,33 @@ gst_tensor_sink_class_init (GstTensorSinkClass * klass)
           "Emit signal for new data, stream start, eos", DEFAULT_EMIT_SIGNAL,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTensorSink::batch-size:
+   *
+   * The max number of buffers in a new-data-list signal (Default 0 to disable batching, MAX 1024).
+   * If batch-size is larger than 1, GstTensorSink collects the buffers and emits new-data-list signal with a GstBufferList, instead of new-data signal for each buffer.
+   * This reduces the cost of signal emission for high-rate streams.
+   */
+  g_object_class_install_property (gobject_class, PROP_BATCH_SIZE,
+      g_param_spec_uint ("batch-size", "Batch size",
+          "Max number of buffers in a new-data-list signal (0 or 1 to disable batching)",
+          0, MAX_BATCH_SIZE, DEFAULT_BATCH_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstTensorSink::batch-timeout:
+   *
+   * The max time in milliseconds to hold the buffers in the batch (Default 0 for no limit).
+   * GstTensorSink emits new-data-list signal with the collected buffers if the time of the first buffer in the batch exceeds this value.
+   * A timer starts with the first buffer of the batch, so the signal is emitted (in the timer thread of the element) even if no more buffer is received.
+   * The timer is canceled when the batch is passed, flushed or the element is stopped. The remaining buffers are passed at EOS.
+   */
+  g_object_class_install_property (gobject_class, PROP_BATCH_TIMEOUT,
+      g_param_spec_uint ("batch-timeout", "Batch timeout",
+          "Max time (ms) to hold the buffers in the batch (0 for no limit)",
+          0, G_MAXUINT, DEFAULT_BATCH_TIMEOUT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstTensorSink::silent:
    *
@@ -208,6 +260,17 @@ gst_tensor_sink_class_init (GstTensorSinkClass * klass)
       G_STRUCT_OFFSET (GstTensorSinkClass, new_data), NULL, NULL, NULL,
       G_TYPE_NONE, 1, GST_TYPE_BUFFER | G_SIGNAL_TYPE_STATIC_SCOPE);
 
+  /**
+   * GstTensorSink::new-data-list:
+   *
+   * Signal to get the list of buffers from GstTensorSink, if batch-size is larger than 1.
+   */
+  _tensor_sink_signals[SIGNAL_NEW_DATA_LIST] =
+      g_signal_new ("new-data-list", G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST, G_STRUCT_OFFSET (GstTensorSinkClass, new_data_list),
+      NULL, NULL, NULL, G_TYPE_NONE, 1,
+      GST_TYPE_BUFFER_LIST | G_SIGNAL_TYPE_STATIC_SCOPE);
+
   /**
    * GstTensorSink::stream-start:
    *
@@ -243,6 +306,9 @@ gst_tensor_sink_class_init (GstTensorSinkClass * klass)
   bsink_class->query = GST_DEBUG_FUNCPTR (gst_tensor_sink_query);
   bsink_class->render = GST_DEBUG_FUNCPTR (gst_tensor_sink_render);
   bsink_class->render_list = GST_DEBUG_FUNCPTR (gst_tensor_sink_render_list);
+  bsink_class->stop = GST_DEBUG_FUNCPTR (gst_tensor_sink_stop);
+  bsink_class->unlock = GST_DEBUG_FUNCPTR (gst_tensor_sink_unlock);
+  bsink_class->unlock_stop = GST_DEBUG_FUNCPTR (gst_tensor_sink_unlock_stop);
 }
 
 /**
@@ -256,12 +322,22 @@ gst_tensor_sink_init (GstTensorSink * self)
   bsink = GST_BASE_SINK (self);
 
   g_mutex_init (&self->mutex);
+  g_mutex_init (&self->batch_lock);
+  g_cond_init (&self->batch_cond);
+  g_queue_init (&self->batch_pending);
 
   /** init properties */
   self->silent = DEFAULT_SILENT;
   self->emit_signal = DEFAULT_EMIT_SIGNAL;
   self->signal_rate = DEFAULT_SIGNAL_RATE;
   self->last_render_time = GST_CLOCK_TIME_NONE;
+  self->batch_size = DEFAULT_BATCH_SIZE;
+  self->batch_timeout = DEFAULT_BATCH_TIMEOUT;
+  self->batch = NULL;
+  self->batch_deadline = 0;
+  self->batch_thread = NULL;
+  self->batch_emitter = NULL;
+  self->batch_flushing = FALSE;
 
   /** enable qos */
   gst_base_sink_set_qos_enabled (bsink, DEFAULT_QOS);
@@ -289,6 +365,18 @@ gst_tensor_sink_set_property (GObject * object, guint prop_id,
       gst_tensor_sink_set_emit_signal (self, g_value_get_boolean (value));
       break;
 
+    case PROP_BATCH_SIZE:
+      g_mutex_lock (&self->mutex);
+      self->batch_size = g_value_get_uint (value);
+      g_mutex_unlock (&self->mutex);
+      break;
+
+    case PROP_BATCH_TIMEOUT:
+      g_mutex_lock (&self->mutex);
+      self->batch_timeout = g_value_get_uint (value);
+      g_mutex_unlock (&self->mutex);
+      break;
+
     case PROP_SILENT:
       gst_tensor_sink_set_silent (self, g_value_get_boolean (value));
       break;
@@ -321,6 +409,18 @@ gst_tensor_sink_get_property (GObject * object, guint prop_id,
       g_value_set_boolean (value, gst_tensor_sink_get_emit_signal (self));
       break;
 
+    case PROP_BATCH_SIZE:
+      g_mutex_lock (&self->mutex);
+      g_value_set_uint (value, self->batch_size);
+      g_mutex_unlock (&self->mutex);
+      break;
+
+    case PROP_BATCH_TIMEOUT:
+      g_mutex_lock (&self->mutex);
+      g_value_set_uint (value, self->batch_timeout);
+      g_mutex_unlock (&self->mutex);
+      break;
+
     case PROP_SILENT:
       g_value_set_boolean (value, gst_tensor_sink_get_silent (self));
       break;
@@ -343,6 +443,9 @@ gst_tensor_sink_finalize (GObject * object)
 
   self = GST_TENSOR_SINK (object);
 
+  gst_tensor_sink_flush_batch (self, FALSE);
+  g_cond_clear (&self->batch_cond);
+  g_mutex_clear (&self->batch_lock);
   g_mutex_clear (&self->mutex);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -375,6 +478,9 @@ gst_tensor_sink_event (GstBaseSink * sink, GstEvent * event)
       break;
 
     case GST_EVENT_EOS:
+      /* pass the remaining buffers before eos */
+      gst_tensor_sink_flush_batch (self, TRUE);
+
       if (gst_tensor_sink_get_emit_signal (self)) {
         silent_debug ("Emit signal for eos");
 
@@ -382,6 +488,12 @@ gst_tensor_sink_event (GstBaseSink * sink, GstEvent * event)
       }
       break;
 
+    case GST_EVENT_FLUSH_START:
+    case GST_EVENT_FLUSH_STOP:
+      /* drop the buffers and cancel the timer */
+      gst_tensor_sink_flush_batch (self, FALSE);
+      break;
+
     default:
       break;
   }
@@ -461,6 +573,62 @@ gst_tensor_sink_render_list (GstBaseSink * sink, GstBufferList * buffer_list)
   return GST_FLOW_OK;
 }
 
+/**
+ * @brief Stop processing, drop the buffers in the batch.
+ *
+ * GstBaseSink method implementation.
+ */
+static gboolean
+gst_tensor_sink_stop (GstBaseSink * sink)
+{
+  GstTensorSink *self;
+
+  self = GST_TENSOR_SINK (sink);
+  gst_tensor_sink_stop_batch_thread (self);
+  gst_tensor_sink_flush_batch (self, FALSE);
+
+  return TRUE;
+}
+
+/**
+ * @brief Unlock the streaming thread waiting for the emission of new-data-list signal.
+ *
+ * GstBaseSink method implementation.
+ */
+static gboolean
+gst_tensor_sink_unlock (GstBaseSink * sink)
+{
+  GstTensorSink *self;
+
+  self = GST_TENSOR_SINK (sink);
+
+  g_mutex_lock (&self->batch_lock);
+  self->batch_flushing = TRUE;
+  g_cond_broadcast (&self->batch_cond);
+  g_mutex_unlock (&self->batch_lock);
+
+  return TRUE;
+}
+
+/**
+ * @brief Clear the unlock state.
+ *
+ * GstBaseSink method implementation.
+ */
+static gboolean
+gst_tensor_sink_unlock_stop (GstBaseSink * sink)
+{
+  GstTensorSink *self;
+
+  self = GST_TENSOR_SINK (sink);
+
+  g_mutex_lock (&self->batch_lock);
+  self->batch_flushing = FALSE;
+  g_mutex_unlock (&self->batch_lock);
+
+  return TRUE;
+}
+
 /**
  * @brief Handle buffer data.
  * @return None
@@ -509,6 +677,9 @@ gst_tensor_sink_render_buffer (GstTensorSink * self, GstBuffer * buffer)
     gst_tensor_sink_set_last_render_time (self, now);
 
     if (gst_tensor_sink_get_emit_signal (self)) {
+      if (gst_tensor_sink_push_batch (self, buffer))
+        return;
+
       silent_debug ("Emit signal for new data [%" GST_TIME_FORMAT "] rate [%d]",
           GST_TIME_ARGS (now), signal_rate);
 
@@ -517,6 +688,205 @@ gst_tensor_sink_render_buffer (GstTensorSink * self, GstBuffer * buffer)
   }
 }
 
+/**
+ * @brief Detach the batch, and add it to the pending queue (if emit is true) or drop the buffers.
+ * @note This should be called with the batch lock. The timer for batch-timeout is canceled.
+ */
+static void
+gst_tensor_sink_detach_batch (GstTensorSink * self, gboolean emit)
+{
+  GstBufferList *batch;
+
+  batch = self->batch;
+  self->batch = NULL;
+  self->batch_deadline = 0;
+
+  if (batch) {
+    if (emit && gst_buffer_list_length (batch) > 0)
+      g_queue_push_tail (&self->batch_pending, batch);
+    else
+      gst_buffer_list_unref (batch);
+  }
+}
+
+/**
+ * @brief Emit new-data-list signal with the pending batches.
+ * @note This should be called with the batch lock, which is released while emitting the signal.
+ * If another thread is emitting, the batches are passed by that thread to keep the order.
+ */
+static void
+gst_tensor_sink_emit_pending (GstTensorSink * self)
+{
+  GstBufferList *batch;
+
+  if (self->batch_emitter != NULL)
+    return;
+
+  self->batch_emitter = g_thread_self ();
+
+  while ((batch = g_queue_pop_head (&self->batch_pending)) != NULL) {
+    g_mutex_unlock (&self->batch_lock);
+
+    if (gst_tensor_sink_get_emit_signal (self)) {
+      silent_debug ("Emit signal for new data list [%u buffers]",
+          gst_buffer_list_length (batch));
+
+      g_signal_emit (self, _tensor_sink_signals[SIGNAL_NEW_DATA_LIST], 0,
+          batch);
+    }
+
+    gst_buffer_list_unref (batch);
+    g_mutex_lock (&self->batch_lock);
+  }
+
+  self->batch_emitter = NULL;
+  g_cond_broadcast (&self->batch_cond);
+}
+
+/**
+ * @brief Timer thread to emit new-data-list signal with the buffers in the batch when batch-timeout expires.
+ * @note The thread exits when it is replaced or stopped (see gst_tensor_sink_stop_batch_thread).
+ */
+static gpointer
+gst_tensor_sink_batch_thread (gpointer data)
+{
+  GstTensorSink *self = GST_TENSOR_SINK (data);
+  GThread *thread = g_thread_self ();
+
+  g_mutex_lock (&self->batch_lock);
+
+  while (self->batch_thread == thread) {
+    if (self->batch_deadline == 0) {
+      g_cond_wait (&self->batch_cond, &self->batch_lock);
+    } else if (g_get_monotonic_time () < self->batch_deadline) {
+      g_cond_wait_until (&self->batch_cond, &self->batch_lock,
+          self->batch_deadline);
+    } else {
+      gst_tensor_sink_detach_batch (self, TRUE);
+      gst_tensor_sink_emit_pending (self);
+    }
+  }
+
+  g_mutex_unlock (&self->batch_lock);
+
+  gst_object_unref (self);
+  return NULL;
+}
+
+/**
+ * @brief Stop the timer thread for batch-timeout.
+ * @note The signal handler may stop the element in the timer thread, the thread is not joined in this case.
+ */
+static void
+gst_tensor_sink_stop_batch_thread (GstTensorSink * self)
+{
+  GThread *thread;
+
+  g_mutex_lock (&self->batch_lock);
+  thread = self->batch_thread;
+  self->batch_thread = NULL;
+  g_cond_broadcast (&self->batch_cond);
+  g_mutex_unlock (&self->batch_lock);
+
+  if (thread) {
+    if (thread == g_thread_self ())
+      g_thread_unref (thread);
+    else
+      g_thread_join (thread);
+  }
+}
+
+/**
+ * @brief Add the buffer to the batch, and emit new-data-list signal if the batch is full or the timeout expires.
+ * @return TRUE if the buffer is added to the batch, FALSE if batching is disabled.
+ * @param self pointer to GstTensorSink
+ * @param buffer pointer to GstBuffer to be handled
+ */
+static gboolean
+gst_tensor_sink_push_batch (GstTensorSink * self, GstBuffer * buffer)
+{
+  guint batch_size, batch_timeout;
+  gint64 now;
+
+  g_mutex_lock (&self->mutex);
+  batch_size = self->batch_size;
+  batch_timeout = self->batch_timeout;
+  g_mutex_unlock (&self->mutex);
+
+  if (batch_size <= 1) {
+    /* batching is disabled, pass the remaining buffers first */
+    gst_tensor_sink_flush_batch (self, TRUE);
+    return FALSE;
+  }
+
+  now = g_get_monotonic_time ();
+
+  g_mutex_lock (&self->batch_lock);
+
+  if (self->batch == NULL) {
+    self->batch = gst_buffer_list_new_sized (batch_size);
+
+    if (batch_timeout > 0) {
+      if (self->batch_thread == NULL) {
+        self->batch_thread = g_thread_try_new ("tensor_sink_batch",
+            gst_tensor_sink_batch_thread, gst_object_ref (self), NULL);
+
+        if (self->batch_thread == NULL) {
+          GST_WARNING_OBJECT (self,
+              "Failed to start the timer thread for batch-timeout.");
+          gst_object_unref (self);
+        }
+      }
+
+      self->batch_deadline = now + (gint64) batch_timeout * 1000;
+      g_cond_broadcast (&self->batch_cond);
+    }
+  }
+
+  /* keep the reference, not copy the data */
+  gst_buffer_list_add (self->batch, gst_buffer_ref (buffer));
+
+  /* the timer may be late, check the deadline of the batch too */
+  if (gst_buffer_list_length (self->batch) >= batch_size ||
+      (self->batch_deadline > 0 && now >= self->batch_deadline)) {
+    gst_tensor_sink_detach_batch (self, TRUE);
+    gst_tensor_sink_emit_pending (self);
+  }
+
+  g_mutex_unlock (&self->batch_lock);
+  return TRUE;
+}
+
+/**
+ * @brief Emit new-data-list signal with the buffers in the batch (if emit is true), and clear the batch.
+ * @param self pointer to GstTensorSink
+ * @param emit true to emit the signal, false to drop the buffers
+ * @note The timer for batch-timeout is canceled. If emit is true, this returns after all the pending batches are passed (or the element is unlocked).
+ */
+static void
+gst_tensor_sink_flush_batch (GstTensorSink * self, gboolean emit)
+{
+  GstBufferList *batch;
+
+  g_mutex_lock (&self->batch_lock);
+
+  gst_tensor_sink_detach_batch (self, emit);
+
+  if (emit) {
+    gst_tensor_sink_emit_pending (self);
+
+    /* wait for the timer thread, the signals are passed in order */
+    while (self->batch_emitter != NULL &&
+        self->batch_emitter != g_thread_self () && !self->batch_flushing)
+      g_cond_wait (&self->batch_cond, &self->batch_lock);
+  } else {
+    while ((batch = g_queue_pop_head (&self->batch_pending)) != NULL)
+      gst_buffer_list_unref (batch);
+  }
+
+  g_mutex_unlock (&self->batch_lock);
+}
+
 /**
  * @brief Setter for value last_render_time.
  */
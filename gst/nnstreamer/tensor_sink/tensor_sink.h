@@ -61,6 +61,17 @@ struct _GstTensorSink
   gboolean emit_signal; /**< true to emit signal for new data, eos */
   guint signal_rate; /**< new data signals per second */
   GstClockTime last_render_time; /**< buffer rendered time */
+
+  guint batch_size; /**< max number of buffers in a new-data-list signal (0 or 1 to disable batching) */
+  guint batch_timeout; /**< max time (ms) to hold the buffers in the batch (0 for no limit) */
+  GMutex batch_lock; /**< lock for the batch (not held while emitting new-data-list signal) */
+  GCond batch_cond; /**< condition for the timer thread and the end of emission */
+  GstBufferList *batch; /**< buffers to be passed with new-data-list signal */
+  gint64 batch_deadline; /**< monotonic time (us) to pass the batch (0 if no timer is set) */
+  GThread *batch_thread; /**< timer thread to emit the batch when batch-timeout expires */
+  GQueue batch_pending; /**< batches to be emitted in order */
+  GThread *batch_emitter; /**< thread emitting the pending batches (NULL if none) */
+  gboolean batch_flushing; /**< true to stop waiting for the emission (unlock) */
 };
 
 /**
@@ -74,6 +85,7 @@ struct _GstTensorSinkClass
 
   /** signals */
   void (*new_data) (GstElement * element, GstBuffer * buffer); /**< signal when new data received */
+  void (*new_data_list) (GstElement * element, GstBufferList * list); /**< signal when the batch of new data is ready */
   void (*stream_start) (GstElement * element); /**< signal when stream started */
   void (*eos) (GstElement * element); /**< signal when end of stream reached */
 };
@@ -39,6 +39,10 @@
  * split.src_1 ! queue ! filesink location=src1.log
  * ]|
  *
+ * With the property axis, the tensor is split with the segments along the given axis.
+ * (e.g., axis=0 tensorseg=1:100:100,2:100:100 for the first channel and the others of RGB.)
+ * The segments in the flattened tensor (default) or along the outermost axis share the incoming memory without memcpy.
+ *
  * </refsect2>
  *
  */
@@ -63,7 +67,8 @@ enum
   PROP_0,
   PROP_SILENT,
   PROP_TENSORPICK,
-  PROP_TENSORSEG
+  PROP_TENSORSEG,
+  PROP_AXIS
 };
 
 /**
@@ -131,6 +136,11 @@ gst_tensor_split_class_init (GstTensorSplitClass * klass)
       g_param_spec_string ("tensorseg", "TensorSeg",
           "How to split tensor ?", "", G_PARAM_READWRITE));
 
+  g_object_class_install_property (gobject_class, PROP_AXIS,
+      g_param_spec_int ("axis", "Axis",
+          "The axis to split tensor with tensorseg, -1 to split the flattened tensor in order",
+          -1, NNS_TENSOR_RANK_LIMIT - 1, -1, G_PARAM_READWRITE));
+
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_tensor_split_change_state);
 
@@ -167,6 +177,7 @@ gst_tensor_split_init (GstTensorSplit * split)
   split->silent = TRUE;
   split->tensorpick = NULL;
   split->tensorseg = NULL;
+  split->axis = -1;
   split->have_group_id = FALSE;
   split->group_id = G_MAXUINT;
   split->srcpads = NULL;
@@ -220,6 +231,63 @@ gst_tensor_split_get_capsparam (GstTensorSplit * split, GstCaps * caps)
   return gst_tensor_config_from_structure (&split->sink_tensor_conf, st);
 }
 
+/**
+ * @brief Check the segments are in the incoming tensor.
+ * @param split GstTensorSplit Ojbect
+ * @return TRUE if the segments are valid
+ */
+static gboolean
+gst_tensor_split_check_segments (GstTensorSplit * split)
+{
+  uint32_t *in_dim;
+  tensor_dim *dim;
+  gsize total, limit;
+  guint i;
+  gint k;
+
+  if (split->tensorseg == NULL) {
+    /* no rule to split, chain function will handle this. */
+    return TRUE;
+  }
+
+  in_dim = split->sink_tensor_conf.info.dimension;
+  total = 0;
+
+  for (i = 0; i < split->tensorseg->len; i++) {
+    dim = g_array_index (split->tensorseg, tensor_dim *, i);
+
+    if (split->axis < 0) {
+      total += gst_tensor_get_element_count (*dim);
+      continue;
+    }
+
+    for (k = 0; k < NNS_TENSOR_RANK_LIMIT; k++) {
+      if (k != split->axis && (*dim)[k] != in_dim[k]) {
+        GST_ERROR_OBJECT (split,
+            "The dimension %d of %uth segment (%u) is different from the incoming tensor (%u).",
+            k, i, (*dim)[k], in_dim[k]);
+        return FALSE;
+      }
+    }
+
+    total += (*dim)[split->axis];
+  }
+
+  if (split->axis < 0)
+    limit = gst_tensor_get_element_count (in_dim);
+  else
+    limit = in_dim[split->axis];
+
+  if (total > limit) {
+    GST_ERROR_OBJECT (split,
+        "The segments (%" G_GSIZE_FORMAT ") exceed the incoming tensor (%"
+        G_GSIZE_FORMAT ").", total, limit);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief event function for sink (gst element vmethod)
  */
@@ -238,6 +306,9 @@ gst_tensor_split_event (GstPad * pad, GstObject * parent, GstEvent * event)
       if (!gst_tensor_split_get_capsparam (split, caps)) {
         GST_ELEMENT_ERROR (split, STREAM, WRONG_TYPE,
             ("This stream contains no valid type."), NULL);
+      } else if (!gst_tensor_split_check_segments (split)) {
+        GST_ELEMENT_ERROR (split, STREAM, WRONG_TYPE,
+            ("The segments do not fit the incoming tensor."), NULL);
       }
       break;
     }
@@ -402,6 +473,8 @@ done:
  * @param buffer gstbuffer form src
  * @param nth orther of tensor
  * @return return GstMemory for splited tensor
+ * @note The segment shares the incoming memory if it is contiguous (the flattened tensor or the outermost axis).
+ *       Otherwise (inner axis), the segment is copied with the stride of the axis.
  */
 static GstMemory *
 gst_tensor_split_get_splited (GstTensorSplit * split, GstBuffer * buffer,
@@ -409,26 +482,83 @@ gst_tensor_split_get_splited (GstTensorSplit * split, GstBuffer * buffer,
 {
   GstMemory *mem;
   tensor_dim *dim;
-  int i;
-  gsize size, offset;
+  uint32_t *in_dim;
+  gint i;
+  gsize element_size, size, offset, block, stride;
+  guint o, outer;
   GstMapInfo src_info, dest_info;
 
-  size = 0;
-  offset = 0;
+  in_dim = split->sink_tensor_conf.info.dimension;
+  element_size = gst_tensor_get_element_size (split->sink_tensor_conf.info.type);
+
   dim = g_array_index (split->tensorseg, tensor_dim *, nth);
+  size = gst_tensor_get_element_count (*dim) * element_size;
+  offset = 0;
+
+  if (split->axis < 0) {
+    /* consecutive segments in the flattened tensor */
+    for (i = 0; i < nth; i++) {
+      dim = g_array_index (split->tensorseg, tensor_dim *, i);
+      offset += gst_tensor_get_element_count (*dim);
+    }
+
+    offset *= element_size;
+    block = stride = size;
+    outer = 1;
+  } else {
+    gsize inner = element_size;
+
+    /* bytes of an element in the axis */
+    for (i = 0; i < split->axis; i++)
+      inner *= in_dim[i];
+
+    for (i = 0; i < nth; i++)
+      offset += (*g_array_index (split->tensorseg, tensor_dim *, i))[split->axis];
+
+    offset *= inner;
+    block = inner * (*dim)[split->axis];
+    stride = inner * in_dim[split->axis];
+
+    outer = 1;
+    for (i = split->axis + 1; i < NNS_TENSOR_RANK_LIMIT; i++)
+      outer *= in_dim[i];
+  }
+
+  if (offset + (outer - 1) * stride + block > gst_buffer_get_size (buffer)) {
+    GST_ERROR_OBJECT (split, "Invalid buffer size %" G_GSIZE_FORMAT
+        ", cannot get %dth tensor.", gst_buffer_get_size (buffer), nth);
+    return NULL;
+  }
+
+  if (outer == 1 && gst_buffer_n_memory (buffer) == 1) {
+    /* contiguous segment, no memcpy (copy below if the memory cannot be shared) */
+    mem = gst_buffer_peek_memory (buffer, 0);
+    if (!GST_MEMORY_IS_NO_SHARE (mem)) {
+      mem = gst_memory_share (mem, offset, size);
+      if (mem)
+        return mem;
+    }
+  }
 
-  size += gst_tensor_get_element_count (*dim) *
-      gst_tensor_get_element_size (split->sink_tensor_conf.info.type);
   mem = gst_allocator_alloc (NULL, size, NULL);
-  g_assert (gst_memory_map (mem, &dest_info, GST_MAP_WRITE));
-  g_assert (gst_buffer_map (buffer, &src_info, GST_MAP_READ));
+  if (!gst_memory_map (mem, &dest_info, GST_MAP_WRITE)) {
+    GST_ERROR_OBJECT (split, "Failed to map the memory for %dth tensor.", nth);
+    gst_memory_unref (mem);
+    return NULL;
+  }
 
-  for (i = 0; i < nth; i++) {
-    dim = g_array_index (split->tensorseg, tensor_dim *, i);
-    offset += gst_tensor_get_element_count (*dim);
+  if (!gst_buffer_map (buffer, &src_info, GST_MAP_READ)) {
+    GST_ERROR_OBJECT (split, "Failed to map the incoming buffer.");
+    gst_memory_unmap (mem, &dest_info);
+    gst_memory_unref (mem);
+    return NULL;
+  }
+
+  for (o = 0; o < outer; o++) {
+    nns_memcpy (dest_info.data + o * block,
+        src_info.data + offset + o * stride, block);
   }
 
-  nns_memcpy (dest_info.data, src_info.data + offset, size);
   gst_buffer_unmap (buffer, &src_info);
   gst_memory_unmap (mem, &dest_info);
 
@@ -452,6 +582,7 @@ gst_tensor_split_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
   if (split->tensorseg == NULL) {
     GST_ERROR_OBJECT (split, "No rule to split incoming buffers.");
+    gst_buffer_unref (buf);
     return GST_FLOW_ERROR;
   }
 
@@ -477,8 +608,13 @@ gst_tensor_split_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
     srcpad = gst_tensor_split_get_tensor_pad (split, buf, &created, i);
 
-    outbuf = gst_buffer_new ();
     mem = gst_tensor_split_get_splited (split, buf, i);
+    if (mem == NULL) {
+      res = GST_FLOW_ERROR;
+      break;
+    }
+
+    outbuf = gst_buffer_new ();
     gst_buffer_append_memory (outbuf, mem);
     ts = GST_BUFFER_TIMESTAMP (buf);
 
@@ -508,6 +644,7 @@ gst_tensor_split_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       break;
   }
 
+  gst_buffer_unref (buf);
   return res;
 }
 
@@ -602,6 +739,9 @@ gst_tensor_split_set_property (GObject * object, guint prop_id,
       g_strfreev (strv);
       break;
     }
+    case PROP_AXIS:
+      split->axis = g_value_get_int (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -683,6 +823,9 @@ gst_tensor_split_get_property (GObject * object, guint prop_id,
       }
       break;
     }
+    case PROP_AXIS:
+      g_value_set_int (value, split->axis);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
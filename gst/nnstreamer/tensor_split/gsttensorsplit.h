@@ -58,6 +58,7 @@ struct _GstTensorSplit
   guint32 num_srcpads;
   GList *tensorpick;
   GArray *tensorseg;
+  gint axis; /**< axis to split the tensor, -1 to split the flattened tensor */
   gboolean have_group_id;
   guint group_id;
   GstTensorConfig sink_tensor_conf;
@@ -22,22 +22,27 @@ NNSTREAMER_INCLUDES := \
 NNSTREAMER_COMMON_SRCS := \
     $(NNSTREAMER_GST_HOME)/nnstreamer_conf.c \
     $(NNSTREAMER_GST_HOME)/nnstreamer_subplugin.c \
-    $(NNSTREAMER_GST_HOME)/tensor_common.c
+    $(NNSTREAMER_GST_HOME)/tensor_common.c \
+    $(NNSTREAMER_GST_HOME)/tensor_record.c
 
 # nnstreamer plugins
 NNSTREAMER_PLUGINS_SRCS := \
     $(NNSTREAMER_GST_HOME)/nnstreamer.c \
     $(NNSTREAMER_GST_HOME)/tensor_converter/tensor_converter.c \
+    $(NNSTREAMER_GST_HOME)/tensor_converter/converter-video-convert.c \
     $(NNSTREAMER_GST_HOME)/tensor_aggregator/tensor_aggregator.c \
+    $(NNSTREAMER_GST_HOME)/tensor_crop/gsttensorcrop.c \
     $(NNSTREAMER_GST_HOME)/tensor_decoder/tensordec.c \
     $(NNSTREAMER_GST_HOME)/tensor_demux/gsttensordemux.c \
     $(NNSTREAMER_GST_HOME)/tensor_filter/tensor_filter.c \
     $(NNSTREAMER_GST_HOME)/tensor_filter/tensor_filter_common.c \
     $(NNSTREAMER_GST_HOME)/tensor_filter/tensor_filter_custom.c \
     $(NNSTREAMER_GST_HOME)/tensor_filter/tensor_filter_custom_easy.c \
+    $(NNSTREAMER_GST_HOME)/tensor_if/gsttensorif.c \
     $(NNSTREAMER_GST_HOME)/tensor_merge/gsttensormerge.c \
     $(NNSTREAMER_GST_HOME)/tensor_mux/gsttensormux.c \
     $(NNSTREAMER_GST_HOME)/tensor_repo/tensor_repo.c \
+    $(NNSTREAMER_GST_HOME)/tensor_repo/tensor_repo_shm.c \
     $(NNSTREAMER_GST_HOME)/tensor_repo/tensor_reposink.c \
     $(NNSTREAMER_GST_HOME)/tensor_repo/tensor_reposrc.c \
     $(NNSTREAMER_GST_HOME)/tensor_sink/tensor_sink.c \
@@ -375,6 +375,7 @@ export GST_PLUGIN_PATH=$(pwd)/build/gst/nnstreamer
 export NNSTREAMER_CONF=$(pwd)/build/nnstreamer-test.ini
 export NNSTREAMER_FILTERS=$(pwd)/build/ext/nnstreamer/tensor_filter
 export NNSTREAMER_DECODERS=$(pwd)/build/ext/nnstreamer/tensor_decoder
+export NNSTREAMER_CONVERTERS=$(pwd)/build/ext/nnstreamer/tensor_converter
 
 %define test_script $(pwd)/packaging/run_unittests_binaries.sh
 
@@ -472,6 +473,7 @@ cp -r result %{buildroot}%{_datadir}/nnstreamer/unittest/
 %defattr(-,root,root,-)
 %license LICENSE
 %{_prefix}/lib/nnstreamer/decoders/libnnstreamer_decoder_*.so
+%{_prefix}/lib/nnstreamer/converters/libnnstreamer_converter_*.so
 %{gstlibdir}/libnnstreamer.so
 %{_libdir}/libnnstreamer.so
 %{_sysconfdir}/nnstreamer.ini
@@ -508,6 +510,7 @@ cp -r result %{buildroot}%{_datadir}/nnstreamer/unittest/
 %{_includedir}/nnstreamer/nnstreamer_plugin_api_decoder.h
 %{_includedir}/nnstreamer/nnstreamer_plugin_api_converter.h
 %{_includedir}/nnstreamer/nnstreamer_plugin_api.h
+%{_includedir}/nnstreamer/tensor_record.h
 %{_libdir}/*.a
 %exclude %{_libdir}/libcapi*.a
 %{_libdir}/pkgconfig/nnstreamer.pc
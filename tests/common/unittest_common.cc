@@ -19,6 +19,7 @@
 #include <glib.h>
 #include <glib/gstdio.h>
 #include <nnstreamer_conf.h>
+#include <tensor_record.h>
 
 /**
  * @brief Test for int32 type string.
@@ -783,6 +784,166 @@ TEST (common_string_util, replace_str_02)
   g_free (result);
 }
 
+/**
+ * @brief Test for the stream header of tensor record.
+ */
+TEST (common_tensor_record, stream_header_p)
+{
+  GstTensorsConfig config, parsed;
+  GstTensorRecordStreamHeader header;
+
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 2;
+  config.info.info[0].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("3:224:224:1", config.info.info[0].dimension);
+  config.info.info[1].type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("10:1:1:1", config.info.info[1].dimension);
+  config.rate_n = 30;
+  config.rate_d = 1;
+
+  EXPECT_TRUE (gst_tensor_record_set_stream_header (&header, &config));
+  EXPECT_TRUE (gst_tensor_record_parse_stream_header ((const guint8 *) &header,
+          sizeof (header), &parsed));
+  EXPECT_TRUE (gst_tensors_config_is_equal (&config, &parsed));
+
+  /* invalid size and magic */
+  EXPECT_FALSE (gst_tensor_record_parse_stream_header ((const guint8 *) &header,
+          sizeof (header) - 1, &parsed));
+  header.magic = 0;
+  EXPECT_FALSE (gst_tensor_record_parse_stream_header ((const guint8 *) &header,
+          sizeof (header), &parsed));
+}
+
+/**
+ * @brief Test for the caps of tensor record.
+ */
+TEST (common_tensor_record, caps_p)
+{
+  GstTensorsConfig config, parsed;
+  GstCaps *caps;
+
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 1;
+  config.info.info[0].type = _NNS_INT16;
+  gst_tensor_parse_dimension ("1:16000:1:1", config.info.info[0].dimension);
+  config.rate_n = 10;
+  config.rate_d = 1;
+
+  caps = gst_tensor_record_caps_from_config (&config);
+  ASSERT_TRUE (caps != NULL);
+  EXPECT_TRUE (gst_structure_has_name (gst_caps_get_structure (caps, 0),
+          NNS_TENSOR_RECORD_MIMETYPE));
+
+  EXPECT_TRUE (gst_tensor_record_config_from_structure (&parsed,
+          gst_caps_get_structure (caps, 0)));
+  EXPECT_TRUE (gst_tensors_config_is_equal (&config, &parsed));
+  gst_caps_unref (caps);
+
+  /* other/tensors is not a recorded stream */
+  caps = gst_tensors_caps_from_config (&config);
+  EXPECT_FALSE (gst_tensor_record_config_from_structure (&parsed,
+          gst_caps_get_structure (caps, 0)));
+  gst_caps_unref (caps);
+}
+
+/**
+ * @brief Test for the options of time-sync mode latest.
+ */
+TEST (common_time_sync, latest_option_p)
+{
+  tensor_time_sync_data sync;
+
+  memset (&sync, 0, sizeof (sync));
+  sync.mode = gst_tensor_time_sync_get_mode ("latest");
+  EXPECT_EQ (sync.mode, SYNC_LATEST);
+  EXPECT_STREQ (gst_tensor_time_sync_get_mode_string (sync.mode), "latest");
+
+  /* default option, base pad 0 without staleness limit */
+  EXPECT_TRUE (gst_tensor_time_sync_set_option_data (&sync));
+  EXPECT_EQ (sync.data_latest.sink_id, 0U);
+  EXPECT_EQ (sync.data_latest.max_staleness, GST_CLOCK_TIME_NONE);
+
+  sync.option = g_strdup ("1:33333333");
+  EXPECT_TRUE (gst_tensor_time_sync_set_option_data (&sync));
+  EXPECT_EQ (sync.data_latest.sink_id, 1U);
+  EXPECT_EQ (sync.data_latest.max_staleness, 33333333U);
+  g_free (sync.option);
+
+  sync.option = g_strdup ("2");
+  EXPECT_TRUE (gst_tensor_time_sync_set_option_data (&sync));
+  EXPECT_EQ (sync.data_latest.sink_id, 2U);
+  EXPECT_EQ (sync.data_latest.max_staleness, GST_CLOCK_TIME_NONE);
+  g_free (sync.option);
+}
+
+/**
+ * @brief Test for the options of time-sync mode timeout.
+ */
+TEST (common_time_sync, timeout_option_p)
+{
+  tensor_time_sync_data sync;
+
+  memset (&sync, 0, sizeof (sync));
+  sync.mode = gst_tensor_time_sync_get_mode ("timeout");
+  EXPECT_EQ (sync.mode, SYNC_TIMEOUT);
+  EXPECT_STREQ (gst_tensor_time_sync_get_mode_string (sync.mode), "timeout");
+
+  /* default timeout */
+  EXPECT_TRUE (gst_tensor_time_sync_set_option_data (&sync));
+  EXPECT_EQ (sync.data_timeout.timeout, 100 * GST_MSECOND);
+  EXPECT_EQ (sync.timer.deadline, 0);
+
+  sync.option = g_strdup ("5000000");
+  EXPECT_TRUE (gst_tensor_time_sync_set_option_data (&sync));
+  EXPECT_EQ (sync.data_timeout.timeout, 5 * GST_MSECOND);
+  g_free (sync.option);
+}
+
+/**
+ * @brief Test for the timer armed with the old option, cancelled when the option is changed.
+ */
+TEST (common_time_sync, timeout_option_cancel_timer_p)
+{
+  tensor_time_sync_data sync;
+  guint seq;
+
+  memset (&sync, 0, sizeof (sync));
+  g_mutex_init (&sync.lock);
+  sync.mode = SYNC_TIMEOUT;
+
+  /* armed timer */
+  sync.timer.deadline = g_get_monotonic_time () + G_USEC_PER_SEC;
+  seq = sync.timer.seq;
+
+  sync.option = g_strdup ("5000000");
+  EXPECT_TRUE (gst_tensor_time_sync_set_option_data (&sync));
+  EXPECT_EQ (sync.data_timeout.timeout, 5 * GST_MSECOND);
+  EXPECT_EQ (sync.timer.deadline, 0);
+  EXPECT_NE (sync.timer.seq, seq);
+  g_free (sync.option);
+
+  /* the mode is changed while the timer is armed */
+  sync.timer.deadline = g_get_monotonic_time () + G_USEC_PER_SEC;
+  sync.mode = SYNC_SLOWEST;
+  sync.option = NULL;
+  EXPECT_FALSE (gst_tensor_time_sync_set_option_data (&sync));
+  EXPECT_EQ (sync.timer.deadline, 0);
+
+  g_mutex_clear (&sync.lock);
+}
+
+/**
+ * @brief Test for the basepad mode without option (no default option).
+ */
+TEST (common_time_sync, basepad_option_n)
+{
+  tensor_time_sync_data sync;
+
+  memset (&sync, 0, sizeof (sync));
+  sync.mode = SYNC_BASEPAD;
+  EXPECT_FALSE (gst_tensor_time_sync_set_option_data (&sync));
+}
+
 /**
  * @brief Create null files
  */
@@ -53,6 +53,11 @@ callCompareTest testcase2.con.log testcase2.dec.log 2 "Compare for case 2" 0 0
 gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"testsequence_%1d.png\" index=0 caps=\"image/png,framerate=\(fraction\)30/1\" ! pngdec ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tee name=t ! queue ! tensor_decoder mode=direct_video option1=\"nothing\" option2=\"else\" option3=\"matters\" option4=\"whattheheck=is\" option5=\"goingon=idontknow\" option6=\"whydowehave\" option7=\"somany\" option8=\"options\" option9=\"whydontyouguess\" ! filesink location=\"testcase3.dec.log\" sync=true t. ! queue ! filesink location=\"testcase3.con.log\" sync=true" 3 0 0 $PERFORMANCE
 callCompareTest testcase3.con.log testcase3.dec.log 3 "Compare for case 3" 0 0
 
+## Record the tensor stream and replay it (tensor_record)
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} multifilesrc location=\"testsequence_%1d.png\" index=0 caps=\"image/png,framerate=\(fraction\)30/1\" ! pngdec ! videoconvert ! video/x-raw, format=RGB ! tensor_converter ! tee name=t ! queue ! tensor_decoder mode=tensor_record ! filesink location=\"testcase5.nnsr\" sync=true t. ! queue ! filesink location=\"testcase5.con.log\" sync=true" 5-1 0 0 $PERFORMANCE
+gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} filesrc location=\"testcase5.nnsr\" ! typefind ! tensor_converter ! filesink location=\"testcase5.replay.log\" sync=true" 5-2 0 0 $PERFORMANCE
+callCompareTest testcase5.con.log testcase5.replay.log 5 "Compare for case 5" 0 0
+
 ## Trigger "decoder not configured"
 gstTest "--gst-plugin-path=${PATH_TO_PLUGIN} videotestsrc ! tensor_converter ! tensor_decoder mode=direct_video ! video/mpeg ! fakesink" 4F_n 0 1 $PERFORMANCE
 
@@ -103,3 +103,28 @@ for n in range(0,3):
 
 with open("batch.golden", 'wb') as file:
     file.write(out)
+
+#reduce the tensors elementwise
+ch = 3
+height= 50
+width= 100
+batch= 1
+
+buf=[]
+
+buf.append(np.array(saveTestData("reduce_0.dat", width, height, ch, batch), dtype=np.float32))
+buf.append(np.array(saveTestData("reduce_1.dat", width, height, ch, batch), dtype=np.float32))
+buf.append(np.array(saveTestData("reduce_2.dat", width, height, ch, batch), dtype=np.float32))
+
+reduce_sum = buf[0] + buf[1] + buf[2]
+reduce_mean = reduce_sum / np.float32(3)
+reduce_max = np.maximum(np.maximum(buf[0], buf[1]), buf[2])
+
+with open("reduce_sum.golden", 'wb') as file:
+    file.write(reduce_sum.astype(np.float32).tobytes())
+
+with open("reduce_mean.golden", 'wb') as file:
+    file.write(reduce_mean.astype(np.float32).tobytes())
+
+with open("reduce_max.golden", 'wb') as file:
+    file.write(reduce_max.astype(np.float32).tobytes())
@@ -8,16 +8,20 @@
  */
 
 #include <string.h>
+#include <unistd.h>
+#include <math.h>
 #include <gtest/gtest.h>
 #include <gst/gst.h>
 #include <gst/check/gstcheck.h>
 #include <gst/check/gsttestclock.h>
 #include <gst/check/gstharness.h>
+#include <gst/video/video.h>
 #include <glib/gstdio.h>
 #include <tensor_common.h>
 #include <nnstreamer_plugin_api_filter.h>
 
 #include "../gst/nnstreamer/tensor_transform/tensor_transform.h"
+#include "../gst/nnstreamer/tensor_repo/tensor_repo.h"
 
 /**
  * @brief Macro for debug mode.
@@ -1207,6 +1211,14 @@ TEST (test_tensor_aggregator, properties)
   g_object_get (h->element, "concat", &res_concat, NULL);
   EXPECT_EQ (res_concat, !concat);
 
+  /* default ring-buffer is FALSE */
+  g_object_get (h->element, "ring-buffer", &concat, NULL);
+  EXPECT_EQ (concat, FALSE);
+
+  g_object_set (h->element, "ring-buffer", !concat, NULL);
+  g_object_get (h->element, "ring-buffer", &res_concat, NULL);
+  EXPECT_EQ (res_concat, !concat);
+
   /* default silent is TRUE */
   g_object_get (h->element, "silent", &silent, NULL);
   EXPECT_EQ (silent, TRUE);
@@ -1584,6 +1596,2062 @@ TEST (test_tensor_aggregator, aggregate_5)
   gst_harness_teardown (h);
 }
 
+/**
+ * @brief Test for tensor_aggregator (sliding window in the ring buffer, frames-out 3 and frames-flush 1)
+ */
+TEST (test_tensor_aggregator, aggregate_ring_1)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorConfig config;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i, j;
+  guint64 copied;
+  gsize data_in_size, data_out_size;
+
+  h = gst_harness_new ("tensor_aggregator");
+
+  g_object_set (h->element, "frames-out", 3, "frames-flush", 1,
+      "frames-dim", 3, "ring-buffer", TRUE, NULL);
+
+  /* input tensor info */
+  config.info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("4:1:1:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+  data_in_size = gst_tensor_info_get_size (&config.info);
+  data_out_size = data_in_size * 3;
+
+  /* push 5 frames, 3 windows (0-2, 1-3, 2-4) */
+  for (i = 0; i < 5; i++) {
+    in_buf = gst_harness_create_buffer (h, data_in_size);
+
+    mem = gst_buffer_peek_memory (in_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+    memset (info.data, i + 1, data_in_size);
+
+    gst_memory_unmap (mem, &info);
+
+    GST_BUFFER_PTS (in_buf) = i * 10 * GST_MSECOND;
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 3U);
+
+  for (i = 0; i < 3; i++) {
+    out_buf = gst_harness_pull (h);
+
+    ASSERT_TRUE (out_buf != NULL);
+    ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+    ASSERT_EQ (gst_buffer_get_size (out_buf), data_out_size);
+    EXPECT_EQ (GST_BUFFER_PTS (out_buf), i * 10 * GST_MSECOND);
+
+    mem = gst_buffer_peek_memory (out_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+
+    for (j = 0; j < data_out_size; j++) {
+      EXPECT_EQ (info.data[j], i + 1 + j / data_in_size);
+    }
+
+    gst_memory_unmap (mem, &info);
+    gst_buffer_unref (out_buf);
+  }
+
+  /* each frame is copied once into the ring, each window is copied once */
+  g_object_get (h->element, "copied-bytes", &copied, NULL);
+  EXPECT_EQ (copied, (guint64) (data_in_size * 5 + data_out_size * 3));
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_aggregator (concatenate in the ring buffer with frames-dim 2, out-dimension 3:4:4:2)
+ */
+TEST (test_tensor_aggregator, aggregate_ring_2)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorConfig config;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i;
+  gsize data_in_size, data_out_size;
+
+  h = gst_harness_new ("tensor_aggregator");
+
+  g_object_set (h->element, "frames-out", 2, "frames-dim", 2,
+      "ring-buffer", TRUE, NULL);
+
+  /* input tensor info */
+  config.info.type = _NNS_INT32;
+  gst_tensor_parse_dimension ("3:4:2:2", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+  data_in_size = gst_tensor_info_get_size (&config.info);
+
+  gst_tensor_parse_dimension ("3:4:4:2", config.info.dimension);
+  data_out_size = gst_tensor_info_get_size (&config.info);
+
+  /* push buffers */
+  for (i = 0; i < 2; i++) {
+    in_buf = gst_harness_create_buffer (h, data_in_size);
+
+    mem = gst_buffer_peek_memory (in_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+    memcpy (info.data, aggr_test_frames[i], data_in_size);
+
+    gst_memory_unmap (mem, &info);
+
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), data_out_size);
+
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+
+  const gint expected[96] = {
+    1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
+    1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+    2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112,
+    2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124,
+    1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,
+    1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+    2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212,
+    2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224
+  };
+
+  for (i = 0; i < 96; i++) {
+    EXPECT_EQ (((gint *) info.data)[i], expected[i]);
+  }
+
+  gst_memory_unmap (mem, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_aggregator (frames-flush is larger than frames-out, same result with the ring buffer)
+ */
+TEST (test_tensor_aggregator, aggregate_flush_over_out)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorConfig config;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i, j, k;
+  guint64 copied;
+  gsize frame_size;
+  gboolean ring;
+  /* the first frames of the windows, frames 3 and 6 are skipped but frames 4 and 7 are not */
+  const guint8 expected[3] = { 1, 4, 7 };
+
+  for (k = 0; k < 2; k++) {
+    ring = (k == 1);
+
+    h = gst_harness_new ("tensor_aggregator");
+
+    g_object_set (h->element, "frames-in", 4, "frames-out", 2,
+        "frames-flush", 3, "frames-dim", 3, "ring-buffer", ring, NULL);
+
+    /* input tensor info, 4 frames in a buffer */
+    config.info.type = _NNS_UINT8;
+    gst_tensor_parse_dimension ("4:1:1:4", config.info.dimension);
+    config.rate_n = 0;
+    config.rate_d = 1;
+
+    gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+    frame_size = gst_tensor_info_get_size (&config.info) / 4;
+
+    /* push 2 buffers, the frames 1 to 8 */
+    for (i = 0; i < 2; i++) {
+      in_buf = gst_harness_create_buffer (h, frame_size * 4);
+
+      mem = gst_buffer_peek_memory (in_buf, 0);
+      ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+
+      for (j = 0; j < 4; j++)
+        memset (info.data + j * frame_size, i * 4 + j + 1, frame_size);
+
+      gst_memory_unmap (mem, &info);
+
+      EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+    }
+
+    EXPECT_EQ (gst_harness_buffers_received (h), 3U);
+
+    for (i = 0; i < 3; i++) {
+      out_buf = gst_harness_pull (h);
+
+      ASSERT_TRUE (out_buf != NULL);
+      ASSERT_EQ (gst_buffer_get_size (out_buf), frame_size * 2);
+
+      ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+      for (j = 0; j < frame_size * 2; j++) {
+        EXPECT_EQ (info.data[j], expected[i] + j / frame_size);
+      }
+      gst_buffer_unmap (out_buf, &info);
+      gst_buffer_unref (out_buf);
+    }
+
+    g_object_get (h->element, "copied-bytes", &copied, NULL);
+    if (ring) {
+      /* 6 frames are copied into the ring, 3 windows are written */
+      EXPECT_EQ (copied, (guint64) (frame_size * 6 + frame_size * 2 * 3));
+    } else {
+      /* only the 2nd window spans the incoming buffers and is merged */
+      EXPECT_EQ (copied, (guint64) (frame_size * 2));
+    }
+
+    gst_harness_teardown (h);
+  }
+}
+
+/**
+ * @brief Test for tensor_aggregator (aggregate each tensor of other/tensors in lockstep)
+ */
+TEST (test_tensor_aggregator, aggregate_tensors_1)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorsConfig config;
+  GstCaps *caps;
+  GstMemory *mem;
+  GstMapInfo info;
+  guint i, j;
+  gsize size_0, size_1;
+
+  h = gst_harness_new ("tensor_aggregator");
+
+  g_object_set (h->element, "frames-out", 2, "frames-flush", 1,
+      "frames-dim", 1, NULL);
+
+  /* input tensors info (int32 4:1 and uint8 2:1) */
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 2;
+  config.info.info[0].type = _NNS_INT32;
+  gst_tensor_parse_dimension ("4:1:1:1", config.info.info[0].dimension);
+  config.info.info[1].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("2:1:1:1", config.info.info[1].dimension);
+  config.rate_n = 10;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensors_caps_from_config (&config));
+  size_0 = gst_tensor_info_get_size (&config.info.info[0]);
+  size_1 = gst_tensor_info_get_size (&config.info.info[1]);
+
+  /* push 3 buffers, 2 outgoing buffers (frame 0-1, 1-2) */
+  for (i = 0; i < 3; i++) {
+    in_buf = gst_buffer_new ();
+
+    mem = gst_allocator_alloc (NULL, size_0, NULL);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+    for (j = 0; j < 4; j++)
+      ((gint *) info.data)[j] = (i + 1) * 100 + j;
+    gst_memory_unmap (mem, &info);
+    gst_buffer_append_memory (in_buf, mem);
+
+    mem = gst_allocator_alloc (NULL, size_1, NULL);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+    memset (info.data, i + 1, size_1);
+    gst_memory_unmap (mem, &info);
+    gst_buffer_append_memory (in_buf, mem);
+
+    GST_BUFFER_PTS (in_buf) = i * 100 * GST_MSECOND;
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 2U);
+
+  /* out caps (other/tensors, 4:2 and 2:2) */
+  caps = gst_pad_get_current_caps (h->sinkpad);
+  ASSERT_TRUE (caps != NULL);
+  EXPECT_TRUE (gst_structure_has_name (gst_caps_get_structure (caps, 0),
+          "other/tensors"));
+  EXPECT_TRUE (gst_tensors_config_from_structure (&config,
+          gst_caps_get_structure (caps, 0)));
+  EXPECT_EQ (config.info.num_tensors, 2U);
+  EXPECT_EQ (config.info.info[0].dimension[1], 2U);
+  EXPECT_EQ (config.info.info[1].dimension[1], 2U);
+  gst_caps_unref (caps);
+
+  for (i = 0; i < 2; i++) {
+    out_buf = gst_harness_pull (h);
+
+    ASSERT_TRUE (out_buf != NULL);
+    ASSERT_EQ (gst_buffer_n_memory (out_buf), 2U);
+    EXPECT_EQ (GST_BUFFER_PTS (out_buf), i * 100 * GST_MSECOND);
+
+    mem = gst_buffer_peek_memory (out_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+    ASSERT_EQ (info.size, size_0 * 2);
+    for (j = 0; j < 8; j++) {
+      EXPECT_EQ (((gint *) info.data)[j], (gint) ((i + 1 + j / 4) * 100 + j % 4));
+    }
+    gst_memory_unmap (mem, &info);
+
+    mem = gst_buffer_peek_memory (out_buf, 1);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+    ASSERT_EQ (info.size, size_1 * 2);
+    for (j = 0; j < 4; j++) {
+      EXPECT_EQ (info.data[j], i + 1 + j / 2);
+    }
+    gst_memory_unmap (mem, &info);
+
+    gst_buffer_unref (out_buf);
+  }
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_if (max of the tensor, passthrough and skip)
+ */
+TEST (test_tensor_if, max_value_passthrough_p)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorConfig config;
+  GstMemory *mem, *in_mem;
+  GstMapInfo info;
+  guint i, b;
+  gsize data_size;
+  const gfloat peaks[4] = { 0.5f, 0.9f, 0.25f, 0.7f };
+
+  h = gst_harness_new_with_padnames ("tensor_if", "sink", "src_0");
+
+  g_object_set (h->element, "compared-value", "TENSOR_MAX_VALUE",
+      "compared-value-option", "0", "operator", "GT", "supplied-value", "0.6",
+      "then", "PASSTHROUGH", "else", "SKIP", NULL);
+
+  /* input tensor info (float32 10) */
+  gst_tensor_config_init (&config);
+  config.info.type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("10:1:1:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+  data_size = gst_tensor_info_get_size (&config.info);
+
+  for (b = 0; b < 4; b++) {
+    in_buf = gst_harness_create_buffer (h, data_size);
+    in_mem = gst_buffer_peek_memory (in_buf, 0);
+
+    ASSERT_TRUE (gst_memory_map (in_mem, &info, GST_MAP_WRITE));
+    for (i = 0; i < 10; i++)
+      ((gfloat *) info.data)[i] = (i == 7) ? peaks[b] : 0.1f * (i % 3);
+    gst_memory_unmap (in_mem, &info);
+
+    GST_BUFFER_PTS (in_buf) = b * 100 * GST_MSECOND;
+    GST_BUFFER_DURATION (in_buf) = 100 * GST_MSECOND;
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+    if (peaks[b] > 0.6f) {
+      /* the incoming memory is pushed to then pad */
+      out_buf = gst_harness_pull (h);
+      ASSERT_TRUE (out_buf != NULL);
+      ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+      EXPECT_EQ (GST_BUFFER_PTS (out_buf), b * 100 * GST_MSECOND);
+
+      mem = gst_buffer_peek_memory (out_buf, 0);
+      EXPECT_TRUE (mem == in_mem);
+
+      ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+      EXPECT_FLOAT_EQ (((gfloat *) info.data)[7], peaks[b]);
+      gst_memory_unmap (mem, &info);
+
+      gst_buffer_unref (out_buf);
+    }
+  }
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 2U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_if (count of the elements, tensorpick with other/tensors)
+ */
+TEST (test_tensor_if, count_tensorpick_p)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstTensorsConfig config;
+  GstCaps *caps;
+  GstMemory *mem, *picked;
+  GstMapInfo info;
+  guint i, b;
+  gsize size_0, size_1;
+
+  h = gst_harness_new_with_padnames ("tensor_if", "sink", "src_1");
+
+  /* else branch gets the 2nd tensor if less than 3 elements are over 100 */
+  g_object_set (h->element, "compared-value", "TENSOR_COUNT",
+      "compared-value-option", "0,100", "operator", "GE", "supplied-value", "3",
+      "then", "SKIP", "else", "TENSORPICK", "else-option", "1", NULL);
+
+  /* input tensors info (uint8 20 and int32 4) */
+  gst_tensors_config_init (&config);
+  config.info.num_tensors = 2;
+  config.info.info[0].type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("20:1:1:1", config.info.info[0].dimension);
+  config.info.info[1].type = _NNS_INT32;
+  gst_tensor_parse_dimension ("4:1:1:1", config.info.info[1].dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensors_caps_from_config (&config));
+  size_0 = gst_tensor_info_get_size (&config.info.info[0]);
+  size_1 = gst_tensor_info_get_size (&config.info.info[1]);
+
+  /* the number of elements over 100 is b + 1 */
+  for (b = 0; b < 4; b++) {
+    in_buf = gst_buffer_new ();
+
+    mem = gst_allocator_alloc (NULL, size_0, NULL);
+    ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_WRITE));
+    for (i = 0; i < 20; i++)
+      info.data[i] = (i <= b) ? 200 : 100;
+    gst_memory_unmap (mem, &info);
+    gst_buffer_append_memory (in_buf, mem);
+
+    picked = gst_allocator_alloc (NULL, size_1, NULL);
+    ASSERT_TRUE (gst_memory_map (picked, &info, GST_MAP_WRITE));
+    for (i = 0; i < 4; i++)
+      ((gint *) info.data)[i] = b * 10 + i;
+    gst_memory_unmap (picked, &info);
+    gst_buffer_append_memory (in_buf, picked);
+
+    GST_BUFFER_PTS (in_buf) = b * 100 * GST_MSECOND;
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+    if (b < 2) {
+      out_buf = gst_harness_pull (h);
+      ASSERT_TRUE (out_buf != NULL);
+      ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+      EXPECT_EQ (GST_BUFFER_PTS (out_buf), b * 100 * GST_MSECOND);
+
+      /* the memory of the 2nd tensor is shared */
+      mem = gst_buffer_peek_memory (out_buf, 0);
+      EXPECT_TRUE (mem == picked);
+
+      ASSERT_TRUE (gst_memory_map (mem, &info, GST_MAP_READ));
+      for (i = 0; i < 4; i++)
+        EXPECT_EQ (((gint *) info.data)[i], (gint) (b * 10 + i));
+      gst_memory_unmap (mem, &info);
+
+      gst_buffer_unref (out_buf);
+    }
+  }
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 2U);
+
+  /* out caps (other/tensors, int32 4) */
+  caps = gst_pad_get_current_caps (h->sinkpad);
+  ASSERT_TRUE (caps != NULL);
+  EXPECT_TRUE (gst_tensors_config_from_structure (&config,
+          gst_caps_get_structure (caps, 0)));
+  EXPECT_EQ (config.info.num_tensors, 1U);
+  EXPECT_EQ (config.info.info[0].type, _NNS_INT32);
+  EXPECT_EQ (config.info.info[0].dimension[0], 4U);
+  gst_caps_unref (caps);
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_if (an element of the tensor with range operator)
+ */
+TEST (test_tensor_if, a_value_range_p)
+{
+  GstHarness *h;
+  GstBuffer *in_buf;
+  GstTensorConfig config;
+  GstMapInfo info;
+  guint b;
+  gsize data_size;
+
+  h = gst_harness_new_with_padnames ("tensor_if", "sink", "src_0");
+
+  /* element (1,2) of int16 3:4 tensor in [-5, 5] */
+  g_object_set (h->element, "compared-value", "A_VALUE",
+      "compared-value-option", "1:2:0:0,0", "operator", "RANGE_INCLUSIVE",
+      "supplied-value", "-5,5", NULL);
+
+  gst_tensor_config_init (&config);
+  config.info.type = _NNS_INT16;
+  gst_tensor_parse_dimension ("3:4:1:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+  data_size = gst_tensor_info_get_size (&config.info);
+
+  /* values -6, -5, 5, 6 */
+  for (b = 0; b < 4; b++) {
+    in_buf = gst_harness_create_buffer (h, data_size);
+
+    ASSERT_TRUE (gst_buffer_map (in_buf, &info, GST_MAP_WRITE));
+    memset (info.data, 0, data_size);
+    ((gint16 *) info.data)[2 * 3 + 1] = (b < 2) ? (b - 6) : (b + 3);
+    gst_buffer_unmap (in_buf, &info);
+
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 2U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_if (range operator without two supplied values)
+ */
+TEST (test_tensor_if, invalid_supplied_value_n)
+{
+  GstHarness *h;
+  GstBuffer *in_buf;
+  GstTensorConfig config;
+
+  h = gst_harness_new_with_padnames ("tensor_if", "sink", "src_0");
+
+  g_object_set (h->element, "compared-value", "TENSOR_AVERAGE_VALUE",
+      "operator", "RANGE_EXCLUSIVE", "supplied-value", "10", NULL);
+
+  gst_tensor_config_init (&config);
+  config.info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("4:1:1:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+
+  in_buf = gst_harness_create_buffer (h, gst_tensor_info_get_size (&config.info));
+  EXPECT_NE (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 0U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Data to push a buffer into the raw pad of tensor_crop.
+ */
+typedef struct
+{
+  GstHarness *h; /**< harness of the raw pad */
+  GstBuffer *buf; /**< buffer to be pushed */
+  GstFlowReturn ret; /**< return of the pushed buffer */
+} test_crop_push_data;
+
+/**
+ * @brief Thread to push a buffer (collect pads waits for the buffer of info pad).
+ */
+static gpointer
+test_crop_push_thread (gpointer user_data)
+{
+  test_crop_push_data *data = (test_crop_push_data *) user_data;
+
+  data->ret = gst_harness_push (data->h, data->buf);
+  return NULL;
+}
+
+/**
+ * @brief Push the raw frame (4x4, gray) and the boxes into tensor_crop.
+ */
+static void
+test_crop_push_frame (GstHarness * h_raw, GstHarness * h_info,
+    const gfloat * boxes, guint num_boxes)
+{
+  test_crop_push_data data;
+  GstBuffer *info_buf;
+  GstMapInfo map;
+  GThread *thread;
+  guint i;
+
+  data.h = h_raw;
+  data.buf = gst_harness_create_buffer (h_raw, 16);
+  data.ret = GST_FLOW_ERROR;
+
+  ASSERT_TRUE (gst_buffer_map (data.buf, &map, GST_MAP_WRITE));
+  for (i = 0; i < 16; i++)
+    map.data[i] = i;
+  gst_buffer_unmap (data.buf, &map);
+
+  info_buf = gst_harness_create_buffer (h_info, num_boxes * 4 * sizeof (gfloat));
+  ASSERT_TRUE (gst_buffer_map (info_buf, &map, GST_MAP_WRITE));
+  memcpy (map.data, boxes, num_boxes * 4 * sizeof (gfloat));
+  gst_buffer_unmap (info_buf, &map);
+
+  thread = g_thread_new ("crop_push", test_crop_push_thread, &data);
+  EXPECT_EQ (gst_harness_push (h_info, info_buf), GST_FLOW_OK);
+  g_thread_join (thread);
+
+  EXPECT_EQ (data.ret, GST_FLOW_OK);
+}
+
+/**
+ * @brief Test for tensor_crop (crop the regions of the boxes, uint8 4x4)
+ */
+TEST (test_tensor_crop, crop_boxes_p)
+{
+  GstHarness *h, *h_info;
+  GstBuffer *out_buf;
+  GstMemory *mem;
+  GstMapInfo map;
+  GstTensorConfig config;
+  /* x, y, w, h (the last row is padding) */
+  const gfloat boxes[] = { 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0 };
+  const guint8 expected[] = { 0, 1, 4, 5, 10, 11, 14, 15 };
+  guint i;
+
+  h = gst_harness_new_with_padnames ("tensor_crop", "raw", "src");
+  h_info = gst_harness_new_with_element (h->element, "info", NULL);
+
+  g_object_set (h->element, "size", "2:2", "max-crops", 4, NULL);
+
+  /* raw frame [1:4:4:1] */
+  gst_tensor_config_init (&config);
+  config.info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("1:4:4:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+
+  /* boxes [4:3:1:1] */
+  config.info.type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("4:3:1:1", config.info.dimension);
+  gst_harness_set_src_caps (h_info, gst_tensor_caps_from_config (&config));
+
+  test_crop_push_frame (h, h_info, boxes, 3);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 2U);
+
+  /* crops [1:2:2:4], the unused slots are filled with zero */
+  mem = gst_buffer_peek_memory (out_buf, 0);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+  ASSERT_EQ (map.size, 16U);
+  for (i = 0; i < 8; i++)
+    EXPECT_EQ (map.data[i], expected[i]);
+  for (i = 8; i < 16; i++)
+    EXPECT_EQ (map.data[i], 0);
+  gst_memory_unmap (mem, &map);
+
+  /* the number of crops */
+  mem = gst_buffer_peek_memory (out_buf, 1);
+  ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+  EXPECT_EQ (*((guint32 *) map.data), 2U);
+  gst_memory_unmap (mem, &map);
+
+  gst_buffer_unref (out_buf);
+  gst_harness_teardown (h_info);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_crop (non-finite boxes are ignored, max-crops is fixed after negotiation)
+ */
+TEST (test_tensor_crop, non_finite_boxes_p)
+{
+  GstHarness *h, *h_info;
+  GstBuffer *out_buf;
+  GstMemory *mem;
+  GstMapInfo map;
+  GstTensorConfig config;
+  gfloat boxes[12] = { 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2 };
+  guint i;
+
+  /* x of the first box is NaN, w of the second box is infinite */
+  boxes[0] = NAN;
+  boxes[6] = INFINITY;
+
+  h = gst_harness_new_with_padnames ("tensor_crop", "raw", "src");
+  h_info = gst_harness_new_with_element (h->element, "info", NULL);
+
+  g_object_set (h->element, "size", "2:2", "max-crops", 2, NULL);
+
+  gst_tensor_config_init (&config);
+  config.info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("1:4:4:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+
+  config.info.type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("4:3:1:1", config.info.dimension);
+  gst_harness_set_src_caps (h_info, gst_tensor_caps_from_config (&config));
+
+  for (i = 0; i < 2; i++) {
+    test_crop_push_frame (h, h_info, boxes, 3);
+
+    out_buf = gst_harness_pull (h);
+    ASSERT_TRUE (out_buf != NULL);
+    ASSERT_EQ (gst_buffer_n_memory (out_buf), 2U);
+
+    /* crops [1:2:2:2] with the negotiated max-crops */
+    mem = gst_buffer_peek_memory (out_buf, 0);
+    ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+    EXPECT_EQ (map.size, 8U);
+    EXPECT_EQ (map.data[0], 10);
+    EXPECT_EQ (map.data[3], 15);
+    gst_memory_unmap (mem, &map);
+
+    /* only the last box is valid */
+    mem = gst_buffer_peek_memory (out_buf, 1);
+    ASSERT_TRUE (gst_memory_map (mem, &map, GST_MAP_READ));
+    EXPECT_EQ (*((guint32 *) map.data), 1U);
+    gst_memory_unmap (mem, &map);
+
+    gst_buffer_unref (out_buf);
+
+    /* not applied until the element is negotiated again */
+    g_object_set (h->element, "max-crops", 16, NULL);
+  }
+
+  gst_harness_teardown (h_info);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_crop (drop the frame without valid box)
+ */
+TEST (test_tensor_crop, no_boxes_p)
+{
+  GstHarness *h, *h_info;
+  GstTensorConfig config;
+  /* boxes out of the frame or empty */
+  const gfloat boxes[] = { 5, 5, 2, 2, 1, 1, 0, 2 };
+
+  h = gst_harness_new_with_padnames ("tensor_crop", "raw", "src");
+  h_info = gst_harness_new_with_element (h->element, "info", NULL);
+
+  g_object_set (h->element, "size", "2:2", NULL);
+
+  gst_tensor_config_init (&config);
+  config.info.type = _NNS_UINT8;
+  gst_tensor_parse_dimension ("1:4:4:1", config.info.dimension);
+  config.rate_n = 0;
+  config.rate_d = 1;
+  gst_harness_set_src_caps (h, gst_tensor_caps_from_config (&config));
+
+  config.info.type = _NNS_FLOAT32;
+  gst_tensor_parse_dimension ("4:2:1:1", config.info.dimension);
+  gst_harness_set_src_caps (h_info, gst_tensor_caps_from_config (&config));
+
+  test_crop_push_frame (h, h_info, boxes, 2);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 0U);
+
+  gst_harness_teardown (h_info);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Push a buffer with a value into the repository slot.
+ */
+static gboolean
+test_repo_push_value (guint slot, guint8 value)
+{
+  GstBuffer *buf;
+  GstCaps *caps;
+  gboolean ret;
+
+  buf = gst_buffer_new_allocate (NULL, 1, NULL);
+  gst_buffer_memset (buf, 0, value, 1);
+  caps = gst_caps_from_string ("other/tensor,dimension=(string)1:1:1:1,"
+      "type=(string)uint8,framerate=(fraction)0/1");
+
+  ret = gst_tensor_repo_set_buffer (slot, slot, buf, caps);
+
+  gst_caps_unref (caps);
+  gst_buffer_unref (buf);
+  return ret;
+}
+
+/**
+ * @brief Pull a buffer from the repository slot and get the value.
+ */
+static guint8
+test_repo_pull_value (guint slot)
+{
+  GstBuffer *buf;
+  gboolean eos = FALSE;
+  guint newid;
+  guint8 value = 0;
+
+  buf = gst_tensor_repo_get_buffer (slot, slot, &eos, &newid);
+  if (buf) {
+    gst_buffer_extract (buf, 0, &value, 1);
+    gst_buffer_unref (buf);
+  }
+
+  return value;
+}
+
+/**
+ * @brief Test for tensor_repo (the queue of slot with the drop policies)
+ */
+TEST (test_tensor_repo, drop_policy_p)
+{
+  const guint slot = 100;
+  guint level;
+  guint64 pushed, dropped;
+
+  gst_tensor_repo_init ();
+  ASSERT_TRUE (gst_tensor_repo_add_repodata (slot, TRUE));
+
+  /* drop the oldest buffer */
+  EXPECT_TRUE (gst_tensor_repo_set_queue (slot, 2, REPO_POLICY_DROP_OLDEST));
+  EXPECT_TRUE (test_repo_push_value (slot, 1));
+  EXPECT_TRUE (test_repo_push_value (slot, 2));
+  EXPECT_TRUE (test_repo_push_value (slot, 3));
+
+  EXPECT_TRUE (gst_tensor_repo_get_stats (slot, &level, &pushed, &dropped));
+  EXPECT_EQ (level, 2U);
+  EXPECT_EQ (pushed, 3U);
+  EXPECT_EQ (dropped, 1U);
+
+  EXPECT_EQ (test_repo_pull_value (slot), 2);
+  EXPECT_EQ (test_repo_pull_value (slot), 3);
+
+  /* drop the incoming buffer */
+  EXPECT_TRUE (gst_tensor_repo_set_queue (slot, 2, REPO_POLICY_DROP_NEWEST));
+  EXPECT_TRUE (test_repo_push_value (slot, 4));
+  EXPECT_TRUE (test_repo_push_value (slot, 5));
+  EXPECT_TRUE (test_repo_push_value (slot, 6));
+
+  EXPECT_TRUE (gst_tensor_repo_get_stats (slot, &level, &pushed, &dropped));
+  EXPECT_EQ (level, 2U);
+  EXPECT_EQ (pushed, 5U);
+  EXPECT_EQ (dropped, 2U);
+
+  EXPECT_EQ (test_repo_pull_value (slot), 4);
+  EXPECT_EQ (test_repo_pull_value (slot), 5);
+
+  EXPECT_TRUE (gst_tensor_repo_get_stats (slot, &level, NULL, NULL));
+  EXPECT_EQ (level, 0U);
+
+  EXPECT_TRUE (gst_tensor_repo_remove_repodata (slot));
+}
+
+/**
+ * @brief Test for tensor_repo (hand off the buffer without memcpy)
+ */
+TEST (test_tensor_repo, handoff_p)
+{
+  const guint slot = 102;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo map;
+  GstCaps *caps;
+  gboolean eos = FALSE;
+  guint newid;
+
+  gst_tensor_repo_init ();
+  ASSERT_TRUE (gst_tensor_repo_add_repodata (slot, TRUE));
+
+  /* lstm state [4:4:4:1] float32 */
+  in_buf = gst_buffer_new_allocate (NULL, 256, NULL);
+  gst_buffer_memset (in_buf, 0, 1, 256);
+  caps = gst_caps_from_string ("other/tensor,dimension=(string)4:4:4:1,"
+      "type=(string)float32,framerate=(fraction)0/1");
+
+  EXPECT_TRUE (gst_tensor_repo_set_buffer (slot, slot, in_buf, caps));
+  out_buf = gst_tensor_repo_get_buffer (slot, slot, &eos, &newid);
+  ASSERT_TRUE (out_buf != NULL);
+
+  /* the memory is shared */
+  EXPECT_TRUE (gst_buffer_peek_memory (out_buf, 0) ==
+      gst_buffer_peek_memory (in_buf, 0));
+  EXPECT_TRUE (gst_buffer_is_writable (out_buf));
+
+  /* copy-on-write, the incoming buffer is not changed */
+  ASSERT_TRUE (gst_buffer_map (out_buf, &map, GST_MAP_WRITE));
+  memset (map.data, 2, map.size);
+  gst_buffer_unmap (out_buf, &map);
+
+  EXPECT_TRUE (gst_buffer_peek_memory (out_buf, 0) !=
+      gst_buffer_peek_memory (in_buf, 0));
+  ASSERT_TRUE (gst_buffer_map (in_buf, &map, GST_MAP_READ));
+  EXPECT_EQ (map.data[0], 1);
+  gst_buffer_unmap (in_buf, &map);
+
+  gst_buffer_unref (out_buf);
+  gst_buffer_unref (in_buf);
+  gst_caps_unref (caps);
+
+  EXPECT_TRUE (gst_tensor_repo_remove_repodata (slot));
+}
+
+/**
+ * @brief Test for tensor_repo (the recurrent loop hands off the same memory at every step)
+ */
+TEST (test_tensor_repo, handoff_loop_p)
+{
+  const guint slot = 103;
+  const guint steps = 100;
+  /* lstm/rnn state [4:4:4:1] and a larger state [1024:256:1:1] float32 */
+  const gsize sizes[] = { 256, 1024 * 256 * 4 };
+  GstBuffer *in_buf, *out_buf;
+  GstMemory *mem;
+  GstCaps *caps;
+  gboolean eos = FALSE;
+  guint newid, i, s;
+
+  gst_tensor_repo_init ();
+  ASSERT_TRUE (gst_tensor_repo_add_repodata (slot, TRUE));
+  caps = gst_caps_from_string ("other/tensor,type=(string)float32");
+
+  for (s = 0; s < G_N_ELEMENTS (sizes); s++) {
+    in_buf = gst_buffer_new_allocate (NULL, sizes[s], NULL);
+    mem = gst_buffer_peek_memory (in_buf, 0);
+
+    for (i = 0; i < steps; i++) {
+      /* reposink -> reposrc -> the next step */
+      EXPECT_TRUE (gst_tensor_repo_set_buffer (slot, slot, in_buf, caps));
+      out_buf = gst_tensor_repo_get_buffer (slot, slot, &eos, &newid);
+      ASSERT_TRUE (out_buf != NULL);
+      gst_buffer_remove_meta (out_buf, (GstMeta *) GST_META_REPO_GET (out_buf));
+
+      /* no copy in any step */
+      EXPECT_EQ (gst_buffer_n_memory (out_buf), 1U);
+      EXPECT_TRUE (gst_buffer_peek_memory (out_buf, 0) == mem);
+      EXPECT_EQ (gst_buffer_get_size (out_buf), sizes[s]);
+
+      gst_buffer_unref (in_buf);
+      in_buf = out_buf;
+    }
+
+    gst_buffer_unref (in_buf);
+  }
+
+  gst_caps_unref (caps);
+  EXPECT_TRUE (gst_tensor_repo_remove_repodata (slot));
+}
+
+/**
+ * @brief Data of the thread to push or pull the buffers (multi-slot contention).
+ */
+typedef struct
+{
+  guint slot; /**< index of the slot */
+  guint count; /**< the number of buffers */
+  guint received; /**< the number of received buffers */
+  guint out_of_order; /**< the number of buffers not in the pushed order */
+} test_repo_thread_data;
+
+/**
+ * @brief Thread to push the buffers into the slot.
+ */
+static gpointer
+test_repo_writer_thread (gpointer user_data)
+{
+  test_repo_thread_data *data = (test_repo_thread_data *) user_data;
+  guint i;
+
+  /* the value is the slot and the order of the buffer */
+  for (i = 0; i < data->count; i++)
+    test_repo_push_value (data->slot, (guint8) (data->slot + i));
+
+  gst_tensor_repo_set_eos (data->slot);
+  return NULL;
+}
+
+/**
+ * @brief Thread to pull the buffers from the slot.
+ */
+static gpointer
+test_repo_reader_thread (gpointer user_data)
+{
+  test_repo_thread_data *data = (test_repo_thread_data *) user_data;
+  GstBuffer *buf;
+  gboolean eos = FALSE;
+  guint newid;
+  guint8 value;
+
+  while (!eos) {
+    buf = gst_tensor_repo_get_buffer (data->slot, data->slot, &eos, &newid);
+    if (buf) {
+      gst_buffer_extract (buf, 0, &value, 1);
+      if (value != (guint8) (data->slot + data->received))
+        data->out_of_order++;
+
+      data->received++;
+      gst_buffer_unref (buf);
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Test for tensor_repo (multi-slot contention, each slot passes all buffers in order)
+ */
+TEST (test_tensor_repo, multi_slot_p)
+{
+  const guint num_slots = 8;
+  const guint count = 2000;
+  test_repo_thread_data data[8];
+  GThread *writers[8], *readers[8];
+  guint i;
+
+  gst_tensor_repo_init ();
+
+  for (i = 0; i < num_slots; i++) {
+    data[i].slot = 200 + i;
+    data[i].count = count;
+    data[i].received = 0;
+    data[i].out_of_order = 0;
+
+    ASSERT_TRUE (gst_tensor_repo_add_repodata (data[i].slot, TRUE));
+    EXPECT_TRUE (gst_tensor_repo_set_queue (data[i].slot, 4,
+            REPO_POLICY_BLOCK));
+  }
+
+  for (i = 0; i < num_slots; i++) {
+    readers[i] = g_thread_new ("repo_reader", test_repo_reader_thread,
+        &data[i]);
+    writers[i] = g_thread_new ("repo_writer", test_repo_writer_thread,
+        &data[i]);
+  }
+
+  for (i = 0; i < num_slots; i++) {
+    g_thread_join (writers[i]);
+    g_thread_join (readers[i]);
+  }
+
+  /* no buffer is lost, duplicated or passed to another slot */
+  for (i = 0; i < num_slots; i++) {
+    EXPECT_EQ (data[i].received, count);
+    EXPECT_EQ (data[i].out_of_order, 0U);
+    EXPECT_TRUE (gst_tensor_repo_remove_repodata (data[i].slot));
+  }
+}
+
+#if defined(__gnu_linux__) && !defined(__ANDROID__)
+/**
+ * @brief Push a buffer with the values into the shared memory.
+ */
+static gboolean
+test_repo_shm_push (GstTensorRepoShm * shm, guint8 value,
+    GstTensorRepoPolicy policy)
+{
+  GstBuffer *buf;
+  gboolean ret;
+
+  buf = gst_buffer_new_allocate (NULL, 4, NULL);
+  gst_buffer_memset (buf, 0, value, 4);
+  GST_BUFFER_PTS (buf) = value * GST_MSECOND;
+
+  ret = gst_tensor_repo_shm_set_buffer (shm, buf, policy);
+  gst_buffer_unref (buf);
+  return ret;
+}
+
+/**
+ * @brief Test for tensor_repo (shared memory between the writer and the reader)
+ */
+TEST (test_tensor_repo, shm_p)
+{
+  GstTensorRepoShm *writer, *reader;
+  GstTensorRepoShmStatus status;
+  GstTensorsInfo info;
+  GstBuffer *buf1, *buf2, *held[10];
+  GstCaps *caps, *shm_caps;
+  GstMapInfo map;
+  gchar *name;
+  guint i, level;
+  guint64 pushed, dropped;
+
+  name = g_strdup_printf ("nns_repo_shm_test_%d", (gint) getpid ());
+  caps = gst_caps_from_string ("other/tensor,dimension=(string)4:1:1:1,"
+      "type=(string)uint8,framerate=(fraction)0/1");
+
+  /* the writer does not create the shared memory yet */
+  EXPECT_TRUE (gst_tensor_repo_shm_open (name) == NULL);
+
+  writer = gst_tensor_repo_shm_create (name, 2, caps);
+  ASSERT_TRUE (writer != NULL);
+  reader = gst_tensor_repo_shm_open (name);
+  ASSERT_TRUE (reader != NULL);
+
+  /* caps and tensors info in the header */
+  shm_caps = gst_tensor_repo_shm_get_caps (reader);
+  EXPECT_TRUE (gst_caps_is_equal (shm_caps, caps));
+  gst_caps_unref (shm_caps);
+
+  EXPECT_TRUE (gst_tensor_repo_shm_get_info (reader, &info));
+  EXPECT_EQ (info.num_tensors, 1U);
+  EXPECT_EQ (info.info[0].type, _NNS_UINT8);
+  EXPECT_EQ (info.info[0].dimension[0], 4U);
+  gst_tensors_info_free (&info);
+
+  EXPECT_TRUE (test_repo_shm_push (writer, 1, REPO_POLICY_BLOCK));
+  buf1 = gst_tensor_repo_shm_get_buffer (reader, &status);
+  ASSERT_TRUE (buf1 != NULL);
+  EXPECT_EQ (status, REPO_SHM_OK);
+  EXPECT_EQ (GST_BUFFER_PTS (buf1), 1 * GST_MSECOND);
+
+  ASSERT_TRUE (gst_buffer_map (buf1, &map, GST_MAP_READ));
+  EXPECT_EQ (map.size, 4U);
+  EXPECT_EQ (map.data[0], 1);
+  EXPECT_EQ (map.data[3], 1);
+  gst_buffer_unmap (buf1, &map);
+
+  /* the slot held by the reader is not counted in max-buffers */
+  EXPECT_TRUE (test_repo_shm_push (writer, 2, REPO_POLICY_DROP_NEWEST));
+  EXPECT_TRUE (test_repo_shm_push (writer, 3, REPO_POLICY_DROP_NEWEST));
+  EXPECT_TRUE (test_repo_shm_push (writer, 4, REPO_POLICY_DROP_NEWEST));
+
+  EXPECT_TRUE (gst_tensor_repo_shm_get_stats (writer, &level, &pushed,
+          &dropped));
+  EXPECT_EQ (level, 2U);
+  EXPECT_EQ (pushed, 3U);
+  EXPECT_EQ (dropped, 1U);
+
+  /* drop the oldest buffer (2) */
+  EXPECT_TRUE (test_repo_shm_push (writer, 5, REPO_POLICY_DROP_OLDEST));
+  gst_buffer_unref (buf1);
+
+  buf1 = gst_tensor_repo_shm_get_buffer (reader, &status);
+  buf2 = gst_tensor_repo_shm_get_buffer (reader, &status);
+  ASSERT_TRUE (buf1 != NULL);
+  ASSERT_TRUE (buf2 != NULL);
+  EXPECT_EQ (GST_BUFFER_PTS (buf1), 3 * GST_MSECOND);
+  EXPECT_EQ (GST_BUFFER_PTS (buf2), 5 * GST_MSECOND);
+  gst_buffer_unref (buf1);
+
+  /* the writer is not blocked even if the reader holds all buffers */
+  for (i = 0; i < G_N_ELEMENTS (held); i++) {
+    EXPECT_TRUE (test_repo_shm_push (writer, 10 + i, REPO_POLICY_BLOCK));
+    held[i] = gst_tensor_repo_shm_get_buffer (reader, &status);
+    ASSERT_TRUE (held[i] != NULL);
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (held); i++) {
+    ASSERT_TRUE (gst_buffer_map (held[i], &map, GST_MAP_READ));
+    EXPECT_EQ (map.data[0], 10 + i);
+    gst_buffer_unmap (held[i], &map);
+    gst_buffer_unref (held[i]);
+  }
+
+  gst_tensor_repo_shm_set_eos (writer);
+
+  /* drained all buffers */
+  EXPECT_TRUE (gst_tensor_repo_shm_get_buffer (reader, &status) == NULL);
+  EXPECT_EQ (status, REPO_SHM_EOS);
+
+  /* the memory is valid until the buffers are freed */
+  gst_tensor_repo_shm_close (reader);
+  gst_tensor_repo_shm_close (writer);
+
+  ASSERT_TRUE (gst_buffer_map (buf2, &map, GST_MAP_READ));
+  EXPECT_EQ (map.data[0], 5);
+  gst_buffer_unmap (buf2, &map);
+
+  gst_buffer_unref (buf2);
+  gst_caps_unref (caps);
+  g_free (name);
+}
+
+/**
+ * @brief Test for tensor_repo (the writer closes the shared memory without EOS event)
+ */
+TEST (test_tensor_repo, shm_close_p)
+{
+  GstTensorRepoShm *writer, *reader;
+  GstTensorRepoShmStatus status;
+  GstBuffer *buf;
+  GstCaps *caps;
+  gchar *name;
+
+  name = g_strdup_printf ("nns_repo_shm_close_%d", (gint) getpid ());
+  caps = gst_caps_from_string ("other/tensor,dimension=(string)4:1:1:1,"
+      "type=(string)uint8,framerate=(fraction)0/1");
+
+  writer = gst_tensor_repo_shm_create (name, 1, caps);
+  ASSERT_TRUE (writer != NULL);
+  reader = gst_tensor_repo_shm_open (name);
+  ASSERT_TRUE (reader != NULL);
+
+  EXPECT_TRUE (test_repo_shm_push (writer, 1, REPO_POLICY_BLOCK));
+  gst_tensor_repo_shm_close (writer);
+
+  /* the buffer is pulled before EOS */
+  buf = gst_tensor_repo_shm_get_buffer (reader, &status);
+  ASSERT_TRUE (buf != NULL);
+  gst_buffer_unref (buf);
+
+  EXPECT_TRUE (gst_tensor_repo_shm_get_buffer (reader, &status) == NULL);
+  EXPECT_EQ (status, REPO_SHM_EOS);
+
+  /* the name is removed */
+  EXPECT_TRUE (gst_tensor_repo_shm_open (name) == NULL);
+
+  gst_tensor_repo_shm_close (reader);
+  gst_caps_unref (caps);
+  g_free (name);
+}
+
+/**
+ * @brief Test for tensor_repo (the shared memory of the live writer and reader is not taken over)
+ */
+TEST (test_tensor_repo, shm_in_use_n)
+{
+  GstTensorRepoShm *writer, *reader;
+  GstCaps *caps;
+  gchar *name;
+
+  name = g_strdup_printf ("nns_repo_shm_in_use_%d", (gint) getpid ());
+  caps = gst_caps_from_string ("other/tensor,dimension=(string)4:1:1:1,"
+      "type=(string)uint8,framerate=(fraction)0/1");
+
+  writer = gst_tensor_repo_shm_create (name, 1, caps);
+  ASSERT_TRUE (writer != NULL);
+  reader = gst_tensor_repo_shm_open (name);
+  ASSERT_TRUE (reader != NULL);
+
+  /* the writer is alive, the name is not removed */
+  EXPECT_TRUE (gst_tensor_repo_shm_create (name, 1, caps) == NULL);
+  /* only one reader */
+  EXPECT_TRUE (gst_tensor_repo_shm_open (name) == NULL);
+
+  EXPECT_TRUE (test_repo_shm_push (writer, 1, REPO_POLICY_BLOCK));
+
+  gst_tensor_repo_shm_close (reader);
+  gst_tensor_repo_shm_close (writer);
+
+  /* the name is free again */
+  writer = gst_tensor_repo_shm_create (name, 1, caps);
+  ASSERT_TRUE (writer != NULL);
+  gst_tensor_repo_shm_close (writer);
+
+  gst_caps_unref (caps);
+  g_free (name);
+}
+
+/**
+ * @brief Callback for tensor sink signal to count the received buffers.
+ */
+static void
+test_repo_shm_new_data_cb (GstElement * element, GstBuffer * buffer,
+    gpointer user_data)
+{
+  guint *received = (guint *) user_data;
+
+  (*received)++;
+}
+
+/**
+ * @brief Run the pipelines with tensor_reposink and tensor_reposrc (sink keeps the last sample).
+ */
+static guint
+test_repo_shm_run_pipeline (const gchar * policy)
+{
+  GstElement *writer, *reader, *sink;
+  GstBus *bus;
+  GstMessage *msg;
+  gchar *name, *str;
+  guint received = 0;
+
+  name = g_strdup_printf ("nns_repo_shm_pipeline_%d", (gint) getpid ());
+
+  str = g_strdup_printf ("videotestsrc num-buffers=30 ! "
+      "video/x-raw,width=4,height=4,format=GRAY8,framerate=(fraction)30/1 ! "
+      "tensor_converter ! tensor_reposink shm-name=%s drop-policy=%s",
+      name, policy);
+  writer = gst_parse_launch (str, NULL);
+  g_free (str);
+
+  str = g_strdup_printf ("tensor_reposrc shm-name=%s ! "
+      "tensor_sink name=sink sync=false enable-last-sample=true", name);
+  reader = gst_parse_launch (str, NULL);
+  g_free (str);
+
+  if (writer == NULL || reader == NULL)
+    goto done;
+
+  sink = gst_bin_get_by_name (GST_BIN (reader), "sink");
+  g_signal_connect (sink, "new-data", (GCallback) test_repo_shm_new_data_cb,
+      &received);
+  gst_object_unref (sink);
+
+  gst_element_set_state (reader, GST_STATE_PLAYING);
+  gst_element_set_state (writer, GST_STATE_PLAYING);
+
+  /* the reader gets EOS from the writer */
+  bus = gst_element_get_bus (reader);
+  msg = gst_bus_timed_pop_filtered (bus, 10 * GST_SECOND,
+      (GstMessageType) (GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+  if (msg == NULL || GST_MESSAGE_TYPE (msg) != GST_MESSAGE_EOS)
+    received = 0;
+
+  if (msg)
+    gst_message_unref (msg);
+  gst_object_unref (bus);
+
+  gst_element_set_state (writer, GST_STATE_NULL);
+  gst_element_set_state (reader, GST_STATE_NULL);
+
+done:
+  if (writer)
+    gst_object_unref (writer);
+  if (reader)
+    gst_object_unref (reader);
+  g_free (name);
+  return received;
+}
+
+/**
+ * @brief Test for tensor_repo (the sink after tensor_reposrc holds the last buffer)
+ */
+TEST (test_tensor_repo, shm_pipeline_p)
+{
+  /* default max-buffers (1), the writer waits for the reader */
+  EXPECT_EQ (test_repo_shm_run_pipeline ("block"), 30U);
+
+  /* the writer is not stalled with the slot held by the sink */
+  EXPECT_GT (test_repo_shm_run_pipeline ("drop-oldest"), 1U);
+  EXPECT_GT (test_repo_shm_run_pipeline ("drop-newest"), 1U);
+}
+#endif /* __gnu_linux__ && !__ANDROID__ */
+
+/**
+ * @brief Test for tensor_repo (invalid queue of slot)
+ */
+TEST (test_tensor_repo, set_queue_n)
+{
+  const guint slot = 101;
+
+  gst_tensor_repo_init ();
+  ASSERT_TRUE (gst_tensor_repo_add_repodata (slot, TRUE));
+
+  EXPECT_FALSE (gst_tensor_repo_set_queue (slot, 0, REPO_POLICY_BLOCK));
+  EXPECT_FALSE (gst_tensor_repo_set_queue (slot, 1, REPO_POLICY_END));
+
+  EXPECT_TRUE (gst_tensor_repo_remove_repodata (slot));
+}
+
+/**
+ * @brief Test for tensor_converter (remove the padding of the video rows, RGB 3x2)
+ */
+TEST (test_tensor_converter, video_remove_padding_p)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo info;
+  guint i, row;
+
+  h = gst_harness_new ("tensor_converter");
+
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=RGB,width=3,height=2,framerate=(fraction)30/1");
+
+  /* stride of a row is 12 (rounded up to 4 bytes) */
+  in_buf = gst_harness_create_buffer (h, 24);
+
+  ASSERT_TRUE (gst_buffer_map (in_buf, &info, GST_MAP_WRITE));
+  memset (info.data, 0xff, 24);
+  for (row = 0; row < 2; row++) {
+    for (i = 0; i < 9; i++) {
+      info.data[row * 12 + i] = row * 10 + i;
+    }
+  }
+  gst_buffer_unmap (in_buf, &info);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), 18U);
+
+  ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+  for (row = 0; row < 2; row++) {
+    for (i = 0; i < 9; i++) {
+      EXPECT_EQ (info.data[row * 9 + i], row * 10 + i);
+    }
+  }
+  gst_buffer_unmap (out_buf, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter (video meta without padding, no memcpy)
+ */
+TEST (test_tensor_converter, video_meta_no_padding_p)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMemory *mem;
+  gsize offset[GST_VIDEO_MAX_PLANES] = { 0, };
+  gint stride[GST_VIDEO_MAX_PLANES] = { 9, };
+
+  h = gst_harness_new ("tensor_converter");
+
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=RGB,width=3,height=2,framerate=(fraction)30/1");
+
+  in_buf = gst_harness_create_buffer (h, 18);
+  gst_buffer_add_video_meta_full (in_buf, GST_VIDEO_FRAME_FLAG_NONE,
+      GST_VIDEO_FORMAT_RGB, 3, 2, 1, offset, stride);
+  mem = gst_buffer_peek_memory (in_buf, 0);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* get output buffer, should share the incoming memory */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), 18U);
+  EXPECT_TRUE (gst_buffer_peek_memory (out_buf, 0) == mem);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter (video meta with the offset out of the buffer)
+ */
+TEST (test_tensor_converter, video_meta_invalid_offset_n)
+{
+  GstHarness *h;
+  GstBuffer *in_buf;
+  gsize offset[GST_VIDEO_MAX_PLANES] = { 4, };
+  gint stride[GST_VIDEO_MAX_PLANES] = { 9, };
+
+  h = gst_harness_new ("tensor_converter");
+
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=RGB,width=3,height=2,framerate=(fraction)30/1");
+
+  /* packed rows, but the frame (18 bytes) from the offset exceeds the buffer */
+  in_buf = gst_harness_create_buffer (h, 18);
+  gst_buffer_add_video_meta_full (in_buf, GST_VIDEO_FRAME_FLAG_NONE,
+      GST_VIDEO_FORMAT_RGB, 3, 2, 1, offset, stride);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_ERROR);
+  EXPECT_EQ (gst_harness_buffers_received (h), 0U);
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter properties to convert YUV video
+ */
+TEST (test_tensor_converter, video_convert_properties)
+{
+  GstHarness *h;
+  gchar *str;
+  gboolean letterbox;
+
+  h = gst_harness_new ("tensor_converter");
+
+  /* default video-format is empty (no conversion) */
+  g_object_get (h->element, "video-format", &str, NULL);
+  EXPECT_STREQ (str, "");
+  g_free (str);
+
+  g_object_set (h->element, "video-format", "BGR", NULL);
+  g_object_get (h->element, "video-format", &str, NULL);
+  EXPECT_STREQ (str, "BGR");
+  g_free (str);
+
+  g_object_set (h->element, "video-size", "224:160", NULL);
+  g_object_get (h->element, "video-size", &str, NULL);
+  EXPECT_STREQ (str, "224:160");
+  g_free (str);
+
+  /* default video-resize is bilinear */
+  g_object_get (h->element, "video-resize", &str, NULL);
+  EXPECT_STREQ (str, "bilinear");
+  g_free (str);
+
+  g_object_set (h->element, "video-resize", "nearest", NULL);
+  g_object_get (h->element, "video-resize", &str, NULL);
+  EXPECT_STREQ (str, "nearest");
+  g_free (str);
+
+  /* default video-letterbox is FALSE */
+  g_object_get (h->element, "video-letterbox", &letterbox, NULL);
+  EXPECT_FALSE (letterbox);
+
+  /* default video-type is uint8 */
+  g_object_get (h->element, "video-type", &str, NULL);
+  EXPECT_STREQ (str, "uint8");
+  g_free (str);
+
+  g_object_set (h->element, "video-type", "float32", NULL);
+  g_object_get (h->element, "video-type", &str, NULL);
+  EXPECT_STREQ (str, "float32");
+  g_free (str);
+
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter (I420 4x2 to GRAY8 4x4 with letterbox)
+ */
+TEST (test_tensor_converter, video_convert_letterbox_p)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo info;
+  guint i;
+
+  h = gst_harness_new ("tensor_converter");
+
+  g_object_set (h->element, "video-format", "GRAY8", "video-size", "4:4",
+      "video-letterbox", TRUE, NULL);
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=I420,width=4,height=2,framerate=(fraction)30/1");
+
+  /* Y (4x2, stride 4), U (2x1, stride 4), V (2x1, stride 4) */
+  in_buf = gst_harness_create_buffer (h, 16);
+
+  ASSERT_TRUE (gst_buffer_map (in_buf, &info, GST_MAP_WRITE));
+  memset (info.data, 235, 8);
+  memset (info.data + 8, 128, 8);
+  gst_buffer_unmap (in_buf, &info);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), 16U);
+
+  /* first and last rows are borders */
+  ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+  for (i = 0; i < 16; i++) {
+    if (i < 4 || i >= 12)
+      EXPECT_EQ (info.data[i], 0U);
+    else
+      EXPECT_EQ (info.data[i], 255U);
+  }
+  gst_buffer_unmap (out_buf, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter (NV12 4x4 to RGB float32 2x2, bilinear)
+ */
+TEST (test_tensor_converter, video_convert_float_p)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo info;
+  guint i;
+
+  h = gst_harness_new ("tensor_converter");
+
+  g_object_set (h->element, "video-format", "RGB", "video-size", "2:2",
+      "video-type", "float32", NULL);
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=NV12,width=4,height=4,framerate=(fraction)30/1");
+
+  /* Y (4x4), UV (2x2 interleaved) */
+  in_buf = gst_harness_create_buffer (h, 24);
+
+  ASSERT_TRUE (gst_buffer_map (in_buf, &info, GST_MAP_WRITE));
+  memset (info.data, 235, 16);
+  memset (info.data + 16, 128, 8);
+  gst_buffer_unmap (in_buf, &info);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), 2 * 2 * 3 * sizeof (float));
+
+  ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+  for (i = 0; i < 12; i++) {
+    EXPECT_FLOAT_EQ (((float *) info.data)[i], 255.0f);
+  }
+  gst_buffer_unmap (out_buf, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for tensor_converter (multiple frames with padding in a tensor)
+ */
+TEST (test_tensor_converter, video_batch_frames_p)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo info;
+  guint i, row, f;
+
+  h = gst_harness_new ("tensor_converter");
+
+  g_object_set (h->element, "frames-per-tensor", 2, NULL);
+  gst_harness_set_src_caps_str (h,
+      "video/x-raw,format=RGB,width=3,height=2,framerate=(fraction)30/1");
+
+  for (f = 0; f < 2; f++) {
+    /* stride of a row is 12 (rounded up to 4 bytes) */
+    in_buf = gst_harness_create_buffer (h, 24);
+
+    ASSERT_TRUE (gst_buffer_map (in_buf, &info, GST_MAP_WRITE));
+    memset (info.data, 0xff, 24);
+    for (row = 0; row < 2; row++) {
+      for (i = 0; i < 9; i++) {
+        info.data[row * 12 + i] = f * 100 + row * 10 + i;
+      }
+    }
+    gst_buffer_unmap (in_buf, &info);
+
+    GST_BUFFER_PTS (in_buf) = f * 10 * GST_MSECOND;
+    GST_BUFFER_DURATION (in_buf) = 10 * GST_MSECOND;
+
+    EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+  }
+
+  /* get output buffer */
+  out_buf = gst_harness_pull (h);
+
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_n_memory (out_buf), 1U);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), 36U);
+  EXPECT_EQ (GST_BUFFER_PTS (out_buf), 0U);
+  EXPECT_EQ (GST_BUFFER_DURATION (out_buf), 20 * GST_MSECOND);
+
+  ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+  for (f = 0; f < 2; f++) {
+    for (row = 0; row < 2; row++) {
+      for (i = 0; i < 9; i++) {
+        EXPECT_EQ (info.data[f * 18 + row * 9 + i], f * 100 + row * 10 + i);
+      }
+    }
+  }
+  gst_buffer_unmap (out_buf, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Generate the audio samples (S16LE, mono) for audio feature tests, sine waves of 440Hz and 3kHz with noise.
+ */
+static void
+_audio_feature_get_samples (gint16 * samples, guint num, guint rate)
+{
+  guint32 seed = 1;
+  guint i;
+
+  for (i = 0; i < num; i++) {
+    gdouble noise;
+
+    seed = seed * 1103515245U + 12345U;
+    noise = ((seed >> 16) & 0x7fff) / 32768.0 - 0.5;
+
+    samples[i] = (gint16) (32767 * (0.3 * sin (2 * G_PI * 440.0 * i / rate) +
+            0.2 * sin (2 * G_PI * 3000.0 * i / rate) + 0.05 * noise));
+  }
+}
+
+/**
+ * @brief Get the golden log-mel energies of a window (naive DFT in double, periodic Hann window, HTK mel scale from 0 to rate / 2).
+ */
+static void
+_audio_feature_get_log_mel (const gint16 * samples, guint n_fft, guint rate,
+    guint n_mels, gdouble * out)
+{
+  gdouble *power, *center;
+  gdouble mel_max;
+  guint i, k, m;
+
+  power = g_new0 (gdouble, n_fft / 2 + 1);
+  for (k = 0; k <= n_fft / 2; k++) {
+    gdouble re = 0.0, im = 0.0;
+
+    for (i = 0; i < n_fft; i++) {
+      gdouble v = samples[i] / 32768.0 * (0.5 - 0.5 * cos (2 * G_PI * i / n_fft));
+
+      re += v * cos (2 * G_PI * k * i / n_fft);
+      im -= v * sin (2 * G_PI * k * i / n_fft);
+    }
+
+    power[k] = re * re + im * im;
+  }
+
+  mel_max = 2595.0 * log10 (1.0 + rate / 2.0 / 700.0);
+  center = g_new0 (gdouble, n_mels + 2);
+  for (m = 0; m < n_mels + 2; m++)
+    center[m] = 700.0 * (pow (10.0, mel_max * m / (n_mels + 1) / 2595.0) - 1.0);
+
+  for (m = 0; m < n_mels; m++) {
+    gdouble sum = 0.0;
+
+    for (k = 0; k <= n_fft / 2; k++) {
+      gdouble f = (gdouble) k * rate / n_fft;
+
+      if (f <= center[m] || f >= center[m + 2])
+        continue;
+
+      if (f <= center[m + 1])
+        sum += power[k] * (f - center[m]) / (center[m + 1] - center[m]);
+      else
+        sum += power[k] * (center[m + 2] - f) / (center[m + 2] - center[m + 1]);
+    }
+
+    out[m] = log (sum + 1e-6);
+  }
+
+  g_free (center);
+  g_free (power);
+}
+
+/**
+ * @brief Test for audio feature converter (log-mel spectrogram of 2 frames in a tensor)
+ */
+TEST (test_tensor_converter, audio_feature_log_mel_p)
+{
+  const guint rate = 16000, n_fft = 512, hop = 160, n_mels = 40;
+  const guint num = n_fft + hop;
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo info;
+  gint16 samples[num];
+  gdouble golden[n_mels];
+  guint f, m;
+
+  h = gst_harness_new ("tensor_converter");
+
+  g_object_set (h->element, "mode", "audio_feature",
+      "option", "n_fft:512,hop:160,n_mels:40,frames:2", NULL);
+  gst_harness_set_src_caps_str (h,
+      "audio/x-raw,format=S16LE,rate=16000,channels=1,layout=interleaved");
+
+  _audio_feature_get_samples (samples, num, rate);
+
+  in_buf = gst_harness_create_buffer (h, sizeof (samples));
+  ASSERT_TRUE (gst_buffer_map (in_buf, &info, GST_MAP_WRITE));
+  memcpy (info.data, samples, sizeof (samples));
+  gst_buffer_unmap (in_buf, &info);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  /* 2 windows (0 and hop) in a tensor, the features of a frame are contiguous */
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), sizeof (gfloat) * n_mels * 2);
+
+  ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+  for (f = 0; f < 2; f++) {
+    _audio_feature_get_log_mel (samples + f * hop, n_fft, rate, n_mels, golden);
+
+    for (m = 0; m < n_mels; m++)
+      EXPECT_NEAR (((gfloat *) info.data)[f * n_mels + m], golden[m], 1e-3);
+  }
+  gst_buffer_unmap (out_buf, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for audio feature converter (MFCC)
+ */
+TEST (test_tensor_converter, audio_feature_mfcc_p)
+{
+  const guint rate = 16000, n_fft = 512, n_mels = 40, n_mfcc = 13;
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo info;
+  gint16 samples[n_fft];
+  gdouble log_mel[n_mels];
+  guint i, m;
+
+  h = gst_harness_new ("tensor_converter");
+
+  g_object_set (h->element, "mode", "audio_feature",
+      "option", "n_fft:512,hop:160,n_mels:40,n_mfcc:13", NULL);
+  gst_harness_set_src_caps_str (h,
+      "audio/x-raw,format=S16LE,rate=16000,channels=1,layout=interleaved");
+
+  _audio_feature_get_samples (samples, n_fft, rate);
+  _audio_feature_get_log_mel (samples, n_fft, rate, n_mels, log_mel);
+
+  in_buf = gst_harness_create_buffer (h, sizeof (samples));
+  ASSERT_TRUE (gst_buffer_map (in_buf, &info, GST_MAP_WRITE));
+  memcpy (info.data, samples, sizeof (samples));
+  gst_buffer_unmap (in_buf, &info);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), sizeof (gfloat) * n_mfcc);
+
+  /* orthonormal DCT-II of the log-mel energies */
+  ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+  for (i = 0; i < n_mfcc; i++) {
+    gdouble golden = 0.0;
+    gdouble scale = (i == 0) ? sqrt (1.0 / n_mels) : sqrt (2.0 / n_mels);
+
+    for (m = 0; m < n_mels; m++)
+      golden += scale * cos (G_PI * i * (2.0 * m + 1.0) / (2.0 * n_mels)) *
+          log_mel[m];
+
+    EXPECT_NEAR (((gfloat *) info.data)[i], golden, 1e-3);
+  }
+  gst_buffer_unmap (out_buf, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Write the vocabulary for text tokenizer tests.
+ * @return the path of the vocabulary (caller should remove and free it)
+ */
+static gchar *
+_text_tokenizer_write_vocab (void)
+{
+  gchar *path, *long_word, *contents;
+
+  /**
+   * line number is the id, the 14th token (id 13) is 100 characters long,
+   * then CJK characters (id 15, 16) and a 2-byte character (id 17, 18)
+   */
+  long_word = g_strnfill (100, 'a');
+  contents = g_strdup_printf ("[PAD]\n[UNK]\n[CLS]\n[SEP]\nhello\nworld\n##s\n,\n"
+      "un\n##aff\n##able\ncafe\n!\n%s\n##a\n\xe4\xb8\xad\n\xe6\x96\x87\n"
+      "\xd0\xb4\n##\xd0\xb4\n", long_word);
+
+  path = g_build_filename (g_get_tmp_dir (), "nns-text-tokenizer-vocab.txt",
+      NULL);
+  EXPECT_TRUE (g_file_set_contents (path, contents, -1, NULL));
+
+  g_free (long_word);
+  g_free (contents);
+  return path;
+}
+
+/**
+ * @brief Push the text to text tokenizer and compare the outgoing tensor.
+ */
+static void
+_text_tokenizer_check (const gchar * option, const gchar * text,
+    guint seq_len, const gint32 * ids, const gint32 * mask,
+    const gint32 * segment)
+{
+  GstHarness *h;
+  GstBuffer *in_buf, *out_buf;
+  GstMapInfo info;
+  gint32 *out;
+  guint i;
+
+  h = gst_harness_new ("tensor_converter");
+
+  g_object_set (h->element, "mode", "text_tokenizer", "option", option, NULL);
+  gst_harness_set_src_caps_str (h, "text/x-raw,format=utf8");
+
+  in_buf = gst_harness_create_buffer (h, strlen (text));
+  ASSERT_TRUE (gst_buffer_map (in_buf, &info, GST_MAP_WRITE));
+  memcpy (info.data, text, strlen (text));
+  gst_buffer_unmap (in_buf, &info);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_OK);
+
+  out_buf = gst_harness_pull (h);
+  ASSERT_TRUE (out_buf != NULL);
+  ASSERT_EQ (gst_buffer_get_size (out_buf), sizeof (gint32) * seq_len * 3);
+
+  ASSERT_TRUE (gst_buffer_map (out_buf, &info, GST_MAP_READ));
+  out = (gint32 *) info.data;
+  for (i = 0; i < seq_len; i++) {
+    EXPECT_EQ (out[i], ids[i]);
+    EXPECT_EQ (out[seq_len + i], mask[i]);
+    EXPECT_EQ (out[seq_len * 2 + i], segment[i]);
+  }
+  gst_buffer_unmap (out_buf, &info);
+  gst_buffer_unref (out_buf);
+
+  EXPECT_EQ (gst_harness_buffers_received (h), 1U);
+  gst_harness_teardown (h);
+}
+
+/**
+ * @brief Test for text tokenizer (WordPiece, unknown words, long words and non-ASCII)
+ */
+TEST (test_tensor_converter, text_tokenizer_p)
+{
+  const gint32 ids[] = { 2, 4, 7, 5, 6, 12, 8, 9, 10, 1, 11, 15, 13, 1, 3, 0 };
+  const gint32 mask[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0 };
+  const gint32 segment[16] = { 0, };
+  gchar *vocab, *option, *word100, *word101, *text;
+
+  vocab = _text_tokenizer_write_vocab ();
+  option = g_strdup_printf ("vocab:%s,seq_len:16", vocab);
+
+  /**
+   * hello , world ##s ! un ##aff ##able [UNK] (xyz) cafe (accent stripped)
+   * (CJK character) aaa...(100) [UNK] (longer than 100 characters)
+   */
+  word100 = g_strnfill (100, 'a');
+  word101 = g_strnfill (101, 'a');
+  text = g_strdup_printf ("Hello, worlds! unaffable xyz CAF\xc3\xa9 "
+      "\xe4\xb8\xad %s %s", word100, word101);
+
+  _text_tokenizer_check (option, text, 16, ids, mask, segment);
+
+  g_remove (vocab);
+  g_free (vocab);
+  g_free (option);
+  g_free (word100);
+  g_free (word101);
+  g_free (text);
+}
+
+/**
+ * @brief Test for text tokenizer (CJK characters, Unicode punctuation, spaces and control characters)
+ */
+TEST (test_tensor_converter, text_tokenizer_unicode_p)
+{
+  const gint32 ids[] = { 2, 11, 15, 16, 1, 4, 5, 6, 1, 3, 0, 0 };
+  const gint32 mask[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0 };
+  const gint32 segment[12] = { 0, };
+  gchar *vocab, *option;
+
+  vocab = _text_tokenizer_write_vocab ();
+  option = g_strdup_printf ("vocab:%s,seq_len:12", vocab);
+
+  /**
+   * CAF(E-acute) -> cafe, two CJK characters without space -> two words,
+   * ideographic full stop -> [UNK], no-break space -> space,
+   * right double quotation mark after worlds -> world ##s [UNK], control character removed
+   */
+  _text_tokenizer_check (option, "CAF\xc3\x89\xe4\xb8\xad\xe6\x96\x87\xe3\x80\x82"
+      "hello\xc2\xa0worlds\xe2\x80\x9d\xc2\x85", 12, ids, mask, segment);
+
+  g_remove (vocab);
+  g_free (vocab);
+  g_free (option);
+}
+
+/**
+ * @brief Test for text tokenizer (max length of a word is counted in characters, not bytes)
+ */
+TEST (test_tensor_converter, text_tokenizer_word_chars_p)
+{
+  const guint seq_len = 54;
+  gint32 ids[54], mask[54], segment[54] = { 0, };
+  gchar *vocab, *option;
+  GString *text;
+  guint i;
+
+  vocab = _text_tokenizer_write_vocab ();
+  option = g_strdup_printf ("vocab:%s,seq_len:%u,lower:false", vocab, seq_len);
+
+  /* 51 characters (102 bytes) in a word, not [UNK] */
+  text = g_string_new (NULL);
+  for (i = 0; i < 51; i++)
+    g_string_append (text, "\xd0\xb4");
+
+  ids[0] = 2;
+  ids[1] = 17;
+  for (i = 2; i < 52; i++)
+    ids[i] = 18;
+  ids[52] = 3;
+  ids[53] = 0;
+
+  for (i = 0; i < seq_len; i++)
+    mask[i] = (i < 53) ? 1 : 0;
+
+  _text_tokenizer_check (option, text->str, seq_len, ids, mask, segment);
+
+  g_string_free (text, TRUE);
+  g_remove (vocab);
+  g_free (vocab);
+  g_free (option);
+}
+
+/**
+ * @brief Test for text tokenizer (invalid UTF-8 is rejected)
+ */
+TEST (test_tensor_converter, text_tokenizer_invalid_utf8_n)
+{
+  GstHarness *h;
+  GstBuffer *in_buf;
+  gchar *vocab, *option;
+
+  vocab = _text_tokenizer_write_vocab ();
+  option = g_strdup_printf ("vocab:%s,seq_len:8", vocab);
+
+  h = gst_harness_new ("tensor_converter");
+
+  g_object_set (h->element, "mode", "text_tokenizer", "option", option, NULL);
+  gst_harness_set_src_caps_str (h, "text/x-raw,format=utf8");
+
+  in_buf = gst_harness_create_buffer (h, 4);
+  gst_buffer_fill (in_buf, 0, "ab\xff\xfe", 4);
+
+  EXPECT_EQ (gst_harness_push (h, in_buf), GST_FLOW_ERROR);
+  EXPECT_EQ (gst_harness_buffers_received (h), 0U);
+
+  gst_harness_teardown (h);
+  g_remove (vocab);
+  g_free (vocab);
+  g_free (option);
+}
+
+/**
+ * @brief Test for text tokenizer (sentence pair, the longer one is truncated)
+ */
+TEST (test_tensor_converter, text_tokenizer_pair_p)
+{
+  const gint32 ids[] = { 2, 4, 5, 5, 3, 4, 3 };
+  const gint32 mask[] = { 1, 1, 1, 1, 1, 1, 1 };
+  const gint32 segment[] = { 0, 0, 0, 0, 0, 1, 1 };
+  gchar *vocab, *option;
+
+  vocab = _text_tokenizer_write_vocab ();
+  option = g_strdup_printf ("vocab:%s,seq_len:7,pair:true", vocab);
+
+  _text_tokenizer_check (option, "hello world world world\thello", 7,
+      ids, mask, segment);
+
+  g_remove (vocab);
+  g_free (vocab);
+  g_free (option);
+}
+
 #ifdef HAVE_ORC
 #include "transform-orc.h"
 
@@ -322,6 +322,30 @@ _new_data_cb (GstElement * element, GstBuffer * buffer, gpointer user_data)
   }
 }
 
+/**
+ * @brief Callback for signal new-data-list.
+ */
+static void
+_new_data_list_cb (GstElement * element, GstBufferList * list,
+    gpointer user_data)
+{
+  guint *num_lists = (guint *) user_data;
+  guint i, length;
+
+  length = gst_buffer_list_length (list);
+  if (length == 0) {
+    _print_log ("received empty buffer list");
+    g_test_data.test_failed = TRUE;
+    return;
+  }
+
+  (*num_lists)++;
+  _print_log ("new data list callback [%d] buffers [%d]", *num_lists, length);
+
+  for (i = 0; i < length; i++)
+    _new_data_cb (element, gst_buffer_list_get (list, i), NULL);
+}
+
 /**
  * @brief Callback for signal stream-start.
  */
@@ -1014,6 +1038,7 @@ error:
 TEST (tensor_sink_test, properties)
 {
   guint rate, res_rate;
+  guint batch, res_batch;
   gint64 lateness, res_lateness;
   gboolean silent, res_silent;
   gboolean emit, res_emit;
@@ -1049,6 +1074,24 @@ TEST (tensor_sink_test, properties)
   g_object_get (g_test_data.sink, "silent", &res_silent, NULL);
   EXPECT_EQ (res_silent, !silent);
 
+  /** default batch-size is 0 */
+  g_object_get (g_test_data.sink, "batch-size", &batch, NULL);
+  EXPECT_EQ (batch, 0U);
+
+  batch += 10;
+  g_object_set (g_test_data.sink, "batch-size", batch, NULL);
+  g_object_get (g_test_data.sink, "batch-size", &res_batch, NULL);
+  EXPECT_EQ (res_batch, batch);
+
+  /** default batch-timeout is 0 */
+  g_object_get (g_test_data.sink, "batch-timeout", &batch, NULL);
+  EXPECT_EQ (batch, 0U);
+
+  batch += 100;
+  g_object_set (g_test_data.sink, "batch-timeout", batch, NULL);
+  g_object_get (g_test_data.sink, "batch-timeout", &res_batch, NULL);
+  EXPECT_EQ (res_batch, batch);
+
   /** GstBaseSink:sync TRUE */
   g_object_get (g_test_data.sink, "sync", &sync, NULL);
   EXPECT_EQ (sync, TRUE);
@@ -1234,6 +1277,52 @@ TEST (tensor_sink_test, signal_rate)
   _free_test_data ();
 }
 
+/**
+ * @brief Test for tensor sink batch-size (new-data-list signal).
+ */
+TEST (tensor_sink_test, signal_batch)
+{
+  const guint num_buffers = 10;
+  guint num_lists = 0;
+  gulong handle_id;
+  TestOption option = { num_buffers, TEST_TYPE_VIDEO_RGB };
+
+  ASSERT_TRUE (_setup_pipeline (option));
+
+  /** new-data is not emitted with batch-size */
+  g_object_set (g_test_data.sink, "batch-size", 4U, NULL);
+
+  handle_id = g_signal_connect (g_test_data.sink, "new-data-list",
+      (GCallback) _new_data_list_cb, &num_lists);
+  EXPECT_TRUE (handle_id > 0);
+
+  handle_id = g_signal_connect (g_test_data.sink, "eos",
+      (GCallback) _eos_cb, NULL);
+  EXPECT_TRUE (handle_id > 0);
+
+  gst_element_set_state (g_test_data.pipeline, GST_STATE_PLAYING);
+  g_main_loop_run (g_test_data.loop);
+  g_usleep (jitter);
+  gst_element_set_state (g_test_data.pipeline, GST_STATE_NULL);
+
+  /** check eos message */
+  EXPECT_EQ (g_test_data.status, TEST_EOS);
+
+  /** check received buffers (4 + 4 + 2, the last batch is passed at eos) */
+  EXPECT_EQ (g_test_data.received, num_buffers);
+  EXPECT_EQ (num_lists, 3U);
+  EXPECT_EQ (g_test_data.end, TRUE);
+
+  /** check caps name */
+  EXPECT_TRUE (g_str_equal (g_test_data.caps_name, "other/tensor"));
+
+  /** check timestamp */
+  EXPECT_FALSE (g_test_data.invalid_timestamp);
+
+  EXPECT_FALSE (g_test_data.test_failed);
+  _free_test_data ();
+}
+
 /**
  * @brief Test for caps negotiation failed.
  */
@@ -4940,6 +5029,289 @@ TEST (tensor_stream_test, tensor_decoder_property)
   _free_test_data ();
 }
 
+/**
+ * @brief Data to check the buffers of tensor_mux.
+ */
+typedef struct
+{
+  guint num_pads; /**< the number of sink pads of tensor_mux */
+  guint received; /**< the number of received buffers */
+  guint invalid; /**< the number of buffers with wrong memory blocks */
+} _mux_check_data;
+
+/**
+ * @brief Callback for tensor sink signal to check the memory blocks of the received buffers.
+ * @note The tensor of n-th pad has (n + 1) * 16 bytes.
+ */
+static void
+_mux_new_data_cb (GstElement * element, GstBuffer * buffer, gpointer user_data)
+{
+  _mux_check_data *data = (_mux_check_data *) user_data;
+  guint i;
+
+  data->received++;
+
+  if (gst_buffer_n_memory (buffer) != data->num_pads) {
+    data->invalid++;
+    return;
+  }
+
+  for (i = 0; i < data->num_pads; i++) {
+    if (gst_buffer_peek_memory (buffer, i)->size != (i + 1) * 16) {
+      data->invalid++;
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Run tensor_mux with the given number of sink pads (the n-th pad has the tensor 1:(n+1)*4:4:1).
+ * @return TRUE if the pipeline reaches EOS
+ */
+static gboolean
+_mux_run_pipeline (_mux_check_data * data, guint num_buffers,
+    GstTensorsConfig * config)
+{
+  GstElement *pipeline, *sink;
+  GstBus *bus;
+  GstMessage *msg;
+  GstPad *pad;
+  GstCaps *caps;
+  GString *str;
+  gboolean eos;
+  guint i;
+
+  str = g_string_new ("tensor_mux name=mux ! tensor_sink name=test_sink sync=false ");
+  for (i = 0; i < data->num_pads; i++) {
+    g_string_append_printf (str,
+        "videotestsrc num-buffers=%u pattern=black ! video/x-raw,width=%u,height=4,format=GRAY8,framerate=(fraction)30/1 ! tensor_converter ! mux.sink_%u ",
+        num_buffers, (i + 1) * 4, i);
+  }
+
+  pipeline = gst_parse_launch (str->str, NULL);
+  g_string_free (str, TRUE);
+  if (pipeline == NULL)
+    return FALSE;
+
+  sink = gst_bin_get_by_name (GST_BIN (pipeline), "test_sink");
+  g_signal_connect (sink, "new-data", (GCallback) _mux_new_data_cb, data);
+
+  bus = gst_element_get_bus (pipeline);
+
+  gst_element_set_state (pipeline, GST_STATE_PLAYING);
+  msg = gst_bus_timed_pop_filtered (bus, 10 * GST_SECOND,
+      (GstMessageType) (GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+  eos = (msg != NULL && GST_MESSAGE_TYPE (msg) == GST_MESSAGE_EOS);
+
+  /* the negotiated config of outgoing tensors */
+  pad = gst_element_get_static_pad (sink, "sink");
+  caps = gst_pad_get_current_caps (pad);
+  if (caps) {
+    gst_tensors_config_from_structure (config, gst_caps_get_structure (caps, 0));
+    gst_caps_unref (caps);
+  }
+  gst_object_unref (pad);
+  gst_object_unref (sink);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+
+  if (msg)
+    gst_message_unref (msg);
+  gst_object_unref (bus);
+  gst_object_unref (pipeline);
+
+  return eos;
+}
+
+/**
+ * @brief Test for tensor_mux with increasing number of sink pads, each pad has its own config.
+ */
+TEST (tensor_stream_test, mux_many_pads_p)
+{
+  const guint num_buffers = 10;
+  const guint num_pads[] = { 1, 4, 12 };
+  GstTensorsConfig config;
+  _mux_check_data data;
+  guint i, n;
+
+  for (i = 0; i < G_N_ELEMENTS (num_pads); i++) {
+    data.num_pads = num_pads[i];
+    data.received = data.invalid = 0;
+    gst_tensors_config_init (&config);
+
+    EXPECT_TRUE (_mux_run_pipeline (&data, num_buffers, &config));
+    EXPECT_EQ (data.received, num_buffers);
+    EXPECT_EQ (data.invalid, 0U);
+
+    /* the config of each pad in order */
+    EXPECT_EQ (config.info.num_tensors, num_pads[i]);
+    for (n = 0; n < config.info.num_tensors; n++) {
+      EXPECT_EQ (config.info.info[n].type, _NNS_UINT8);
+      EXPECT_EQ (config.info.info[n].dimension[1], (n + 1) * 4);
+      EXPECT_EQ (config.info.info[n].dimension[2], 4U);
+    }
+
+    gst_tensors_info_free (&config.info);
+  }
+}
+
+/**
+ * @brief Callback for tensor sink signal to count the received buffers from the streaming thread.
+ * @note The buffer of tensor_mux should have the tensors of both pads.
+ */
+static void
+_mux_timeout_new_data_cb (GstElement * element, GstBuffer * buffer,
+    gpointer user_data)
+{
+  if (gst_buffer_n_memory (buffer) == 2)
+    g_atomic_int_inc ((gint *) user_data);
+}
+
+/**
+ * @brief Test for tensor_mux in timeout mode, a stalled pad does not stall the output.
+ */
+TEST (tensor_stream_test, mux_timeout_stalled_pad_p)
+{
+  const gint num_buffers = 10;
+  const GstClockTime timeout = 50 * GST_MSECOND;
+  GstElement *pipeline, *sink;
+  gchar *str;
+  gint received = 0;
+  guint i;
+
+  /* sink_1 sends the first buffer and then stalls for 10 seconds */
+  str = g_strdup_printf ("tensor_mux name=mux sync_mode=timeout sync_option=%"
+      G_GUINT64_FORMAT " ! tensor_sink name=test_sink sync=false "
+      "videotestsrc num-buffers=%d pattern=black ! video/x-raw,width=4,height=4,format=GRAY8,framerate=(fraction)30/1 ! tensor_converter ! mux.sink_0 "
+      "videotestsrc is-live=true pattern=black ! video/x-raw,width=4,height=4,format=GRAY8,framerate=(fraction)1/10 ! tensor_converter ! mux.sink_1",
+      timeout, num_buffers);
+  pipeline = gst_parse_launch (str, NULL);
+  g_free (str);
+  ASSERT_TRUE (pipeline != NULL);
+
+  sink = gst_bin_get_by_name (GST_BIN (pipeline), "test_sink");
+  g_signal_connect (sink, "new-data", (GCallback) _mux_timeout_new_data_cb,
+      &received);
+  gst_object_unref (sink);
+
+  gst_element_set_state (pipeline, GST_STATE_PLAYING);
+
+  /**
+   * The first output may be dropped if the timer expires before the live source starts.
+   * The others are pushed by the timer with the first buffer of sink_1.
+   */
+  for (i = 0; i < 100; i++) {
+    if (g_atomic_int_get (&received) >= num_buffers - 1)
+      break;
+    g_usleep (50000);
+  }
+
+  /* wait for the last timer */
+  g_usleep (2 * timeout / GST_USECOND);
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (pipeline);
+
+  /* without the timer, no output is pushed until sink_1 sends the next buffer */
+  EXPECT_GE (g_atomic_int_get (&received), num_buffers - 1);
+  EXPECT_LE (g_atomic_int_get (&received), num_buffers);
+}
+
+/**
+ * @brief Data for the test of batch-timeout.
+ */
+typedef struct
+{
+  GMutex lock; /**< lock for the received data */
+  GCond cond; /**< condition to wait for the signal */
+  guint received; /**< number of the received buffers */
+  guint8 data[10]; /**< data of the first received buffer */
+} batch_timeout_data_s;
+
+/**
+ * @brief Callback for tensor sink signal to get the received buffers in the lists from the timer thread.
+ */
+static void
+_batch_timeout_new_data_list_cb (GstElement * element, GstBufferList * list,
+    gpointer user_data)
+{
+  batch_timeout_data_s *data = (batch_timeout_data_s *) user_data;
+
+  g_mutex_lock (&data->lock);
+  if (data->received == 0 && gst_buffer_list_length (list) > 0)
+    gst_buffer_extract (gst_buffer_list_get (list, 0), 0, data->data,
+        sizeof (data->data));
+  data->received += gst_buffer_list_length (list);
+  g_cond_broadcast (&data->cond);
+  g_mutex_unlock (&data->lock);
+}
+
+/**
+ * @brief Test for tensor sink batch-timeout, the timer passes the batch of a stalled stream.
+ */
+TEST (tensor_sink_test, signal_batch_timeout_stalled_p)
+{
+  GstElement *pipeline, *sink, *appsrc;
+  batch_timeout_data_s data;
+  GstBuffer *buf;
+  guint8 *raw;
+  gint64 end_time;
+  guint i;
+
+  g_mutex_init (&data.lock);
+  g_cond_init (&data.cond);
+  data.received = 0;
+  memset (data.data, 0, sizeof (data.data));
+
+  pipeline = gst_parse_launch ("appsrc name=appsrc caps=application/octet-stream ! "
+      "tensor_converter input-dim=1:10 input-type=uint8 ! "
+      "tensor_sink name=test_sink sync=false batch-size=4 batch-timeout=100",
+      NULL);
+  ASSERT_TRUE (pipeline != NULL);
+
+  sink = gst_bin_get_by_name (GST_BIN (pipeline), "test_sink");
+  g_signal_connect (sink, "new-data-list",
+      (GCallback) _batch_timeout_new_data_list_cb, &data);
+  gst_object_unref (sink);
+
+  EXPECT_NE (gst_element_set_state (pipeline, GST_STATE_PLAYING),
+      GST_STATE_CHANGE_FAILURE);
+
+  /* push one buffer and stall the stream (no more buffer and no eos) */
+  raw = (guint8 *) g_malloc (10);
+  for (i = 0; i < 10; i++)
+    raw[i] = (guint8) (i + 1);
+  buf = gst_buffer_new_wrapped (raw, 10);
+
+  appsrc = gst_bin_get_by_name (GST_BIN (pipeline), "appsrc");
+  EXPECT_EQ (gst_app_src_push_buffer (GST_APP_SRC (appsrc), buf), GST_FLOW_OK);
+
+  /* the batch is not full, only the timer can pass it (wait limit to avoid hanging) */
+  end_time = g_get_monotonic_time () + 10 * G_TIME_SPAN_SECOND;
+  g_mutex_lock (&data.lock);
+  while (data.received == 0) {
+    if (!g_cond_wait_until (&data.cond, &data.lock, end_time))
+      break;
+  }
+  g_mutex_unlock (&data.lock);
+
+  EXPECT_EQ (gst_element_set_state (pipeline, GST_STATE_NULL),
+      GST_STATE_CHANGE_SUCCESS);
+
+  /* the stopped sink does not emit the signal any more */
+  EXPECT_EQ (gst_app_src_push_buffer (GST_APP_SRC (appsrc),
+          gst_buffer_new_allocate (NULL, 10, NULL)), GST_FLOW_FLUSHING);
+
+  gst_object_unref (appsrc);
+  gst_object_unref (pipeline);
+
+  EXPECT_EQ (data.received, 1U);
+  for (i = 0; i < 10; i++)
+    EXPECT_EQ (data.data[i], (guint8) (i + 1));
+
+  g_cond_clear (&data.cond);
+  g_mutex_clear (&data.lock);
+}
+
 #include <tensor_filter_custom_easy.h>
 
 /**
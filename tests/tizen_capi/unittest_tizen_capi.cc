@@ -430,6 +430,69 @@ test_sink_callback_count (const ml_tensors_data_h data,
   G_UNLOCK(callback_lock);
 }
 
+/**
+ * @brief A tensor-sink callback for the list of data
+ */
+static void
+test_sink_callback_list (const ml_tensors_data_h * data, unsigned int num_data,
+    const ml_tensors_info_h info, void *user_data)
+{
+  guint *count = (guint *) user_data;
+  unsigned int i;
+
+  G_LOCK(callback_lock);
+  for (i = 0; i < num_data; i++) {
+    void *raw = NULL;
+    size_t size = 0;
+
+    if (ml_tensors_data_get_tensor_data (data[i], 0, &raw, &size) == ML_ERROR_NONE &&
+        raw != NULL && size > 0)
+      count[1]++;
+  }
+  count[0]++;
+  G_UNLOCK(callback_lock);
+}
+
+/**
+ * @brief A slow tensor-sink callback to test the async dispatch
+ */
+static void
+test_sink_callback_slow (const ml_tensors_data_h data,
+    const ml_tensors_info_h info, void *user_data)
+{
+  g_usleep (20000); /* 20ms. Slower than the stream. */
+  test_sink_callback_count (data, info, user_data);
+}
+
+/**
+ * @brief Data for the tensor-sink callback calling the API of the sink handle
+ */
+typedef struct {
+  ml_pipeline_sink_h sinkhandle;
+  guint count;
+  guint errors;
+} test_sink_reentrant_data;
+
+/**
+ * @brief A slow tensor-sink callback calling the API of its own sink handle
+ */
+static void
+test_sink_callback_reentrant (const ml_tensors_data_h data,
+    const ml_tensors_info_h info, void *user_data)
+{
+  test_sink_reentrant_data *rd = (test_sink_reentrant_data *) user_data;
+  guint queued, dropped;
+
+  g_usleep (20000); /* 20ms. The streaming thread waits for the queue. */
+
+  G_LOCK (callback_lock);
+  if (ml_pipeline_sink_get_dispatch_stats (rd->sinkhandle, &queued,
+          &dropped) != ML_ERROR_NONE)
+    rd->errors++;
+  rd->count++;
+  G_UNLOCK (callback_lock);
+}
+
 /**
  * @brief Pipeline state changed callback
  */
@@ -742,1422 +805,1586 @@ TEST (nnstreamer_capi_sink, failure_01_n)
 }
 
 /**
- * @brief Test NNStreamer pipeline src
+ * @brief Test NNStreamer pipeline sink
+ * @detail The callback is called in the dispatch thread and all data is passed with block policy.
  */
-TEST (nnstreamer_capi_src, dummy_01)
+TEST (nnstreamer_capi_sink, dispatch_block_p)
 {
-  const gchar *_tmpdir = g_get_tmp_dir ();
-  const gchar *_dirname = "nns-tizen-XXXXXX";
-  gchar *fullpath = g_build_path ("/", _tmpdir, _dirname, NULL);
-  gchar *dir = g_mkdtemp ((gchar *) fullpath);
-  gchar *file1 = g_build_path ("/", dir, "output", NULL);
-  gchar *pipeline =
-      g_strdup_printf
-      ("appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! filesink location=\"%s\" buffer-mode=unbuffered",
-      file1);
   ml_pipeline_h handle;
-  ml_pipeline_state_e state;
-  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data1, data2;
-  unsigned int count = 0;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  ml_tensor_dimension dim = { 0, };
+  guint *count_sink;
+  guint queued, dropped, count, i;
 
-  int i;
-  uint8_t *uintarray1[10];
-  uint8_t *uintarray2[10];
-  uint8_t *content = NULL;
-  gsize len;
+  pipeline = g_strdup ("videotestsrc num-buffers=10 ! videoconvert ! video/x-raw,format=RGB,width=16,height=16 ! "
+      "tensor_converter ! tensor_sink name=sinkx sync=false");
+
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (dir != NULL);
-  for (i = 0; i < 10; i++) {
-    uintarray1[i] = (uint8_t *) g_malloc (4);
-    ASSERT_TRUE (uintarray1[i] != NULL);
-    uintarray1[i][0] = i + 4;
-    uintarray1[i][1] = i + 1;
-    uintarray1[i][2] = i + 3;
-    uintarray1[i][3] = i + 2;
-
-    uintarray2[i] = (uint8_t *) g_malloc (4);
-    ASSERT_TRUE (uintarray2[i] != NULL);
-    uintarray2[i][0] = i + 3;
-    uintarray2[i][1] = i + 2;
-    uintarray2[i][2] = i + 1;
-    uintarray2[i][3] = i + 4;
-    /* These will be free'ed by gstreamer (ML_PIPELINE_BUF_POLICY_AUTO_FREE) */
-    /** @todo Check whether gstreamer really deallocates this */
-  }
 
-  status = ml_pipeline_start (handle);
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_slow, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (10000); /* 10ms. Wait a bit. */
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status, ML_ERROR_NONE); /* At this moment, it can be READY, PAUSED, or PLAYING */
-  EXPECT_NE (state, ML_PIPELINE_STATE_UNKNOWN);
-  EXPECT_NE (state, ML_PIPELINE_STATE_NULL);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  status = ml_pipeline_sink_set_dispatch (sinkhandle, ML_PIPELINE_SINK_DISPATCH_ASYNC_BLOCK, 2);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_get_count (info, &count);
-  EXPECT_EQ (count, 1U);
-
-  ml_tensors_info_get_tensor_type (info, 0, &type);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
-
-  ml_tensors_info_get_tensor_dimension (info, 0, dim);
-  EXPECT_EQ (dim[0], 4U);
-  EXPECT_EQ (dim[1], 1U);
-  EXPECT_EQ (dim[2], 1U);
-  EXPECT_EQ (dim[3], 1U);
-
-  status = ml_tensors_data_create (info, &data1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* wait for the dispatch thread (max 2 sec) */
+  for (i = 0; i < 100; i++) {
+    G_LOCK (callback_lock);
+    count = *count_sink;
+    G_UNLOCK (callback_lock);
 
-  ml_tensors_info_destroy (info);
+    if (count >= 10U)
+      break;
+    g_usleep (20000);
+  }
 
-  status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[0], 4);
+  status = ml_pipeline_sink_get_dispatch_stats (sinkhandle, &queued, &dropped);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (queued, 0U);
+  EXPECT_EQ (dropped, 0U);
 
-  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000); /* 50ms. Wait a bit. */
 
-  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000); /* 50ms. Wait a bit. */
 
-  status = ml_pipeline_src_release_handle (srchandle);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (*count_sink, 10U);
 
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+  g_free (count_sink);
+}
 
-  ml_tensors_info_get_count (info, &count);
-  EXPECT_EQ (count, 1U);
+/**
+ * @brief Test NNStreamer pipeline sink
+ * @detail The callback calls the API of the sink handle while the streaming thread waits for the queue.
+ */
+TEST (nnstreamer_capi_sink, dispatch_block_reentrant_p)
+{
+  ml_pipeline_h handle;
+  test_sink_reentrant_data *rd;
+  gchar *pipeline;
+  int status;
+  guint count, i;
 
-  ml_tensors_info_get_tensor_type (info, 0, &type);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  pipeline = g_strdup ("videotestsrc num-buffers=10 ! videoconvert ! video/x-raw,format=RGB,width=16,height=16 ! "
+      "tensor_converter ! tensor_sink name=sinkx sync=false");
 
-  ml_tensors_info_get_tensor_dimension (info, 0, dim);
-  EXPECT_EQ (dim[0], 4U);
-  EXPECT_EQ (dim[1], 1U);
-  EXPECT_EQ (dim[2], 1U);
-  EXPECT_EQ (dim[3], 1U);
+  rd = (test_sink_reentrant_data *) g_malloc0 (sizeof (test_sink_reentrant_data));
+  ASSERT_TRUE (rd != NULL);
 
-  for (i = 0; i < 10; i++) {
-    status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[i], 4);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  G_LOCK (callback_lock);
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_reentrant, rd, &rd->sinkhandle);
+  G_UNLOCK (callback_lock);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_tensors_data_create (info, &data2);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_set_dispatch (rd->sinkhandle, ML_PIPELINE_SINK_DISPATCH_ASYNC_BLOCK, 1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_tensors_data_set_tensor_data (data2, 0, uintarray2[i], 4);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_pipeline_src_input_data (srchandle, data2, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  /* wait for the dispatch thread (max 2 sec) */
+  for (i = 0; i < 100; i++) {
+    G_LOCK (callback_lock);
+    count = rd->count;
+    G_UNLOCK (callback_lock);
 
-    g_usleep (50000); /* 50ms. Wait a bit. */
+    if (count >= 10U)
+      break;
+    g_usleep (20000);
   }
 
-  status = ml_pipeline_src_release_handle (srchandle);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (50000); /* Wait for the pipeline to flush all */
+  status = ml_pipeline_sink_unregister (rd->sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-
-  EXPECT_TRUE (g_file_get_contents (file1, (gchar **) &content, &len, NULL));
-  EXPECT_EQ (len, 8U * 11);
-
-  for (i = 0; i < 10; i++) {
-    EXPECT_EQ (content[i * 8 + 0 + 8], i + 4);
-    EXPECT_EQ (content[i * 8 + 1 + 8], i + 1);
-    EXPECT_EQ (content[i * 8 + 2 + 8], i + 3);
-    EXPECT_EQ (content[i * 8 + 3 + 8], i + 2);
-    EXPECT_EQ (content[i * 8 + 4 + 8], i + 3);
-    EXPECT_EQ (content[i * 8 + 5 + 8], i + 2);
-    EXPECT_EQ (content[i * 8 + 6 + 8], i + 1);
-    EXPECT_EQ (content[i * 8 + 7 + 8], i + 4);
-  }
+  EXPECT_EQ (rd->count, 10U);
+  EXPECT_EQ (rd->errors, 0U);
 
-  g_free (content);
-  ml_tensors_info_destroy (info);
-  ml_tensors_data_destroy (data1);
+  g_free (pipeline);
+  g_free (rd);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when pipeline is NULL.
+ * @brief Test NNStreamer pipeline sink
+ * @detail The pipeline does not wait for the slow callback with drop-oldest policy.
  */
-TEST (nnstreamer_capi_src, failure_01_n)
+TEST (nnstreamer_capi_sink, dispatch_drop_oldest_p)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
+  gchar *pipeline;
   int status;
-  ml_pipeline_src_h srchandle;
+  guint *count_sink;
+  guint queued, dropped, count, i;
 
-  status = ml_pipeline_src_get_handle (NULL, "dummy", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  pipeline = g_strdup ("videotestsrc num-buffers=50 ! videoconvert ! video/x-raw,format=RGB,width=16,height=16 ! "
+      "tensor_converter ! tensor_sink name=sinkx sync=false");
 
-/**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
- */
-TEST (nnstreamer_capi_src, failure_02_n)
-{
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
-  ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : pipe */
-  status = ml_pipeline_src_get_handle (NULL, "mysource", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_slow, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : name */
-  status = ml_pipeline_src_get_handle (handle, NULL, &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_set_dispatch (sinkhandle, ML_PIPELINE_SINK_DISPATCH_ASYNC_DROP_OLDEST, 1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : wrong name */
-  status = ml_pipeline_src_get_handle (handle, "wrongname", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : invalid type */
-  status = ml_pipeline_src_get_handle (handle, "valvex", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* wait until all buffers are passed or dropped (max 2 sec) */
+  for (i = 0; i < 100; i++) {
+    G_LOCK (callback_lock);
+    count = *count_sink;
+    G_UNLOCK (callback_lock);
 
-  /* invalid param : handle */
-  status = ml_pipeline_src_get_handle (handle, "mysource", NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    status = ml_pipeline_sink_get_dispatch_stats (sinkhandle, &queued, &dropped);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (queued <= 1U);
+
+    if (count + dropped >= 50U)
+      break;
+    g_usleep (20000);
+  }
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_TRUE (*count_sink > 0U);
+  EXPECT_TRUE (dropped > 0U);
+  EXPECT_EQ (*count_sink + dropped, 50U);
+
+  g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the number of tensors is 0 or bigger than ML_TENSOR_SIZE_LIMIT;
+ * @brief Test NNStreamer pipeline sink
+ * @detail The callback gets the list of data (batch mode of tensor_sink).
  */
-TEST (nnstreamer_capi_src, failure_03_n)
+TEST (nnstreamer_capi_sink, register_list_p)
 {
-  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
-  ml_tensors_data_h data;
-  ml_tensors_info_h info;
+  ml_pipeline_sink_h sinkhandle, sinkhandle_each;
+  gchar *pipeline;
+  int status;
+  guint *count_sink;
+  guint *count_list;
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("videotestsrc num-buffers=10 ! videoconvert ! video/x-raw,format=RGB,width=16,height=16 ! "
+      "tensor_converter ! tensor_sink name=sinkx sync=false");
 
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* [0] number of callbacks, [1] number of data */
+  count_list = (guint *) g_malloc0 (sizeof (guint) * 2);
+  ASSERT_TRUE (count_list != NULL);
 
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (info, &data);
+  status = ml_pipeline_sink_register_list (handle, "sinkx", 4, 0, test_sink_callback_list, count_list, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle != NULL);
 
-  /* null data */
-  status = ml_pipeline_src_input_data (srchandle, NULL, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* the handle for each data gets the same data */
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle_each);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_release_handle (srchandle);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  g_usleep (500000); /* 500ms. Let all frames flow. */
+
   status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_sink_unregister (sinkhandle_each);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_destroy (data);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  /* 4 + 4 + 2 (the remaining data is passed at eos) */
+  EXPECT_EQ (count_list[0], 3U);
+  EXPECT_EQ (count_list[1], 10U);
+  EXPECT_EQ (*count_sink, 10U);
+
+  g_free (pipeline);
+  g_free (count_sink);
+  g_free (count_list);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
+ * @brief Test NNStreamer pipeline sink
+ * @detail Failure case to register the callback for the list of data with invalid param.
  */
-TEST (nnstreamer_capi_switch, dummy_01)
+TEST (nnstreamer_capi_sink, register_list_n)
 {
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
   ml_pipeline_sink_h sinkhandle;
-  ml_pipeline_switch_e type;
-  ml_pipeline_state_e state;
   gchar *pipeline;
   int status;
-  guint *count_sink;
-  TestPipeState *pipe_state;
-  gchar **node_list = NULL;
+  guint count_list[2] = { 0, 0 };
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-      "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-      "videotestsrc num-buffers=3 is-live=true ! videoconvert ! ins.sink_1");
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! tee name=t "
+      "t. ! queue ! tensor_converter ! tensor_sink name=sinkx "
+      "t. ! queue ! tensor_converter ! appsink name=appsinkx");
 
-  count_sink = (guint *) g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  pipe_state = (TestPipeState *) g_new0 (TestPipeState, 1);
-  ASSERT_TRUE (pipe_state != NULL);
+  /* invalid param : pipe */
+  status = ml_pipeline_sink_register_list (NULL, "sinkx", 4, 0, test_sink_callback_list, count_list, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* invalid param : batch size */
+  status = ml_pipeline_sink_register_list (handle, "sinkx", 1, 0, test_sink_callback_list, count_list, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_switch_get_handle (handle, "ins", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_PIPELINE_SWITCH_INPUT_SELECTOR);
+  /* invalid param : appsink */
+  status = ml_pipeline_sink_register_list (handle, "appsinkx", 4, 0, test_sink_callback_list, count_list, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
+  /* invalid param : callback */
+  status = ml_pipeline_sink_register_list (handle, "sinkx", 4, 0, NULL, count_list, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid param : handle */
+  status = ml_pipeline_sink_register_list (handle, "sinkx", 4, 0, test_sink_callback_list, count_list, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  if (node_list) {
-    gchar *name = NULL;
-    guint idx = 0;
+  g_free (pipeline);
+}
 
-    while ((name = node_list[idx]) != NULL) {
-      EXPECT_TRUE (g_str_equal (name, "sink_0") || g_str_equal (name, "sink_1"));
-      idx++;
-      g_free (name);
-    }
+/**
+ * @brief Test NNStreamer pipeline sink
+ * @detail Failure case to set the dispatch policy with invalid param.
+ */
+TEST (nnstreamer_capi_sink, dispatch_invalid_param_n)
+{
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
+  gchar *pipeline;
+  int status;
+  guint count_sink = 0;
 
-    EXPECT_EQ (idx, 2U);
-    g_free (node_list);
-  }
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! tensor_converter ! tensor_sink name=sinkx");
 
-  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle != NULL);
 
-  status = ml_pipeline_switch_select (switchhandle, "sink_1");
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, &count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* invalid param : handle */
+  status = ml_pipeline_sink_set_dispatch (NULL, ML_PIPELINE_SINK_DISPATCH_ASYNC_BLOCK, 2);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  g_usleep (50000);
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  wait_for_start (handle, state, status);
+  /* invalid param : policy */
+  status = ml_pipeline_sink_set_dispatch (sinkhandle, (ml_pipeline_sink_dispatch_e) 10, 2);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  g_usleep (300000); /* 300ms. Let a few frames flow. */
+  /* invalid param : max queue */
+  status = ml_pipeline_sink_set_dispatch (sinkhandle, ML_PIPELINE_SINK_DISPATCH_ASYNC_DROP_OLDEST, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* invalid param : handle */
+  status = ml_pipeline_sink_get_dispatch_stats (NULL, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_EQ (*count_sink, 3U);
-
-  EXPECT_TRUE (pipe_state->paused);
-  EXPECT_TRUE (pipe_state->playing);
-
   g_free (pipeline);
-  g_free (count_sink);
-  g_free (pipe_state);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
+ * @brief Test NNStreamer pipeline src
  */
-TEST (nnstreamer_capi_switch, dummy_02)
+TEST (nnstreamer_capi_src, dummy_01)
 {
+  const gchar *_tmpdir = g_get_tmp_dir ();
+  const gchar *_dirname = "nns-tizen-XXXXXX";
+  gchar *fullpath = g_build_path ("/", _tmpdir, _dirname, NULL);
+  gchar *dir = g_mkdtemp ((gchar *) fullpath);
+  gchar *file1 = g_build_path ("/", dir, "output", NULL);
+  gchar *pipeline =
+      g_strdup_printf
+      ("appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! filesink location=\"%s\" buffer-mode=unbuffered",
+      file1);
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_sink_h sinkhandle0, sinkhandle1;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
+  ml_pipeline_state_e state;
+  ml_pipeline_src_h srchandle;
   int status;
-  guint *count_sink0, *count_sink1;
-  gchar **node_list = NULL;
-
-  /**
-   * Prerolling problem
-   * For running the test, set async=false in the sink element when using an output selector.
-   * The pipeline state can be changed to paused after all sink element receive buffer.
-   */
-  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! output-selector name=outs "
-      "outs.src_0 ! tensor_sink name=sink0 async=false "
-      "outs.src_1 ! tensor_sink name=sink1 async=false");
-
-  count_sink0 = (guint *) g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink0 != NULL);
-  *count_sink0 = 0;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data1, data2;
+  unsigned int count = 0;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  ml_tensor_dimension dim = { 0, };
 
-  count_sink1 = (guint *) g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink1 != NULL);
-  *count_sink1 = 0;
+  int i;
+  uint8_t *uintarray1[10];
+  uint8_t *uintarray2[10];
+  uint8_t *content = NULL;
+  gsize len;
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (dir != NULL);
+  for (i = 0; i < 10; i++) {
+    uintarray1[i] = (uint8_t *) g_malloc (4);
+    ASSERT_TRUE (uintarray1[i] != NULL);
+    uintarray1[i][0] = i + 4;
+    uintarray1[i][1] = i + 1;
+    uintarray1[i][2] = i + 3;
+    uintarray1[i][3] = i + 2;
 
-  status = ml_pipeline_switch_get_handle (handle, "outs", &type, &switchhandle);
+    uintarray2[i] = (uint8_t *) g_malloc (4);
+    ASSERT_TRUE (uintarray2[i] != NULL);
+    uintarray2[i][0] = i + 3;
+    uintarray2[i][1] = i + 2;
+    uintarray2[i][2] = i + 1;
+    uintarray2[i][3] = i + 4;
+    /* These will be free'ed by gstreamer (ML_PIPELINE_BUF_POLICY_AUTO_FREE) */
+    /** @todo Check whether gstreamer really deallocates this */
+  }
+
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_PIPELINE_SWITCH_OUTPUT_SELECTOR);
+  g_usleep (10000); /* 10ms. Wait a bit. */
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE); /* At this moment, it can be READY, PAUSED, or PLAYING */
+  EXPECT_NE (state, ML_PIPELINE_STATE_UNKNOWN);
+  EXPECT_NE (state, ML_PIPELINE_STATE_NULL);
 
-  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  if (node_list) {
-    gchar *name = NULL;
-    guint idx = 0;
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    while ((name = node_list[idx]) != NULL) {
-      EXPECT_TRUE (g_str_equal (name, "src_0") || g_str_equal (name, "src_1"));
-      idx++;
-      g_free (name);
-    }
+  ml_tensors_info_get_count (info, &count);
+  EXPECT_EQ (count, 1U);
 
-    EXPECT_EQ (idx, 2U);
-    g_free (node_list);
-  }
+  ml_tensors_info_get_tensor_type (info, 0, &type);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-  status = ml_pipeline_sink_register (handle, "sink0", test_sink_callback_count, count_sink0, &sinkhandle0);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle0 != NULL);
+  ml_tensors_info_get_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (dim[0], 4U);
+  EXPECT_EQ (dim[1], 1U);
+  EXPECT_EQ (dim[2], 1U);
+  EXPECT_EQ (dim[3], 1U);
 
-  status = ml_pipeline_sink_register (handle, "sink1", test_sink_callback_count, count_sink1, &sinkhandle1);
+  status = ml_tensors_data_create (info, &data1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle1 != NULL);
 
-  status = ml_pipeline_switch_select (switchhandle, "src_1");
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (info);
 
-  status = ml_pipeline_start (handle);
+  status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[0], 4);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (200000); /* 200ms. Let a few frames flow. */
-
-  status = ml_pipeline_stop (handle);
+  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000); /* 50ms. Wait a bit. */
 
-  status = ml_pipeline_sink_unregister (sinkhandle0);
+  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000); /* 50ms. Wait a bit. */
 
-  status = ml_pipeline_sink_unregister (sinkhandle1);
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_EQ (*count_sink0, 0U);
-  EXPECT_TRUE (*count_sink1 > 0U);
+  ml_tensors_info_get_count (info, &count);
+  EXPECT_EQ (count, 1U);
 
-  g_free (pipeline);
-  g_free (count_sink0);
-  g_free (count_sink1);
-}
+  ml_tensors_info_get_tensor_type (info, 0, &type);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-/**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
- */
-TEST (nnstreamer_capi_switch, failure_01_n)
-{
-  ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
-  int status;
+  ml_tensors_info_get_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (dim[0], 4U);
+  EXPECT_EQ (dim[1], 1U);
+  EXPECT_EQ (dim[2], 1U);
+  EXPECT_EQ (dim[3], 1U);
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-      "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-      "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
-
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < 10; i++) {
+    status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[i], 4);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : pipe */
-  status = ml_pipeline_switch_get_handle (NULL, "ins", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : name */
-  status = ml_pipeline_switch_get_handle (handle, NULL, &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    status = ml_tensors_data_create (info, &data2);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : wrong name */
-  status = ml_pipeline_switch_get_handle (handle, "wrongname", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    status = ml_tensors_data_set_tensor_data (data2, 0, uintarray2[i], 4);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : invalid type */
-  status = ml_pipeline_switch_get_handle (handle, "sinkx", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    status = ml_pipeline_src_input_data (srchandle, data2, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : handle */
-  status = ml_pipeline_switch_get_handle (handle, "ins", &type, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    g_usleep (50000); /* 50ms. Wait a bit. */
+  }
 
-  /* succesfully get switch handle if the param type is null */
-  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : handle */
-  status = ml_pipeline_switch_select (NULL, "invalidpadname");
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  /* invalid param : pad name */
-  status = ml_pipeline_switch_select (switchhandle, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  /* invalid param : wrong pad name */
-  status = ml_pipeline_switch_select (switchhandle, "wrongpadname");
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_pipeline_switch_release_handle (switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000); /* Wait for the pipeline to flush all */
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
+
+  EXPECT_TRUE (g_file_get_contents (file1, (gchar **) &content, &len, NULL));
+  EXPECT_EQ (len, 8U * 11);
+
+  for (i = 0; i < 10; i++) {
+    EXPECT_EQ (content[i * 8 + 0 + 8], i + 4);
+    EXPECT_EQ (content[i * 8 + 1 + 8], i + 1);
+    EXPECT_EQ (content[i * 8 + 2 + 8], i + 3);
+    EXPECT_EQ (content[i * 8 + 3 + 8], i + 2);
+    EXPECT_EQ (content[i * 8 + 4 + 8], i + 3);
+    EXPECT_EQ (content[i * 8 + 5 + 8], i + 2);
+    EXPECT_EQ (content[i * 8 + 6 + 8], i + 1);
+    EXPECT_EQ (content[i * 8 + 7 + 8], i + 4);
+  }
+
+  g_free (content);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data1);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of NNFW
+ * @brief Callback to release the memory block given by the test.
  */
-TEST (nnstreamer_capi_util, availability_00)
+static void
+test_free_wrapped_data (void *user_data)
 {
-  bool result;
-  int status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-#ifdef ENABLE_NNFW_RUNTIME
-  EXPECT_EQ (result, true);
-#else   /* ENABLE_NNFW_RUNTIME */
-  EXPECT_EQ (result, false);
-#endif  /* ENABLE_NNFW_RUNTIME */
-
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_AUTO, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-#ifdef ENABLE_NNFW_RUNTIME
-  EXPECT_EQ (result, true);
-#else   /* ENABLE_NNFW_RUNTIME */
-  EXPECT_EQ (result, false);
-#endif  /* ENABLE_NNFW_RUNTIME */
+  guint *count = (guint *) user_data;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-#ifdef ENABLE_NNFW_RUNTIME
-  EXPECT_EQ (result, true);
-#else   /* ENABLE_NNFW_RUNTIME */
-  EXPECT_EQ (result, false);
-#endif  /* ENABLE_NNFW_RUNTIME */
+  g_atomic_int_inc (count);
 }
 
-#ifdef ENABLE_TENSORFLOW_LITE
 /**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
+ * @brief Test NNStreamer pipeline src
+ * @detail Push the memory blocks of application without copy.
  */
-TEST (nnstreamer_capi_util, availability_01)
+TEST (nnstreamer_capi_src, wrapped_data_p)
 {
-  bool result;
-  int status;
+  const gchar *_tmpdir = g_get_tmp_dir ();
+  const gchar *_dirname = "nns-tizen-XXXXXX";
+  gchar *fullpath = g_build_path ("/", _tmpdir, _dirname, NULL);
+  gchar *dir = g_mkdtemp ((gchar *) fullpath);
+  gchar *file1 = g_build_path ("/", dir, "output", NULL);
+  gchar *pipeline =
+      g_strdup_printf
+      ("appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! filesink location=\"%s\" buffer-mode=unbuffered",
+      file1);
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  uint8_t frames[5][4];
+  void *raw_data[1];
+  void *data_ptr;
+  size_t data_size;
+  guint num_released = 0;
+  uint8_t *content = NULL;
+  gsize len;
+  int i, status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, &result);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_AUTO, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU_NEON, &result);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_GPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  for (i = 0; i < 5; i++) {
+    frames[i][0] = i + 1;
+    frames[i][1] = i + 2;
+    frames[i][2] = i + 3;
+    frames[i][3] = i + 4;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
-}
+    raw_data[0] = frames[i];
+    status = ml_tensors_data_create_from_ptr (info, raw_data,
+        test_free_wrapped_data, &num_released, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
- */
-TEST (nnstreamer_capi_util, availability_fail_01_n)
-{
-  bool result;
-  int status;
+    /* the handle refers the memory block without copy */
+    status = ml_tensors_data_get_tensor_data (data, 0, &data_ptr, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (data_ptr == frames[i]);
+    EXPECT_EQ (data_size, 4U);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_MOVIDIUS, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_EDGE_TPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+    g_usleep (50000); /* 50ms. Wait a bit. */
+  }
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_VIVANTE, &result);
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_SR, &result);
+  g_usleep (50000); /* Wait for the pipeline to flush all */
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
-#endif /* ENABLE_TENSORFLOW_LITE */
 
-#ifdef ENABLE_TENSORFLOW
-/**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
- */
-TEST (nnstreamer_capi_util, availability_02)
-{
-  bool result;
-  int status;
+  /* all memory blocks are released by the pipeline */
+  EXPECT_EQ (num_released, 5U);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  EXPECT_TRUE (g_file_get_contents (file1, (gchar **) &content, &len, NULL));
+  EXPECT_EQ (len, 4U * 5);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_AUTO, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  for (i = 0; i < 5 && len == 4U * 5; i++) {
+    EXPECT_EQ (content[i * 4 + 0], i + 1);
+    EXPECT_EQ (content[i * 4 + 1], i + 2);
+    EXPECT_EQ (content[i * 4 + 2], i + 3);
+    EXPECT_EQ (content[i * 4 + 3], i + 4);
+  }
+
+  g_free (content);
+  ml_tensors_info_destroy (info);
+  g_free (pipeline);
+  g_free (file1);
+  g_free (fullpath);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when pipeline is NULL.
  */
-TEST (nnstreamer_capi_util, availability_fail_02_n)
+TEST (nnstreamer_capi_src, failure_01_n)
 {
-  bool result;
   int status;
+  ml_pipeline_src_h srchandle;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_CPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_GPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  status = ml_pipeline_src_get_handle (NULL, "dummy", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 }
-#endif /** ENABLE_TENSORFLOW */
 
 /**
- * @brief Test NNStreamer Utility for checking availability of custom backend
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
  */
-TEST (nnstreamer_capi_util, availability_03)
+TEST (nnstreamer_capi_src, failure_02_n)
 {
-  bool result;
-  int status;
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY, &result);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_AUTO, &result);
+  /* invalid param : pipe */
+  status = ml_pipeline_src_get_handle (NULL, "mysource", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid param : name */
+  status = ml_pipeline_src_get_handle (handle, NULL, &srchandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid param : wrong name */
+  status = ml_pipeline_src_get_handle (handle, "wrongname", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid param : invalid type */
+  status = ml_pipeline_src_get_handle (handle, "valvex", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid param : handle */
+  status = ml_pipeline_src_get_handle (handle, "mysource", NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of custom backend
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the number of tensors is 0 or bigger than ML_TENSOR_SIZE_LIMIT;
  */
-TEST (nnstreamer_capi_util, availability_fail_03_n)
+TEST (nnstreamer_capi_src, failure_03_n)
 {
-  bool result;
-  int status;
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_data_h data;
+  ml_tensors_info_h info;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_CPU, &result);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
-
-#ifdef ENABLE_NNFW_RUNTIME
-/**
- * @brief Test NNStreamer Utility for checking availability of custom backend
- */
-TEST (nnstreamer_capi_util, availability_04)
-{
-  bool result;
-  int status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_AUTO, &result);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_CPU, &result);
+  status = ml_tensors_data_create (info, &data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_GPU, &result);
+  /* null data */
+  status = ml_pipeline_src_input_data (srchandle, NULL, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU, &result);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
-}
 
-/**
- * @brief Test NNStreamer Utility for checking availability of custom backend
- */
-TEST (nnstreamer_capi_util, availability_fail_04_n)
-{
-  bool result;
-  int status;
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU_SR, &result);
+  status = ml_tensors_data_destroy (data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  status = ml_tensors_info_destroy (info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+
 }
-#endif /** ENABLE_NNFW_RUNTIME */
 
-#ifdef ENABLE_MOVIDIUS_NCSDK2
 /**
- * @brief Test NNStreamer Utility for checking availability of custom backend
+ * @brief Test NNStreamer pipeline switch
  */
-TEST (nnstreamer_capi_util, availability_05)
+TEST (nnstreamer_capi_switch, dummy_01)
 {
-  bool result;
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_switch_e type;
+  ml_pipeline_state_e state;
+  gchar *pipeline;
   int status;
+  guint *count_sink;
+  TestPipeState *pipe_state;
+  gchar **node_list = NULL;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_ANY, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+      "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+      "videotestsrc num-buffers=3 is-live=true ! videoconvert ! ins.sink_1");
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_AUTO, &result);
+  count_sink = (guint *) g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
+
+  pipe_state = (TestPipeState *) g_new0 (TestPipeState, 1);
+  ASSERT_TRUE (pipe_state != NULL);
+
+  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_NPU, &result);
+  status = ml_pipeline_switch_get_handle (handle, "ins", &type, &switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  EXPECT_EQ (type, ML_PIPELINE_SWITCH_INPUT_SELECTOR);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
-}
 
-/**
- * @brief Test NNStreamer Utility for checking availability of custom backend
- */
-TEST (nnstreamer_capi_util, availability_fail_05_n)
-{
-  bool result;
-  int status;
+  if (node_list) {
+    gchar *name = NULL;
+    guint idx = 0;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_CPU, &result);
+    while ((name = node_list[idx]) != NULL) {
+      EXPECT_TRUE (g_str_equal (name, "sink_0") || g_str_equal (name, "sink_1"));
+      idx++;
+      g_free (name);
+    }
+
+    EXPECT_EQ (idx, 2U);
+    g_free (node_list);
+  }
+
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  EXPECT_TRUE (sinkhandle != NULL);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_switch_select (switchhandle, "sink_1");
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
-#endif /** ENABLE_MOVIDIUS_NCSDK2 */
 
-#ifdef ENABLE_ARMNN
-/**
- * @brief Test NNStreamer Utility for checking availability of custom backend
- */
-TEST (nnstreamer_capi_util, availability_06)
-{
-  bool result;
-  int status;
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY, &result);
+  g_usleep (50000);
+  status = ml_pipeline_get_state (handle, &state);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  wait_for_start (handle, state, status);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_AUTO, &result);
+  g_usleep (300000); /* 300ms. Let a few frames flow. */
+
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_CPU_NEON, &result);
+  status = ml_pipeline_switch_release_handle (switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
-}
 
-/**
- * @brief Test NNStreamer Utility for checking availability of custom backend
- */
-TEST (nnstreamer_capi_util, availability_fail_06_n)
-{
-  bool result;
-  int status;
+  EXPECT_EQ (*count_sink, 3U);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_NPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  EXPECT_TRUE (pipe_state->paused);
+  EXPECT_TRUE (pipe_state->playing);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_NPU_EDGE_TPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  g_free (pipeline);
+  g_free (count_sink);
+  g_free (pipe_state);
 }
-#endif /** ENABLE_ARMNN */
 
 /**
- * @brief Test NNStreamer Utility for checking tensors info handle
+ * @brief Test NNStreamer pipeline switch
  */
-TEST (nnstreamer_capi_util, tensors_info)
+TEST (nnstreamer_capi_switch, dummy_02)
 {
-  ml_tensors_info_h info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e out_type;
-  gchar *out_name;
-  size_t data_size;
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_sink_h sinkhandle0, sinkhandle1;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
   int status;
+  guint *count_sink0, *count_sink1;
+  gchar **node_list = NULL;
 
-  status = ml_tensors_info_create (&info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /**
+   * Prerolling problem
+   * For running the test, set async=false in the sink element when using an output selector.
+   * The pipeline state can be changed to paused after all sink element receive buffer.
+   */
+  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! output-selector name=outs "
+      "outs.src_0 ! tensor_sink name=sink0 async=false "
+      "outs.src_1 ! tensor_sink name=sink1 async=false");
 
-  in_dim[0] = 3;
-  in_dim[1] = 300;
-  in_dim[2] = 300;
-  in_dim[3] = 1;
+  count_sink0 = (guint *) g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink0 != NULL);
+  *count_sink0 = 0;
 
-  /* add tensor info */
-  status = ml_tensors_info_set_count (info, 2);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  count_sink1 = (guint *) g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink1 != NULL);
+  *count_sink1 = 0;
 
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, in_dim);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 1, in_dim);
+  status = ml_pipeline_switch_get_handle (handle, "outs", &type, &switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_name (info, 1, "tensor-name-test");
+  EXPECT_EQ (type, ML_PIPELINE_SWITCH_OUTPUT_SELECTOR);
+
+  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_UINT64);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-  status = ml_tensors_info_set_tensor_dimension (info, 2, in_dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  if (node_list) {
+    gchar *name = NULL;
+    guint idx = 0;
 
-  /* get tensor info */
-  status = ml_tensors_info_get_tensor_type (info, 0, &out_type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_type, ML_TENSOR_TYPE_UINT8);
+    while ((name = node_list[idx]) != NULL) {
+      EXPECT_TRUE (g_str_equal (name, "src_0") || g_str_equal (name, "src_1"));
+      idx++;
+      g_free (name);
+    }
 
-  status = ml_tensors_info_get_tensor_dimension (info, 0, out_dim);
+    EXPECT_EQ (idx, 2U);
+    g_free (node_list);
+  }
+
+  status = ml_pipeline_sink_register (handle, "sink0", test_sink_callback_count, count_sink0, &sinkhandle0);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_dim[0], 3U);
-  EXPECT_EQ (out_dim[1], 300U);
-  EXPECT_EQ (out_dim[2], 300U);
-  EXPECT_EQ (out_dim[3], 1U);
+  EXPECT_TRUE (sinkhandle0 != NULL);
 
-  status = ml_tensors_info_get_tensor_name (info, 0, &out_name);
+  status = ml_pipeline_sink_register (handle, "sink1", test_sink_callback_count, count_sink1, &sinkhandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (out_name == NULL);
+  EXPECT_TRUE (sinkhandle1 != NULL);
 
-  status = ml_tensors_info_get_tensor_type (info, 1, &out_type);
+  status = ml_pipeline_switch_select (switchhandle, "src_1");
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_type, ML_TENSOR_TYPE_FLOAT64);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 1, out_dim);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_dim[0], 3U);
-  EXPECT_EQ (out_dim[1], 300U);
-  EXPECT_EQ (out_dim[2], 300U);
-  EXPECT_EQ (out_dim[3], 1U);
-
-  status = ml_tensors_info_get_tensor_name (info, 1, &out_name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (out_name && g_str_equal (out_name, "tensor-name-test"));
 
-  status = ml_tensors_info_get_tensor_type (info, 2, &out_type);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  g_usleep (200000); /* 200ms. Let a few frames flow. */
 
-  status = ml_tensors_info_get_tensor_dimension (info, 2, out_dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_name (info, 2, &out_name);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_unregister (sinkhandle0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* get tensor size */
-  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  status = ml_pipeline_sink_unregister (sinkhandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == (3 * 300 * 300));
 
-  status = ml_tensors_info_get_tensor_size (info, 1, &data_size);
+  status = ml_pipeline_switch_release_handle (switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == (3 * 300 * 300 * 8));
 
-  status = ml_tensors_info_get_tensor_size (info, -1, &data_size);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == ((3 * 300 * 300) + (3 * 300 * 300 * 8)));
 
-  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (*count_sink0, 0U);
+  EXPECT_TRUE (*count_sink1 > 0U);
 
-  status = ml_tensors_info_destroy (info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+  g_free (count_sink0);
+  g_free (count_sink1);
 }
 
 /**
- * @brief Test utility functions
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, compare_info)
+TEST (nnstreamer_capi_switch, failure_01_n)
 {
-  ml_tensors_info_h info1, info2;
-  ml_tensor_dimension dim;
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
   int status;
 
-  status = ml_tensors_info_create (&info1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+      "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+      "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_create (&info2);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  dim[0] = 3;
-  dim[1] = 4;
-  dim[2] = 4;
-  dim[3] = 1;
+  /* invalid param : pipe */
+  status = ml_pipeline_switch_get_handle (NULL, "ins", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_set_count (info1, 1);
-  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+  /* invalid param : name */
+  status = ml_pipeline_switch_get_handle (handle, NULL, &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_set_count (info2, 1);
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  /* invalid param : wrong name */
+  status = ml_pipeline_switch_get_handle (handle, "wrongname", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* compare info */
-  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
+  /* invalid param : invalid type */
+  status = ml_pipeline_switch_get_handle (handle, "sinkx", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* change type */
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT16);
-  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
+  /* invalid param : handle */
+  status = ml_pipeline_switch_get_handle (handle, "ins", &type, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* validate info */
-  EXPECT_TRUE (ml_tensors_info_is_valid (info2));
+  /* succesfully get switch handle if the param type is null */
+  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* validate invalid dimension */
-  dim[3] = 0;
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
-  EXPECT_FALSE (ml_tensors_info_is_valid (info2));
+  /* invalid param : handle */
+  status = ml_pipeline_switch_select (NULL, "invalidpadname");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info1);
+  /* invalid param : pad name */
+  status = ml_pipeline_switch_select (switchhandle, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid param : wrong pad name */
+  status = ml_pipeline_switch_select (switchhandle, "wrongpadname");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_switch_release_handle (switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info2);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
-#ifdef ENABLE_TENSORFLOW_LITE
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @brief Test NNStreamer Utility for checking availability of NNFW
  */
-TEST (nnstreamer_capi_singleshot, invoke_01)
+TEST (nnstreamer_capi_util, availability_00)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_info_h in_res, out_res;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim, res_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
-  char *name = NULL;
-  int status;
-
-  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
-  gchar *test_model;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  bool result;
+  int status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+#ifdef ENABLE_NNFW_RUNTIME
+  EXPECT_EQ (result, true);
+#else   /* ENABLE_NNFW_RUNTIME */
+  EXPECT_EQ (result, false);
+#endif  /* ENABLE_NNFW_RUNTIME */
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+#ifdef ENABLE_NNFW_RUNTIME
+  EXPECT_EQ (result, true);
+#else   /* ENABLE_NNFW_RUNTIME */
+  EXPECT_EQ (result, false);
+#endif  /* ENABLE_NNFW_RUNTIME */
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-  ml_tensors_info_create (&in_res);
-  ml_tensors_info_create (&out_res);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+#ifdef ENABLE_NNFW_RUNTIME
+  EXPECT_EQ (result, true);
+#else   /* ENABLE_NNFW_RUNTIME */
+  EXPECT_EQ (result, false);
+#endif  /* ENABLE_NNFW_RUNTIME */
+}
 
-  in_dim[0] = 3;
-  in_dim[1] = 224;
-  in_dim[2] = 224;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+#ifdef ENABLE_TENSORFLOW_LITE
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
+ */
+TEST (nnstreamer_capi_util, availability_01)
+{
+  bool result;
+  int status;
 
-  out_dim[0] = 1001;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_AUTO, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  /* input tensor in filter */
-  status = ml_single_get_input_info (single, &in_res);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_count (in_res, &count);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_CPU_NEON, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_GPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (name == NULL);
+  EXPECT_EQ (result, true);
 
-  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (result, true);
+}
 
-  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
-  EXPECT_TRUE (in_dim[0] == res_dim[0]);
-  EXPECT_TRUE (in_dim[1] == res_dim[1]);
-  EXPECT_TRUE (in_dim[2] == res_dim[2]);
-  EXPECT_TRUE (in_dim[3] == res_dim[3]);
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
+ */
+TEST (nnstreamer_capi_util, availability_fail_01_n)
+{
+  bool result;
+  int status;
 
-  /* output tensor in filter */
-  status = ml_single_get_output_info (single, &out_res);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_MOVIDIUS, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  status = ml_tensors_info_get_count (out_res, &count);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_EDGE_TPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_EQ (result, false);
 
-  status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_VIVANTE, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (name == NULL);
+  EXPECT_EQ (result, false);
 
-  status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_NPU_SR, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
-
-  ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
-  EXPECT_TRUE (out_dim[0] == res_dim[0]);
-  EXPECT_TRUE (out_dim[1] == res_dim[1]);
-  EXPECT_TRUE (out_dim[2] == res_dim[2]);
-  EXPECT_TRUE (out_dim[3] == res_dim[3]);
+  EXPECT_EQ (result, false);
+}
+#endif /* ENABLE_TENSORFLOW_LITE */
 
-  input = output = NULL;
+#ifdef ENABLE_TENSORFLOW
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ */
+TEST (nnstreamer_capi_util, availability_02)
+{
+  bool result;
+  int status;
 
-  /* generate dummy data */
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
-
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_single_invoke (single, input, &output);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_AUTO, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  EXPECT_EQ (result, true);
+}
 
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ */
+TEST (nnstreamer_capi_util, availability_fail_02_n)
+{
+  bool result;
+  int status;
 
-  status = ml_single_close (single);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_CPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  g_free (test_model);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-  ml_tensors_info_destroy (in_res);
-  ml_tensors_info_destroy (out_res);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_GPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 }
+#endif /** ENABLE_TENSORFLOW */
 
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Start pipeline without tensor info
+ * @brief Test NNStreamer Utility for checking availability of custom backend
  */
-TEST (nnstreamer_capi_singleshot, invoke_02)
+TEST (nnstreamer_capi_util, availability_03)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info;
-  ml_tensors_data_h input, output;
+  bool result;
   int status;
 
-  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
-  gchar *test_model;
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+}
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+/**
+ * @brief Test NNStreamer Utility for checking availability of custom backend
+ */
+TEST (nnstreamer_capi_util, availability_fail_03_n)
+{
+  bool result;
+  int status;
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_CPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_GPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
 
-  input = output = NULL;
+#ifdef ENABLE_NNFW_RUNTIME
+/**
+ * @brief Test NNStreamer Utility for checking availability of custom backend
+ */
+TEST (nnstreamer_capi_util, availability_04)
+{
+  bool result;
+  int status;
 
-  /* generate dummy data */
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
-
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_single_invoke (single, input, &output);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_AUTO, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  EXPECT_EQ (result, true);
 
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_single_close (single);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_GPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  g_free (test_model);
-  ml_tensors_info_destroy (in_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 }
 
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
- * @note Measure the loading time and total time for the run
+ * @brief Test NNStreamer Utility for checking availability of custom backend
  */
-TEST (nnstreamer_capi_singleshot, benchmark_time)
+TEST (nnstreamer_capi_util, availability_fail_04_n)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim;
-  int status, count;
-  unsigned long open_duration=0, invoke_duration=0, close_duration=0;
-  gint64 start, end;
-
-  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
-  gchar *test_model;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  bool result;
+  int status;
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU_SR, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
+#endif /** ENABLE_NNFW_RUNTIME */
 
-  in_dim[0] = 3;
-  in_dim[1] = 224;
-  in_dim[2] = 224;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+#ifdef ENABLE_MOVIDIUS_NCSDK2
+/**
+ * @brief Test NNStreamer Utility for checking availability of custom backend
+ */
+TEST (nnstreamer_capi_util, availability_05)
+{
+  bool result;
+  int status;
 
-  out_dim[0] = 1001;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  input = output = NULL;
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  /* generate dummy data */
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_NPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
+  EXPECT_EQ (result, true);
 
-  /** Initial run to warm up the cache */
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_NPU_MOVIDIUS, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_single_close (single);
+  EXPECT_EQ (result, true);
+}
+
+/**
+ * @brief Test NNStreamer Utility for checking availability of custom backend
+ */
+TEST (nnstreamer_capi_util, availability_fail_05_n)
+{
+  bool result;
+  int status;
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_CPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  count = 1;
-  for (int i=0; i<count; i++) {
-    start = g_get_real_time();
-    status = ml_single_open (&single, test_model, in_info, out_info,
-        ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-    end = g_get_real_time();
-    open_duration += end - start;
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC, ML_NNFW_HW_GPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
+#endif /** ENABLE_MOVIDIUS_NCSDK2 */
 
-    status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-    EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+#ifdef ENABLE_ARMNN
+/**
+ * @brief Test NNStreamer Utility for checking availability of custom backend
+ */
+TEST (nnstreamer_capi_util, availability_06)
+{
+  bool result;
+  int status;
 
-    start = g_get_real_time();
-    status = ml_single_invoke (single, input, &output);
-    end = g_get_real_time();
-    invoke_duration += end - start;
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (output != NULL);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-    start = g_get_real_time();
-    status = ml_single_close (single);
-    end = g_get_real_time();
-    close_duration = end - start;
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  }
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  g_warning ("Time to open single = %f us", (open_duration * 1.0)/count);
-  g_warning ("Time to invoke single = %f us", (invoke_duration * 1.0)/count);
-  g_warning ("Time to close single = %f us", (close_duration * 1.0)/count);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_CPU_NEON, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  g_free (test_model);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_GPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 }
-#endif /* ENABLE_TENSORFLOW_LITE */
 
 /**
- * @brief Test NNStreamer single shot (custom filter)
- * @detail Run pipeline with custom filter, handle multi tensors.
+ * @brief Test NNStreamer Utility for checking availability of custom backend
  */
-TEST (nnstreamer_capi_singleshot, invoke_03)
+TEST (nnstreamer_capi_util, availability_fail_06_n)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim;
+  bool result;
   int status;
-  unsigned int i;
-  void *data_ptr;
-  size_t data_size;
-
-  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
-  gchar *test_model;
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_NPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  test_model = g_build_filename (root_path, "build", "nnstreamer_example",
-      "custom_example_passthrough",
-      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_NPU_EDGE_TPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
+#endif /** ENABLE_ARMNN */
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+/**
+ * @brief Test NNStreamer Utility for checking tensors info handle
+ */
+TEST (nnstreamer_capi_util, tensors_info)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e out_type;
+  gchar *out_name;
+  size_t data_size;
+  int status;
 
-  ml_tensors_info_set_count (in_info, 2);
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  in_dim[0] = 10;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
+  in_dim[0] = 3;
+  in_dim[1] = 300;
+  in_dim[2] = 300;
   in_dim[3] = 1;
 
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
-
-  ml_tensors_info_set_tensor_type (in_info, 1, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (in_info, 1, in_dim);
+  /* add tensor info */
+  status = ml_tensors_info_set_count (info, 2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_clone (out_info, in_info);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
+  status = ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT64);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 1, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_name (info, 1, "tensor-name-test");
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  input = output = NULL;
+  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_UINT64);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_set_tensor_dimension (info, 2, in_dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* generate input data */
-  status = ml_tensors_data_create (in_info, &input);
+  /* get tensor info */
+  status = ml_tensors_info_get_tensor_type (info, 0, &out_type);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  ASSERT_TRUE (input != NULL);
+  EXPECT_EQ (out_type, ML_TENSOR_TYPE_UINT8);
 
-  for (i = 0; i < 10; i++) {
-    int16_t i16 = (int16_t) (i + 1);
-    float f32 = (float) (i + .1);
+  status = ml_tensors_info_get_tensor_dimension (info, 0, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_dim[0], 3U);
+  EXPECT_EQ (out_dim[1], 300U);
+  EXPECT_EQ (out_dim[2], 300U);
+  EXPECT_EQ (out_dim[3], 1U);
 
-    status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    ((int16_t *) data_ptr)[i] = i16;
+  status = ml_tensors_info_get_tensor_name (info, 0, &out_name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (out_name == NULL);
 
-    status = ml_tensors_data_get_tensor_data (input, 1, &data_ptr, &data_size);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    ((float *) data_ptr)[i] = f32;
-  }
+  status = ml_tensors_info_get_tensor_type (info, 1, &out_type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_type, ML_TENSOR_TYPE_FLOAT64);
 
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  status = ml_tensors_info_get_tensor_dimension (info, 1, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_dim[0], 3U);
+  EXPECT_EQ (out_dim[1], 300U);
+  EXPECT_EQ (out_dim[2], 300U);
+  EXPECT_EQ (out_dim[3], 1U);
 
-  status = ml_single_invoke (single, input, &output);
+  status = ml_tensors_info_get_tensor_name (info, 1, &out_name);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  EXPECT_TRUE (out_name && g_str_equal (out_name, "tensor-name-test"));
 
-  for (i = 0; i < 10; i++) {
-    int16_t i16 = (int16_t) (i + 1);
-    float f32 = (float) (i + .1);
+  status = ml_tensors_info_get_tensor_type (info, 2, &out_type);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-    status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (((int16_t *) data_ptr)[i], i16);
+  status = ml_tensors_info_get_tensor_dimension (info, 2, out_dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-    status = ml_tensors_data_get_tensor_data (output, 1, &data_ptr, &data_size);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_FLOAT_EQ (((float *) data_ptr)[i], f32);
-  }
+  status = ml_tensors_info_get_tensor_name (info, 2, &out_name);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
+  /* get tensor size */
+  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == (3 * 300 * 300));
 
-  status = ml_single_close (single);
+  status = ml_tensors_info_get_tensor_size (info, 1, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == (3 * 300 * 300 * 8));
+
+  status = ml_tensors_info_get_tensor_size (info, -1, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == ((3 * 300 * 300) + (3 * 300 * 300 * 8)));
 
-  g_free (test_model);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
-#ifdef ENABLE_TENSORFLOW
 /**
- * @brief Test NNStreamer single shot (tensorflow)
- * @detail Run pipeline with tensorflow speech command model.
+ * @brief Test utility functions
  */
-TEST (nnstreamer_capi_singleshot, invoke_04)
+TEST (nnstreamer_capi_util, compare_info)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_info_h in_res, out_res;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim, res_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
-  char *name = NULL;
-  int status, max_score_index;
-  float score, max_score;
-  void *data_ptr;
-  size_t data_size;
+  ml_tensors_info_h info1, info2;
+  ml_tensor_dimension dim;
+  int status;
 
-  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
-  gchar *test_model, *test_file;
-  gchar *contents = NULL;
-  gsize len = 0;
+  status = ml_tensors_info_create (&info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  status = ml_tensors_info_create (&info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "conv_actions_frozen.pb", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  dim[0] = 3;
+  dim[1] = 4;
+  dim[2] = 4;
+  dim[3] = 1;
 
-  test_file = g_build_filename (root_path, "tests", "test_models", "data",
-      "yes.wav", NULL);
-  ASSERT_TRUE (g_file_test (test_file, G_FILE_TEST_EXISTS));
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-  ml_tensors_info_create (&in_res);
-  ml_tensors_info_create (&out_res);
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
 
-  in_dim[0] = 1;
-  in_dim[1] = 16022;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_name (in_info, 0, "wav_data");
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  /* compare info */
+  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
 
-  out_dim[0] = 12;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_name (out_info, 0, "labels_softmax");
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  /* change type */
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT16);
+  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
 
-  ASSERT_TRUE (g_file_get_contents (test_file, &contents, &len, NULL));
-  status = ml_tensors_info_get_tensor_size (in_info, 0, &data_size);
+  /* validate info */
+  EXPECT_TRUE (ml_tensors_info_is_valid (info2));
+
+  /* validate invalid dimension */
+  dim[3] = 0;
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  EXPECT_FALSE (ml_tensors_info_is_valid (info2));
+
+  status = ml_tensors_info_destroy (info1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  ASSERT_TRUE (len == data_size);
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY);
+  status = ml_tensors_info_destroy (info2);
   EXPECT_EQ (status, ML_ERROR_NONE);
+}
 
-  /* input tensor in filter */
-  status = ml_single_get_input_info (single, &in_res);
+/**
+ * @brief Test utility functions
+ * @detail Wrap the memory blocks of application in the tensors data.
+ */
+TEST (nnstreamer_capi_util, data_create_from_ptr_p)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  uint8_t block1[4] = { 1, 2, 3, 4 };
+  float block2[4] = { 0.1f, 0.2f, 0.3f, 0.4f };
+  void *raw_data[2];
+  void *data_ptr;
+  size_t data_size;
+  guint num_released = 0;
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  raw_data[0] = block1;
+  raw_data[1] = block2;
+
+  status = ml_tensors_data_create_from_ptr (info, raw_data,
+      test_free_wrapped_data, &num_released, &data);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_count (in_res, &count);
+  status = ml_tensors_data_get_tensor_data (data, 0, &data_ptr, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_TRUE (data_ptr == block1);
+  EXPECT_EQ (data_size, 4U);
 
-  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
+  status = ml_tensors_data_get_tensor_data (data, 1, &data_ptr, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (g_str_equal (name, "wav_data"));
+  EXPECT_TRUE (data_ptr == block2);
+  EXPECT_EQ (data_size, 4U * sizeof (float));
 
-  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+  /* set data writes in the given memory block */
+  status = ml_tensors_data_set_tensor_data (data, 0, block1 + 1, 2);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT16);
+  EXPECT_EQ (block1[0], 2);
+  EXPECT_EQ (block1[1], 3);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the callback is called once */
+  EXPECT_EQ (num_released, 1U);
+
+  /* without callback */
+  status = ml_tensors_data_create_from_ptr (info, raw_data, NULL, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions
+ * @detail Failure case to wrap the memory blocks with invalid param.
+ */
+TEST (nnstreamer_capi_util, data_create_from_ptr_n)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data = NULL;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  uint8_t block[4] = { 0, };
+  void *raw_data[2];
+  guint num_released = 0;
+  int status;
+
+  ml_tensors_info_create (&info);
+
+  raw_data[0] = block;
+  raw_data[1] = NULL;
+
+  /* invalid info */
+  status = ml_tensors_data_create_from_ptr (info, raw_data,
+      test_free_wrapped_data, &num_released, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  status = ml_tensors_data_create_from_ptr (NULL, raw_data,
+      test_free_wrapped_data, &num_released, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_from_ptr (info, NULL,
+      test_free_wrapped_data, &num_released, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_from_ptr (info, raw_data,
+      test_free_wrapped_data, &num_released, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the second block is null */
+  status = ml_tensors_data_create_from_ptr (info, raw_data,
+      test_free_wrapped_data, &num_released, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_TRUE (data == NULL);
+
+  /* the callback is not called when failed */
+  EXPECT_EQ (num_released, 0U);
+
+  ml_tensors_info_destroy (info);
+}
+
+#ifdef ENABLE_TENSORFLOW_LITE
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ */
+TEST (nnstreamer_capi_singleshot, invoke_01)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_info_h in_res, out_res;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim, res_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0;
+  char *name = NULL;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_create (&in_res);
+  ml_tensors_info_create (&out_res);
+
+  in_dim[0] = 3;
+  in_dim[1] = 224;
+  in_dim[2] = 224;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  out_dim[0] = 1001;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* input tensor in filter */
+  status = ml_single_get_input_info (single, &in_res);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (in_res, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (name == NULL);
+
+  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
   ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
   EXPECT_TRUE (in_dim[0] == res_dim[0]);
@@ -2175,11 +2402,11 @@ TEST (nnstreamer_capi_singleshot, invoke_04)
 
   status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (g_str_equal (name, "labels_softmax"));
+  EXPECT_TRUE (name == NULL);
 
   status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
   ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
   EXPECT_TRUE (out_dim[0] == res_dim[0]);
@@ -2189,13 +2416,66 @@ TEST (nnstreamer_capi_singleshot, invoke_04)
 
   input = output = NULL;
 
-  /* generate input data */
+  /* generate dummy data */
   status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (input != NULL);
 
-  status = ml_tensors_data_set_tensor_data (input, 0, contents, len);
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (in_res);
+  ml_tensors_info_destroy (out_res);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Start pipeline without tensor info
+ */
+TEST (nnstreamer_capi_singleshot, invoke_02)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  input = output = NULL;
+
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
 
   status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
   EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
@@ -2204,48 +2484,1130 @@ TEST (nnstreamer_capi_singleshot, invoke_04)
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (output != NULL);
 
-  /* check result (max score index is 2) */
-  status = ml_tensors_data_get_tensor_data (output, 1, &data_ptr, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
 
-  status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
+  status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  max_score = .0;
-  max_score_index = 0;
-  for (gint i = 0; i < 12; i++) {
-    score = ((float *) data_ptr)[i];
-    if (score > max_score) {
-      max_score = score;
-      max_score_index = i;
-    }
-  }
+  g_free (test_model);
+  ml_tensors_info_destroy (in_info);
+}
 
-  EXPECT_EQ (max_score_index, 2);
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @note Measure the loading time and total time for the run
+ */
+TEST (nnstreamer_capi_singleshot, benchmark_time)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim;
+  int status, count;
+  unsigned long open_duration=0, invoke_duration=0, close_duration=0;
+  gint64 start, end;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  in_dim[0] = 3;
+  in_dim[1] = 224;
+  in_dim[2] = 224;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  out_dim[0] = 1001;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  input = output = NULL;
+
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
+
+  /** Initial run to warm up the cache */
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  count = 1;
+  for (int i=0; i<count; i++) {
+    start = g_get_real_time();
+    status = ml_single_open (&single, test_model, in_info, out_info,
+        ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+    end = g_get_real_time();
+    open_duration += end - start;
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+    EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+    start = g_get_real_time();
+    status = ml_single_invoke (single, input, &output);
+    end = g_get_real_time();
+    invoke_duration += end - start;
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (output != NULL);
+
+    start = g_get_real_time();
+    status = ml_single_close (single);
+    end = g_get_real_time();
+    close_duration = end - start;
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  g_warning ("Time to open single = %f us", (open_duration * 1.0)/count);
+  g_warning ("Time to invoke single = %f us", (invoke_duration * 1.0)/count);
+  g_warning ("Time to close single = %f us", (close_duration * 1.0)/count);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+
+  g_free (test_model);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
+#endif /* ENABLE_TENSORFLOW_LITE */
+
+/**
+ * @brief Test NNStreamer single shot (custom filter)
+ * @detail Run pipeline with custom filter, handle multi tensors.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_03)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim;
+  int status;
+  unsigned int i;
+  void *data_ptr;
+  size_t data_size;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "build", "nnstreamer_example",
+      "custom_example_passthrough",
+      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  ml_tensors_info_set_count (in_info, 2);
+
+  in_dim[0] = 10;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  ml_tensors_info_set_tensor_type (in_info, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (in_info, 1, in_dim);
+
+  ml_tensors_info_clone (out_info, in_info);
+
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  input = output = NULL;
+
+  /* generate input data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ASSERT_TRUE (input != NULL);
+
+  for (i = 0; i < 10; i++) {
+    int16_t i16 = (int16_t) (i + 1);
+    float f32 = (float) (i + .1);
+
+    status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ((int16_t *) data_ptr)[i] = i16;
+
+    status = ml_tensors_data_get_tensor_data (input, 1, &data_ptr, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ((float *) data_ptr)[i] = f32;
+  }
+
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  for (i = 0; i < 10; i++) {
+    int16_t i16 = (int16_t) (i + 1);
+    float f32 = (float) (i + .1);
+
+    status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (((int16_t *) data_ptr)[i], i16);
+
+    status = ml_tensors_data_get_tensor_data (output, 1, &data_ptr, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_FLOAT_EQ (((float *) data_ptr)[i], f32);
+  }
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
+
+/**
+ * @brief Test NNStreamer single shot (custom filter)
+ * @detail The caller returns at the deadline while the slow model is running.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_timeout_slow_model_n)
+{
+  ml_single_h single;
+  ml_single_preset info = { 0, };
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim;
+  gint64 start, elapsed;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /* the custom filter sleeps 2 seconds in each invoke */
+  test_model = g_build_filename (root_path, "build", "tests",
+      "libnnscustom_framecounter.so", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+
+  in_dim[0] = 1;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT32);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  info.input_info = in_info;
+  info.output_info = in_info;
+  info.nnfw = ML_NNFW_TYPE_CUSTOM_FILTER;
+  info.hw = ML_NNFW_HW_ANY;
+  info.models = test_model;
+  info.custom_option = (char *) "delay-2000";
+
+  status = ml_single_open_custom (&single, &info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_set_timeout (single, 100);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  output = NULL;
+  start = g_get_monotonic_time ();
+  status = ml_single_invoke (single, input, &output);
+  elapsed = g_get_monotonic_time () - start;
+
+  /* the caller does not wait for the model */
+  EXPECT_EQ (status, ML_ERROR_TIMED_OUT);
+  EXPECT_TRUE (output == NULL);
+  EXPECT_LT (elapsed, 2000 * G_TIME_SPAN_MILLISECOND);
+
+  /* the model is still running */
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_TRY_AGAIN);
+  EXPECT_TRUE (output == NULL);
+
+  /* close waits for the running model */
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (custom filter)
+ * @detail Invoke in the caller's thread (no timeout).
+ */
+TEST (nnstreamer_capi_singleshot, invoke_no_timeout_p)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim;
+  void *data_ptr;
+  size_t data_size;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "build", "nnstreamer_example",
+      "custom_example_passthrough",
+      "libnnstreamer_customfilter_passthrough_variable.so", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+
+  in_dim[0] = 4;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  status = ml_single_open (&single, test_model, in_info, in_info,
+      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_set_timeout (single, 0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ((uint8_t *) data_ptr)[0] = 10;
+  ((uint8_t *) data_ptr)[3] = 30;
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ASSERT_TRUE (output != NULL);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 4U);
+  EXPECT_EQ (((uint8_t *) data_ptr)[0], 10);
+  EXPECT_EQ (((uint8_t *) data_ptr)[3], 30);
+
+  ml_tensors_data_destroy (output);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  g_free (test_model);
+}
+
+#ifdef ENABLE_TENSORFLOW
+/**
+ * @brief Test NNStreamer single shot (tensorflow)
+ * @detail Run pipeline with tensorflow speech command model.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_04)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_info_h in_res, out_res;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim, res_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0;
+  char *name = NULL;
+  int status, max_score_index;
+  float score, max_score;
+  void *data_ptr;
+  size_t data_size;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model, *test_file;
+  gchar *contents = NULL;
+  gsize len = 0;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "conv_actions_frozen.pb", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  test_file = g_build_filename (root_path, "tests", "test_models", "data",
+      "yes.wav", NULL);
+  ASSERT_TRUE (g_file_test (test_file, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_create (&in_res);
+  ml_tensors_info_create (&out_res);
+
+  in_dim[0] = 1;
+  in_dim[1] = 16022;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_name (in_info, 0, "wav_data");
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  out_dim[0] = 12;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_name (out_info, 0, "labels_softmax");
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  ASSERT_TRUE (g_file_get_contents (test_file, &contents, &len, NULL));
+  status = ml_tensors_info_get_tensor_size (in_info, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ASSERT_TRUE (len == data_size);
+
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* input tensor in filter */
+  status = ml_single_get_input_info (single, &in_res);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (in_res, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (g_str_equal (name, "wav_data"));
+
+  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT16);
+
+  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
+  EXPECT_TRUE (in_dim[0] == res_dim[0]);
+  EXPECT_TRUE (in_dim[1] == res_dim[1]);
+  EXPECT_TRUE (in_dim[2] == res_dim[2]);
+  EXPECT_TRUE (in_dim[3] == res_dim[3]);
+
+  /* output tensor in filter */
+  status = ml_single_get_output_info (single, &out_res);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (out_res, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (g_str_equal (name, "labels_softmax"));
+
+  status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+  ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
+  EXPECT_TRUE (out_dim[0] == res_dim[0]);
+  EXPECT_TRUE (out_dim[1] == res_dim[1]);
+  EXPECT_TRUE (out_dim[2] == res_dim[2]);
+  EXPECT_TRUE (out_dim[3] == res_dim[3]);
+
+  input = output = NULL;
+
+  /* generate input data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
+
+  status = ml_tensors_data_set_tensor_data (input, 0, contents, len);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  /* check result (max score index is 2) */
+  status = ml_tensors_data_get_tensor_data (output, 1, &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  max_score = .0;
+  max_score_index = 0;
+  for (gint i = 0; i < 12; i++) {
+    score = ((float *) data_ptr)[i];
+    if (score > max_score) {
+      max_score = score;
+      max_score_index = i;
+    }
+  }
+
+  EXPECT_EQ (max_score_index, 2);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+  g_free (test_file);
+  g_free (contents);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (in_res);
+  ml_tensors_info_destroy (out_res);
+}
+#else
+/**
+ * @brief Test NNStreamer single shot (tensorflow is not supported)
+ */
+TEST (nnstreamer_capi_singleshot, unavailable_fw_tf_n)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "conv_actions_frozen.pb", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  in_dim[0] = 1;
+  in_dim[1] = 16022;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_name (in_info, 0, "wav_data");
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  out_dim[0] = 12;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_name (out_info, 0, "labels_softmax");
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  /* tensorflow is not supported */
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NOT_SUPPORTED);
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  g_free (test_model);
+}
+#endif /* ENABLE_TENSORFLOW */
+
+#ifdef ENABLE_TENSORFLOW_LITE
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case with invalid param.
+ */
+TEST (nnstreamer_capi_singleshot, open_fail_01_n)
+{
+  ml_single_h single;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  /* invalid file path */
+  status = ml_single_open (&single, "wrong_file_name", NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* null file path */
+  status = ml_single_open (&single, NULL, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid handle */
+  status = ml_single_open (NULL, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid file extension */
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid handle */
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* Successfully opened unknown fw type (tf-lite) */
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case with invalid tensor info.
+ */
+TEST (nnstreamer_capi_singleshot, open_fail_02_n)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  /* invalid input tensor info */
+  status = ml_single_open (&single, test_model, in_info, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid output tensor info */
+  status = ml_single_open (&single, test_model, NULL, out_info,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  in_dim[0] = 3;
+  in_dim[1] = 100;
+  in_dim[2] = 100;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  /* invalid input dimension (model does not support dynamic dimension) */
+  status = ml_single_open (&single, test_model, in_info, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  in_dim[1] = in_dim[2] = 224;
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT16);
+
+  /* invalid input type */
+  status = ml_single_open (&single, test_model, in_info, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+
+  out_dim[0] = 1;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  /* invalid output dimension */
+  status = ml_single_open (&single, test_model, NULL, out_info,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  out_dim[0] = 1001;
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT16);
+
+  /* invalid output type */
+  status = ml_single_open (&single, test_model, NULL, out_info,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
+
+  /* Successfully opened unknown fw type (tf-lite) */
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Open model (dynamic dimension is supported)
+ */
+TEST (nnstreamer_capi_singleshot, open_dynamic)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /* dynamic dimension supported */
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+
+  in_dim[0] = 5;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  /* open with input tensor info (1:1:1:1 > 5:1:1:1) */
+  status = ml_single_open (&single, test_model, in_info, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* validate output info */
+  status = ml_single_get_output_info (single, &out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (out_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  EXPECT_EQ (out_dim[0], 5U);
+  EXPECT_EQ (out_dim[1], 1U);
+  EXPECT_EQ (out_dim[2], 1U);
+  EXPECT_EQ (out_dim[3], 1U);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
+
+/**
+ * @brief Structure containing values to run single shot
+ */
+typedef struct {
+  gchar *test_model;
+  guint num_runs;
+  guint timeout;
+  guint min_time_to_run;
+  gboolean expect;
+  ml_single_h *single;
+} single_shot_thread_data;
+
+/**
+ * @brief Open and run on single shot API with provided data
+ */
+static void *
+single_shot_loop_test (void *arg)
+{
+  guint i;
+  int status = ML_ERROR_NONE;
+  ml_single_h single;
+  single_shot_thread_data *ss_data = (single_shot_thread_data *) arg;
+  int timeout_cond, no_error_cond;
+
+  status = ml_single_open (&single, ss_data->test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (ss_data->expect) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+  ss_data->single = &single;
+
+  /* set timeout */
+  if (ss_data->timeout != 0) {
+    status = ml_single_set_timeout (single, ss_data->timeout);
+    if (ss_data->expect) {
+      EXPECT_NE (status, ML_ERROR_INVALID_PARAMETER);
+    }
+    if (status == ML_ERROR_NOT_SUPPORTED)
+      ss_data->timeout = 0;
+  }
+
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim;
+
+  ml_tensors_info_create (&in_info);
+
+  in_dim[0] = 3;
+  in_dim[1] = 224;
+  in_dim[2] = 224;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  input = output = NULL;
+
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
+  if (ss_data->expect) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (input != NULL);
+  }
+
+  for (i=0; i<ss_data->num_runs; i++) {
+    status = ml_single_invoke (single, input, &output);
+    if (ss_data->expect) {
+      no_error_cond = status == ML_ERROR_NONE && output != NULL;
+      if (ss_data->timeout < ss_data->min_time_to_run) {
+        /** Default timeout can return timed out with many parallel runs */
+        timeout_cond = output == NULL &&
+          (status == ML_ERROR_TIMED_OUT || status == ML_ERROR_TRY_AGAIN);
+        EXPECT_TRUE (timeout_cond || no_error_cond);
+      } else {
+        EXPECT_TRUE (no_error_cond);
+      }
+    }
+    output = NULL;
+  }
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+  status = ml_single_close (single);
+  if (ss_data->expect) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Testcase with timeout.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_timeout)
+{
+  ml_single_h single;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* set timeout 5 ms */
+  status = ml_single_set_timeout (single, 5);
+  /* test timeout if supported (gstreamer ver >= 1.10) */
+  if (status == ML_ERROR_NONE) {
+    ml_tensors_info_h in_info;
+    ml_tensors_data_h input, output;
+    ml_tensor_dimension in_dim;
+
+    ml_tensors_info_create (&in_info);
+
+    in_dim[0] = 3;
+    in_dim[1] = 224;
+    in_dim[2] = 224;
+    in_dim[3] = 1;
+    ml_tensors_info_set_count (in_info, 1);
+    ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+    ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+    input = output = NULL;
+
+    /* generate dummy data */
+    status = ml_tensors_data_create (in_info, &input);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (input != NULL);
+
+    status = ml_single_invoke (single, input, &output);
+    EXPECT_EQ (status, ML_ERROR_TIMED_OUT);
+    EXPECT_TRUE (output == NULL);
+
+    /* check the old buffer is dropped */
+    status = ml_single_invoke (single, input, &output);
+    /* try_again implies that previous invoke hasn't finished yet */
+    EXPECT_TRUE (status == ML_ERROR_TIMED_OUT || status == ML_ERROR_TRY_AGAIN);
+    EXPECT_TRUE (output == NULL);
+
+    /* set timeout 10 s */
+    status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+    /* clear out previous buffers */
+    g_usleep (SINGLE_DEF_TIMEOUT_MSEC * 1000);    /** 10 sec */
+
+    status = ml_single_invoke (single, input, &output);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (output != NULL);
+
+    ml_tensors_data_destroy (output);
+    ml_tensors_data_destroy (input);
+    ml_tensors_info_destroy (in_info);
+  }
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Testcase with multiple runs in parallel. Some of the
+ *         running instances will timeout, however others will not.
+ */
+TEST (nnstreamer_capi_singleshot, parallel_runs)
+{
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+  const gint num_threads = 3;
+  const gint num_cases = 3;
+  pthread_t thread[num_threads * num_cases];
+  single_shot_thread_data ss_data[num_cases];
+  guint i, j;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  for (i=0; i<num_cases; i++) {
+    ss_data[i].test_model = test_model;
+    ss_data[i].num_runs = 3;
+    ss_data[i].min_time_to_run = 10;    /** 10 msec */
+    ss_data[i].expect = TRUE;
+  }
+
+  /** Default timeout runs */
+  ss_data[0].timeout = 0;
+  /** small timeout runs */
+  ss_data[1].timeout = 5;
+  /** large timeout runs - increases with each run as tests run in parallel */
+  ss_data[2].timeout = SINGLE_DEF_TIMEOUT_MSEC * num_cases * num_threads;
+
+  /**
+   * make thread running things in background, each with different timeout,
+   * some fails, some runs, all opens pipelines by themselves in parallel
+   */
+  for (j=0; j<num_cases; j++) {
+    for (i=0; i<num_threads; i++) {
+      pthread_create (&thread[i+j * num_threads], NULL, single_shot_loop_test,
+          (void *) &ss_data[j]);
+    }
+  }
+
+  for (i=0; i<num_threads * num_cases; i++) {
+    pthread_join(thread[i], NULL);
+  }
+
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Close the single handle while running. This test shuuld not crash.
+ *         This closes the single handle twice, while opens it once
+ */
+TEST (nnstreamer_capi_singleshot, close_while_running)
+{
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+  pthread_t thread;
+  single_shot_thread_data ss_data;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ss_data.test_model = test_model;
+  ss_data.num_runs = 10;
+  ss_data.min_time_to_run = 10;    /** 10 msec */
+  ss_data.expect = FALSE;
+  ss_data.timeout = SINGLE_DEF_TIMEOUT_MSEC;
+  ss_data.single = NULL;
+
+  pthread_create (&thread, NULL, single_shot_loop_test, (void *) &ss_data);
+
+  /** Start the thread and let the code start */
+  g_usleep (100000);    /** 100 msec */
+
+  /**
+   * Call single API functions while its running. One run takes 100ms on average.
+   * So, these calls would in the middle of running and should not crash
+   * However, their status can be of failure, if the thread is closed earlier
+   */
+  if (ss_data.single) {
+    ml_single_set_timeout (*ss_data.single, ss_data.timeout);
+    ml_single_close (*ss_data.single);
+  }
+
+  pthread_join(thread, NULL);
+
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Try setting dimensions for input tensor.
+ */
+TEST (nnstreamer_capi_singleshot, set_input_info_fail)
+{
+  int status;
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensor_dimension in_dim;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_set_input_info (single, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_info_create (&in_info);
+  in_dim[0] = 3;
+  in_dim[1] = 4;
+  in_dim[2] = 4;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
+  /** mobilenet model does not support setting different input dimension */
+  status = ml_single_set_input_info (single, in_info);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED ||
+      status == ML_ERROR_INVALID_PARAMETER);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  status = ml_tensors_info_destroy (in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
   g_free (test_model);
-  g_free (test_file);
-  g_free (contents);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-  ml_tensors_info_destroy (in_res);
-  ml_tensors_info_destroy (out_res);
 }
-#else
+
 /**
- * @brief Test NNStreamer single shot (tensorflow is not supported)
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Try setting number of input tensors and its type
  */
-TEST (nnstreamer_capi_singleshot, unavailable_fw_tf_n)
+TEST (nnstreamer_capi_singleshot, set_input_info_fail_01)
 {
   ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
+  ml_tensors_info_h in_info;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0;
   int status;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
@@ -2255,51 +3617,58 @@ TEST (nnstreamer_capi_singleshot, unavailable_fw_tf_n)
   if (root_path == NULL)
     root_path = "..";
 
+  /** add.tflite adds value 2 to all the values in the input */
   test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "conv_actions_frozen.pb", NULL);
+      "add.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  in_dim[0] = 1;
-  in_dim[1] = 16022;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_name (in_info, 0, "wav_data");
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  out_dim[0] = 12;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_name (out_info, 0, "labels_softmax");
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  status = ml_tensors_info_get_count (in_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* tensorflow is not supported */
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_NOT_SUPPORTED);
+  /** changing the count of number of tensors is not allowed */
+  ml_tensors_info_set_count (in_info, count + 1);
+  status = ml_single_set_input_info (single, in_info);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (in_info, count);
+
+  status = ml_tensors_info_get_tensor_type (in_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+  /** changing the type of input tensors is not allowed */
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT32);
+  status = ml_single_set_input_info (single, in_info);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
   g_free (test_model);
 }
-#endif /* ENABLE_TENSORFLOW */
 
-#ifdef ENABLE_TENSORFLOW_LITE
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Failure case with invalid param.
+ * @detail Try setting dimension to the same value. This model does not allow
+ *         changing the dimension to a different. However, setting the same
+ *         value for dimension should be successful.
  */
-TEST (nnstreamer_capi_singleshot, open_fail_01_n)
+TEST (nnstreamer_capi_singleshot, set_input_info_success)
 {
-  ml_single_h single;
   int status;
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensor_dimension in_dim;
+  ml_tensors_data_h input, output;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -2312,51 +3681,65 @@ TEST (nnstreamer_capi_singleshot, open_fail_01_n)
       "mobilenet_v1_1.0_224_quant.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  /* invalid file path */
-  status = ml_single_open (&single, "wrong_file_name", NULL, NULL,
+  status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* null file path */
-  status = ml_single_open (&single, NULL, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_single_set_input_info (single, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  /* invalid handle */
-  status = ml_single_open (NULL, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_create (&in_info);
+  in_dim[0] = 3;
+  in_dim[1] = 224;
+  in_dim[2] = 224;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
-  /* invalid file extension */
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /** set the same original input dimension */
+  status = ml_single_set_input_info (single, in_info);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED ||
+      status == ML_ERROR_NONE);
 
-  /* invalid handle */
-  status = ml_single_close (single);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* generate dummy data */
+  input = output = NULL;
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
 
-  /* Successfully opened unknown fw type (tf-lite) */
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY);
+  status = ml_single_invoke (single, input, &output);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  status = ml_tensors_info_destroy (in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
   g_free (test_model);
 }
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Failure case with invalid tensor info.
+ * @detail Change the number of input tensors, run the model and verify output
  */
-TEST (nnstreamer_capi_singleshot, open_fail_02_n)
+TEST (nnstreamer_capi_singleshot, set_input_info_success_01)
 {
   ml_single_h single;
   ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
-  int status;
+  ml_tensors_info_h in_res, out_res;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim, res_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0;
+  int status, tensor_size;
+  size_t data_size;
+  float *data;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -2365,75 +3748,127 @@ TEST (nnstreamer_capi_singleshot, open_fail_02_n)
   if (root_path == NULL)
     root_path = "..";
 
+  /** add.tflite adds value 2 to all the values in the input */
   test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+      "add.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
   ml_tensors_info_create (&in_info);
   ml_tensors_info_create (&out_info);
+  ml_tensors_info_create (&in_res);
+  ml_tensors_info_create (&out_res);
 
-  /* invalid input tensor info */
-  status = ml_single_open (&single, test_model, in_info, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  /* invalid output tensor info */
-  status = ml_single_open (&single, test_model, NULL, out_info,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  tensor_size = 5;
 
-  in_dim[0] = 3;
-  in_dim[1] = 100;
-  in_dim[2] = 100;
+  in_dim[0] = tensor_size;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
   in_dim[3] = 1;
   ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
-  /* invalid input dimension (model does not support dynamic dimension) */
-  status = ml_single_open (&single, test_model, in_info, NULL,
+  out_dim[0] = tensor_size;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  in_dim[1] = in_dim[2] = 224;
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT16);
+  status = ml_single_get_input_info (single, &in_res);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid input type */
-  status = ml_single_open (&single, test_model, in_info, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /**
+   * 1. start with a model file with different input dimensions
+   * 2. change the input for the model file
+   * 3. run the model file with the updated input dimensions
+   * 4. verify the output
+   */
+
+  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
+  EXPECT_FALSE (in_dim[0] == res_dim[0]);
+  EXPECT_TRUE (in_dim[1] == res_dim[1]);
+  EXPECT_TRUE (in_dim[2] == res_dim[2]);
+  EXPECT_TRUE (in_dim[3] == res_dim[3]);
+
+  /** set the same original input dimension */
+  status = ml_single_set_input_info (single, in_info);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED ||
+      status == ML_ERROR_NONE);
+  if (status == ML_ERROR_NONE) {
+    /* input tensor in filter */
+    status = ml_single_get_input_info (single, &in_res);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_info_get_count (in_res, &count);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (count, 1U);
+
+    status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+    ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
+    EXPECT_TRUE (in_dim[0] == res_dim[0]);
+    EXPECT_TRUE (in_dim[1] == res_dim[1]);
+    EXPECT_TRUE (in_dim[2] == res_dim[2]);
+    EXPECT_TRUE (in_dim[3] == res_dim[3]);
+
+    /* output tensor in filter */
+    status = ml_single_get_output_info (single, &out_res);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_info_get_count (out_res, &count);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (count, 1U);
+
+    status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+    ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
+    EXPECT_TRUE (out_dim[0] == res_dim[0]);
+    EXPECT_TRUE (out_dim[1] == res_dim[1]);
+    EXPECT_TRUE (out_dim[2] == res_dim[2]);
+    EXPECT_TRUE (out_dim[3] == res_dim[3]);
 
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+    input = output = NULL;
 
-  out_dim[0] = 1;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+    /* generate dummy data */
+    status = ml_tensors_data_create (in_info, &input);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (input != NULL);
 
-  /* invalid output dimension */
-  status = ml_single_open (&single, test_model, NULL, out_info,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    status = ml_tensors_data_get_tensor_data (input, 0, (void **) &data, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (data_size, tensor_size * sizeof (int));
+    for (int idx = 0; idx < tensor_size; idx++)
+      data[idx] = idx;
 
-  out_dim[0] = 1001;
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT16);
+    status = ml_single_invoke (single, input, &output);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (output != NULL);
 
-  /* invalid output type */
-  status = ml_single_open (&single, test_model, NULL, out_info,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    status = ml_tensors_data_get_tensor_data (input, 0, (void **) &data, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (data_size, tensor_size * sizeof (int));
+    for (int idx = 0; idx < tensor_size; idx++)
+      EXPECT_EQ (data[idx], idx);
 
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
+    status = ml_tensors_data_get_tensor_data (output, 0, (void **) &data, &data_size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (data_size, tensor_size * sizeof (int));
+    for (int idx = 0; idx < tensor_size; idx++)
+      EXPECT_EQ (data[idx], idx+2);
 
-  /* Successfully opened unknown fw type (tf-lite) */
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_destroy (output);
+    ml_tensors_data_destroy (input);
+  }
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -2441,20 +3876,23 @@ TEST (nnstreamer_capi_singleshot, open_fail_02_n)
   g_free (test_model);
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (in_res);
+  ml_tensors_info_destroy (out_res);
 }
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Open model (dynamic dimension is supported)
+ * @detail Update property 'layout' for input tensor
  */
-TEST (nnstreamer_capi_singleshot, open_dynamic)
+TEST (nnstreamer_capi_singleshot, property_01_p)
 {
   ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
   int status;
+  char *prop_value;
+  void *data;
+  size_t data_size;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -2463,152 +3901,70 @@ TEST (nnstreamer_capi_singleshot, open_dynamic)
   if (root_path == NULL)
     root_path = "..";
 
-  /* dynamic dimension supported */
   test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "add.tflite", NULL);
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  ml_tensors_info_create (&in_info);
-
-  in_dim[0] = 5;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
-
-  /* open with input tensor info (1:1:1:1 > 5:1:1:1) */
-  status = ml_single_open (&single, test_model, in_info, NULL,
+  status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* validate output info */
-  status = ml_single_get_output_info (single, &out_info);
+  /* get layout */
+  status = ml_single_get_property (single, "inputlayout", &prop_value);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_count (out_info, &count);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_STREQ (prop_value, "ANY");
+  g_free (prop_value);
 
-  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  /* get updatable */
+  status = ml_single_get_property (single, "is-updatable", &prop_value);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
-  EXPECT_EQ (out_dim[0], 5U);
-  EXPECT_EQ (out_dim[1], 1U);
-  EXPECT_EQ (out_dim[2], 1U);
-  EXPECT_EQ (out_dim[3], 1U);
+  EXPECT_STREQ (prop_value, "false");
+  g_free (prop_value);
 
-  status = ml_single_close (single);
+  /* get input info */
+  status = ml_single_get_input_info (single, &in_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (test_model);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-}
-
-/**
- * @brief Structure containing values to run single shot
- */
-typedef struct {
-  gchar *test_model;
-  guint num_runs;
-  guint timeout;
-  guint min_time_to_run;
-  gboolean expect;
-  ml_single_h *single;
-} single_shot_thread_data;
-
-/**
- * @brief Open and run on single shot API with provided data
- */
-static void *
-single_shot_loop_test (void *arg)
-{
-  guint i;
-  int status = ML_ERROR_NONE;
-  ml_single_h single;
-  single_shot_thread_data *ss_data = (single_shot_thread_data *) arg;
-  int timeout_cond, no_error_cond;
-
-  status = ml_single_open (&single, ss_data->test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (ss_data->expect) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  }
-  ss_data->single = &single;
-
-  /* set timeout */
-  if (ss_data->timeout != 0) {
-    status = ml_single_set_timeout (single, ss_data->timeout);
-    if (ss_data->expect) {
-      EXPECT_NE (status, ML_ERROR_INVALID_PARAMETER);
-    }
-    if (status == ML_ERROR_NOT_SUPPORTED)
-      ss_data->timeout = 0;
-  }
-
-  ml_tensors_info_h in_info;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim;
-
-  ml_tensors_info_create (&in_info);
-
-  in_dim[0] = 3;
-  in_dim[1] = 224;
-  in_dim[2] = 224;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
-
+  /* invoke */
   input = output = NULL;
 
   /* generate dummy data */
   status = ml_tensors_data_create (in_info, &input);
-  if (ss_data->expect) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (input != NULL);
-  }
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
 
-  for (i=0; i<ss_data->num_runs; i++) {
-    status = ml_single_invoke (single, input, &output);
-    if (ss_data->expect) {
-      no_error_cond = status == ML_ERROR_NONE && output != NULL;
-      if (ss_data->timeout < ss_data->min_time_to_run) {
-        /** Default timeout can return timed out with many parallel runs */
-        timeout_cond = output == NULL &&
-          (status == ML_ERROR_TIMED_OUT || status == ML_ERROR_TRY_AGAIN);
-        EXPECT_TRUE (timeout_cond || no_error_cond);
-      } else {
-        EXPECT_TRUE (no_error_cond);
-      }
-    }
-    output = NULL;
-  }
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 1001U);
 
   ml_tensors_data_destroy (output);
   ml_tensors_data_destroy (input);
   ml_tensors_info_destroy (in_info);
 
   status = ml_single_close (single);
-  if (ss_data->expect) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  }
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  return NULL;
+  g_free (test_model);
 }
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Testcase with timeout.
+ * @detail Failure case to set invalid property
  */
-TEST (nnstreamer_capi_singleshot, invoke_timeout)
+TEST (nnstreamer_capi_singleshot, property_02_n)
 {
   ml_single_h single;
   int status;
+  char *prop_value = NULL;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -2625,54 +3981,35 @@ TEST (nnstreamer_capi_singleshot, invoke_timeout)
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* set timeout 5 ms */
-  status = ml_single_set_timeout (single, 5);
-  /* test timeout if supported (gstreamer ver >= 1.10) */
-  if (status == ML_ERROR_NONE) {
-    ml_tensors_info_h in_info;
-    ml_tensors_data_h input, output;
-    ml_tensor_dimension in_dim;
-
-    ml_tensors_info_create (&in_info);
-
-    in_dim[0] = 3;
-    in_dim[1] = 224;
-    in_dim[2] = 224;
-    in_dim[3] = 1;
-    ml_tensors_info_set_count (in_info, 1);
-    ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-    ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
-
-    input = output = NULL;
+  /* get invalid property */
+  status = ml_single_get_property (single, "unknown_prop", &prop_value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  g_free (prop_value);
 
-    /* generate dummy data */
-    status = ml_tensors_data_create (in_info, &input);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (input != NULL);
+  /* set invalid property */
+  status = ml_single_set_property (single, "unknown_prop", "INVALID");
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-    status = ml_single_invoke (single, input, &output);
-    EXPECT_EQ (status, ML_ERROR_TIMED_OUT);
-    EXPECT_TRUE (output == NULL);
+  /* null params */
+  status = ml_single_set_property (single, "input", NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-    /* check the old buffer is dropped */
-    status = ml_single_invoke (single, input, &output);
-    /* try_again implies that previous invoke hasn't finished yet */
-    EXPECT_TRUE (status == ML_ERROR_TIMED_OUT || status == ML_ERROR_TRY_AGAIN);
-    EXPECT_TRUE (output == NULL);
+  status = ml_single_set_property (single, NULL, "INVALID");
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-    /* set timeout 10 s */
-    status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-    /* clear out previous buffers */
-    g_usleep (SINGLE_DEF_TIMEOUT_MSEC * 1000);    /** 10 sec */
+  status = ml_single_get_property (single, "input", NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-    status = ml_single_invoke (single, input, &output);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (output != NULL);
+  status = ml_single_get_property (single, NULL, &prop_value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  g_free (prop_value);
 
-    ml_tensors_data_destroy (output);
-    ml_tensors_data_destroy (input);
-    ml_tensors_info_destroy (in_info);
-  }
+  /* dimension should be valid */
+  status = ml_single_get_property (single, "input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_STREQ (prop_value, "3:224:224:1");
+  g_free (prop_value);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -2682,18 +4019,24 @@ TEST (nnstreamer_capi_singleshot, invoke_timeout)
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Testcase with multiple runs in parallel. Some of the
- *         running instances will timeout, however others will not.
+ * @detail Failure case to set meta property
  */
-TEST (nnstreamer_capi_singleshot, parallel_runs)
+TEST (nnstreamer_capi_singleshot, property_03_n)
 {
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensors_data_h input, output;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  int status;
+  unsigned int count = 0;
+  char *name = NULL;
+  char *prop_value = NULL;
+  void *data;
+  size_t data_size;
+
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
-  const gint num_threads = 3;
-  const gint num_cases = 3;
-  pthread_t thread[num_threads * num_cases];
-  single_shot_thread_data ss_data[num_cases];
-  guint i, j;
 
   /* supposed to run test in build directory */
   if (root_path == NULL)
@@ -2703,95 +4046,108 @@ TEST (nnstreamer_capi_singleshot, parallel_runs)
       "mobilenet_v1_1.0_224_quant.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  for (i=0; i<num_cases; i++) {
-    ss_data[i].test_model = test_model;
-    ss_data[i].num_runs = 3;
-    ss_data[i].min_time_to_run = 10;    /** 10 msec */
-    ss_data[i].expect = TRUE;
-  }
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /** Default timeout runs */
-  ss_data[0].timeout = 0;
-  /** small timeout runs */
-  ss_data[1].timeout = 5;
-  /** large timeout runs - increases with each run as tests run in parallel */
-  ss_data[2].timeout = SINGLE_DEF_TIMEOUT_MSEC * num_cases * num_threads;
+  /* failed to set dimension */
+  status = ml_single_set_property (single, "input", "3:4:4:1");
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  /**
-   * make thread running things in background, each with different timeout,
-   * some fails, some runs, all opens pipelines by themselves in parallel
-   */
-  for (j=0; j<num_cases; j++) {
-    for (i=0; i<num_threads; i++) {
-      pthread_create (&thread[i+j * num_threads], NULL, single_shot_loop_test,
-          (void *) &ss_data[j]);
-    }
-  }
+  status = ml_single_get_property (single, "input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  for (i=0; i<num_threads * num_cases; i++) {
-    pthread_join(thread[i], NULL);
-  }
+  EXPECT_STREQ (prop_value, "3:224:224:1");
+  g_free (prop_value);
 
-  g_free (test_model);
-}
+  /* input tensor in filter */
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Close the single handle while running. This test shuuld not crash.
- *         This closes the single handle twice, while opens it once
- */
-TEST (nnstreamer_capi_singleshot, close_while_running)
-{
-  const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
-  gchar *test_model;
-  pthread_t thread;
-  single_shot_thread_data ss_data;
+  status = ml_tensors_info_get_count (in_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  status = ml_tensors_info_get_tensor_name (in_info, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (name == NULL);
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  status = ml_tensors_info_get_tensor_type (in_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-  ss_data.test_model = test_model;
-  ss_data.num_runs = 10;
-  ss_data.min_time_to_run = 10;    /** 10 msec */
-  ss_data.expect = FALSE;
-  ss_data.timeout = SINGLE_DEF_TIMEOUT_MSEC;
-  ss_data.single = NULL;
+  ml_tensors_info_get_tensor_dimension (in_info, 0, in_dim);
+  EXPECT_EQ (in_dim[0], 3U);
+  EXPECT_EQ (in_dim[1], 224U);
+  EXPECT_EQ (in_dim[2], 224U);
+  EXPECT_EQ (in_dim[3], 1U);
 
-  pthread_create (&thread, NULL, single_shot_loop_test, (void *) &ss_data);
+  /* output tensor in filter */
+  status = ml_single_get_output_info (single, &out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /** Start the thread and let the code start */
-  g_usleep (100000);    /** 100 msec */
+  status = ml_tensors_info_get_count (out_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
 
-  /**
-   * Call single API functions while its running. One run takes 100ms on average.
-   * So, these calls would in the middle of running and should not crash
-   * However, their status can be of failure, if the thread is closed earlier
-   */
-  if (ss_data.single) {
-    ml_single_set_timeout (*ss_data.single, ss_data.timeout);
-    ml_single_close (*ss_data.single);
-  }
+  status = ml_tensors_info_get_tensor_name (out_info, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (name == NULL);
 
-  pthread_join(thread, NULL);
+  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  EXPECT_EQ (out_dim[0], 1001U);
+  EXPECT_EQ (out_dim[1], 1U);
+  EXPECT_EQ (out_dim[2], 1U);
+  EXPECT_EQ (out_dim[3], 1U);
+
+  /* invoke */
+  input = output = NULL;
+
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
+
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 1001U);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_data_destroy (output);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (test_model);
 }
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Try setting dimensions for input tensor.
+ * @detail Update dimension for input tensor
  */
-TEST (nnstreamer_capi_singleshot, set_input_info_fail)
+TEST (nnstreamer_capi_singleshot, property_04_p)
 {
-  int status;
   ml_single_h single;
-  ml_tensors_info_h in_info;
-  ml_tensor_dimension in_dim;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim;
+  char *prop_value;
+  int status;
+  size_t data_size;
+  float *data;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -2800,50 +4156,90 @@ TEST (nnstreamer_capi_singleshot, set_input_info_fail)
   if (root_path == NULL)
     root_path = "..";
 
+  /** add.tflite adds value 2 to all the values in the input */
   test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+      "add.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
   status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_set_input_info (single, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_single_set_property (single, "input", "5:1:1:1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&in_info);
-  in_dim[0] = 3;
-  in_dim[1] = 4;
-  in_dim[2] = 4;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_single_get_property (single, "input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /** mobilenet model does not support setting different input dimension */
-  status = ml_single_set_input_info (single, in_info);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED ||
-      status == ML_ERROR_INVALID_PARAMETER);
+  EXPECT_STREQ (prop_value, "5:1:1:1");
+  g_free (prop_value);
+
+  /* validate in/out info */
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_get_tensor_dimension (in_info, 0, in_dim);
+  EXPECT_EQ (in_dim[0], 5U);
+  EXPECT_EQ (in_dim[1], 1U);
+  EXPECT_EQ (in_dim[2], 1U);
+  EXPECT_EQ (in_dim[3], 1U);
+
+  status = ml_single_get_output_info (single, &out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  EXPECT_EQ (out_dim[0], 5U);
+  EXPECT_EQ (out_dim[1], 1U);
+  EXPECT_EQ (out_dim[2], 1U);
+  EXPECT_EQ (out_dim[3], 1U);
+
+  /* invoke */
+  input = output = NULL;
+
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
+
+  status = ml_tensors_data_get_tensor_data (input, 0, (void **) &data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 5 * sizeof (float));
+  for (int idx = 0; idx < 5; idx++)
+    data[idx] = idx;
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 5 * sizeof (float));
+  for (int idx = 0; idx < 5; idx++)
+    EXPECT_EQ (data[idx], idx + 2);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_data_destroy (output);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   g_free (test_model);
 }
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Try setting number of input tensors and its type
+ * @detail Invoke the model with the output buffer given by user.
  */
-TEST (nnstreamer_capi_singleshot, set_input_info_fail_01)
+TEST (nnstreamer_capi_singleshot, invoke_fast_p)
 {
   ml_single_h single;
-  ml_tensors_info_h in_info;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h input, output, fast_output;
+  void *data, *fast_data;
+  size_t data_size, fast_data_size;
+  guint i;
   int status;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
@@ -2853,40 +4249,60 @@ TEST (nnstreamer_capi_singleshot, set_input_info_fail_01)
   if (root_path == NULL)
     root_path = "..";
 
-  /** add.tflite adds value 2 to all the values in the input */
   test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "add.tflite", NULL);
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
   status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_single_get_input_info (single, &in_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_count (in_info, &count);
+  status = ml_single_get_output_info (single, &out_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /** changing the count of number of tensors is not allowed */
-  ml_tensors_info_set_count (in_info, count + 1);
-  status = ml_single_set_input_info (single, in_info);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  ml_tensors_info_set_count (in_info, count);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_type (in_info, 0, &type);
+  status = ml_tensors_data_create (out_info, &fast_output);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  /** changing the type of input tensors is not allowed */
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT32);
-  status = ml_single_set_input_info (single, in_info);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (fast_output, 0, &fast_data,
+      &fast_data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_close (single);
+  /* reuse the output buffer */
+  for (i = 0; i < 3; i++) {
+    status = ml_single_invoke_fast (single, input, fast_output);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* the result should be same as the invoke with allocated output */
+  status = ml_single_invoke (single, input, &output);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (in_info);
+  status = ml_tensors_data_get_tensor_data (output, 0, &data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, fast_data_size);
+  EXPECT_EQ (memcmp (data, fast_data, data_size), 0);
+
+  /* the buffer is not changed */
+  status = ml_tensors_data_get_tensor_data (fast_output, 0, &data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data == fast_data);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (fast_output);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+
+  status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (test_model);
@@ -2894,17 +4310,14 @@ TEST (nnstreamer_capi_singleshot, set_input_info_fail_01)
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Try setting dimension to the same value. This model does not allow
- *         changing the dimension to a different. However, setting the same
- *         value for dimension should be successful.
+ * @detail Failure case with the output buffer not matched with the model.
  */
-TEST (nnstreamer_capi_singleshot, set_input_info_success)
+TEST (nnstreamer_capi_singleshot, invoke_fast_n)
 {
-  int status;
   ml_single_h single;
   ml_tensors_info_h in_info;
-  ml_tensor_dimension in_dim;
-  ml_tensors_data_h input, output;
+  ml_tensors_data_h input;
+  int status;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -2919,63 +4332,79 @@ TEST (nnstreamer_capi_singleshot, set_input_info_success)
 
   status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_set_input_info (single, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&in_info);
-  in_dim[0] = 3;
-  in_dim[1] = 224;
-  in_dim[2] = 224;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_single_invoke_fast (NULL, input, input);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /** set the same original input dimension */
-  status = ml_single_set_input_info (single, in_info);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED ||
-      status == ML_ERROR_NONE);
+  status = ml_single_invoke_fast (single, NULL, input);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* generate dummy data */
-  input = output = NULL;
-  status = ml_tensors_data_create (in_info, &input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
+  status = ml_single_invoke_fast (single, input, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  /* output size is not matched (input info) */
+  status = ml_single_invoke_fast (single, input, input);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_data_destroy (output);
   ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   g_free (test_model);
 }
 
+/**
+ * @brief Data for the callback of async invoke.
+ */
+typedef struct {
+  guint num_called;
+  guint num_success;
+  guint num_canceled;
+} single_async_cb_data;
+
+/**
+ * @brief Callback for the completion of async invoke.
+ */
+static void
+test_single_invoke_cb (int status, ml_tensors_data_h output, void *user_data)
+{
+  single_async_cb_data *cb_data = (single_async_cb_data *) user_data;
+
+  if (status == ML_ERROR_NONE) {
+    EXPECT_TRUE (output != NULL);
+    ml_tensors_data_destroy (output);
+    g_atomic_int_inc (&cb_data->num_success);
+  } else {
+    EXPECT_TRUE (output == NULL);
+    if (status == ML_ERROR_STREAMS_PIPE)
+      g_atomic_int_inc (&cb_data->num_canceled);
+  }
+
+  g_atomic_int_inc (&cb_data->num_called);
+}
+
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Change the number of input tensors, run the model and verify output
+ * @detail Invoke the model asynchronously with several requests in flight.
  */
-TEST (nnstreamer_capi_singleshot, set_input_info_success_01)
+TEST (nnstreamer_capi_singleshot, invoke_async_p)
 {
   ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_info_h in_res, out_res;
+  ml_tensors_info_h in_info;
   ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim, res_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
-  int status, tensor_size;
-  size_t data_size;
-  float *data;
+  single_async_cb_data cb_data = { 0, };
+  const guint num_requests = 4;
+  guint i, retry;
+  int status;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -2984,151 +4413,64 @@ TEST (nnstreamer_capi_singleshot, set_input_info_success_01)
   if (root_path == NULL)
     root_path = "..";
 
-  /** add.tflite adds value 2 to all the values in the input */
   test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "add.tflite", NULL);
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-  ml_tensors_info_create (&in_res);
-  ml_tensors_info_create (&out_res);
-
-  tensor_size = 5;
-
-  in_dim[0] = tensor_size;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
-
-  out_dim[0] = tensor_size;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
-
   status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_get_input_info (single, &in_res);
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /**
-   * 1. start with a model file with different input dimensions
-   * 2. change the input for the model file
-   * 3. run the model file with the updated input dimensions
-   * 4. verify the output
-   */
-
-  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
-  EXPECT_FALSE (in_dim[0] == res_dim[0]);
-  EXPECT_TRUE (in_dim[1] == res_dim[1]);
-  EXPECT_TRUE (in_dim[2] == res_dim[2]);
-  EXPECT_TRUE (in_dim[3] == res_dim[3]);
-
-  /** set the same original input dimension */
-  status = ml_single_set_input_info (single, in_info);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED ||
-      status == ML_ERROR_NONE);
-  if (status == ML_ERROR_NONE) {
-    /* input tensor in filter */
-    status = ml_single_get_input_info (single, &in_res);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-
-    status = ml_tensors_info_get_count (in_res, &count);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (count, 1U);
-
-    status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
-
-    ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
-    EXPECT_TRUE (in_dim[0] == res_dim[0]);
-    EXPECT_TRUE (in_dim[1] == res_dim[1]);
-    EXPECT_TRUE (in_dim[2] == res_dim[2]);
-    EXPECT_TRUE (in_dim[3] == res_dim[3]);
-
-    /* output tensor in filter */
-    status = ml_single_get_output_info (single, &out_res);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-
-    status = ml_tensors_info_get_count (out_res, &count);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (count, 1U);
-
-    status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
-
-    ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
-    EXPECT_TRUE (out_dim[0] == res_dim[0]);
-    EXPECT_TRUE (out_dim[1] == res_dim[1]);
-    EXPECT_TRUE (out_dim[2] == res_dim[2]);
-    EXPECT_TRUE (out_dim[3] == res_dim[3]);
-
-    input = output = NULL;
-
-    /* generate dummy data */
-    status = ml_tensors_data_create (in_info, &input);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (input != NULL);
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_tensors_data_get_tensor_data (input, 0, (void **) &data, &data_size);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (data_size, tensor_size * sizeof (int));
-    for (int idx = 0; idx < tensor_size; idx++)
-      data[idx] = idx;
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_single_invoke (single, input, &output);
+  for (i = 0; i < num_requests; i++) {
+    status = ml_single_invoke_async (single, input, test_single_invoke_cb,
+        &cb_data);
     EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (output != NULL);
+  }
 
-    status = ml_tensors_data_get_tensor_data (input, 0, (void **) &data, &data_size);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (data_size, tensor_size * sizeof (int));
-    for (int idx = 0; idx < tensor_size; idx++)
-      EXPECT_EQ (data[idx], idx);
+  /* wait for the requests (max 10 sec) */
+  retry = 0;
+  while (g_atomic_int_get (&cb_data.num_called) < num_requests && retry < 100) {
+    g_usleep (100000);
+    retry++;
+  }
 
-    status = ml_tensors_data_get_tensor_data (output, 0, (void **) &data, &data_size);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (data_size, tensor_size * sizeof (int));
-    for (int idx = 0; idx < tensor_size; idx++)
-      EXPECT_EQ (data[idx], idx+2);
+  EXPECT_EQ (cb_data.num_called, num_requests);
+  EXPECT_EQ (cb_data.num_success, num_requests);
 
-    ml_tensors_data_destroy (output);
-    ml_tensors_data_destroy (input);
-  }
+  /* sync invoke is available after the requests are done */
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (output);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (test_model);
+  ml_tensors_data_destroy (input);
   ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-  ml_tensors_info_destroy (in_res);
-  ml_tensors_info_destroy (out_res);
+  g_free (test_model);
 }
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Update property 'layout' for input tensor
+ * @detail Close the handle with pending requests, all callbacks should be called.
  */
-TEST (nnstreamer_capi_singleshot, property_01_p)
+TEST (nnstreamer_capi_singleshot, invoke_async_close_p)
 {
   ml_single_h single;
-  ml_tensors_info_h in_info;
-  ml_tensors_data_h input, output;
-  int status;
-  char *prop_value;
-  void *data;
-  size_t data_size;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  single_async_cb_data cb_data = { 0, };
+  guint i, num_requests = 0;
+  int status;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -3143,64 +4485,49 @@ TEST (nnstreamer_capi_singleshot, property_01_p)
 
   status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  /* get layout */
-  status = ml_single_get_property (single, "inputlayout", &prop_value);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  EXPECT_STREQ (prop_value, "ANY");
-  g_free (prop_value);
-
-  /* get updatable */
-  status = ml_single_get_property (single, "is-updatable", &prop_value);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  EXPECT_STREQ (prop_value, "false");
-  g_free (prop_value);
+  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  /* get input info */
   status = ml_single_get_input_info (single, &in_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invoke */
-  input = output = NULL;
-
-  /* generate dummy data */
   status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
 
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  /* the queue is bounded */
+  for (i = 0; i < ML_SINGLE_ASYNC_QUEUE_LIMIT + 2; i++) {
+    status = ml_single_invoke_async (single, input, test_single_invoke_cb,
+        &cb_data);
+    if (status == ML_ERROR_NONE)
+      num_requests++;
+    else
+      EXPECT_EQ (status, ML_ERROR_TRY_AGAIN);
+  }
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  EXPECT_GE (num_requests, (guint) ML_SINGLE_ASYNC_QUEUE_LIMIT);
 
-  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &data, &data_size);
+  status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (data_size, 1001U);
 
-  ml_tensors_data_destroy (output);
+  /* all callbacks are called before close returns */
+  EXPECT_EQ (cb_data.num_called, num_requests);
+  EXPECT_EQ (cb_data.num_success + cb_data.num_canceled, num_requests);
+
   ml_tensors_data_destroy (input);
   ml_tensors_info_destroy (in_info);
-
-  status = ml_single_close (single);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   g_free (test_model);
 }
 
 /**
  * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Failure case to set invalid property
+ * @detail Failure case of async invoke with invalid param.
  */
-TEST (nnstreamer_capi_singleshot, property_02_n)
+TEST (nnstreamer_capi_singleshot, invoke_async_n)
 {
   ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input;
+  single_async_cb_data cb_data = { 0, };
   int status;
-  char *prop_value = NULL;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -3215,61 +4542,79 @@ TEST (nnstreamer_capi_singleshot, property_02_n)
 
   status = ml_single_open (&single, test_model, NULL, NULL,
       ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_input_info (single, &in_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* get invalid property */
-  status = ml_single_get_property (single, "unknown_prop", &prop_value);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  g_free (prop_value);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* set invalid property */
-  status = ml_single_set_property (single, "unknown_prop", "INVALID");
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_single_invoke_async (NULL, input, test_single_invoke_cb, &cb_data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* null params */
-  status = ml_single_set_property (single, "input", NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_single_invoke_async (single, NULL, test_single_invoke_cb, &cb_data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_single_set_property (single, NULL, "INVALID");
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_single_invoke_async (single, input, NULL, &cb_data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_single_get_property (single, "input", NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_get_property (single, NULL, &prop_value);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  g_free (prop_value);
+  EXPECT_EQ (cb_data.num_called, 0U);
 
-  /* dimension should be valid */
-  status = ml_single_get_property (single, "input", &prop_value);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+  g_free (test_model);
+}
 
-  EXPECT_STREQ (prop_value, "3:224:224:1");
-  g_free (prop_value);
+/**
+ * @brief Data for the threads invoking the pool.
+ */
+typedef struct {
+  ml_single_pool_h pool;
+  ml_tensors_data_h input;
+  guint num_runs;
+  guint num_success;
+} single_pool_thread_data;
 
-  status = ml_single_close (single);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Thread to invoke the pool repeatedly.
+ */
+static void *
+single_pool_invoke_loop (void *arg)
+{
+  single_pool_thread_data *pd = (single_pool_thread_data *) arg;
+  ml_tensors_data_h output;
+  guint i;
 
-  g_free (test_model);
+  for (i = 0; i < pd->num_runs; i++) {
+    output = NULL;
+    if (ml_single_pool_invoke (pd->pool, pd->input, &output) == ML_ERROR_NONE) {
+      g_atomic_int_inc (&pd->num_success);
+      ml_tensors_data_destroy (output);
+    }
+  }
+
+  return NULL;
 }
 
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Failure case to set meta property
+ * @brief Test NNStreamer single shot pool (tensorflow-lite)
+ * @detail Invoke the pool in parallel, the requests wait for an idle instance.
  */
-TEST (nnstreamer_capi_singleshot, property_03_n)
+TEST (nnstreamer_capi_singleshot, pool_parallel_invoke_p)
 {
-  ml_single_h single;
+  ml_single_pool_h pool;
   ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensors_data_h input, output;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  ml_tensors_data_h input;
+  unsigned int num_instances, num_busy, num_waiting, num_rejected;
+  const guint num_threads = 4;
+  pthread_t thread[num_threads];
+  single_pool_thread_data pd;
+  guint i;
   int status;
-  unsigned int count = 0;
-  char *name = NULL;
-  char *prop_value = NULL;
-  void *data;
-  size_t data_size;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -3282,108 +4627,68 @@ TEST (nnstreamer_capi_singleshot, property_03_n)
       "mobilenet_v1_1.0_224_quant.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  /* failed to set dimension */
-  status = ml_single_set_property (single, "input", "3:4:4:1");
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_single_get_property (single, "input", &prop_value);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  EXPECT_STREQ (prop_value, "3:224:224:1");
-  g_free (prop_value);
-
-  /* input tensor in filter */
-  status = ml_single_get_input_info (single, &in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_get_count (in_info, &count);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
-
-  status = ml_tensors_info_get_tensor_name (in_info, 0, &name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (name == NULL);
-
-  status = ml_tensors_info_get_tensor_type (in_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
-
-  ml_tensors_info_get_tensor_dimension (in_info, 0, in_dim);
-  EXPECT_EQ (in_dim[0], 3U);
-  EXPECT_EQ (in_dim[1], 224U);
-  EXPECT_EQ (in_dim[2], 224U);
-  EXPECT_EQ (in_dim[3], 1U);
+  status = ml_single_pool_open (&pool, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, 2, num_threads);
+  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  /* output tensor in filter */
-  status = ml_single_get_output_info (single, &out_info);
+  status = ml_single_pool_set_timeout (pool, SINGLE_DEF_TIMEOUT_MSEC);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_count (out_info, &count);
+  status = ml_single_pool_get_tensors_info (pool, true, &in_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
 
-  status = ml_tensors_info_get_tensor_name (out_info, 0, &name);
+  status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (name == NULL);
 
-  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  pd.pool = pool;
+  pd.input = input;
+  pd.num_runs = 3;
+  pd.num_success = 0;
 
-  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
-  EXPECT_EQ (out_dim[0], 1001U);
-  EXPECT_EQ (out_dim[1], 1U);
-  EXPECT_EQ (out_dim[2], 1U);
-  EXPECT_EQ (out_dim[3], 1U);
+  for (i = 0; i < num_threads; i++)
+    pthread_create (&thread[i], NULL, single_pool_invoke_loop, (void *) &pd);
 
-  /* invoke */
-  input = output = NULL;
+  /* the pool APIs do not lock the instances while the requests are running */
+  for (i = 0; i < 10; i++) {
+    status = ml_single_pool_set_timeout (pool, SINGLE_DEF_TIMEOUT_MSEC);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* generate dummy data */
-  status = ml_tensors_data_create (in_info, &input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
+    status = ml_single_pool_get_tensors_info (pool, false, &out_info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_info_destroy (out_info);
+  }
 
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  for (i = 0; i < num_threads; i++)
+    pthread_join (thread[i], NULL);
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  EXPECT_EQ (pd.num_success, num_threads * pd.num_runs);
 
-  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &data, &data_size);
+  status = ml_single_pool_get_stats (pool, &num_instances, &num_busy,
+      &num_waiting, &num_rejected);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (data_size, 1001U);
+  EXPECT_EQ (num_instances, 2U);
+  EXPECT_EQ (num_busy, 0U);
+  EXPECT_EQ (num_waiting, 0U);
+  EXPECT_EQ (num_rejected, 0U);
 
   ml_tensors_data_destroy (input);
-  ml_tensors_data_destroy (output);
   ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
 
-  status = ml_single_close (single);
+  status = ml_single_pool_close (pool);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (test_model);
 }
 
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Update dimension for input tensor
+ * @brief Test NNStreamer single shot pool (tensorflow-lite)
+ * @detail Failure case with invalid param.
  */
-TEST (nnstreamer_capi_singleshot, property_04_p)
+TEST (nnstreamer_capi_singleshot, pool_invalid_param_n)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim;
-  char *prop_value;
+  ml_single_pool_h pool = NULL;
+  ml_tensors_data_h output = NULL;
   int status;
-  size_t data_size;
-  float *data;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_BUILD_ROOT_PATH");
   gchar *test_model;
@@ -3392,74 +4697,30 @@ TEST (nnstreamer_capi_singleshot, property_04_p)
   if (root_path == NULL)
     root_path = "..";
 
-  /** add.tflite adds value 2 to all the values in the input */
   test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "add.tflite", NULL);
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_single_set_property (single, "input", "5:1:1:1");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_single_get_property (single, "input", &prop_value);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  EXPECT_STREQ (prop_value, "5:1:1:1");
-  g_free (prop_value);
-
-  /* validate in/out info */
-  status = ml_single_get_input_info (single, &in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  ml_tensors_info_get_tensor_dimension (in_info, 0, in_dim);
-  EXPECT_EQ (in_dim[0], 5U);
-  EXPECT_EQ (in_dim[1], 1U);
-  EXPECT_EQ (in_dim[2], 1U);
-  EXPECT_EQ (in_dim[3], 1U);
-
-  status = ml_single_get_output_info (single, &out_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
-  EXPECT_EQ (out_dim[0], 5U);
-  EXPECT_EQ (out_dim[1], 1U);
-  EXPECT_EQ (out_dim[2], 1U);
-  EXPECT_EQ (out_dim[3], 1U);
-
-  /* invoke */
-  input = output = NULL;
-
-  /* generate dummy data */
-  status = ml_tensors_data_create (in_info, &input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
+  status = ml_single_pool_open (NULL, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, 2, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_get_tensor_data (input, 0, (void **) &data, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (data_size, 5 * sizeof (float));
-  for (int idx = 0; idx < 5; idx++)
-    data[idx] = idx;
+  /* no instance */
+  status = ml_single_pool_open (&pool, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, 0, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  status = ml_single_pool_invoke (NULL, NULL, &output);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_get_tensor_data (output, 0, (void **) &data, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (data_size, 5 * sizeof (float));
-  for (int idx = 0; idx < 5; idx++)
-    EXPECT_EQ (data[idx], idx + 2);
+  status = ml_single_pool_set_timeout (NULL, 10);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_data_destroy (input);
-  ml_tensors_data_destroy (output);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  status = ml_single_pool_get_stats (NULL, NULL, NULL, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_single_close (single);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_pool_close (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   g_free (test_model);
 }